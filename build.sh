@@ -12,6 +12,7 @@ Usage:
 
 Build libinote and tests.
 Options: 
+-b, --bench        run the benchmark (JSON results)
 -c, --clean		   clean-up: delete the build directory and object files
 -d, --debug        compile with debug symbols 
 -g, --gdb		   with gdb
@@ -33,6 +34,9 @@ Example:
 
 # compile libinote, run tests via gdb
  $0 -dgt
+
+# compile libinote, run the benchmark
+ $0 -b
 " 
 
 }
@@ -52,15 +56,16 @@ cleanup() {
 	(cd src/test && make clean)
 }
 
-unset CC CFLAGS CLEAN DBG_FLAGS GDB HELP INSTALL ARCH STRIP TEST
+unset BENCH CC CFLAGS CLEAN DBG_FLAGS GDB HELP INSTALL ARCH STRIP TEST
 
-OPTIONS=`getopt -o cdghi:m:t --long clean,debug,gdb,help,install:,mach:,test \
+OPTIONS=`getopt -o bcdghi:m:t --long bench,clean,debug,gdb,help,install:,mach:,test \
              -n "$NAME" -- "$@"`
 [ $? != 0 ] && usage && exit 1
 eval set -- "$OPTIONS"
 
 while true; do
   case "$1" in
+    -b|--bench) BENCH=1; shift;;
     -c|--clean) CLEAN=1; shift;;
     -d|--debug) export DBG_FLAGS="-ggdb -DDEBUG"; export STRIP=test; shift;;
     -g|--gdb) GDB="-g"; shift;;
@@ -104,6 +109,9 @@ for i in src/libinote src/test; do
 done
 
 if [ -n "$TEST" ]; then
-	cd src/test
-	./inote.sh $GDB
+	(cd src/test; ./inote.sh $GDB)
+fi
+
+if [ -n "$BENCH" ]; then
+	(cd src/test; make bench)
 fi
@@ -0,0 +1,1025 @@
+/*
+  Copyright 2019-2023, Gilles Casse <gcasse@oralux.org>
+
+  This is free software; you can redistribute it and/or modify it
+  under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation; either version 2.1, or
+  (at your option) any later version.
+
+  This software is distributed in the hope that it will be useful, but
+  WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+  Lesser General Public License for more details.
+
+*/
+
+/**
+   @file
+   @brief libinote API 
+   
+   The libinote library preprocesses a text aimed to a text-to-speech engine:
+   - input: raw text or enriched with SSML tags or ECI annotations,
+   - output: type-length-value format.
+
+   Links:
+   - Libinote sources: https://github.com/Oralux/libinote 
+   
+*/
+#ifndef INOTE_H
+#define INOTE_H
+
+#include <stdint.h>
+
+#define INOTE_VERSION_MAJOR 1
+#define INOTE_VERSION_MINOR 3
+#define INOTE_VERSION_PATCH 0
+
+typedef enum {
+  INOTE_CHARSET_UNDEFINED = 0,
+  INOTE_CHARSET_ISO_8859_1,
+  INOTE_CHARSET_GBK,
+  INOTE_CHARSET_UCS_2,
+  INOTE_CHARSET_BIG_5,
+  INOTE_CHARSET_SJIS,
+  INOTE_CHARSET_UTF_8,
+  INOTE_CHARSET_UTF_16,
+  INOTE_CHARSET_UTF_32,
+} inote_charset_t;
+
+typedef enum {
+  INOTE_TYPE_UNDEFINED,
+  INOTE_TYPE_TEXT=(1<<0),
+  INOTE_TYPE_CHARSET=(1<<1),
+  INOTE_TYPE_PUNCTUATION=INOTE_TYPE_TEXT+(1<<2),
+  INOTE_TYPE_ANNOTATION=INOTE_TYPE_TEXT+(1<<3),
+  INOTE_TYPE_CAPITAL=INOTE_TYPE_TEXT+(1<<4),
+  INOTE_TYPE_CAPITALS=INOTE_TYPE_TEXT+(1<<4)+(1<<1),
+  INOTE_TYPE_SSML=(1<<5),
+  INOTE_TYPE_LANGUAGE=(1<<6),
+} inote_type_t;
+
+/**
+   SSML element of an INOTE_TYPE_SSML tlv (first byte of the value)
+*/
+typedef enum {
+  INOTE_SSML_UNDEFINED=0,
+  INOTE_SSML_BREAK, /**< <break/>: pause */
+  INOTE_SSML_PROSODY, /**< <prosody>: push the prosody */
+  INOTE_SSML_PROSODY_END, /**< </prosody>: pop the prosody */
+  INOTE_SSML_SAY_AS, /**< <say-as>: interpretation of the text */
+  INOTE_SSML_SAY_AS_END, /**< </say-as> */
+  INOTE_SSML_MARK, /**< <mark/>: named position */
+  INOTE_SSML_VOICE, /**< <voice>: push the voice */
+  INOTE_SSML_VOICE_END, /**< </voice>: pop the voice */
+  INOTE_SSML_LANG, /**< <lang>: push the language */
+  INOTE_SSML_LANG_END, /**< </lang>: pop the language */
+} inote_ssml_t;
+
+/**
+   Split points of a text which does not fit in the current tlv (see
+   inote_set_tlv_split)
+*/
+typedef enum {
+  INOTE_SPLIT_ANY=0, /**< fill the tlv, the text may be split inside a word */
+  INOTE_SPLIT_WORD, /**< split the text after a blank */
+} inote_split_t;
+
+typedef enum {
+  INOTE_PUNCT_MODE_NONE=0, /**< do not pronounce punctuation */
+  INOTE_PUNCT_MODE_ALL=1, /**< pronounce all punctuation character */
+  INOTE_PUNCT_MODE_SOME=2, /**< pronounce any punctuation character in the punctuation list */
+  INOTE_PUNCT_FOUND=UINT8_MAX, /**< punctuation character */
+} inote_punct_mode_t;
+
+/**
+   inote_tlv_t 
+   
+   type, length, value description
+   with 
+   - type: see inote_type_t
+   - length: 0..255
+   - value: array of length bytes
+   
+   Text
+   type = INOTE_TYPE_TEXT
+
+   Punctuation character (to be said)
+   type = INOTE_TYPE_PUNCTUATION
+   length = 1 + remaining text (first char=punctuation char, followed by text) 
+
+   Annotation
+   type = INOTE_TYPE_ANNOTATION
+   length = annotation length
+
+   Capital
+   type = INOTE_TYPE_CAPITAL
+   length = number of capital letters
+
+   SSML element (see inote_enable_ssml_tlv)
+   type = INOTE_TYPE_SSML
+   value = inote_ssml_t (1 byte) followed by
+   - INOTE_SSML_BREAK: the duration in milliseconds (32 bits, little
+     endian)
+   - otherwise: the attributes of the start tag, each one as its name
+     then its value, both in the tlv charset and preceded by their
+     length in bytes (1 byte), e.g. "\x04rate\x04slow" for
+     <prosody rate="slow"> (see inote_enable_ssml_tlv).
+
+   Language switching (see inote_enable_language_tlv)
+   type = INOTE_TYPE_LANGUAGE
+   length = 4
+   value = language (32 bits, little endian)
+
+   TLV v2 (see inote_enable_tlv_v2)
+   A tlv whose value exceeds TLV_VALUE_LENGTH_MAX bytes has a 3 bytes
+   header:
+   - type: INOTE_TLV_V2 bit set 
+   - length: 16 bits, little endian (up to TLV2_VALUE_LENGTH_MAX)
+   - value: array of length bytes
+   The other tlv keep the v1 header: use the inote_tlv_get_*
+   functions to read both formats.
+*/
+typedef struct {
+  uint8_t type;
+  uint8_t length;
+} inote_tlv_t;
+
+#define TLV_LENGTH_MAX (1+UINT8_MAX)
+#define TLV_HEADER_LENGTH_MAX sizeof(inote_tlv_t)
+#define TLV_VALUE_LENGTH_MAX (TLV_LENGTH_MAX - TLV_HEADER_LENGTH_MAX)
+
+#define INOTE_TLV_V2 0x80
+#define TLV2_HEADER_LENGTH 3
+#define TLV2_LENGTH_MAX 4096
+#define TLV2_VALUE_LENGTH_MAX (TLV2_LENGTH_MAX - TLV2_HEADER_LENGTH)
+
+uint8_t *inote_tlv_get_value(const inote_tlv_t *tlv);
+inote_type_t inote_tlv_get_type(const inote_tlv_t *tlv);
+size_t inote_tlv_get_length(const inote_tlv_t *tlv);
+
+typedef struct {
+  uint8_t *buffer; 
+  size_t length; /**< data length in bytes */
+  inote_charset_t charset;
+  uint8_t *end_of_buffer; /**< allocated buffer size (buffer + length <= end_of_buffer) */
+} inote_slice_t;
+  
+typedef struct {
+  inote_punct_mode_t punct_mode;
+  uint32_t spelling; /**< 1 = spelling command already set */
+  uint32_t lang; /**< 0=unknown, otherwise probable language */
+  uint32_t *expected_lang; /**< array of the expected languages */
+  uint32_t max_expected_lang; /**< max number of elements of expected_lang */
+  uint32_t ssml; /**< 1 = SSML tags must be interpreted; 0 = no interpretation */
+  uint32_t annotation; /**< 1 = annotations must be interpreted; 0 = no interpretation */
+} inote_state_t;
+
+typedef enum {
+  INOTE_OK=0,
+  INOTE_ARGS_ERROR,
+  INOTE_CHARSET_ERROR,
+  INOTE_INVALID_MULTIBYTE,
+  INOTE_INCOMPLETE_MULTIBYTE,
+  INOTE_TLV_MESSAGE_FULL, /**< no other tlv can be added to tlv_message */
+  INOTE_TLV_FULL, /**< the current tlv is full */
+  INOTE_UNPROCESSED,
+  INOTE_UNEMPTIED_BUFFER, /**< the internal char32_t buffer can't be fully processed */
+  INOTE_TLV_ERROR,
+  INOTE_IO_ERROR,
+  INOTE_LANGUAGE_SWITCHING, /**< the remaining input text concerns another language (see below 'Language Switching') */
+  INOTE_ERRNO=0x1000 /**< return 0x1000 + errno */
+} inote_error;
+
+typedef inote_error (*inote_add_annotation_t)(inote_tlv_t *tlv, void *user_data);  
+typedef inote_error (*inote_add_charset_t)(inote_tlv_t *tlv, void *user_data);  
+typedef inote_error (*inote_add_punct_t)(inote_tlv_t *tlv, void *user_data);  
+typedef inote_error (*inote_add_text_t)(inote_tlv_t *tlv, void *user_data);  
+typedef inote_error (*inote_add_capital_t)(inote_tlv_t *tlv, bool capitals, void *user_data);  
+typedef inote_error (*inote_add_ssml_t)(inote_tlv_t *tlv, void *user_data);  
+typedef inote_error (*inote_add_language_t)(inote_tlv_t *tlv, void *user_data);  
+
+typedef struct {
+  inote_add_annotation_t add_annotation;
+  inote_add_charset_t add_charset;
+  inote_add_punct_t add_punctuation;
+  inote_add_text_t add_text;
+  inote_add_capital_t add_capital;
+  void *user_data;
+} inote_cb_t;
+
+/**
+   inote_cb_ext_t
+
+   Callbacks of inote_convert_tlv_to_text_ext(): those of inote_cb_t
+   followed by the callbacks of the tlv types added since, so that the
+   layout of inote_cb_t is unchanged for the existing callers.
+*/
+typedef struct {
+  inote_cb_t cb;
+  inote_add_ssml_t add_ssml; /**< optional (NULL: the INOTE_TYPE_SSML tlv are skipped) */
+  inote_add_language_t add_language; /**< optional (NULL: the INOTE_TYPE_LANGUAGE tlv are skipped) */
+} inote_cb_ext_t;
+
+/**
+   inote_sink_t
+
+   Output of the tlv by blocks (see inote_set_sink).
+
+   write: called with a block of complete tlv (tlv_block->length
+   bytes from tlv_block->buffer). Before returning, the sink may
+   replace tlv_block->buffer and tlv_block->end_of_buffer by the next
+   block to fill (e.g. chunk chain), otherwise the same block is
+   filled again. A block must have at least TLV_BLOCK_LENGTH_MIN
+   bytes (TLV2_BLOCK_LENGTH_MIN for TLV v2).
+   If write returns an error, the conversion is stopped and returns
+   this error.
+*/
+typedef inote_error (*inote_write_tlv_t)(inote_slice_t *tlv_block, void *user_data);
+
+typedef struct {
+  inote_write_tlv_t write;
+  void *user_data;
+} inote_sink_t;
+
+/**
+   inote_alloc_t, inote_free_t
+
+   Memory owned by an instance (see inote_create_with_allocator).
+
+   alloc: return a block of size bytes suitably aligned for any type,
+   NULL on error.
+   free: release a block returned by alloc.
+*/
+typedef void *(*inote_alloc_t)(size_t size, void *user_data);
+typedef void (*inote_free_t)(void *ptr, void *user_data);
+
+#define TLV_BLOCK_LENGTH_MIN (2*TLV_LENGTH_MAX)
+#define TLV2_BLOCK_LENGTH_MIN (2*TLV2_LENGTH_MAX)
+
+// TEXT_LENGTH_MAX: no longer a limit; a text of TEXT_LENGTH_MAX bytes
+// needs at most TLV_MESSAGE_LENGTH_MAX bytes of tlv.
+#define TEXT_LENGTH_MAX 1024
+#define TLV_MESSAGE_LENGTH_MAX (3*TEXT_LENGTH_MAX)
+
+/**
+   create an inote instance
+
+   An instance only keeps its settings and the state carried over
+   between the calls (a few hundred bytes, plus about 1 KB once used
+   in stream mode). The scratch memory of a conversion (about 16 KB)
+   is borrowed for the duration of the call from a pool of the
+   calling thread, allocated by its first conversion and freed when
+   the thread exits (see also inote_set_scratch).
+
+   @return instance
+*/
+void *inote_create();
+
+/**
+   create an inote instance whose memory comes from an allocator
+
+   The memory owned by the instance (handle, stream carry-over, `Pf2
+   punctuation lists, buffers of the parallel conversion) is
+   allocated by alloc and released by free instead of the C library.
+   The scratch memory is owned by the instance as well (allocated by
+   its first conversion), unless a scratch is set by
+   inote_set_scratch().
+
+   Steady state: once the instance has converted a text with given
+   charsets, the next conversions with these charsets
+   (inote_convert_text_to_tlv, inote_stream_feed,...) make no
+   allocation at all, except through alloc when a `Pf2 annotation
+   changes the punctuation list or for the parallel conversion.
+   Out of the allocator: the iconv descriptors of the charsets
+   without native conversion, opened by the C library during the
+   first conversion (see inote_prewarm to open them beforehand), the
+   batches (inote_batch_create) and the trace buffers
+   (inote_trace_enable).
+
+   alloc and free are called by the thread converting with the
+   instance; free may also be called by a worker of a batch for a
+   punctuation list shared with the instance.
+
+   @param alloc  allocation function
+   @param free  release function
+   @param user_data  passed to alloc and free
+   @return instance, NULL on error
+*/
+void *inote_create_with_allocator(inote_alloc_t alloc, inote_free_t free, void *user_data);
+
+
+/**
+   delete an inote instance
+
+   @param instance
+*/
+void inote_delete(void *handle);
+
+/**
+   open in advance the charset converters
+
+   The iconv converters are shared by the inote instances: they are
+   opened on first use and kept once the instance is deleted.
+   inote_prewarm() opens them at service start instead of during the
+   first inote_convert_text_to_tlv() call and keeps them until the
+   end of the process.
+   The scratch memory of the calling thread is allocated as well (see
+   inote_create).
+   This function is thread-safe.
+
+   @param charset  array of charsets (text or tlv charsets)
+   @param nb  number of charsets
+   @return INOTE_OK or INOTE_CHARSET_ERROR if a charset is not supported
+*/
+inote_error inote_prewarm(const inote_charset_t *charset, size_t nb);
+
+/**
+   create a scratch memory for the conversions
+
+   See inote_set_scratch.
+
+   @return scratch, NULL on error
+*/
+void *inote_scratch_create();
+
+/**
+   delete a scratch memory
+
+   The scratch must no longer be set to an instance.
+
+   @param scratch
+*/
+void inote_scratch_delete(void *scratch);
+
+/**
+   Set the scratch memory of an instance
+
+   By default, the scratch memory of a conversion is borrowed from the
+   pool of the calling thread (or owned by the instance, see
+   inote_create_with_allocator). A scratch set by the application is
+   used instead: it may be shared by several instances provided that
+   they are not converting at the same time (including a conversion
+   called from a sink).
+
+   @param handle  inote instance
+   @param scratch  scratch (inote_scratch_create) or NULL for the
+   pool of the calling thread
+   @return inote_error
+*/
+inote_error inote_set_scratch(void *handle, void *scratch);
+
+/**
+   The text and tlv_message slices are pre-allocated by the caller,
+   with the max size details below.
+   
+   text: raw text or enriched with SSML tags or ECI annotations.
+   null terminator not needed.
+   No limit on text->length: a long text is converted by windows of
+   an internal buffer (the tlv generated do not depend on the
+   windows, except for a tag or annotation longer than a window - at
+   least 4096 characters - which is then converted as text).
+   
+   state: punctuation, current language,...
+   
+   tlv_message: type_length_value formated data
+   tlv_message->length: TLV_MESSAGE_LENGTH_MAX bytes per
+   TEXT_LENGTH_MAX bytes of text.
+   
+   text_left: number of bytes not yet consumed in text->buffer 
+   
+   Language switching
+   If an annotation requires to change the language,
+   inote_convert_text_to_tlv returns INOTE_LANGUAGE_SWITCHING, and the
+   remaining text points on this annotation (unless the switch is
+   emitted as tlv, see inote_enable_language_tlv).
+   
+   RETURN: INOTE_OK if no error, otherwise:
+   - INOTE_INVALID_MULTIBYTE: text_left is set; the first byte left is the invalid byte.
+   - INOTE_INCOMPLETE_MULTIBYTE: idem: text_left set; first byte left is the invalid byte.
+   - INOTE_LANGUAGE_SWITCHING: text_left is set; the first byte left is the annotation.
+   - ... 
+   
+   Example
+   input: text="`Pf2()? <speak>Un &lt;éléphant&gt; (1)</speak>"  
+   output:
+   00000000  01 10 55 6e 20 3c c3 a9  6c c3 a9 70 68 61 6e 74  |..Un <..l..phant|
+   00000010  3e 20 05 02 28 31 05 01  29                       |> ..(1..)|
+   
+   |-------------------+--------+------------------|
+   | Type              | Length | Value            |
+   |-------------------+--------+------------------|
+   | text              |     16 | "Un <éléphant> " |
+   | text+punctuation  |      2 | "(1"             |
+   | text+punctuation  |      1 | ")"              |
+   |-------------------+--------+------------------|
+   
+   @param[in] handle  inote instance
+   @param[in] text  text to convert
+   @param[in,out] state  Can be updated according e.g. to the annotations processed internally (punctuation or ssml mode,...)
+   @param[out] tlv_message  tlv resulting from the conversion of text
+   @param[out] text_left  end of the supplied text not yet converted
+   @return inote_error
+*/
+inote_error inote_convert_text_to_tlv(void *handle, const inote_slice_t *text, inote_state_t *state, inote_slice_t *tlv_message, size_t *text_left);
+
+/**
+   start a new text stream
+
+   The text of a stream can be supplied in several chunks by
+   inote_stream_feed(): the chunk boundaries may split a multibyte
+   sequence or a word.
+   inote_stream_start() discards the state of the previous stream.
+
+   @param handle  inote instance
+   @return inote_error
+*/
+inote_error inote_stream_start(void *handle);
+
+/**
+   convert the next chunk of the text stream
+
+   Same as inote_convert_text_to_tlv() except that:
+   - each input byte is decoded once: an incomplete multibyte
+   sequence at the end of text is kept by the instance and completed
+   by the next chunk,
+   - an invalid byte is replaced by a space,
+   - the capital letters of a word split by the chunks are managed
+   as in a single text,
+   - a tag, an annotation or an entity at the end of text (at most
+   256 characters) is kept by the instance and converted with the
+   next chunk (or by inote_stream_flush()): a pattern split by the
+   chunks gives the same tlv as in a single text.
+
+   RETURN: INOTE_OK if no error, otherwise:
+   - INOTE_LANGUAGE_SWITCHING: text_left is set; the first byte left
+   is the annotation, unless the annotation starts in a previous
+   chunk: its beginning is then kept by the instance (see
+   inote_stream_take_annotation()) and followed by the text left. The
+   text left must be supplied again.
+   - ...
+
+   @param[in] handle  inote instance
+   @param[in] text  next chunk of text
+   @param[in,out] state  see inote_convert_text_to_tlv()
+   @param[out] tlv_message  tlv resulting from the conversion of text
+   @param[out] text_left  end of the supplied text not yet converted
+   @return inote_error
+*/
+inote_error inote_stream_feed(void *handle, const inote_slice_t *text, inote_state_t *state, inote_slice_t *tlv_message, size_t *text_left);
+
+/**
+   end the text stream
+
+   The pattern kept by the last chunk, if any, is converted.
+
+   RETURN: INOTE_OK if no error, otherwise:
+   - INOTE_INCOMPLETE_MULTIBYTE: the stream ends with an incomplete
+   multibyte sequence (discarded).
+
+   @param[in] handle  inote instance
+   @param[in,out] state  see inote_convert_text_to_tlv()
+   @param[out] tlv_message  tlv resulting from the end of the stream
+   @return inote_error
+*/
+inote_error inote_stream_flush(void *handle, inote_state_t *state, inote_slice_t *tlv_message);
+
+/**
+   take the beginning of the language switching annotation
+
+   After INOTE_LANGUAGE_SWITCHING, the beginning of an annotation
+   which starts in a previous chunk is kept by the instance: the
+   annotation is this beginning followed by the text left. It is
+   appended to annotation and no longer kept; otherwise it is
+   converted again with the next chunk.
+   Nothing is appended if the annotation starts in the text left.
+
+   @param[in] handle  inote instance
+   @param[out] annotation  beginning of the annotation (in
+   annotation->charset)
+   @return inote_error
+*/
+inote_error inote_stream_take_annotation(void *handle, inote_slice_t *annotation);
+
+/**
+   deliver the tlv to a sink instead of filling tlv_message
+
+   Once a sink is set, inote_convert_text_to_tlv() and
+   inote_stream_feed() use tlv_message as the first tlv block (at
+   least TLV_BLOCK_LENGTH_MIN or TLV2_BLOCK_LENGTH_MIN free bytes):
+   each block is passed to the sink as soon as it is full, and the
+   last one before returning. The output length is then unlimited
+   (INOTE_TLV_MESSAGE_FULL is not returned) and tlv_message->length
+   is 0 on return.
+   The tlv delivered are the same as those written to a large enough
+   tlv_message, except that on a decoding error the tlv of the text
+   preceding the invalid byte may already have been delivered.
+
+   @param handle  inote instance
+   @param sink  sink to use, or NULL to fill tlv_message again
+   @return inote_error
+*/
+inote_error inote_set_sink(void *handle, const inote_sink_t *sink);
+
+/**
+   inote_job_t
+
+   conversion of a text by inote_batch_convert(): the fields are the
+   arguments (text, state, tlv_message) and the results (tlv_message,
+   text_left, ret) of inote_convert_text_to_tlv().
+*/
+typedef struct {
+  inote_slice_t text;
+  inote_state_t *state;
+  inote_slice_t tlv_message;
+  size_t text_left;
+  inote_error ret;
+} inote_job_t;
+
+/**
+   create a batch converter
+
+   The batch converter runs a pool of worker threads; each worker
+   uses its own inote instance.
+
+   @param nb_thread  number of workers (calling thread included); 0
+   for the number of online processors
+   @return batch converter, NULL on error
+*/
+void *inote_batch_create(unsigned int nb_thread);
+
+/**
+   delete a batch converter
+
+   @param batch  batch converter
+*/
+void inote_batch_delete(void *batch);
+
+/**
+   convert independent texts in parallel
+
+   Each job gives the same result as inote_convert_text_to_tlv()
+   with a copy of handle (settings and state kept between the
+   conversions); handle itself is not modified and must not be used
+   by another thread during the call.
+   The jobs are distributed among the workers (work stealing); the
+   calling thread is one of them. The call returns once all the jobs
+   are converted.
+   The jobs must not share the same state or tlv_message buffer.
+
+   @param batch  batch converter
+   @param handle  inote instance supplying the settings (see inote_enable_capital,...)
+   @param[in,out] job  array of jobs; the result of each job is in job[i].ret
+   @param nb_job  number of jobs
+   @return INOTE_OK if the jobs have been run, INOTE_ARGS_ERROR otherwise
+*/
+inote_error inote_batch_convert(void *batch, const void *handle, inote_job_t *job, size_t nb_job);
+
+/**
+   convert a long text using the workers of a batch converter
+
+   Same result as inote_convert_text_to_tlv(handle,...): tlv_message,
+   state, text_left, returned value and state of handle.
+
+   The text is split into chunks converted in parallel, each one from
+   the state expected at its beginning (the annotations which modify
+   the state are searched before). The chunks are then joined in
+   order: the text preceding the first tlv of a chunk converted in the
+   same state as in a sequential conversion is converted again
+   sequentially.
+   The text is converted sequentially if it is shorter than 64 KB,
+   if it is not in UTF-8 or ISO-8859-1, if it cannot be decoded, if
+   it includes a language switching annotation or if a sink is set.
+
+   @param batch  batch converter
+   @param handle  inote instance (must not be used by another thread during the call)
+   @param[in] text  text to convert
+   @param[in,out] state  see inote_convert_text_to_tlv()
+   @param[out] tlv_message  tlv resulting from the conversion of text
+   @param[out] text_left  end of the supplied text not yet converted
+   @return inote_error
+*/
+inote_error inote_convert_text_to_tlv_parallel(void *batch, void *handle, const inote_slice_t *text, inote_state_t *state, inote_slice_t *tlv_message, size_t *text_left);
+
+/**
+   tlv_message and cb are supplied by the caller.
+   
+   tlv_message: type_length_value formated data
+   tlv_message->length: no implicit limit on the length
+   
+   cb: callback to be called according to the tlv type
+  
+   RETURN: INOTE_OK if no error, otherwise:
+   - INOTE_TLV_ERROR: unknown type or truncated tlv
+   - the error returned by a callback (the next tlv are not processed)
+  
+   Example
+   input:
+   00000000  01 10 55 6e 20 3c c3 a9  6c c3 a9 70 68 61 6e 74  |..Un <..l..phant|
+   00000010  3e 20 05 02 28 31 05 01  29                       |> ..(1..)|
+  
+   |-------------------+--------+------------------|
+   | Type              | Length | Value            |
+   |-------------------+--------+------------------|
+   | text              |     16 | "Un <éléphant> " |
+   | text+punctuation  |      2 | "(1"             |
+   | text+punctuation  |      1 | ")"              |
+   |-------------------+--------+------------------|
+
+   possible output (according to the supplied callbacks): 
+   text="Un <éléphant> (1)"  
+
+   The INOTE_TYPE_SSML and INOTE_TYPE_LANGUAGE tlv are skipped (see
+   inote_convert_tlv_to_text_ext).
+
+   @param tlv_message  tlv to convert
+   @param cb  callbacks to call according to the recognized type
+   @return inote_error
+*/
+inote_error inote_convert_tlv_to_text(inote_slice_t *tlv_message, inote_cb_t *cb);
+
+/**
+   Same as inote_convert_tlv_to_text() with the callbacks of the tlv
+   types added since (INOTE_TYPE_SSML, INOTE_TYPE_LANGUAGE).
+
+   @param tlv_message  tlv to convert
+   @param cb  callbacks to call according to the recognized type
+   @return inote_error
+*/
+inote_error inote_convert_tlv_to_text_ext(inote_slice_t *tlv_message, const inote_cb_ext_t *cb);
+
+/**
+   inote_tlv_iterator_t
+
+   Read the tlv of a message in place (TLV v1 and v2), e.g.:
+
+   inote_tlv_iterator_t it;
+   inote_tlv_iterator_begin(&it, tlv_message);
+   while (inote_tlv_iterator_next(&it)) {
+     // it.tlv, it.type, it.length, it.value
+   }
+   if (it.error) ...
+
+   The value points into the tlv message (not copied, not aligned).
+*/
+typedef struct {
+  const uint8_t *next; /**< next tlv */
+  const uint8_t *end; /**< end of the tlv message */
+  inote_error error; /**< INOTE_TLV_ERROR once a truncated tlv is found */
+  const inote_tlv_t *tlv; /**< current tlv: header, */
+  inote_type_t type; /**< type, */
+  size_t length; /**< length */
+  const uint8_t *value; /**< and value */
+} inote_tlv_iterator_t;
+
+/**
+   Start the iteration on the tlv of the message
+   
+   @param[out] it  iterator
+   @param[in] tlv_message  tlv to read (must not be modified during the iteration)
+   @return inote_error
+*/
+inote_error inote_tlv_iterator_begin(inote_tlv_iterator_t *it, const inote_slice_t *tlv_message);
+
+/**
+   Move to the next tlv
+   
+   @param[in,out] it  iterator
+   @return true if it.tlv, it.type, it.length and it.value are set
+   to the next tlv; false at the end of the message or if the next tlv is
+   truncated (it.error = INOTE_TLV_ERROR)
+*/
+bool inote_tlv_iterator_next(inote_tlv_iterator_t *it);
+
+/**
+   inote_tlv_index_t
+
+   Index of the tlv of a message as parallel arrays: the i-th tlv has
+   the type type[i], its value starts at offset[i] bytes from the
+   beginning of the message and its length is length[i].
+   The arrays are supplied by the caller (capacity elements); an array
+   may be NULL if not needed.
+*/
+typedef struct {
+  uint8_t *type; /**< inote_type_t */
+  uint32_t *offset;
+  uint16_t *length;
+  size_t capacity; /**< number of elements of each array */
+  size_t nb; /**< number of tlv of the message (indexed if nb <= capacity) */
+} inote_tlv_index_t;
+
+/**
+   Index the tlv of a message in one pass
+
+   The first capacity tlv are indexed; index->nb is set to the number
+   of tlv of the whole message, so that the caller can index again
+   with larger arrays if nb > capacity.
+   
+   @param[in] tlv_message  tlv to index (shorter than 4 GB)
+   @param[in,out] index  arrays to fill
+   @return INOTE_OK, or INOTE_TLV_ERROR if a tlv is truncated (the
+   previous tlv are indexed)
+*/
+inote_error inote_tlv_index(const inote_slice_t *tlv_message, inote_tlv_index_t *index);
+
+/**
+   Validate an untrusted tlv message
+
+   Check that each tlv fits in the message, that its type is known
+   and that its value is well-formed:
+   - INOTE_TYPE_SSML: known inote_ssml_t, 4 bytes duration for
+     INOTE_SSML_BREAK, attributes which fit in the tlv otherwise
+     (well-formed in tlv_message->charset if check_charset)
+   - INOTE_TYPE_LANGUAGE: 4 bytes
+   - text types (INOTE_TYPE_TEXT, PUNCTUATION, ANNOTATION,
+     CAPITAL(S)): well-formed in tlv_message->charset if check_charset
+     is true (UTF-32: little endian, no surrogates).
+
+   A validated message can be walked with inote_tlv_iterator_next()
+   or the inote_tlv_get_* functions without further checks.
+
+   @param[in] tlv_message  tlv to check
+   @param[in] check_charset  also check the text of the tlv
+   @param[out] offset  offset of the first invalid tlv (length of the
+   message if valid)
+   @return INOTE_OK, INOTE_TLV_ERROR (truncated tlv, unknown type or
+   invalid value), INOTE_INVALID_MULTIBYTE or
+   INOTE_INCOMPLETE_MULTIBYTE (text not in the charset), or
+   INOTE_CHARSET_ERROR
+*/
+inote_error inote_tlv_validate(const inote_slice_t *tlv_message, bool check_charset, size_t *offset);
+
+/**
+   Merge the adjacent text tlv of a message
+
+   The consecutive INOTE_TYPE_TEXT tlv (e.g. produced by successive
+   stream calls or around the filtered tags and annotations) are
+   merged in place while the merged value does not exceed length_max
+   bytes. A tlv is merged entirely or not at all: the split points
+   are kept (see inote_set_tlv_split).
+   The other types are left as is: their value is bound to the tlv
+   (punctuation character, annotation, capital letters,...).
+
+   A length_max greater than TLV_VALUE_LENGTH_MAX gives TLV v2 headers
+   for the longer values (decoded from version 1.2.0, see
+   inote_enable_tlv_v2).
+   
+   @param[in,out] tlv_message  tlv to merge; its length is updated
+   @param[in] length_max  maximal value length of a merged tlv, up
+   to TLV2_VALUE_LENGTH_MAX
+   @return INOTE_OK, INOTE_ARGS_ERROR or INOTE_TLV_ERROR if a tlv is
+   truncated (the message is unchanged)
+*/
+inote_error inote_tlv_coalesce(inote_slice_t *tlv_message, size_t length_max);
+
+/**
+   obtain the type of a tlv message
+   
+   @param[in] tlv_message  tlv messageresulting from the conversion of text
+   @param[out] type  type of the tlv_message
+   @return inote_error
+*/
+inote_error inote_slice_get_type(const inote_slice_t *tlv_message, inote_type_t *type);
+
+/**
+   stringify an inote_error
+   
+   @param err
+   @return string
+*/
+const char *inote_error_get_string(inote_error err);
+
+/**
+   Generate tlv compatible with an older version.
+   
+   This function indicates the version of libinote which will be used to decode the tlv.
+   inote_convert_text_to_tlv() will then generate TLV compatible with this version.
+
+   For example, TLV indicating capitalized words (INOTE_TYPE_CAPITAL)
+   will be generated only if the version supplied is greater or equal
+   to 1.1.0.
+
+   @param handle  inote instance
+   @param major  e.g. 1 for version 1.2.3
+   @param minor  e.g. 2 for version 1.2.3
+   @param major  e.g. 3 for version 1.2.3
+   @return inote_error
+*/
+inote_error inote_set_compatibility(void *handle, int major, int minor, int patch);
+
+/**
+   Enable TVL for capitalized words
+   
+   By default, no INOTE_TYPE_CAPITAL(S) TLV is generated.
+
+   @param handle  inote instance
+   @param with_capital  if set to true, enable TLV for capitalized words
+   @return inote_error
+*/
+inote_error inote_enable_capital(void *handle, bool with_capital);
+
+/**
+   Generate TLV v2
+   
+   By default, the TLV v1 format is generated: a text longer than
+   TLV_VALUE_LENGTH_MAX bytes is split in several TLV.
+   The TLV v2 format (16 bits length for long values) reduces the
+   number of TLV and callbacks for long texts. It can be decoded from version
+   1.2.0 (see inote_set_compatibility).
+
+   @param handle  inote instance
+   @param with_tlv_v2  if set to true, generate TLV v2
+   @return inote_error
+*/
+inote_error inote_enable_tlv_v2(void *handle, bool with_tlv_v2);
+
+/**
+   Generate TLV for the SSML elements
+   
+   By default, the SSML tags are filtered out (state->ssml).
+   Once enabled, the following elements give an INOTE_TYPE_SSML tlv
+   (the other tags are still filtered out):
+   - <break/>: the duration of the time attribute ("250ms", "1.5s"),
+     otherwise of the strength attribute: none=0, x-weak=100,
+     weak=250, medium=500 (default), strong=1000, x-strong=2000
+   - <prosody> and </prosody>: rate, pitch, volume
+   - <say-as> and </say-as>: interpret-as, format, detail
+   - <mark/>: name
+   - <voice> and </voice>: name, gender, xml:lang
+   - <lang> and </lang>: xml:lang
+   An empty element with an end tlv (e.g. <prosody rate="slow"/>)
+   has no content: it gives no tlv.
+   The attributes are written as length-prefixed name and value in
+   the tlv charset (see the TLV format); the values are copied as is,
+   a character without equivalent in the charset being converted as
+   in a text tlv. The attributes which do not fit in the tlv are
+   dropped.
+   The tlv can be decoded from version 1.3.0 (see
+   inote_set_compatibility).
+
+   @param handle  inote instance
+   @param with_ssml  if set to true, generate the INOTE_TYPE_SSML tlv
+   @return inote_error
+*/
+inote_error inote_enable_ssml_tlv(void *handle, bool with_ssml);
+
+/**
+   Generate TLV for the language switching
+   
+   By default, a language switching annotation ("`l" followed by the
+   language) stops the conversion: INOTE_LANGUAGE_SWITCHING is
+   returned.
+   Once enabled, if the language is one of state->expected_lang, the
+   annotation gives an INOTE_TYPE_LANGUAGE tlv, state->lang is set and
+   the conversion goes on in the same call.
+   The language is written in hexadecimal ("`l0x10000"), in decimal
+   ("`l65536") or as dialect ("`l1.0" for 0x10000).
+   An unexpected or invalid language still returns
+   INOTE_LANGUAGE_SWITCHING.
+   The tlv can be decoded from version 1.3.0 (see
+   inote_set_compatibility).
+
+   @param handle  inote instance
+   @param with_language  if set to true, generate the INOTE_TYPE_LANGUAGE tlv
+   @return inote_error
+*/
+inote_error inote_enable_language_tlv(void *handle, bool with_language);
+
+/**
+   Set the chunking policy of the text tlv
+   
+   A text which follows a text tlv is appended to it while the tlv
+   has more than threshold free bytes, otherwise a new tlv is started
+   (default: 16 bytes).
+   A text which does not fit in the tlv is split according to split:
+   - INOTE_SPLIT_ANY (default): the tlv is filled, the text may be
+     cut inside a word
+   - INOTE_SPLIT_WORD: the text is cut after its last blank which
+     fits in the tlv; a word which does not fit in a tlv appended to
+     starts the next tlv (a word longer than a tlv is still cut).
+   Fewer and larger tlv reduce the callbacks of the decoder; see also
+   inote_tlv_coalesce().
+
+   @param handle  inote instance
+   @param threshold  free bytes under which a text tlv is not
+   continued, up to TLV2_VALUE_LENGTH_MAX
+   @param split  split points
+   @return inote_error
+*/
+inote_error inote_set_tlv_split(void *handle, size_t threshold, inote_split_t split);
+
+/**
+   inote_stats_t
+
+   counters of a handle, accumulated by inote_convert_text_to_tlv(),
+   inote_stream_feed() and inote_convert_text_to_tlv_parallel()
+   (the jobs of inote_batch_convert() are not counted in handle).
+   The times are measured only if enabled by inote_enable_stats_timing().
+*/
+typedef struct {
+  uint64_t bytes_in; /**< bytes of the input texts (minus the text left) */
+  uint64_t units_decoded; /**< bytes (UTF-8) or characters decoded in the internal buffer */
+  uint64_t tlv_text; /**< number of INOTE_TYPE_TEXT tlv */
+  uint64_t tlv_punctuation; /**< number of INOTE_TYPE_PUNCTUATION tlv */
+  uint64_t tlv_annotation; /**< number of INOTE_TYPE_ANNOTATION tlv */
+  uint64_t tlv_capital; /**< number of INOTE_TYPE_CAPITAL tlv */
+  uint64_t tlv_capitals; /**< number of INOTE_TYPE_CAPITALS tlv */
+  uint64_t tlv_ssml; /**< number of INOTE_TYPE_SSML tlv */
+  uint64_t tlv_language; /**< number of INOTE_TYPE_LANGUAGE tlv */
+  uint64_t iconv_calls; /**< calls to iconv (charsets without native converter) */
+  uint64_t fallbacks; /**< characters replaced by their ASCII fallback (e.g. quotes, dashes, ligatures) */
+  uint64_t tlv_message_full; /**< conversions returning INOTE_TLV_MESSAGE_FULL */
+  uint64_t language_switching; /**< conversions returning INOTE_LANGUAGE_SWITCHING */
+  uint64_t decode_ns; /**< time to decode the text in the internal buffer */
+  uint64_t scan_ns; /**< time to search the patterns (annotations, punctuation,...) */
+  uint64_t encode_ns; /**< time to convert the segments to the tlv charset */
+} inote_stats_t;
+
+/**
+   Get the counters of the handle
+
+   @param handle  inote instance
+   @param stats  returned counters
+   @return inote_error
+*/
+inote_error inote_get_stats(const void *handle, inote_stats_t *stats);
+
+/**
+   Reset the counters of the handle
+
+   @param handle  inote instance
+   @return inote_error
+*/
+inote_error inote_reset_stats(void *handle);
+
+/**
+   Measure the time of each stage (decode_ns, scan_ns, encode_ns)
+
+   By default, the times are not measured: the clock is read for each
+   segment converted.
+
+   @param handle  inote instance
+   @param with_timing  if set to true, measure the time of each stage
+   @return inote_error
+*/
+inote_error inote_enable_stats_timing(void *handle, bool with_timing);
+
+/**
+   inote_trace_event_t
+
+   events of the binary trace (see inote_trace_record_t)
+*/
+typedef enum {
+  INOTE_TRACE_CONVERT_START, /**< arg0: text length, arg1: text charset */
+  INOTE_TRACE_CONVERT_END, /**< arg0: inote_error, arg1: tlv message length */
+  INOTE_TRACE_WINDOW, /**< arg0: bytes decoded in the internal buffer, arg1: bytes carried from the previous window */
+  INOTE_TRACE_SINK, /**< arg0: length of the block delivered, arg1: bytes kept for the next block */
+  INOTE_TRACE_JOIN, /**< parallel conversion; arg0: chunk joined, arg1: position of the sync point */
+} inote_trace_event_t;
+
+/**
+   inote_trace_record_t
+
+   fixed-size record of the binary trace
+*/
+typedef struct {
+  uint64_t time; /**< CLOCK_MONOTONIC, in nanoseconds */
+  uint32_t thread; /**< thread number (order of its first record) */
+  uint32_t event; /**< inote_trace_event_t */
+  uint64_t arg0;
+  uint64_t arg1;
+} inote_trace_record_t;
+
+typedef void (*inote_trace_cb_t)(const inote_trace_record_t *record, void *user_data);
+
+/**
+   Enable the binary trace
+
+   Once enabled, each thread writes the trace records in its own ring
+   buffer (lock-free, the last 1024 records are kept). By default,
+   the trace is disabled; the trace points are removed if libinote is
+   compiled with INOTE_TRACE=0.
+
+   @param enable  true to write the trace records
+*/
+void inote_trace_enable(bool enable);
+
+/**
+   Read the binary trace
+
+   cb is called for each record kept, thread by thread, from the
+   oldest to the newest record. The trace can be read while the
+   other threads write their records.
+
+   @param cb  called for each record
+   @param user_data  supplied to cb
+*/
+void inote_trace_read(inote_trace_cb_t cb, void *user_data);
+
+/** debug */
+void inoteDebugInit();
+
+#endif
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
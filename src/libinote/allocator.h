@@ -0,0 +1,55 @@
+#ifndef __ALLOCATOR_H_
+#define __ALLOCATOR_H_
+
+/*
+  Allocator of the memory owned by a handle (see
+  inote_create_with_allocator): the C library if alloc is NULL.
+
+  The objects which may outlive the call (punctuation sets, scratch)
+  keep a copy of the allocator to be released by it.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "inote.h"
+
+typedef struct {
+  inote_alloc_t alloc;
+  inote_free_t free;
+  void *user_data;
+} allocator_t;
+
+static inline void *allocator_malloc(const allocator_t *self, size_t size) {
+  if (!self || !self->alloc)
+    return malloc(size);
+  return self->alloc(size, self->user_data);
+}
+
+static inline void *allocator_calloc(const allocator_t *self, size_t nb, size_t size) {
+  void *ptr;
+  if (!self || !self->alloc)
+    return calloc(nb, size);
+  if (size && (nb > SIZE_MAX/size))
+    return NULL;
+  ptr = self->alloc(nb*size, self->user_data);
+  if (ptr) {
+    memset(ptr, 0, nb*size);
+  }
+  return ptr;
+}
+
+static inline void allocator_free(const allocator_t *self, void *ptr) {
+  if (!self || !self->alloc) {
+    free(ptr);
+  } else if (ptr) {
+    self->free(ptr, self->user_data);
+  }
+}
+
+#endif
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
@@ -0,0 +1,853 @@
+#include <string.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "conv.h"
+#include "unicode.h"
+#include "fallback.h"
+#include "debug.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define WITH_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#define UTF8_LEAD_INVALID 0
+#define ICONV_ERROR ((iconv_t)-1)
+#define CONV_IDLE_MAX 16
+
+typedef size_t (*widen_t)(const uint8_t *in, size_t n, char32_t *out);
+typedef size_t (*narrow_t)(const char32_t *in, size_t n, uint8_t *out);
+typedef size_t (*ascii_length_t)(const uint8_t *in, size_t n);
+
+static size_t min_size(size_t a, size_t b) {
+  return (a<b) ? a : b;
+}
+
+/*
+  widen_ascii: copy the leading ascii bytes of in to out (one char32_t per byte)
+  widen_latin1: copy n bytes of in to out (one char32_t per byte)
+
+  return the number of copied bytes
+*/
+static size_t widen_ascii_scalar(const uint8_t *in, size_t n, char32_t *out) {
+  size_t i;
+  for (i=0; (i<n) && (in[i] < 0x80); i++) {
+    out[i] = in[i];
+  }
+  return i;
+}
+
+static size_t widen_latin1_scalar(const uint8_t *in, size_t n, char32_t *out) {
+  size_t i;
+  for (i=0; i<n; i++) {
+    out[i] = in[i];
+  }
+  return n;
+}
+
+/* number of leading ascii bytes */
+static size_t ascii_length_scalar(const uint8_t *in, size_t n) {
+  size_t i;
+  for (i=0; (i<n) && (in[i] < 0x80); i++);
+  return i;
+}
+
+/*
+  narrow_ascii: copy the leading ascii characters of in to out (one byte per char32_t)
+  narrow_latin1: copy the leading latin-1 characters of in to out (one byte per char32_t)
+
+  return the number of copied characters
+*/
+static size_t narrow_ascii_scalar(const char32_t *in, size_t n, uint8_t *out) {
+  size_t i;
+  for (i=0; (i<n) && (in[i] < 0x80); i++) {
+    out[i] = in[i];
+  }
+  return i;
+}
+
+static size_t narrow_latin1_scalar(const char32_t *in, size_t n, uint8_t *out) {
+  size_t i;
+  for (i=0; (i<n) && (in[i] < 0x100); i++) {
+    out[i] = in[i];
+  }
+  return i;
+}
+
+#ifdef WITH_X86_SIMD
+__attribute__((target("sse2")))
+static void widen16_sse2(__m128i x, char32_t *out) {
+  __m128i zero = _mm_setzero_si128();
+  __m128i lo = _mm_unpacklo_epi8(x, zero);
+  __m128i hi = _mm_unpackhi_epi8(x, zero);
+  _mm_storeu_si128((__m128i*)(out), _mm_unpacklo_epi16(lo, zero));
+  _mm_storeu_si128((__m128i*)(out+4), _mm_unpackhi_epi16(lo, zero));
+  _mm_storeu_si128((__m128i*)(out+8), _mm_unpacklo_epi16(hi, zero));
+  _mm_storeu_si128((__m128i*)(out+12), _mm_unpackhi_epi16(hi, zero));
+}
+
+__attribute__((target("sse2")))
+static size_t widen_ascii_sse2(const uint8_t *in, size_t n, char32_t *out) {
+  size_t i = 0;
+  for (; i+16 <= n; i+=16) {
+    __m128i x = _mm_loadu_si128((const __m128i*)(in+i));
+    if (_mm_movemask_epi8(x))
+      break;
+    widen16_sse2(x, out+i);
+  }
+  return i + widen_ascii_scalar(in+i, n-i, out+i);
+}
+
+__attribute__((target("sse2")))
+static size_t ascii_length_sse2(const uint8_t *in, size_t n) {
+  size_t i = 0;
+  for (; (i+16 <= n) && !_mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(in+i))); i+=16);
+  return i + ascii_length_scalar(in+i, n-i);
+}
+
+__attribute__((target("sse2")))
+static size_t widen_latin1_sse2(const uint8_t *in, size_t n, char32_t *out) {
+  size_t i = 0;
+  for (; i+16 <= n; i+=16) {
+    widen16_sse2(_mm_loadu_si128((const __m128i*)(in+i)), out+i);
+  }
+  return i + widen_latin1_scalar(in+i, n-i, out+i);
+}
+
+/* narrow 16 char32_t if each of them is lower than limit (0x80 or 0x100) */
+__attribute__((target("sse2")))
+static bool narrow16_sse2(const char32_t *in, uint8_t *out, uint32_t limit) {
+  __m128i a = _mm_loadu_si128((const __m128i*)(in));
+  __m128i b = _mm_loadu_si128((const __m128i*)(in+4));
+  __m128i c = _mm_loadu_si128((const __m128i*)(in+8));
+  __m128i d = _mm_loadu_si128((const __m128i*)(in+12));
+  __m128i high = _mm_set1_epi32(~(limit-1));
+  __m128i x = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+  if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(x, high), _mm_setzero_si128())) != 0xffff)
+    return false;
+  // values lower than 0x100: no saturation
+  _mm_storeu_si128((__m128i*)out, _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+  return true;
+}
+
+__attribute__((target("sse2")))
+static size_t narrow_ascii_sse2(const char32_t *in, size_t n, uint8_t *out) {
+  size_t i = 0;
+  for (; (i+16 <= n) && narrow16_sse2(in+i, out+i, 0x80); i+=16);
+  return i + narrow_ascii_scalar(in+i, n-i, out+i);
+}
+
+__attribute__((target("sse2")))
+static size_t narrow_latin1_sse2(const char32_t *in, size_t n, uint8_t *out) {
+  size_t i = 0;
+  for (; (i+16 <= n) && narrow16_sse2(in+i, out+i, 0x100); i+=16);
+  return i + narrow_latin1_scalar(in+i, n-i, out+i);
+}
+
+__attribute__((target("avx2")))
+static void widen32_avx2(const uint8_t *in, char32_t *out) {
+  int j;
+  for (j=0; j<32; j+=8) {
+    __m128i x = _mm_loadl_epi64((const __m128i*)(in+j));
+    _mm256_storeu_si256((__m256i*)(out+j), _mm256_cvtepu8_epi32(x));
+  }
+}
+
+__attribute__((target("avx2")))
+static size_t widen_ascii_avx2(const uint8_t *in, size_t n, char32_t *out) {
+  size_t i = 0;
+  for (; i+32 <= n; i+=32) {
+    __m256i x = _mm256_loadu_si256((const __m256i*)(in+i));
+    if (_mm256_movemask_epi8(x))
+      break;
+    widen32_avx2(in+i, out+i);
+  }
+  return i + widen_ascii_scalar(in+i, n-i, out+i);
+}
+
+__attribute__((target("avx2")))
+static size_t ascii_length_avx2(const uint8_t *in, size_t n) {
+  size_t i = 0;
+  for (; (i+32 <= n) && !_mm256_movemask_epi8(_mm256_loadu_si256((const __m256i*)(in+i))); i+=32);
+  return i + ascii_length_scalar(in+i, n-i);
+}
+
+__attribute__((target("avx2")))
+static size_t widen_latin1_avx2(const uint8_t *in, size_t n, char32_t *out) {
+  size_t i = 0;
+  for (; i+32 <= n; i+=32) {
+    widen32_avx2(in+i, out+i);
+  }
+  return i + widen_latin1_scalar(in+i, n-i, out+i);
+}
+
+__attribute__((target("avx2")))
+static bool narrow16_avx2(const char32_t *in, uint8_t *out, uint32_t limit) {
+  __m256i a = _mm256_loadu_si256((const __m256i*)(in));
+  __m256i b = _mm256_loadu_si256((const __m256i*)(in+8));
+  __m256i high = _mm256_set1_epi32(~(limit-1));
+  __m256i x;
+  if (!_mm256_testz_si256(_mm256_or_si256(a, b), high))
+    return false;
+  // packus works per 128 bits lane: restore the order of the 64 bits blocks
+  x = _mm256_permute4x64_epi64(_mm256_packus_epi32(a, b), 0xd8);
+  _mm_storeu_si128((__m128i*)out, _mm_packus_epi16(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1)));
+  return true;
+}
+
+__attribute__((target("avx2")))
+static size_t narrow_ascii_avx2(const char32_t *in, size_t n, uint8_t *out) {
+  size_t i = 0;
+  for (; (i+16 <= n) && narrow16_avx2(in+i, out+i, 0x80); i+=16);
+  return i + narrow_ascii_scalar(in+i, n-i, out+i);
+}
+
+__attribute__((target("avx2")))
+static size_t narrow_latin1_avx2(const char32_t *in, size_t n, uint8_t *out) {
+  size_t i = 0;
+  for (; (i+16 <= n) && narrow16_avx2(in+i, out+i, 0x100); i+=16);
+  return i + narrow_latin1_scalar(in+i, n-i, out+i);
+}
+#endif
+
+static widen_t widen_ascii = widen_ascii_scalar;
+static widen_t widen_latin1 = widen_latin1_scalar;
+static narrow_t narrow_ascii = narrow_ascii_scalar;
+static narrow_t narrow_latin1 = narrow_latin1_scalar;
+static ascii_length_t ascii_length = ascii_length_scalar;
+
+/* select the widening/narrowing functions according to the cpu features */
+__attribute__((constructor))
+static void conv_init() {
+#ifdef WITH_X86_SIMD
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    widen_ascii = widen_ascii_avx2;
+    widen_latin1 = widen_latin1_avx2;
+    narrow_ascii = narrow_ascii_avx2;
+    narrow_latin1 = narrow_latin1_avx2;
+    ascii_length = ascii_length_avx2;
+  } else if (__builtin_cpu_supports("sse2")) {
+    widen_ascii = widen_ascii_sse2;
+    widen_latin1 = widen_latin1_sse2;
+    narrow_ascii = narrow_ascii_sse2;
+    narrow_latin1 = narrow_latin1_sse2;
+    ascii_length = ascii_length_sse2;
+  }
+#endif
+}
+
+/*
+  number of bytes of the utf-8 sequence starting with the lead byte c
+  (UTF8_LEAD_INVALID if c can't start a sequence).
+
+  As glibc, 0xf5..0xf7 are considered as 4 bytes lead bytes (resp. 5
+  bytes for 0xf8..0xfb, 6 bytes for 0xfc..0xfd): the sequence is
+  reported as incomplete or rejected afterwards (greater than
+  0x10ffff).
+*/
+static int utf8_get_sequence_length(uint8_t c) {
+  if (c < 0x80)
+    return 1;
+  if ((c >= 0xc2) && (c < 0xe0))
+    return 2;
+  if ((c & 0xf0) == 0xe0)
+    return 3;
+  if ((c & 0xf8) == 0xf0)
+    return 4;
+  if ((c & 0xfc) == 0xf8)
+    return 5;
+  if ((c & 0xfe) == 0xfc)
+    return 6;
+  return UTF8_LEAD_INVALID;
+}
+
+/*
+  decode the utf-8 sequence at in (avail bytes available).
+  The value may exceed 0x10ffff.
+
+  return the sequence length, 0 (errno=EINVAL) for an incomplete
+  sequence or -1 (errno=EILSEQ) for an invalid one.
+*/
+static int utf8_decode(const uint8_t *in, size_t avail, char32_t *c) {
+  int len = utf8_get_sequence_length(*in);
+  int i;
+  char32_t ch;
+
+  if (len == UTF8_LEAD_INVALID)
+    goto ilseq;
+
+  if ((size_t)len > avail) {
+    // incomplete if the available bytes are correct
+    for (i=1; (size_t)i<avail; i++) {
+      if ((in[i] & 0xc0) != 0x80)
+	goto ilseq;
+    }
+    errno = EINVAL;
+    return 0;
+  }
+
+  ch = (len == 1) ? *in : *in & (0x7f >> len);
+  for (i=1; i<len; i++) {
+    if ((in[i] & 0xc0) != 0x80)
+      goto ilseq;
+    ch = (ch << 6) | (in[i] & 0x3f);
+  }
+
+  // overlong form or surrogate
+  if (((len > 2) && !(ch >> (5*len - 4)))
+      || ((ch >= 0xd800) && (ch < 0xe000)))
+    goto ilseq;
+
+  *c = ch;
+  return len;
+
+ ilseq:
+  errno = EILSEQ;
+  return -1;
+}
+
+static size_t utf8_to_char32(char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  const uint8_t *in = (const uint8_t *)*inbuf;
+  const uint8_t *inmax = in + *inbytesleft;
+  char32_t *out = (char32_t *)*outbuf;
+  char32_t *outmax = out + *outbytesleft/sizeof(char32_t);
+  size_t ret = 0;
+
+  while (in < inmax) {
+    int len;
+    char32_t c;
+    if (*in < 0x80) {
+      size_t n = widen_ascii(in, min_size(inmax - in, outmax - out), out);
+      if (n) {
+	in += n;
+	out += n;
+	continue;
+      }
+    }
+    // as iconv, an erroneous input is reported before a full output
+    len = utf8_decode(in, inmax - in, &c);
+    if (len <= 0) {
+      ret = (size_t)-1;
+      break;
+    }
+    if (out == outmax) {
+      errno = E2BIG;
+      ret = (size_t)-1;
+      break;
+    }
+    // as iconv, the code point is checked once there is room for it
+    if (c > 0x10ffff) {
+      errno = EILSEQ;
+      ret = (size_t)-1;
+      break;
+    }
+    *out++ = c;
+    in += len;
+  }
+
+  *inbytesleft -= (char *)in - *inbuf;
+  *outbytesleft -= (char *)out - *outbuf;
+  *inbuf = (char *)in;
+  *outbuf = (char *)out;
+  return ret;
+}
+
+static size_t utf8_to_utf8(char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  const uint8_t *in = (const uint8_t *)*inbuf;
+  const uint8_t *inmax = in + *inbytesleft;
+  uint8_t *out = (uint8_t *)*outbuf;
+  uint8_t *outmax = out + *outbytesleft;
+  size_t ret = 0;
+
+  while (in < inmax) {
+    int len;
+    char32_t c;
+    if (*in < 0x80) {
+      size_t n = ascii_length(in, min_size(inmax - in, outmax - out));
+      if (n) {
+	memcpy(out, in, n);
+	in += n;
+	out += n;
+	continue;
+      }
+    }
+    len = utf8_decode(in, inmax - in, &c);
+    if (len <= 0) {
+      ret = (size_t)-1;
+      break;
+    }
+    if (len > outmax - out) {
+      errno = E2BIG;
+      ret = (size_t)-1;
+      break;
+    }
+    if (c > 0x10ffff) {
+      errno = EILSEQ;
+      ret = (size_t)-1;
+      break;
+    }
+    memcpy(out, in, len);
+    out += len;
+    in += len;
+  }
+
+  *inbytesleft -= (char *)in - *inbuf;
+  *outbytesleft -= (char *)out - *outbuf;
+  *inbuf = (char *)in;
+  *outbuf = (char *)out;
+  return ret;
+}
+
+static size_t latin1_to_char32(char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  size_t n = min_size(*inbytesleft, *outbytesleft/sizeof(char32_t));
+  size_t ret = 0;
+
+  widen_latin1((const uint8_t *)*inbuf, n, (char32_t *)*outbuf);
+  if (n < *inbytesleft) {
+    errno = E2BIG;
+    ret = (size_t)-1;
+  }
+  *inbuf += n;
+  *inbytesleft -= n;
+  *outbuf += n*sizeof(char32_t);
+  *outbytesleft -= n*sizeof(char32_t);
+  return ret;
+}
+
+/* 
+   return the number of bytes of the utf-8 encoded character c, 0 if c
+   is not a valid code point
+*/
+static int utf8_encode(char32_t c, uint8_t *out, size_t avail) {
+  int len;
+
+  if (c < 0x80)
+    len = 1;
+  else if (c < 0x800)
+    len = 2;
+  else if (c < 0x10000)
+    len = ((c >= 0xd800) && (c < 0xe000)) ? 0 : 3;
+  else if (c <= 0x10ffff)
+    len = 4;
+  else
+    len = 0;
+
+  if (!len || ((size_t)len > avail))
+    return len;
+
+  switch (len) {
+  case 1:
+    out[0] = c;
+    break;
+  case 2:
+    out[0] = 0xc0 | (c >> 6);
+    out[1] = 0x80 | (c & 0x3f);
+    break;
+  case 3:
+    out[0] = 0xe0 | (c >> 12);
+    out[1] = 0x80 | ((c >> 6) & 0x3f);
+    out[2] = 0x80 | (c & 0x3f);
+    break;
+  default:
+    out[0] = 0xf0 | (c >> 18);
+    out[1] = 0x80 | ((c >> 12) & 0x3f);
+    out[2] = 0x80 | ((c >> 6) & 0x3f);
+    out[3] = 0x80 | (c & 0x3f);
+    break;
+  }
+  return len;
+}
+
+/*
+  Same behavior as iconv and the //IGNORE suffix:
+  - a character which can't be represented in the destination charset
+  is skipped; EILSEQ is returned once the whole input is converted,
+  - E2BIG is returned as soon as the output is full, even if a
+  character has been skipped previously.
+*/
+static size_t char32_to_native(inote_charset_t charset, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  const char32_t *in = (const char32_t *)*inbuf;
+  const char32_t *inmax = in + *inbytesleft/sizeof(char32_t);
+  uint8_t *out = (uint8_t *)*outbuf;
+  uint8_t *outmax = out + *outbytesleft;
+  narrow_t narrow = (charset == INOTE_CHARSET_UTF_8) ? narrow_ascii : narrow_latin1;
+  bool ignored = false;
+  size_t ret = 0;
+
+  while (in < inmax) {
+    size_t n = narrow(in, min_size(inmax - in, outmax - out), out);
+    in += n;
+    out += n;
+    if (in == inmax)
+      break;
+
+    if (out == outmax) {
+      errno = E2BIG;
+      ret = (size_t)-1;
+      break;
+    }
+
+    if (charset == INOTE_CHARSET_UTF_8) {
+      int len = utf8_encode(*in, out, outmax - out);
+      if (len > outmax - out) {
+	errno = E2BIG;
+	ret = (size_t)-1;
+	break;
+      }
+      if (len) {
+	out += len;
+      } else {
+	ignored = true;
+      }
+    } else {
+      // not a latin-1 character
+      ignored = true;
+    }
+    in++;
+  }
+
+  if (!ret && ignored) {
+    errno = EILSEQ;
+    ret = (size_t)-1;
+  }
+
+  *inbytesleft -= (char *)in - *inbuf;
+  *outbytesleft -= (char *)out - *outbuf;
+  *inbuf = (char *)in;
+  *outbuf = (char *)out;
+  return ret;
+}
+
+bool conv_is_native(inote_charset_t charset) {
+  return (charset == INOTE_CHARSET_UTF_8) || (charset == INOTE_CHARSET_ISO_8859_1);
+}
+
+size_t conv_to_char32(inote_charset_t charset, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  switch (charset) {
+  case INOTE_CHARSET_UTF_8:
+    return utf8_to_char32(inbuf, inbytesleft, outbuf, outbytesleft);
+  case INOTE_CHARSET_ISO_8859_1:
+    return latin1_to_char32(inbuf, inbytesleft, outbuf, outbytesleft);
+  default:
+    break;
+  }
+  errno = EINVAL;
+  return (size_t)-1;
+}
+
+size_t conv_check_utf8(char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  return utf8_to_utf8(inbuf, inbytesleft, outbuf, outbytesleft);
+}
+
+size_t conv_ascii_length(const uint8_t *in, size_t n) {
+  return ascii_length(in, n);
+}
+
+static inote_error utf8_validate(const uint8_t *in, size_t length) {
+  const uint8_t *inmax = in + length;
+  char32_t c;
+  int len;
+
+  while (in < inmax) {
+    if (*in < 0x80) {
+      in += ascii_length(in, inmax - in);
+      continue;
+    }
+    len = utf8_decode(in, inmax - in, &c);
+    if (len <= 0)
+      return (errno == EINVAL) ? INOTE_INCOMPLETE_MULTIBYTE : INOTE_INVALID_MULTIBYTE;
+    if (c > 0x10ffff)
+      return INOTE_INVALID_MULTIBYTE;
+    in += len;
+  }
+  return INOTE_OK;
+}
+
+static inote_error char32_validate(const uint8_t *in, size_t length) {
+  size_t i;
+  if (length % sizeof(char32_t))
+    return INOTE_INCOMPLETE_MULTIBYTE;
+  for (i=0; i<length; i+=sizeof(char32_t)) {
+    char32_t c = in[i] | (in[i+1] << 8) | (in[i+2] << 16) | ((char32_t)in[i+3] << 24);
+    if ((c > 0x10ffff) || ((c >= 0xd800) && (c < 0xe000)))
+      return INOTE_INVALID_MULTIBYTE;
+  }
+  return INOTE_OK;
+}
+
+/* decode the input with iconv, the output is dropped */
+static inote_error iconv_validate(inote_charset_t charset, const uint8_t *in, size_t length) {
+  char32_t buf[256];
+  char *inbuf = (char*)in;
+  size_t inbytesleft = length;
+  iconv_t cd;
+  inote_error ret = conv_cache_get(charset, CONV_TO_CHAR32, &cd);
+
+  if (ret)
+    return ret;
+  while (inbytesleft) {
+    char *outbuf = (char*)buf;
+    size_t outbytesleft = sizeof(buf);
+    if ((iconv(cd, &inbuf, &inbytesleft, &outbuf, &outbytesleft) == (size_t)-1)
+	&& (errno != E2BIG)) {
+      ret = (errno == EINVAL) ? INOTE_INCOMPLETE_MULTIBYTE : INOTE_INVALID_MULTIBYTE;
+      break;
+    }
+  }
+  conv_cache_put(charset, CONV_TO_CHAR32, cd);
+  return ret;
+}
+
+inote_error conv_validate(inote_charset_t charset, const uint8_t *in, size_t length) {
+  switch (charset) {
+  case INOTE_CHARSET_UTF_8:
+    return utf8_validate(in, length);
+  case INOTE_CHARSET_ISO_8859_1:
+    return INOTE_OK;
+  case INOTE_CHARSET_UTF_32:
+    return char32_validate(in, length);
+  default:
+    return iconv_validate(charset, in, length);
+  }
+}
+
+size_t conv_from_char32(inote_charset_t charset, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  if (conv_is_native(charset)) {
+    return char32_to_native(charset, inbuf, inbytesleft, outbuf, outbytesleft);
+  }
+  errno = EINVAL;
+  return (size_t)-1;
+}
+
+static const char* charset_name[CONV_MAX_CHARSET] = {
+  NULL,
+  "ISO-8859-1//IGNORE",
+  "GBK//IGNORE",
+  "UCS2//IGNORE",
+  "BIG5//IGNORE",
+  "SJIS//IGNORE",
+  "UTF8//IGNORE",
+  "UTF16//IGNORE",
+  "UTF32LE", // UTF32 instead of UTF32LE would add BOM
+};
+
+typedef struct {
+  iconv_t cd[CONV_IDLE_MAX];
+  size_t nb;
+} conv_idle_t;
+
+static struct {
+  pthread_mutex_t mutex;
+  // refcount: number of handles + 1 if prewarmed
+  unsigned int refcount;
+  bool prewarmed;
+  conv_idle_t idle[CONV_MAX_CHARSET][CONV_MAX_DIRECTION];
+} conv_cache = {
+  .mutex = PTHREAD_MUTEX_INITIALIZER,
+};
+
+/* call with the mutex locked */
+static void conv_cache_close_idle() {
+  int i, j;
+  for (i=0; i<CONV_MAX_CHARSET; i++) {
+    for (j=0; j<CONV_MAX_DIRECTION; j++) {
+      conv_idle_t *idle = &conv_cache.idle[i][j];
+      while (idle->nb) {
+	iconv_close(idle->cd[--idle->nb]);
+      }
+    }
+  }
+}
+
+void conv_cache_ref() {
+  pthread_mutex_lock(&conv_cache.mutex);
+  conv_cache.refcount++;
+  pthread_mutex_unlock(&conv_cache.mutex);
+}
+
+void conv_cache_unref() {
+  pthread_mutex_lock(&conv_cache.mutex);
+  if (conv_cache.refcount && !--conv_cache.refcount) {
+    conv_cache_close_idle();
+  }
+  pthread_mutex_unlock(&conv_cache.mutex);
+}
+
+inote_error conv_cache_get(inote_charset_t charset, conv_direction_t direction, iconv_t *cd) {
+  conv_idle_t *idle;
+  const char *tocode;
+  const char *fromcode;
+
+  if (!cd || (charset >= CONV_MAX_CHARSET) || (direction >= CONV_MAX_DIRECTION))
+    return INOTE_ARGS_ERROR;
+
+  if (!charset_name[charset] || conv_is_native(charset))
+    return INOTE_CHARSET_ERROR;
+  
+  idle = &conv_cache.idle[charset][direction];
+  *cd = ICONV_ERROR;
+  pthread_mutex_lock(&conv_cache.mutex);
+  if (idle->nb) {
+    *cd = idle->cd[--idle->nb];
+  }
+  pthread_mutex_unlock(&conv_cache.mutex);
+  if (*cd != ICONV_ERROR)
+    return INOTE_OK;
+
+  // iconv_open outside the lock: it may load the gconv modules
+  tocode = (direction == CONV_TO_CHAR32) ? charset_name[INOTE_CHARSET_UTF_32] : charset_name[charset];
+  fromcode = (direction == CONV_TO_CHAR32) ? charset_name[charset] : charset_name[INOTE_CHARSET_UTF_32];
+  *cd = iconv_open(tocode, fromcode);
+  if (*cd == ICONV_ERROR) {
+    int status = errno;
+    dbg("Error iconv_open: from %s to %s (%s)", fromcode, tocode, strerror(status));
+    return INOTE_CHARSET_ERROR;
+  }
+  return INOTE_OK;
+}
+
+void conv_cache_put(inote_charset_t charset, conv_direction_t direction, iconv_t cd) {
+  conv_idle_t *idle;
+  if ((cd == ICONV_ERROR) || (charset >= CONV_MAX_CHARSET) || (direction >= CONV_MAX_DIRECTION))
+    return;
+
+  // the next borrower starts from the initial state
+  iconv(cd, NULL, NULL, NULL, NULL);
+  idle = &conv_cache.idle[charset][direction];
+  pthread_mutex_lock(&conv_cache.mutex);
+  if (conv_cache.refcount && (idle->nb < CONV_IDLE_MAX)) {
+    idle->cd[idle->nb++] = cd;
+    cd = ICONV_ERROR;
+  }
+  pthread_mutex_unlock(&conv_cache.mutex);
+  if (cd != ICONV_ERROR) {
+    iconv_close(cd);
+  }
+}
+
+inote_error conv_cache_prewarm(inote_charset_t charset) {
+  inote_error ret = INOTE_OK;
+  int j;
+  
+  if (charset >= CONV_MAX_CHARSET)
+    return INOTE_ARGS_ERROR;
+
+  pthread_mutex_lock(&conv_cache.mutex);
+  if (!conv_cache.prewarmed) {
+    conv_cache.prewarmed = true;
+    conv_cache.refcount++;
+  }
+  pthread_mutex_unlock(&conv_cache.mutex);
+
+  if (conv_is_native(charset))
+    return INOTE_OK;
+  
+  for (j=0; j<CONV_MAX_DIRECTION; j++) {
+    iconv_t cd;
+    bool found;
+    pthread_mutex_lock(&conv_cache.mutex);
+    found = (conv_cache.idle[charset][j].nb != 0);
+    pthread_mutex_unlock(&conv_cache.mutex);
+    if (found)
+      continue;
+    ret = conv_cache_get(charset, j, &cd);
+    if (ret)
+      break;
+    conv_cache_put(charset, j, cd);
+  }
+  return ret;
+}
+
+/*
+  Fallbacks: computed once per charset; needed[i] is true if
+  fallback[i].c can't be converted to the charset.
+*/
+static struct {
+  pthread_mutex_t mutex;
+  atomic_bool ready[CONV_MAX_CHARSET];
+  bool any[CONV_MAX_CHARSET];
+  bool needed[CONV_MAX_CHARSET][FALLBACK_NB];
+} conv_fallback = {
+  .mutex = PTHREAD_MUTEX_INITIALIZER,
+};
+
+/* the fallbacks are ascii: only for the charsets which include ascii */
+static bool fallback_is_supported(inote_charset_t charset) {
+  switch (charset) {
+  case INOTE_CHARSET_ISO_8859_1:
+  case INOTE_CHARSET_GBK:
+  case INOTE_CHARSET_BIG_5:
+  case INOTE_CHARSET_SJIS:
+    return true;
+  default:
+    return false;
+  }
+}
+
+/* true if c is converted to charset (the //IGNORE converter outputs nothing otherwise) */
+static bool fallback_is_convertible(inote_charset_t charset, iconv_t cd, char32_t c) {
+  char out[8];
+  char *inbuf = (char*)&c;
+  char *outbuf = out;
+  size_t inbytesleft = sizeof(c);
+  size_t outbytesleft = sizeof(out);
+
+  if (charset == INOTE_CHARSET_ISO_8859_1)
+    return (c <= 0xff);
+  iconv(cd, NULL, NULL, NULL, NULL);
+  iconv(cd, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+  return (outbuf != out);
+}
+
+static void fallback_init(inote_charset_t charset) {
+  iconv_t cd = ICONV_ERROR;
+  size_t i;
+
+  pthread_mutex_lock(&conv_fallback.mutex);
+  if (atomic_load(&conv_fallback.ready[charset]))
+    goto exit0;
+
+  if (fallback_is_supported(charset)
+      && (conv_is_native(charset)
+	  || !conv_cache_get(charset, CONV_FROM_CHAR32, &cd))) {
+    for (i=0; i<FALLBACK_NB; i++) {
+      conv_fallback.needed[charset][i] = !fallback_is_convertible(charset, cd, fallback[i].c);
+      conv_fallback.any[charset] |= conv_fallback.needed[charset][i];
+    }
+    conv_cache_put(charset, CONV_FROM_CHAR32, cd);
+  }
+  atomic_store(&conv_fallback.ready[charset], true);
+
+ exit0:
+  pthread_mutex_unlock(&conv_fallback.mutex);
+}
+
+static int fallback_compare(const void *key, const void *entry) {
+  char32_t c = *(const char32_t*)key;
+  char32_t f = ((const fallback_t*)entry)->c;
+  return (c > f) - (c < f);
+}
+
+bool conv_has_fallback(inote_charset_t charset) {
+  if (charset >= CONV_MAX_CHARSET)
+    return false;
+  if (!atomic_load_explicit(&conv_fallback.ready[charset], memory_order_acquire))
+    fallback_init(charset);
+  return conv_fallback.any[charset];
+}
+
+const char *conv_get_fallback(inote_charset_t charset, char32_t c) {
+  const fallback_t *f;
+
+  if (!(unicode_get_property(c) & UNICODE_FALLBACK) || !conv_has_fallback(charset))
+    return NULL;
+  f = bsearch(&c, fallback, FALLBACK_NB, sizeof(*fallback), fallback_compare);
+  return (f && conv_fallback.needed[charset][f - fallback]) ? f->ascii : NULL;
+}
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
@@ -0,0 +1,107 @@
+#ifndef __CONV_H_
+#define __CONV_H_
+
+/*
+  Built-in charset converters and shared iconv descriptors.
+
+  UTF-8 and ISO-8859-1 are converted from/to UTF-32 without iconv.
+  The functions below follow the iconv() conventions so that they can
+  be used in place of the corresponding iconv descriptor:
+  - the buffer pointers and lengths are updated as iconv() does,
+  - return 0 if the whole input is converted, otherwise (size_t)-1 and
+    errno is set to EILSEQ, EINVAL or E2BIG.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <uchar.h>
+#include <iconv.h>
+#include "inote.h"
+
+#define CONV_MAX_CHARSET (INOTE_CHARSET_UTF_32+1)
+
+typedef enum {
+  CONV_TO_CHAR32,
+  CONV_FROM_CHAR32,
+  CONV_MAX_DIRECTION,
+} conv_direction_t;
+
+/* true if charset is converted by the built-in converters */
+extern bool conv_is_native(inote_charset_t charset);
+
+/* same as iconv(iconv_open("UTF32LE", charset)) */
+extern size_t conv_to_char32(inote_charset_t charset, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft);
+
+/* 
+   copy the valid utf-8 input; errors are reported as
+   conv_to_char32(INOTE_CHARSET_UTF_8,...) does
+*/
+extern size_t conv_check_utf8(char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft);
+
+/* number of leading ascii bytes of in (n bytes) */
+extern size_t conv_ascii_length(const uint8_t *in, size_t n);
+
+/*
+  check that the length bytes of in are well-formed in the charset
+  (UTF-32: little endian).
+  Return INOTE_OK, INOTE_INVALID_MULTIBYTE, INOTE_INCOMPLETE_MULTIBYTE
+  or INOTE_CHARSET_ERROR.
+*/
+extern inote_error conv_validate(inote_charset_t charset, const uint8_t *in, size_t length);
+
+/* same as iconv(iconv_open(charset + "//IGNORE", "UTF32LE")) */
+extern size_t conv_from_char32(inote_charset_t charset, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft);
+
+/*
+  Process-wide cache of iconv descriptors (thread-safe).
+
+  iconv_open() may have to load the gconv modules: the descriptors
+  are kept in the cache once released and borrowed again by the next
+  handles.
+  The idle descriptors are closed when the cache is no longer
+  referenced (no handle and no prewarm).
+*/
+
+/* reference the cache (one per handle) */
+extern void conv_cache_ref();
+
+/* release the reference; the idle descriptors are closed by the last one */
+extern void conv_cache_unref();
+
+/* 
+   borrow a descriptor from the cache (opened if no descriptor is
+   idle) for the non native charset.
+   Return INOTE_CHARSET_ERROR if the charset is not supported by iconv.
+*/
+extern inote_error conv_cache_get(inote_charset_t charset, conv_direction_t direction, iconv_t *cd);
+
+/* give back the descriptor borrowed by conv_cache_get */
+extern void conv_cache_put(inote_charset_t charset, conv_direction_t direction, iconv_t cd);
+
+/* 
+   pin the cache and open one descriptor in each direction for the
+   charset if none is idle
+*/
+extern inote_error conv_cache_prewarm(inote_charset_t charset);
+
+/*
+  Fallbacks (see fallback.h): ascii equivalent of the quotes, dashes,
+  ellipsis, spaces, ligatures,... which have no equivalent in the
+  charset.
+  Only for the charsets which include ascii (ISO-8859-1, GBK, BIG5,
+  SJIS); the table of each charset is computed at the first call
+  (thread-safe).
+*/
+
+/* true if at least one character needs a fallback in charset */
+extern bool conv_has_fallback(inote_charset_t charset);
+
+/* return the fallback of c (NUL terminated ascii) or NULL if none is needed */
+extern const char *conv_get_fallback(inote_charset_t charset, char32_t c);
+
+#endif
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
@@ -13,14 +13,17 @@
 #include <sys/stat.h>
 
 FILE *inoteDebugFile = NULL;
+int inoteDebugLevelMax = LV_DEBUG_LEVEL;
 static enum DebugLevel inoteDebugLevel = LV_ERROR_LEVEL;
 static int checkEnableCount = 0;
 static void DebugFileInit();
 
 int inoteDebugEnabled(enum DebugLevel level)
 {
-  if (!inoteDebugFile)
+  if (!inoteDebugFile) {
     DebugFileInit();
+    inoteDebugLevelMax = inoteDebugFile ? (int)inoteDebugLevel : -1;
+  }
 
   return (inoteDebugFile && (level <= inoteDebugLevel)); 
 }
@@ -125,7 +128,8 @@ void DebugFileInit()
     goto exit0;
   }
   
-  setbuf(inoteDebugFile, NULL);
+  // line buffered: one write per log
+  setvbuf(inoteDebugFile, NULL, _IOLBF, BUFSIZ);
 
  exit0:
   if (fd)
@@ -139,6 +143,7 @@ void inoteDebugFileFinish()
     fclose(inoteDebugFile);  
 
   inoteDebugFile = NULL;
+  inoteDebugLevelMax = LV_DEBUG_LEVEL;
   checkEnableCount = 0;
 }
 
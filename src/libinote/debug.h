@@ -16,7 +16,21 @@
 
 enum DebugLevel {LV_ERROR_LEVEL=0, LV_INFO_LEVEL=1, LV_DEBUG_LEVEL=2, LV_LOG_DEFAULT=LV_ERROR_LEVEL};
 
-#define log(level,fmt,...) if (inoteDebugEnabled(level)) {inoteDebugDisplayTime(); fprintf (inoteDebugFile, "%s: " fmt "\n", __func__, ##__VA_ARGS__);}
+/* 
+   max log level compiled: the logs of a greater level are removed at
+   compilation time (-1: no log at all)
+*/
+#ifndef INOTE_LOG_LEVEL
+#define INOTE_LOG_LEVEL LV_DEBUG_LEVEL
+#endif
+
+/* 
+   true if the logs of this level are written: inoteDebugLevelMax is
+   checked first (no call once the log file is known to be disabled)
+*/
+#define log_enabled(level) (((int)(level) <= INOTE_LOG_LEVEL) && ((int)(level) <= inoteDebugLevelMax) && inoteDebugEnabled(level))
+
+#define log(level,fmt,...) if (log_enabled(level)) {inoteDebugDisplayTime(); fprintf (inoteDebugFile, "%s: " fmt "\n", __func__, ##__VA_ARGS__);}
 #define err(fmt,...) log(LV_ERROR_LEVEL, fmt, ##__VA_ARGS__)
 #define msg(fmt,...) log(LV_INFO_LEVEL, fmt, ##__VA_ARGS__)
 #define dbg(fmt,...) log(LV_DEBUG_LEVEL, fmt, ##__VA_ARGS__)
@@ -29,6 +43,8 @@ enum DebugLevel {LV_ERROR_LEVEL=0, LV_INFO_LEVEL=1, LV_DEBUG_LEVEL=2, LV_LOG_DEF
 #define ENTER() dbg1("ENTER")
 #define LEAVE() dbg1("LEAVE")
 
+#define dump(label,buf,size) if (log_enabled(LV_DEBUG_LEVEL)) {inoteDebugDump(label, buf, size);}
+
 /* compilation error if condition is not fullfilled (inspired from */
 /* BUILD_BUG_ON, linux kernel). */
 #define BUILD_ASSERT(condition) ((void)sizeof(char[(condition)?1:-1]))
@@ -39,6 +55,9 @@ extern void inoteDebugDisplayTime();
 extern void inoteDebugDump(const char *label, uint8_t *buf, size_t size);
 
 extern FILE *inoteDebugFile;
+// inoteDebugLevelMax: max level of the logs written (LV_DEBUG_LEVEL
+// until the log file is opened, -1 if disabled)
+extern int inoteDebugLevelMax;
   
 
 
@@ -0,0 +1,50 @@
+#ifndef __ENTITY_H_
+#define __ENTITY_H_
+
+/*
+  HTML5 named character references (&eacute;, &amp;,...).
+
+  Trie generated at build time by gen_entity from entity.txt
+  (entity_table.c): the node 0 is the root, the children of a node
+  are contiguous and sorted by character. The names are ASCII, the
+  final ';' is not stored.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <uchar.h>
+
+#define ENTITY_NAME_MAX 32
+#define ENTITY_VALUE_MAX 2 // code points of an entity
+
+typedef struct {
+  uint8_t c; // character leading to the node
+  uint8_t nb_child;
+  uint16_t child; // first child
+  uint16_t value; // index in entity_value, 0 if the node ends no name
+} entity_node_t;
+
+extern const entity_node_t entity_node[];
+extern const char32_t entity_value[][ENTITY_VALUE_MAX];
+
+/* return the child of node for c, 0 if none */
+static inline uint16_t entity_get_child(uint16_t node, char32_t c) {
+  const entity_node_t *n = entity_node + node;
+  size_t low = n->child, high = n->child + n->nb_child;
+  while (low < high) {
+    size_t mid = (low + high)/2;
+    if (entity_node[mid].c == c)
+      return mid;
+    if (entity_node[mid].c < c)
+      low = mid + 1;
+    else
+      high = mid;
+  }
+  return 0;
+}
+
+#endif
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
@@ -0,0 +1,9863 @@
+/* generated by gen_entity */
+#include "entity.h"
+
+const entity_node_t entity_node[7729] = {
+  {0, 52, 1, 0},
+  {65, 16, 53, 0},
+  {66, 8, 69, 0},
+  {67, 14, 77, 0},
+  {68, 11, 91, 0},
+  {69, 16, 102, 0},
+  {70, 5, 118, 0},
+  {71, 12, 123, 0},
+  {72, 8, 135, 0},
+  {73, 14, 143, 0},
+  {74, 5, 157, 0},
+  {75, 7, 162, 0},
+  {76, 11, 169, 0},
+  {77, 8, 180, 0},
+  {78, 9, 188, 0},
+  {79, 14, 197, 0},
+  {80, 9, 211, 0},
+  {81, 4, 220, 0},
+  {82, 12, 224, 0},
+  {83, 13, 236, 0},
+  {84, 11, 249, 0},
+  {85, 14, 260, 0},
+  {86, 9, 274, 0},
+  {87, 5, 283, 0},
+  {88, 4, 288, 0},
+  {89, 9, 292, 0},
+  {90, 8, 301, 0},
+  {97, 16, 309, 0},
+  {98, 16, 325, 0},
+  {99, 15, 341, 0},
+  {100, 19, 356, 0},
+  {101, 18, 375, 0},
+  {102, 12, 393, 0},
+  {103, 17, 405, 0},
+  {104, 10, 422, 0},
+  {105, 15, 432, 0},
+  {106, 6, 447, 0},
+  {107, 8, 453, 0},
+  {108, 23, 461, 0},
+  {109, 14, 484, 0},
+  {110, 24, 498, 0},
+  {111, 18, 522, 0},
+  {112, 12, 540, 0},
+  {113, 6, 552, 0},
+  {114, 21, 558, 0},
+  {115, 19, 579, 0},
+  {116, 13, 598, 0},
+  {117, 18, 611, 0},
+  {118, 15, 629, 0},
+  {119, 7, 644, 0},
+  {120, 14, 651, 0},
+  {121, 8, 665, 0},
+  {122, 10, 673, 0},
+  {69, 1, 683, 0},
+  {77, 1, 684, 0},
+  {97, 1, 685, 0},
+  {98, 1, 686, 0},
+  {99, 2, 687, 0},
+  {102, 1, 689, 0},
+  {103, 1, 690, 0},
+  {108, 1, 691, 0},
+  {109, 1, 692, 0},
+  {110, 1, 693, 0},
+  {111, 2, 694, 0},
+  {112, 1, 696, 0},
+  {114, 1, 697, 0},
+  {115, 2, 698, 0},
+  {116, 1, 700, 0},
+  {117, 1, 701, 0},
+  {97, 2, 702, 0},
+  {99, 1, 704, 0},
+  {101, 3, 705, 0},
+  {102, 1, 708, 0},
+  {111, 1, 709, 0},
+  {114, 1, 710, 0},
+  {115, 1, 711, 0},
+  {117, 1, 712, 0},
+  {72, 1, 713, 0},
+  {79, 1, 714, 0},
+  {97, 3, 715, 0},
+  {99, 4, 718, 0},
+  {100, 1, 722, 0},
+  {101, 2, 723, 0},
+  {102, 1, 725, 0},
+  {104, 1, 726, 0},
+  {105, 1, 727, 0},
+  {108, 1, 728, 0},
+  {111, 4, 729, 0},
+  {114, 1, 733, 0},
+  {115, 1, 734, 0},
+  {117, 1, 735, 0},
+  {68, 1, 736, 1},
+  {74, 1, 737, 0},
+  {83, 1, 738, 0},
+  {90, 1, 739, 0},
+  {97, 3, 740, 0},
+  {99, 2, 743, 0},
+  {101, 1, 745, 0},
+  {102, 1, 746, 0},
+  {105, 2, 747, 0},
+  {111, 4, 749, 0},
+  {115, 2, 753, 0},
+  {78, 1, 755, 0},
+  {84, 1, 756, 0},
+  {97, 1, 757, 0},
+  {99, 3, 758, 0},
+  {100, 1, 761, 0},
+  {102, 1, 762, 0},
+  {103, 1, 763, 0},
+  {108, 1, 764, 0},
+  {109, 2, 765, 0},
+  {111, 2, 767, 0},
+  {112, 1, 769, 0},
+  {113, 1, 770, 0},
+  {115, 2, 771, 0},
+  {116, 1, 773, 0},
+  {117, 1, 774, 0},
+  {120, 2, 775, 0},
+  {99, 1, 777, 0},
+  {102, 1, 778, 0},
+  {105, 1, 779, 0},
+  {111, 3, 780, 0},
+  {115, 1, 783, 0},
+  {74, 1, 784, 0},
+  {84, 0, 0, 2},
+  {97, 1, 785, 0},
+  {98, 1, 786, 0},
+  {99, 3, 787, 0},
+  {100, 1, 790, 0},
+  {102, 1, 791, 0},
+  {103, 0, 0, 3},
+  {111, 1, 792, 0},
+  {114, 1, 793, 0},
+  {115, 1, 794, 0},
+  {116, 0, 0, 4},
+  {65, 1, 795, 0},
+  {97, 2, 796, 0},
+  {99, 1, 798, 0},
+  {102, 1, 799, 0},
+  {105, 1, 800, 0},
+  {111, 2, 801, 0},
+  {115, 2, 803, 0},
+  {117, 1, 805, 0},
+  {69, 1, 806, 0},
+  {74, 1, 807, 0},
+  {79, 1, 808, 0},
+  {97, 1, 809, 0},
+  {99, 2, 810, 0},
+  {100, 1, 812, 0},
+  {102, 1, 813, 0},
+  {103, 1, 814, 0},
+  {109, 2, 815, 5},
+  {110, 2, 817, 0},
+  {111, 3, 819, 0},
+  {115, 1, 822, 0},
+  {116, 1, 823, 0},
+  {117, 2, 824, 0},
+  {99, 2, 826, 0},
+  {102, 1, 828, 0},
+  {111, 1, 829, 0},
+  {115, 2, 830, 0},
+  {117, 1, 832, 0},
+  {72, 1, 833, 0},
+  {74, 1, 834, 0},
+  {97, 1, 835, 0},
+  {99, 2, 836, 0},
+  {102, 1, 838, 0},
+  {111, 1, 839, 0},
+  {115, 1, 840, 0},
+  {74, 1, 841, 0},
+  {84, 0, 0, 6},
+  {97, 5, 842, 0},
+  {99, 3, 847, 0},
+  {101, 2, 850, 0},
+  {102, 1, 852, 0},
+  {108, 1, 853, 7},
+  {109, 1, 854, 0},
+  {111, 3, 855, 0},
+  {115, 3, 858, 0},
+  {116, 0, 0, 8},
+  {97, 1, 861, 0},
+  {99, 1, 862, 0},
+  {101, 2, 863, 0},
+  {102, 1, 865, 0},
+  {105, 1, 866, 0},
+  {111, 1, 867, 0},
+  {115, 1, 868, 0},
+  {117, 0, 0, 9},
+  {74, 1, 869, 0},
+  {97, 1, 870, 0},
+  {99, 3, 871, 0},
+  {101, 3, 874, 0},
+  {102, 1, 877, 0},
+  {111, 4, 878, 0},
+  {115, 1, 882, 0},
+  {116, 1, 883, 0},
+  {117, 0, 0, 10},
+  {69, 1, 884, 0},
+  {97, 1, 885, 0},
+  {99, 2, 886, 0},
+  {100, 1, 888, 0},
+  {102, 1, 889, 0},
+  {103, 1, 890, 0},
+  {109, 3, 891, 0},
+  {111, 1, 894, 0},
+  {112, 1, 895, 0},
+  {114, 0, 0, 11},
+  {115, 2, 896, 0},
+  {116, 1, 898, 0},
+  {117, 1, 899, 0},
+  {118, 1, 900, 0},
+  {97, 1, 901, 0},
+  {99, 1, 902, 0},
+  {102, 1, 903, 0},
+  {104, 1, 904, 0},
+  {105, 0, 0, 12},
+  {108, 1, 905, 0},
+  {111, 2, 906, 0},
+  {114, 3, 908, 13},
+  {115, 2, 911, 0},
+  {85, 1, 913, 0},
+  {102, 1, 914, 0},
+  {111, 1, 915, 0},
+  {115, 1, 916, 0},
+  {66, 1, 917, 0},
+  {69, 1, 918, 0},
+  {97, 3, 919, 0},
+  {99, 3, 922, 0},
+  {101, 1, 925, 14},
+  {102, 1, 926, 0},
+  {104, 1, 927, 0},
+  {105, 1, 928, 0},
+  {111, 2, 929, 0},
+  {114, 1, 931, 0},
+  {115, 2, 932, 0},
+  {117, 1, 934, 0},
+  {72, 2, 935, 0},
+  {79, 1, 937, 0},
+  {97, 1, 938, 0},
+  {99, 4, 939, 15},
+  {102, 1, 943, 0},
+  {104, 1, 944, 0},
+  {105, 1, 945, 0},
+  {109, 1, 946, 0},
+  {111, 1, 947, 0},
+  {113, 2, 948, 0},
+  {115, 1, 950, 0},
+  {116, 1, 951, 0},
+  {117, 4, 952, 0},
+  {72, 1, 956, 0},
+  {82, 1, 957, 0},
+  {83, 2, 958, 0},
+  {97, 2, 960, 0},
+  {99, 3, 962, 0},
+  {102, 1, 965, 0},
+  {104, 2, 966, 0},
+  {105, 1, 968, 0},
+  {111, 1, 969, 0},
+  {114, 1, 970, 0},
+  {115, 2, 971, 0},
+  {97, 2, 973, 0},
+  {98, 1, 975, 0},
+  {99, 2, 976, 0},
+  {100, 1, 978, 0},
+  {102, 1, 979, 0},
+  {103, 1, 980, 0},
+  {109, 1, 981, 0},
+  {110, 2, 982, 0},
+  {111, 2, 984, 0},
+  {112, 8, 986, 0},
+  {114, 1, 994, 0},
+  {115, 1, 995, 0},
+  {116, 1, 996, 0},
+  {117, 1, 997, 0},
+  {68, 1, 998, 0},
+  {98, 1, 999, 0},
+  {99, 1, 1000, 0},
+  {100, 1, 1001, 0},
+  {101, 2, 1002, 0},
+  {102, 1, 1004, 0},
+  {111, 1, 1005, 0},
+  {115, 1, 1006, 0},
+  {118, 1, 1007, 0},
+  {99, 1, 1008, 0},
+  {101, 1, 1009, 0},
+  {102, 1, 1010, 0},
+  {111, 1, 1011, 0},
+  {115, 1, 1012, 0},
+  {102, 1, 1013, 0},
+  {105, 0, 0, 16},
+  {111, 1, 1014, 0},
+  {115, 1, 1015, 0},
+  {65, 1, 1016, 0},
+  {73, 1, 1017, 0},
+  {85, 1, 1018, 0},
+  {97, 1, 1019, 0},
+  {99, 2, 1020, 0},
+  {102, 1, 1022, 0},
+  {111, 1, 1023, 0},
+  {115, 1, 1024, 0},
+  {117, 1, 1025, 0},
+  {72, 1, 1026, 0},
+  {97, 1, 1027, 0},
+  {99, 2, 1028, 0},
+  {100, 1, 1030, 0},
+  {101, 2, 1031, 0},
+  {102, 1, 1033, 0},
+  {111, 1, 1034, 0},
+  {115, 1, 1035, 0},
+  {97, 1, 1036, 0},
+  {98, 1, 1037, 0},
+  {99, 5, 1038, 17},
+  {101, 1, 1043, 0},
+  {102, 1, 1044, 18},
+  {103, 1, 1045, 0},
+  {108, 2, 1046, 0},
+  {109, 2, 1048, 0},
+  {110, 2, 1050, 0},
+  {111, 2, 1052, 0},
+  {112, 6, 1054, 19},
+  {114, 1, 1060, 0},
+  {115, 3, 1061, 0},
+  {116, 1, 1064, 0},
+  {117, 1, 1065, 0},
+  {119, 2, 1066, 0},
+  {78, 1, 1068, 0},
+  {97, 2, 1069, 0},
+  {98, 1, 1071, 0},
+  {99, 2, 1072, 0},
+  {100, 1, 1074, 0},
+  {101, 5, 1075, 0},
+  {102, 1, 1080, 0},
+  {105, 1, 1081, 0},
+  {107, 1, 1082, 0},
+  {108, 3, 1083, 0},
+  {110, 2, 1086, 0},
+  {111, 4, 1088, 0},
+  {112, 1, 1092, 0},
+  {114, 2, 1093, 0},
+  {115, 4, 1095, 0},
+  {117, 2, 1099, 0},
+  {97, 3, 1101, 0},
+  {99, 4, 1104, 0},
+  {100, 1, 1108, 0},
+  {101, 3, 1109, 0},
+  {102, 1, 1112, 0},
+  {104, 3, 1113, 0},
+  {105, 1, 1116, 0},
+  {108, 1, 1117, 0},
+  {111, 4, 1118, 0},
+  {114, 2, 1122, 0},
+  {115, 2, 1124, 0},
+  {116, 1, 1126, 0},
+  {117, 7, 1127, 0},
+  {119, 2, 1134, 0},
+  {121, 1, 1136, 0},
+  {65, 1, 1137, 0},
+  {72, 1, 1138, 0},
+  {97, 4, 1139, 0},
+  {98, 2, 1143, 0},
+  {99, 2, 1145, 0},
+  {100, 2, 1147, 20},
+  {101, 3, 1149, 0},
+  {102, 2, 1152, 0},
+  {104, 1, 1154, 0},
+  {105, 5, 1155, 0},
+  {106, 1, 1160, 0},
+  {108, 1, 1161, 0},
+  {111, 5, 1162, 0},
+  {114, 2, 1167, 0},
+  {115, 3, 1169, 0},
+  {116, 2, 1172, 0},
+  {117, 2, 1174, 0},
+  {119, 1, 1176, 0},
+  {122, 2, 1177, 0},
+  {68, 2, 1179, 0},
+  {97, 2, 1181, 0},
+  {99, 4, 1183, 0},
+  {100, 1, 1187, 0},
+  {101, 0, 0, 21},
+  {102, 2, 1188, 0},
+  {103, 2, 1190, 22},
+  {108, 3, 1192, 23},
+  {109, 3, 1195, 0},
+  {110, 2, 1198, 0},
+  {111, 2, 1200, 0},
+  {112, 3, 1202, 0},
+  {113, 4, 1205, 0},
+  {114, 2, 1209, 0},
+  {115, 3, 1211, 0},
+  {116, 2, 1214, 0},
+  {117, 2, 1216, 0},
+  {120, 3, 1218, 0},
+  {97, 1, 1221, 0},
+  {99, 1, 1222, 0},
+  {101, 1, 1223, 0},
+  {102, 3, 1224, 0},
+  {105, 1, 1227, 0},
+  {106, 1, 1228, 0},
+  {108, 3, 1229, 0},
+  {110, 1, 1232, 0},
+  {111, 2, 1233, 0},
+  {112, 1, 1235, 0},
+  {114, 2, 1236, 0},
+  {115, 1, 1238, 0},
+  {69, 1, 1239, 24},
+  {97, 3, 1240, 0},
+  {98, 1, 1243, 0},
+  {99, 2, 1244, 0},
+  {100, 1, 1246, 0},
+  {101, 3, 1247, 25},
+  {102, 1, 1250, 0},
+  {103, 1, 1251, 26},
+  {105, 1, 1252, 0},
+  {106, 1, 1253, 0},
+  {108, 3, 1254, 27},
+  {110, 4, 1257, 0},
+  {111, 1, 1261, 0},
+  {114, 1, 1262, 0},
+  {115, 2, 1263, 0},
+  {116, 5, 1265, 28},
+  {118, 2, 1270, 0},
+  {65, 1, 1272, 0},
+  {97, 4, 1273, 0},
+  {98, 1, 1277, 0},
+  {99, 1, 1278, 0},
+  {101, 3, 1279, 0},
+  {102, 1, 1282, 0},
+  {107, 1, 1283, 0},
+  {111, 5, 1284, 0},
+  {115, 3, 1289, 0},
+  {121, 2, 1292, 0},
+  {97, 1, 1294, 0},
+  {99, 2, 1295, 29},
+  {101, 2, 1297, 0},
+  {102, 2, 1299, 0},
+  {103, 1, 1301, 0},
+  {105, 3, 1302, 30},
+  {106, 1, 1305, 0},
+  {109, 3, 1306, 0},
+  {110, 4, 1309, 31},
+  {111, 4, 1313, 0},
+  {112, 1, 1317, 0},
+  {113, 1, 1318, 0},
+  {115, 2, 1319, 0},
+  {116, 1, 1321, 32},
+  {117, 2, 1322, 0},
+  {99, 2, 1324, 0},
+  {102, 1, 1326, 0},
+  {109, 1, 1327, 0},
+  {111, 1, 1328, 0},
+  {115, 2, 1329, 0},
+  {117, 1, 1331, 0},
+  {97, 1, 1332, 0},
+  {99, 2, 1333, 0},
+  {102, 1, 1335, 0},
+  {103, 1, 1336, 0},
+  {104, 1, 1337, 0},
+  {106, 1, 1338, 0},
+  {111, 1, 1339, 0},
+  {115, 1, 1340, 0},
+  {65, 3, 1341, 0},
+  {66, 1, 1344, 0},
+  {69, 1, 1345, 33},
+  {72, 1, 1346, 0},
+  {97, 9, 1347, 0},
+  {98, 3, 1356, 0},
+  {99, 4, 1359, 0},
+  {100, 4, 1363, 0},
+  {101, 4, 1367, 34},
+  {102, 3, 1371, 0},
+  {103, 1, 1374, 35},
+  {104, 2, 1375, 0},
+  {106, 1, 1377, 0},
+  {108, 4, 1378, 36},
+  {109, 2, 1382, 0},
+  {110, 4, 1384, 0},
+  {111, 8, 1388, 0},
+  {112, 1, 1396, 0},
+  {114, 5, 1397, 0},
+  {115, 6, 1402, 0},
+  {116, 7, 1408, 37},
+  {117, 1, 1415, 0},
+  {118, 2, 1416, 0},
+  {68, 1, 1418, 0},
+  {97, 4, 1419, 0},
+  {99, 2, 1423, 0},
+  {100, 1, 1425, 0},
+  {101, 1, 1426, 0},
+  {102, 1, 1427, 0},
+  {104, 1, 1428, 0},
+  {105, 3, 1429, 0},
+  {108, 2, 1432, 0},
+  {110, 1, 1434, 0},
+  {111, 2, 1435, 0},
+  {112, 0, 0, 38},
+  {115, 2, 1437, 0},
+  {117, 2, 1439, 39},
+  {71, 2, 1441, 0},
+  {76, 3, 1443, 0},
+  {82, 1, 1446, 0},
+  {86, 2, 1447, 0},
+  {97, 5, 1449, 0},
+  {98, 2, 1454, 0},
+  {99, 5, 1456, 0},
+  {100, 1, 1461, 0},
+  {101, 6, 1462, 40},
+  {102, 1, 1468, 0},
+  {103, 4, 1469, 0},
+  {104, 3, 1473, 0},
+  {105, 2, 1476, 41},
+  {106, 1, 1478, 0},
+  {108, 7, 1479, 0},
+  {109, 1, 1486, 0},
+  {111, 2, 1487, 0},
+  {112, 3, 1489, 0},
+  {114, 4, 1492, 0},
+  {115, 7, 1496, 0},
+  {116, 4, 1503, 0},
+  {117, 1, 1507, 42},
+  {118, 9, 1508, 0},
+  {119, 3, 1517, 0},
+  {83, 0, 0, 43},
+  {97, 2, 1520, 0},
+  {99, 2, 1522, 0},
+  {100, 5, 1524, 0},
+  {101, 1, 1529, 0},
+  {102, 2, 1530, 0},
+  {103, 3, 1532, 0},
+  {104, 2, 1535, 0},
+  {105, 1, 1537, 0},
+  {108, 4, 1538, 0},
+  {109, 3, 1542, 0},
+  {111, 1, 1545, 0},
+  {112, 3, 1546, 0},
+  {114, 6, 1549, 44},
+  {115, 3, 1555, 0},
+  {116, 1, 1558, 0},
+  {117, 1, 1559, 0},
+  {118, 1, 1560, 0},
+  {97, 1, 1561, 0},
+  {99, 1, 1562, 0},
+  {101, 1, 1563, 0},
+  {102, 1, 1564, 0},
+  {104, 3, 1565, 0},
+  {105, 2, 1568, 45},
+  {108, 2, 1570, 0},
+  {109, 0, 0, 46},
+  {111, 3, 1572, 0},
+  {114, 9, 1575, 47},
+  {115, 2, 1584, 0},
+  {117, 1, 1586, 0},
+  {102, 1, 1587, 0},
+  {105, 1, 1588, 0},
+  {111, 1, 1589, 0},
+  {112, 1, 1590, 0},
+  {115, 1, 1591, 0},
+  {117, 3, 1592, 0},
+  {65, 3, 1595, 0},
+  {66, 1, 1598, 0},
+  {72, 1, 1599, 0},
+  {97, 7, 1600, 0},
+  {98, 3, 1607, 0},
+  {99, 4, 1610, 0},
+  {100, 4, 1614, 0},
+  {101, 3, 1618, 0},
+  {102, 3, 1621, 0},
+  {104, 2, 1624, 0},
+  {105, 3, 1626, 0},
+  {108, 3, 1629, 0},
+  {109, 1, 1632, 0},
+  {110, 1, 1633, 0},
+  {111, 4, 1634, 0},
+  {112, 2, 1638, 0},
+  {114, 1, 1640, 0},
+  {115, 4, 1641, 0},
+  {116, 3, 1645, 0},
+  {117, 1, 1648, 0},
+  {120, 0, 0, 48},
+  {97, 1, 1649, 0},
+  {98, 1, 1650, 0},
+  {99, 9, 1651, 49},
+  {100, 1, 1660, 0},
+  {101, 7, 1661, 0},
+  {102, 1, 1668, 0},
+  {104, 4, 1669, 0},
+  {105, 2, 1673, 0},
+  {108, 1, 1675, 0},
+  {109, 4, 1676, 0},
+  {111, 3, 1680, 0},
+  {112, 1, 1683, 0},
+  {113, 3, 1684, 0},
+  {114, 1, 1687, 0},
+  {115, 4, 1688, 0},
+  {116, 2, 1692, 0},
+  {117, 5, 1694, 0},
+  {119, 3, 1699, 0},
+  {122, 1, 1702, 0},
+  {97, 2, 1703, 0},
+  {98, 1, 1705, 0},
+  {99, 3, 1706, 0},
+  {100, 1, 1709, 0},
+  {101, 1, 1710, 0},
+  {102, 1, 1711, 0},
+  {104, 4, 1712, 0},
+  {105, 3, 1716, 0},
+  {111, 3, 1719, 0},
+  {112, 1, 1722, 0},
+  {114, 3, 1723, 0},
+  {115, 3, 1726, 0},
+  {119, 2, 1729, 0},
+  {65, 1, 1731, 0},
+  {72, 1, 1732, 0},
+  {97, 2, 1733, 0},
+  {98, 1, 1735, 0},
+  {99, 2, 1736, 0},
+  {100, 3, 1738, 0},
+  {102, 2, 1741, 0},
+  {103, 1, 1743, 0},
+  {104, 2, 1744, 0},
+  {108, 2, 1746, 0},
+  {109, 2, 1748, 0},
+  {111, 2, 1750, 0},
+  {112, 6, 1752, 0},
+  {114, 3, 1758, 0},
+  {115, 1, 1761, 0},
+  {116, 3, 1762, 0},
+  {117, 2, 1765, 0},
+  {119, 1, 1767, 0},
+  {65, 1, 1768, 0},
+  {66, 1, 1769, 0},
+  {68, 1, 1770, 0},
+  {97, 2, 1771, 0},
+  {99, 1, 1773, 0},
+  {100, 1, 1774, 0},
+  {101, 3, 1775, 0},
+  {102, 1, 1778, 0},
+  {108, 1, 1779, 0},
+  {110, 1, 1780, 0},
+  {111, 1, 1781, 0},
+  {112, 1, 1782, 0},
+  {114, 1, 1783, 0},
+  {115, 2, 1784, 0},
+  {122, 1, 1786, 0},
+  {99, 1, 1787, 0},
+  {101, 2, 1788, 0},
+  {102, 1, 1790, 0},
+  {111, 1, 1791, 0},
+  {112, 0, 0, 50},
+  {114, 1, 1792, 51},
+  {115, 1, 1793, 0},
+  {99, 3, 1794, 0},
+  {100, 1, 1797, 0},
+  {102, 1, 1798, 0},
+  {104, 2, 1799, 0},
+  {105, 0, 0, 52},
+  {108, 2, 1801, 0},
+  {109, 1, 1803, 0},
+  {110, 1, 1804, 0},
+  {111, 3, 1805, 0},
+  {114, 2, 1808, 0},
+  {115, 2, 1810, 0},
+  {117, 2, 1812, 0},
+  {118, 1, 1814, 0},
+  {119, 1, 1815, 0},
+  {97, 1, 1816, 0},
+  {99, 2, 1817, 0},
+  {101, 1, 1819, 0},
+  {102, 1, 1820, 0},
+  {105, 1, 1821, 0},
+  {111, 1, 1822, 0},
+  {115, 1, 1823, 0},
+  {117, 2, 1824, 0},
+  {97, 1, 1826, 0},
+  {99, 2, 1827, 0},
+  {100, 1, 1829, 0},
+  {101, 2, 1830, 0},
+  {102, 1, 1832, 0},
+  {104, 1, 1833, 0},
+  {105, 1, 1834, 0},
+  {111, 1, 1835, 0},
+  {115, 1, 1836, 0},
+  {119, 2, 1837, 0},
+  {108, 1, 1839, 0},
+  {80, 0, 0, 53},
+  {99, 1, 1840, 0},
+  {114, 1, 1841, 0},
+  {105, 1, 1842, 0},
+  {121, 0, 0, 54},
+  {114, 0, 0, 55},
+  {114, 1, 1843, 0},
+  {112, 1, 1844, 0},
+  {97, 1, 1845, 0},
+  {100, 0, 0, 56},
+  {103, 1, 1846, 0},
+  {112, 1, 1847, 0},
+  {112, 1, 1848, 0},
+  {105, 1, 1849, 0},
+  {99, 1, 1850, 0},
+  {115, 1, 1851, 0},
+  {105, 1, 1852, 0},
+  {109, 1, 1853, 0},
+  {99, 1, 1854, 0},
+  {114, 2, 1855, 0},
+  {121, 0, 0, 57},
+  {99, 1, 1857, 0},
+  {114, 1, 1858, 0},
+  {116, 1, 1859, 0},
+  {114, 0, 0, 58},
+  {112, 1, 1860, 0},
+  {101, 1, 1861, 0},
+  {99, 1, 1862, 0},
+  {109, 1, 1863, 0},
+  {99, 1, 1864, 0},
+  {80, 1, 1865, 0},
+  {99, 1, 1866, 0},
+  {112, 1, 1867, 59},
+  {121, 1, 1868, 0},
+  {97, 1, 1869, 0},
+  {101, 1, 1870, 0},
+  {105, 1, 1871, 0},
+  {111, 1, 1872, 0},
+  {111, 1, 1873, 0},
+  {100, 1, 1874, 0},
+  {110, 1, 1875, 0},
+  {114, 0, 0, 60},
+  {105, 0, 0, 61},
+  {114, 1, 1876, 0},
+  {111, 2, 1877, 0},
+  {108, 1, 1879, 0},
+  {110, 3, 1880, 0},
+  {112, 2, 1883, 0},
+  {117, 1, 1885, 0},
+  {111, 1, 1886, 0},
+  {99, 1, 1887, 0},
+  {112, 1, 1888, 62},
+  {111, 1, 1889, 0},
+  {99, 1, 1890, 0},
+  {99, 1, 1891, 0},
+  {99, 1, 1892, 0},
+  {103, 1, 1893, 0},
+  {114, 1, 1894, 0},
+  {115, 1, 1895, 0},
+  {97, 1, 1896, 0},
+  {121, 0, 0, 63},
+  {108, 1, 1897, 64},
+  {114, 0, 0, 65},
+  {97, 2, 1898, 0},
+  {102, 1, 1900, 0},
+  {112, 1, 1901, 0},
+  {116, 2, 1902, 66},
+  {117, 1, 1904, 0},
+  {119, 1, 1905, 0},
+  {99, 1, 1906, 0},
+  {116, 1, 1907, 0},
+  {71, 0, 0, 67},
+  {72, 0, 0, 68},
+  {99, 1, 1908, 0},
+  {97, 1, 1909, 0},
+  {105, 1, 1910, 0},
+  {121, 0, 0, 69},
+  {111, 1, 1911, 0},
+  {114, 0, 0, 70},
+  {114, 1, 1912, 0},
+  {101, 1, 1913, 0},
+  {97, 1, 1914, 0},
+  {112, 1, 1915, 0},
+  {103, 1, 1916, 0},
+  {112, 1, 1917, 0},
+  {115, 1, 1918, 0},
+  {117, 2, 1919, 0},
+  {99, 1, 1921, 0},
+  {105, 1, 1922, 0},
+  {97, 0, 0, 71},
+  {109, 1, 1923, 0},
+  {105, 1, 1924, 0},
+  {112, 1, 1925, 0},
+  {121, 0, 0, 72},
+  {114, 0, 0, 73},
+  {108, 1, 1926, 0},
+  {112, 1, 1927, 0},
+  {114, 1, 1928, 0},
+  {117, 1, 1929, 0},
+  {99, 1, 1930, 0},
+  {99, 1, 1931, 0},
+  {109, 1, 1932, 0},
+  {114, 1, 1933, 0},
+  {101, 1, 1934, 0},
+  {105, 1, 1935, 0},
+  {121, 0, 0, 74},
+  {111, 1, 1936, 0},
+  {114, 0, 0, 75},
+  {112, 1, 1937, 0},
+  {101, 1, 1938, 0},
+  {99, 1, 1939, 0},
+  {82, 1, 1940, 0},
+  {99, 1, 1941, 0},
+  {116, 0, 0, 76},
+  {105, 1, 1942, 0},
+  {114, 0, 0, 77},
+  {108, 1, 1943, 0},
+  {112, 1, 1944, 0},
+  {114, 1, 1945, 0},
+  {99, 1, 1946, 0},
+  {116, 1, 1947, 0},
+  {109, 1, 1948, 0},
+  {99, 1, 1949, 0},
+  {108, 1, 1950, 0},
+  {99, 1, 1951, 0},
+  {99, 1, 1952, 0},
+  {105, 1, 1953, 0},
+  {121, 0, 0, 78},
+  {111, 1, 1954, 0},
+  {114, 0, 0, 79},
+  {114, 1, 1955, 0},
+  {97, 2, 1956, 0},
+  {112, 1, 1958, 0},
+  {116, 1, 1959, 80},
+  {118, 1, 1960, 0},
+  {103, 1, 1961, 0},
+  {112, 1, 1962, 0},
+  {116, 1, 1963, 0},
+  {99, 1, 1964, 0},
+  {105, 1, 1965, 0},
+  {107, 1, 1966, 0},
+  {109, 1, 1967, 0},
+  {105, 1, 1968, 0},
+  {121, 0, 0, 81},
+  {114, 0, 0, 82},
+  {112, 1, 1969, 0},
+  {99, 1, 1970, 0},
+  {101, 1, 1971, 0},
+  {107, 1, 1972, 0},
+  {99, 1, 1973, 0},
+  {99, 1, 1974, 0},
+  {112, 1, 1975, 0},
+  {101, 1, 1976, 0},
+  {121, 0, 0, 83},
+  {114, 0, 0, 84},
+  {112, 1, 1977, 0},
+  {99, 1, 1978, 0},
+  {99, 1, 1979, 0},
+  {99, 1, 1980, 0},
+  {109, 1, 1981, 0},
+  {110, 1, 1982, 0},
+  {112, 1, 1983, 0},
+  {114, 1, 1984, 0},
+  {97, 1, 1985, 0},
+  {101, 1, 1986, 0},
+  {121, 0, 0, 85},
+  {102, 1, 1987, 0},
+  {115, 1, 1988, 0},
+  {114, 0, 0, 86},
+  {101, 1, 1989, 0},
+  {105, 1, 1990, 0},
+  {110, 1, 1991, 0},
+  {112, 1, 1992, 0},
+  {119, 1, 1993, 0},
+  {99, 1, 1994, 0},
+  {104, 0, 0, 87},
+  {116, 1, 1995, 0},
+  {112, 0, 0, 88},
+  {121, 0, 0, 89},
+  {100, 1, 1996, 0},
+  {108, 1, 1997, 0},
+  {114, 0, 0, 90},
+  {110, 1, 1998, 0},
+  {112, 1, 1999, 0},
+  {99, 1, 2000, 0},
+  {99, 1, 2001, 0},
+  {99, 1, 2002, 0},
+  {97, 1, 2003, 0},
+  {101, 1, 2004, 0},
+  {121, 0, 0, 91},
+  {103, 1, 2005, 0},
+  {115, 1, 2006, 0},
+  {119, 1, 2007, 0},
+  {114, 0, 0, 92},
+  {66, 1, 2008, 0},
+  {110, 1, 2009, 0},
+  {112, 1, 2010, 0},
+  {116, 12, 2011, 93},
+  {99, 1, 2023, 0},
+  {105, 1, 2024, 0},
+  {108, 1, 2025, 0},
+  {99, 1, 2026, 0},
+  {105, 1, 2027, 0},
+  {121, 0, 0, 94},
+  {98, 1, 2028, 0},
+  {114, 0, 0, 95},
+  {114, 1, 2029, 0},
+  {97, 1, 2030, 0},
+  {101, 1, 2031, 0},
+  {105, 1, 2032, 0},
+  {112, 1, 2033, 0},
+  {101, 1, 2034, 0},
+  {99, 1, 2035, 0},
+  {108, 1, 2036, 0},
+  {105, 2, 2037, 0},
+  {109, 1, 2039, 0},
+  {101, 1, 2040, 0},
+  {114, 1, 2041, 0},
+  {121, 0, 0, 96},
+  {114, 0, 0, 97},
+  {105, 0, 0, 98},
+  {117, 1, 2042, 0},
+  {105, 1, 2043, 0},
+  {112, 1, 2044, 0},
+  {101, 1, 2045, 0},
+  {105, 1, 2046, 0},
+  {111, 2, 2047, 0},
+  {99, 1, 2049, 0},
+  {105, 0, 0, 99},
+  {79, 1, 2050, 0},
+  {114, 0, 0, 100},
+  {112, 1, 2051, 0},
+  {99, 1, 2052, 0},
+  {97, 1, 2053, 0},
+  {71, 0, 0, 101},
+  {99, 1, 2054, 0},
+  {110, 1, 2055, 0},
+  {114, 1, 2056, 0},
+  {97, 1, 2057, 0},
+  {101, 1, 2058, 0},
+  {121, 0, 0, 102},
+  {118, 1, 2059, 0},
+  {114, 0, 0, 103},
+  {111, 0, 0, 104},
+  {103, 1, 2060, 0},
+  {112, 1, 2061, 0},
+  {117, 1, 2062, 0},
+  {105, 1, 2063, 0},
+  {99, 1, 2064, 0},
+  {104, 0, 0, 105},
+  {108, 1, 2065, 0},
+  {67, 1, 2066, 0},
+  {99, 1, 2067, 0},
+  {70, 1, 2068, 0},
+  {99, 1, 2069, 0},
+  {97, 1, 2070, 0},
+  {101, 1, 2071, 0},
+  {105, 1, 2072, 0},
+  {121, 0, 0, 106},
+  {114, 0, 0, 107},
+  {111, 1, 2073, 0},
+  {103, 1, 2074, 0},
+  {97, 1, 2075, 0},
+  {112, 1, 2076, 0},
+  {114, 1, 2077, 0},
+  {117, 1, 2078, 0},
+  {99, 1, 2079, 0},
+  {97, 1, 2080, 0},
+  {98, 1, 2081, 108},
+  {99, 2, 2082, 0},
+  {109, 0, 0, 109},
+  {112, 2, 2084, 110},
+  {79, 1, 2086, 0},
+  {65, 1, 2087, 0},
+  {72, 1, 2088, 0},
+  {99, 1, 2089, 0},
+  {98, 0, 0, 111},
+  {117, 0, 0, 112},
+  {97, 1, 2090, 0},
+  {101, 1, 2091, 0},
+  {121, 0, 0, 113},
+  {114, 0, 0, 114},
+  {101, 2, 2092, 0},
+  {105, 2, 2094, 0},
+  {108, 1, 2096, 0},
+  {112, 1, 2097, 0},
+  {105, 1, 2098, 0},
+  {99, 1, 2099, 0},
+  {116, 1, 2100, 0},
+  {99, 1, 2101, 0},
+  {114, 1, 2102, 0},
+  {114, 2, 2103, 0},
+  {105, 1, 2105, 0},
+  {121, 0, 0, 115},
+  {98, 1, 2106, 0},
+  {114, 0, 0, 116},
+  {114, 1, 2107, 0},
+  {97, 1, 2108, 0},
+  {100, 1, 2109, 0},
+  {105, 1, 2110, 0},
+  {103, 1, 2111, 0},
+  {112, 1, 2112, 0},
+  {65, 1, 2113, 0},
+  {68, 1, 2114, 0},
+  {69, 1, 2115, 0},
+  {84, 1, 2116, 0},
+  {97, 1, 2117, 0},
+  {100, 1, 2118, 0},
+  {112, 1, 2119, 0},
+  {115, 1, 2120, 0},
+  {105, 1, 2121, 0},
+  {99, 1, 2122, 0},
+  {105, 1, 2123, 0},
+  {109, 1, 2124, 0},
+  {97, 1, 2125, 0},
+  {97, 1, 2126, 0},
+  {121, 0, 0, 117},
+  {97, 1, 2127, 0},
+  {101, 0, 0, 118},
+  {114, 3, 2128, 0},
+  {114, 0, 0, 119},
+  {112, 1, 2131, 0},
+  {99, 1, 2132, 0},
+  {100, 1, 2133, 0},
+  {105, 1, 2134, 0},
+  {100, 1, 2135, 0},
+  {114, 0, 0, 120},
+  {112, 1, 2136, 0},
+  {99, 1, 2137, 0},
+  {114, 0, 0, 121},
+  {112, 1, 2138, 0},
+  {99, 1, 2139, 0},
+  {99, 1, 2140, 0},
+  {99, 1, 2141, 0},
+  {99, 1, 2142, 0},
+  {99, 1, 2143, 0},
+  {105, 1, 2144, 0},
+  {121, 0, 0, 122},
+  {114, 0, 0, 123},
+  {112, 1, 2145, 0},
+  {99, 1, 2146, 0},
+  {109, 1, 2147, 0},
+  {99, 1, 2148, 0},
+  {99, 1, 2149, 0},
+  {97, 1, 2150, 0},
+  {121, 0, 0, 124},
+  {111, 1, 2151, 0},
+  {114, 1, 2152, 0},
+  {116, 1, 2153, 0},
+  {114, 0, 0, 125},
+  {112, 1, 2154, 0},
+  {99, 1, 2155, 0},
+  {99, 1, 2156, 0},
+  {114, 1, 2157, 0},
+  {69, 0, 0, 126},
+  {100, 0, 0, 127},
+  {105, 1, 2158, 0},
+  {117, 1, 2159, 0},
+  {121, 0, 0, 128},
+  {108, 1, 2160, 0},
+  {114, 0, 0, 129},
+  {114, 1, 2161, 0},
+  {101, 2, 2162, 0},
+  {112, 1, 2164, 0},
+  {97, 2, 2165, 0},
+  {112, 0, 0, 130},
+  {100, 4, 2167, 131},
+  {103, 6, 2171, 132},
+  {103, 1, 2177, 0},
+  {112, 1, 2178, 0},
+  {69, 0, 0, 133},
+  {97, 1, 2179, 0},
+  {101, 0, 0, 134},
+  {105, 1, 2180, 0},
+  {111, 1, 2181, 0},
+  {112, 1, 2182, 0},
+  {105, 1, 2183, 0},
+  {99, 1, 2184, 0},
+  {116, 0, 0, 135},
+  {121, 1, 2185, 0},
+  {105, 1, 2186, 0},
+  {109, 1, 2187, 0},
+  {99, 1, 2188, 0},
+  {105, 1, 2189, 0},
+  {111, 1, 2190, 0},
+  {99, 1, 2191, 0},
+  {114, 2, 2192, 0},
+  {114, 1, 2194, 0},
+  {111, 1, 2195, 0},
+  {121, 0, 0, 136},
+  {113, 1, 2196, 0},
+  {99, 1, 2197, 0},
+  {109, 1, 2198, 0},
+  {112, 1, 2199, 0},
+  {114, 1, 2200, 0},
+  {116, 3, 2201, 0},
+  {114, 0, 0, 137},
+  {103, 7, 2204, 0},
+  {97, 1, 2211, 0},
+  {97, 2, 2212, 0},
+  {107, 2, 2214, 0},
+  {111, 1, 2216, 0},
+  {101, 1, 2217, 138},
+  {111, 1, 2218, 0},
+  {112, 1, 2219, 0},
+  {116, 1, 2220, 139},
+  {119, 1, 2221, 0},
+  {120, 12, 2222, 0},
+  {114, 1, 2234, 0},
+  {101, 1, 2235, 0},
+  {118, 1, 2236, 0},
+  {99, 1, 2237, 0},
+  {101, 1, 2238, 0},
+  {105, 1, 2239, 0},
+  {111, 1, 2240, 0},
+  {108, 1, 2241, 0},
+  {109, 1, 2242, 0},
+  {99, 1, 2243, 0},
+  {112, 5, 2244, 140},
+  {114, 2, 2249, 0},
+  {97, 2, 2251, 0},
+  {101, 1, 2253, 0},
+  {105, 1, 2254, 0},
+  {117, 1, 2255, 0},
+  {111, 1, 2256, 0},
+  {100, 1, 2257, 0},
+  {109, 1, 2258, 0},
+  {110, 1, 2259, 0},
+  {114, 0, 0, 141},
+  {99, 1, 2260, 0},
+  {101, 1, 2261, 0},
+  {105, 0, 0, 142},
+  {114, 6, 2262, 143},
+  {117, 1, 2268, 0},
+  {108, 1, 2269, 0},
+  {109, 2, 2270, 0},
+  {110, 2, 2272, 0},
+  {112, 3, 2274, 0},
+  {97, 1, 2277, 0},
+  {111, 1, 2278, 0},
+  {99, 1, 2279, 0},
+  {117, 2, 2280, 0},
+  {100, 1, 2282, 0},
+  {100, 1, 2283, 0},
+  {101, 2, 2284, 0},
+  {108, 1, 2286, 0},
+  {112, 5, 2287, 144},
+  {114, 4, 2292, 0},
+  {118, 1, 2296, 0},
+  {119, 1, 2297, 0},
+  {99, 1, 2298, 0},
+  {105, 1, 2299, 0},
+  {108, 1, 2300, 0},
+  {114, 1, 2301, 0},
+  {97, 1, 2302, 0},
+  {103, 1, 2303, 0},
+  {108, 1, 2304, 0},
+  {114, 1, 2305, 0},
+  {115, 1, 2306, 0},
+  {107, 1, 2307, 0},
+  {108, 1, 2308, 0},
+  {97, 1, 2309, 0},
+  {121, 0, 0, 145},
+  {97, 2, 2310, 0},
+  {111, 1, 2312, 0},
+  {103, 0, 0, 146},
+  {108, 1, 2313, 0},
+  {109, 1, 2314, 0},
+  {105, 1, 2315, 0},
+  {114, 0, 0, 147},
+  {97, 1, 2316, 0},
+  {97, 1, 2317, 0},
+  {101, 0, 0, 148},
+  {103, 1, 2318, 0},
+  {115, 1, 2319, 0},
+  {118, 2, 2320, 149},
+  {99, 1, 2322, 0},
+  {99, 2, 2323, 0},
+  {108, 1, 2325, 0},
+  {112, 1, 2326, 0},
+  {116, 4, 2327, 150},
+  {117, 1, 2331, 0},
+  {119, 1, 2332, 0},
+  {98, 1, 2333, 0},
+  {99, 2, 2334, 0},
+  {99, 2, 2336, 0},
+  {111, 1, 2338, 0},
+  {116, 1, 2339, 0},
+  {100, 1, 2340, 0},
+  {114, 1, 2341, 0},
+  {97, 1, 2342, 0},
+  {104, 1, 2343, 0},
+  {97, 1, 2344, 0},
+  {99, 1, 2345, 0},
+  {105, 1, 2346, 0},
+  {68, 1, 2347, 0},
+  {111, 1, 2348, 0},
+  {99, 1, 2349, 0},
+  {115, 1, 2350, 0},
+  {97, 1, 2351, 0},
+  {105, 1, 2352, 0},
+  {111, 1, 2353, 0},
+  {121, 0, 0, 151},
+  {111, 1, 2354, 0},
+  {68, 1, 2355, 0},
+  {114, 0, 0, 152},
+  {114, 1, 2356, 0},
+  {115, 1, 2357, 153},
+  {105, 1, 2358, 0},
+  {108, 0, 0, 154},
+  {115, 1, 2359, 155},
+  {97, 1, 2360, 0},
+  {112, 1, 2361, 0},
+  {115, 1, 2362, 0},
+  {103, 0, 0, 156},
+  {115, 1, 2363, 0},
+  {103, 1, 2364, 0},
+  {112, 1, 2365, 0},
+  {97, 1, 2366, 0},
+  {108, 1, 2367, 0},
+  {115, 1, 2368, 0},
+  {99, 2, 2369, 0},
+  {115, 2, 2371, 0},
+  {117, 3, 2373, 0},
+  {118, 1, 2376, 0},
+  {68, 1, 2377, 0},
+  {97, 1, 2378, 0},
+  {99, 1, 2379, 0},
+  {100, 1, 2380, 0},
+  {105, 1, 2381, 0},
+  {97, 0, 0, 157},
+  {104, 0, 0, 158},
+  {109, 1, 2382, 0},
+  {114, 1, 2383, 0},
+  {99, 1, 2384, 0},
+  {105, 1, 2385, 0},
+  {112, 2, 2386, 0},
+  {108, 1, 2388, 0},
+  {121, 0, 0, 159},
+  {109, 1, 2389, 0},
+  {105, 1, 2390, 0},
+  {108, 2, 2391, 0},
+  {114, 0, 0, 160},
+  {108, 1, 2393, 0},
+  {108, 1, 2394, 0},
+  {97, 1, 2395, 0},
+  {108, 1, 2396, 0},
+  {116, 1, 2397, 0},
+  {111, 1, 2398, 0},
+  {112, 1, 2399, 0},
+  {114, 2, 2400, 0},
+  {97, 1, 2402, 0},
+  {97, 2, 2403, 0},
+  {111, 1, 2405, 0},
+  {99, 1, 2406, 0},
+  {108, 0, 0, 161},
+  {99, 1, 2407, 0},
+  {109, 1, 2408, 0},
+  {112, 0, 0, 162},
+  {114, 1, 2409, 0},
+  {105, 1, 2410, 0},
+  {121, 0, 0, 163},
+  {111, 1, 2411, 0},
+  {108, 0, 0, 164},
+  {113, 2, 2412, 165},
+  {115, 3, 2414, 166},
+  {114, 0, 0, 167},
+  {103, 0, 0, 168},
+  {109, 1, 2417, 0},
+  {99, 1, 2418, 0},
+  {69, 0, 0, 169},
+  {97, 0, 0, 170},
+  {106, 0, 0, 171},
+  {69, 0, 0, 172},
+  {97, 1, 2419, 0},
+  {101, 1, 2420, 173},
+  {115, 1, 2421, 0},
+  {112, 1, 2422, 0},
+  {97, 1, 2423, 0},
+  {99, 1, 2424, 0},
+  {105, 1, 2425, 0},
+  {99, 2, 2426, 0},
+  {100, 1, 2428, 0},
+  {108, 1, 2429, 0},
+  {113, 1, 2430, 0},
+  {114, 5, 2431, 0},
+  {101, 1, 2436, 0},
+  {110, 1, 2437, 0},
+  {114, 1, 2438, 0},
+  {105, 1, 2439, 0},
+  {108, 1, 2440, 0},
+  {109, 1, 2441, 0},
+  {114, 2, 2442, 0},
+  {97, 1, 2444, 0},
+  {105, 1, 2445, 0},
+  {97, 1, 2446, 0},
+  {108, 1, 2447, 0},
+  {114, 1, 2448, 0},
+  {114, 0, 0, 174},
+  {115, 2, 2449, 0},
+  {97, 1, 2451, 0},
+  {109, 1, 2452, 0},
+  {111, 1, 2453, 0},
+  {112, 1, 2454, 0},
+  {114, 1, 2455, 0},
+  {99, 1, 2456, 0},
+  {108, 1, 2457, 0},
+  {116, 1, 2458, 0},
+  {98, 1, 2459, 0},
+  {112, 1, 2460, 0},
+  {99, 1, 2461, 0},
+  {105, 1, 2462, 0},
+  {121, 0, 0, 175},
+  {99, 1, 2463, 0},
+  {120, 1, 2464, 0},
+  {102, 0, 0, 176},
+  {114, 0, 0, 177},
+  {114, 1, 2465, 0},
+  {105, 2, 2466, 0},
+  {110, 1, 2468, 0},
+  {111, 1, 2469, 0},
+  {108, 1, 2470, 0},
+  {97, 3, 2471, 0},
+  {111, 1, 2474, 0},
+  {112, 1, 2475, 0},
+  {99, 1, 2476, 0},
+  {102, 1, 2477, 0},
+  {111, 1, 2478, 0},
+  {116, 4, 2479, 178},
+  {99, 1, 2483, 0},
+  {103, 1, 2484, 0},
+  {112, 1, 2485, 0},
+  {116, 1, 2486, 0},
+  {114, 1, 2487, 0},
+  {117, 1, 2488, 0},
+  {99, 1, 2489, 0},
+  {105, 1, 2490, 0},
+  {105, 1, 2491, 0},
+  {107, 1, 2492, 0},
+  {109, 1, 2493, 0},
+  {105, 1, 2494, 0},
+  {121, 0, 0, 179},
+  {114, 0, 0, 180},
+  {97, 1, 2495, 0},
+  {112, 1, 2496, 0},
+  {99, 1, 2497, 0},
+  {101, 1, 2498, 0},
+  {107, 1, 2499, 0},
+  {112, 1, 2500, 0},
+  {101, 1, 2501, 0},
+  {121, 0, 0, 181},
+  {114, 0, 0, 182},
+  {114, 1, 2502, 0},
+  {99, 1, 2503, 0},
+  {99, 1, 2504, 0},
+  {112, 1, 2505, 0},
+  {99, 1, 2506, 0},
+  {97, 1, 2507, 0},
+  {114, 1, 2508, 0},
+  {116, 1, 2509, 0},
+  {97, 1, 2510, 0},
+  {103, 0, 0, 183},
+  {97, 1, 2511, 0},
+  {99, 1, 2512, 0},
+  {101, 1, 2513, 0},
+  {103, 1, 2514, 0},
+  {109, 1, 2515, 0},
+  {110, 1, 2516, 0},
+  {112, 0, 0, 184},
+  {113, 1, 2517, 0},
+  {114, 1, 2518, 0},
+  {116, 2, 2519, 185},
+  {97, 1, 2521, 0},
+  {98, 1, 2522, 0},
+  {114, 2, 2523, 0},
+  {97, 1, 2525, 0},
+  {101, 2, 2526, 0},
+  {117, 1, 2528, 0},
+  {121, 0, 0, 186},
+  {99, 1, 2529, 0},
+  {113, 1, 2530, 0},
+  {114, 2, 2531, 0},
+  {115, 1, 2533, 0},
+  {102, 1, 2534, 0},
+  {103, 0, 0, 187},
+  {113, 2, 2535, 188},
+  {115, 4, 2537, 189},
+  {105, 1, 2541, 0},
+  {108, 1, 2542, 0},
+  {114, 0, 0, 190},
+  {69, 0, 0, 191},
+  {97, 1, 2543, 0},
+  {98, 1, 2544, 0},
+  {99, 1, 2545, 0},
+  {97, 1, 2546, 0},
+  {99, 1, 2547, 0},
+  {104, 1, 2548, 0},
+  {116, 1, 2549, 0},
+  {105, 1, 2550, 0},
+  {111, 1, 2551, 0},
+  {69, 0, 0, 192},
+  {97, 1, 2552, 0},
+  {101, 1, 2553, 193},
+  {115, 1, 2554, 0},
+  {97, 2, 2555, 0},
+  {98, 1, 2557, 0},
+  {110, 1, 2558, 0},
+  {111, 1, 2559, 0},
+  {112, 3, 2560, 0},
+  {116, 1, 2563, 0},
+  {119, 2, 2564, 0},
+  {122, 2, 2566, 194},
+  {97, 1, 2568, 0},
+  {97, 1, 2569, 0},
+  {99, 1, 2570, 0},
+  {104, 1, 2571, 0},
+  {109, 0, 0, 195},
+  {116, 1, 2572, 0},
+  {97, 1, 2573, 0},
+  {99, 1, 2574, 0},
+  {104, 0, 0, 196},
+  {105, 1, 2575, 0},
+  {113, 2, 2576, 0},
+  {116, 1, 2578, 0},
+  {99, 2, 2579, 0},
+  {100, 1, 2581, 0},
+  {104, 1, 2582, 0},
+  {105, 1, 2583, 0},
+  {108, 1, 2584, 0},
+  {113, 1, 2585, 0},
+  {114, 2, 2586, 0},
+  {114, 2, 2588, 0},
+  {101, 1, 2590, 0},
+  {110, 1, 2591, 0},
+  {68, 1, 2592, 0},
+  {99, 1, 2593, 0},
+  {108, 2, 2594, 0},
+  {112, 1, 2596, 197},
+  {114, 1, 2597, 0},
+  {111, 1, 2598, 0},
+  {121, 0, 0, 198},
+  {97, 1, 2599, 0},
+  {97, 1, 2600, 0},
+  {114, 0, 0, 199},
+  {111, 0, 0, 200},
+  {99, 1, 2601, 0},
+  {100, 3, 2602, 201},
+  {110, 1, 2605, 0},
+  {99, 1, 2606, 0},
+  {100, 1, 2607, 0},
+  {112, 1, 2608, 0},
+  {100, 1, 2609, 0},
+  {112, 1, 2610, 0},
+  {99, 1, 2611, 0},
+  {116, 1, 2612, 0},
+  {108, 1, 2613, 0},
+  {109, 1, 2614, 0},
+  {103, 0, 0, 202},
+  {116, 1, 2615, 203},
+  {101, 1, 2616, 0},
+  {108, 0, 0, 204},
+  {116, 1, 2617, 205},
+  {105, 1, 2618, 0},
+  {68, 1, 2619, 0},
+  {100, 1, 2620, 0},
+  {98, 1, 2621, 0},
+  {99, 1, 2622, 0},
+  {110, 1, 2623, 0},
+  {112, 4, 2624, 206},
+  {116, 1, 2628, 0},
+  {115, 1, 2629, 0},
+  {117, 1, 2630, 0},
+  {97, 2, 2631, 0},
+  {101, 1, 2633, 0},
+  {111, 1, 2634, 0},
+  {117, 1, 2635, 0},
+  {121, 0, 0, 207},
+  {97, 1, 2636, 0},
+  {65, 1, 2637, 0},
+  {97, 1, 2638, 0},
+  {100, 1, 2639, 0},
+  {113, 1, 2640, 0},
+  {115, 2, 2641, 0},
+  {120, 1, 2643, 0},
+  {114, 0, 0, 208},
+  {69, 0, 0, 209},
+  {101, 2, 2644, 210},
+  {115, 1, 2646, 0},
+  {116, 1, 2647, 211},
+  {65, 1, 2648, 0},
+  {97, 1, 2649, 0},
+  {112, 1, 2650, 0},
+  {115, 1, 2651, 212},
+  {118, 0, 0, 213},
+  {99, 1, 2652, 0},
+  {65, 1, 2653, 0},
+  {69, 0, 0, 214},
+  {97, 1, 2654, 0},
+  {100, 1, 2655, 0},
+  {101, 3, 2656, 215},
+  {115, 1, 2659, 0},
+  {116, 1, 2660, 216},
+  {105, 1, 2661, 0},
+  {112, 1, 2662, 0},
+  {116, 2, 2663, 217},
+  {97, 1, 2665, 0},
+  {111, 1, 2666, 0},
+  {114, 2, 2667, 218},
+  {65, 1, 2669, 0},
+  {97, 1, 2670, 0},
+  {105, 1, 2671, 0},
+  {116, 1, 2672, 0},
+  {99, 3, 2673, 219},
+  {104, 1, 2676, 0},
+  {105, 1, 2677, 0},
+  {109, 1, 2678, 0},
+  {112, 1, 2679, 0},
+  {113, 1, 2680, 0},
+  {117, 3, 2681, 0},
+  {103, 1, 2684, 0},
+  {105, 1, 2685, 0},
+  {108, 1, 2686, 0},
+  {114, 1, 2687, 0},
+  {109, 2, 2688, 220},
+  {68, 1, 2690, 0},
+  {72, 1, 2691, 0},
+  {97, 1, 2692, 0},
+  {100, 1, 2693, 0},
+  {103, 2, 2694, 0},
+  {105, 1, 2696, 0},
+  {108, 3, 2697, 0},
+  {114, 2, 2700, 0},
+  {115, 1, 2702, 0},
+  {65, 1, 2703, 0},
+  {97, 1, 2704, 0},
+  {110, 1, 2705, 0},
+  {99, 1, 2706, 0},
+  {115, 1, 2707, 0},
+  {105, 1, 2708, 0},
+  {121, 0, 0, 221},
+  {97, 1, 2709, 0},
+  {98, 1, 2710, 0},
+  {105, 1, 2711, 0},
+  {111, 1, 2712, 0},
+  {115, 1, 2713, 0},
+  {108, 1, 2714, 0},
+  {99, 1, 2715, 0},
+  {114, 0, 0, 222},
+  {111, 1, 2716, 0},
+  {114, 1, 2717, 0},
+  {116, 0, 0, 223},
+  {98, 1, 2718, 0},
+  {109, 0, 0, 224},
+  {110, 1, 2719, 0},
+  {97, 1, 2720, 0},
+  {99, 2, 2721, 0},
+  {105, 1, 2723, 0},
+  {116, 0, 0, 225},
+  {97, 1, 2724, 0},
+  {101, 1, 2725, 0},
+  {105, 3, 2726, 0},
+  {112, 1, 2729, 0},
+  {97, 1, 2730, 0},
+  {101, 1, 2731, 0},
+  {108, 1, 2732, 0},
+  {97, 1, 2733, 0},
+  {100, 3, 2734, 226},
+  {105, 1, 2737, 0},
+  {111, 1, 2738, 0},
+  {115, 1, 2739, 0},
+  {118, 0, 0, 227},
+  {99, 1, 2740, 0},
+  {108, 1, 2741, 0},
+  {111, 1, 2742, 0},
+  {105, 2, 2743, 0},
+  {109, 1, 2745, 0},
+  {98, 1, 2746, 0},
+  {114, 3, 2747, 228},
+  {121, 0, 0, 229},
+  {114, 5, 2750, 0},
+  {114, 0, 0, 230},
+  {105, 1, 2755, 231},
+  {109, 1, 2756, 0},
+  {111, 1, 2757, 0},
+  {116, 1, 2758, 0},
+  {118, 0, 0, 232},
+  {97, 1, 2759, 0},
+  {117, 1, 2760, 0},
+  {105, 1, 2761, 0},
+  {112, 1, 2762, 0},
+  {117, 1, 2763, 0},
+  {69, 0, 0, 233},
+  {97, 1, 2764, 0},
+  {99, 1, 2765, 0},
+  {101, 1, 2766, 234},
+  {105, 1, 2767, 0},
+  {110, 3, 2768, 0},
+  {111, 3, 2771, 0},
+  {115, 1, 2774, 0},
+  {117, 1, 2775, 0},
+  {99, 1, 2776, 0},
+  {105, 0, 0, 235},
+  {110, 1, 2777, 0},
+  {114, 0, 0, 236},
+  {110, 1, 2778, 0},
+  {112, 1, 2779, 0},
+  {114, 1, 2780, 0},
+  {99, 1, 2781, 0},
+  {97, 1, 2782, 0},
+  {101, 1, 2783, 0},
+  {111, 1, 2784, 0},
+  {97, 1, 2785, 0},
+  {114, 1, 2786, 0},
+  {116, 1, 2787, 0},
+  {97, 1, 2788, 0},
+  {97, 1, 2789, 0},
+  {99, 2, 2790, 0},
+  {100, 1, 2792, 0},
+  {101, 1, 2793, 0},
+  {110, 1, 2794, 0},
+  {113, 1, 2795, 0},
+  {114, 1, 2796, 0},
+  {116, 2, 2797, 0},
+  {97, 1, 2799, 0},
+  {98, 1, 2800, 0},
+  {114, 2, 2801, 0},
+  {97, 1, 2803, 0},
+  {101, 2, 2804, 0},
+  {117, 1, 2806, 0},
+  {121, 0, 0, 237},
+  {99, 1, 2807, 0},
+  {108, 1, 2808, 0},
+  {113, 1, 2809, 0},
+  {115, 1, 2810, 0},
+  {97, 1, 2811, 0},
+  {99, 1, 2812, 0},
+  {103, 0, 0, 238},
+  {105, 1, 2813, 0},
+  {108, 1, 2814, 0},
+  {114, 0, 0, 239},
+  {97, 1, 2815, 0},
+  {111, 1, 2816, 240},
+  {103, 1, 2817, 0},
+  {110, 1, 2818, 0},
+  {115, 1, 2819, 0},
+  {97, 1, 2820, 0},
+  {104, 1, 2821, 0},
+  {109, 0, 0, 241},
+  {111, 1, 2822, 0},
+  {109, 1, 2823, 0},
+  {97, 2, 2824, 0},
+  {98, 1, 2826, 0},
+  {112, 3, 2827, 0},
+  {116, 1, 2830, 0},
+  {97, 1, 2831, 0},
+  {112, 1, 2832, 0},
+  {97, 1, 2833, 0},
+  {97, 1, 2834, 0},
+  {99, 1, 2835, 0},
+  {104, 0, 0, 242},
+  {113, 2, 2836, 0},
+  {104, 1, 2838, 0},
+  {105, 1, 2839, 0},
+  {114, 1, 2840, 0},
+  {108, 1, 2841, 0},
+  {99, 1, 2842, 0},
+  {113, 1, 2843, 0},
+  {69, 0, 0, 243},
+  {97, 2, 2844, 0},
+  {99, 1, 2846, 0},
+  {101, 1, 2847, 244},
+  {105, 1, 2848, 0},
+  {110, 3, 2849, 0},
+  {112, 1, 2852, 0},
+  {115, 1, 2853, 0},
+  {121, 0, 0, 245},
+  {111, 1, 2854, 0},
+  {65, 1, 2855, 0},
+  {97, 1, 2856, 0},
+  {99, 1, 2857, 0},
+  {109, 1, 2858, 0},
+  {115, 1, 2859, 0},
+  {116, 1, 2860, 0},
+  {120, 1, 2861, 0},
+  {114, 1, 2862, 246},
+  {97, 1, 2863, 0},
+  {99, 2, 2864, 0},
+  {111, 1, 2866, 0},
+  {121, 0, 0, 247},
+  {103, 1, 2867, 0},
+  {109, 7, 2868, 248},
+  {97, 1, 2875, 0},
+  {97, 2, 2876, 0},
+  {101, 1, 2878, 0},
+  {105, 2, 2879, 0},
+  {116, 1, 2881, 249},
+  {102, 1, 2882, 0},
+  {108, 1, 2883, 250},
+  {112, 1, 2884, 0},
+  {97, 2, 2885, 0},
+  {99, 2, 2887, 0},
+  {115, 1, 2889, 0},
+  {117, 2, 2890, 251},
+  {97, 1, 2892, 0},
+  {99, 1, 2893, 0},
+  {101, 1, 2894, 0},
+  {109, 1, 2895, 0},
+  {116, 1, 2896, 0},
+  {97, 1, 2897, 0},
+  {114, 2, 2898, 0},
+  {98, 8, 2900, 252},
+  {99, 1, 2908, 0},
+  {109, 0, 0, 253},
+  {110, 1, 2909, 0},
+  {112, 12, 2910, 254},
+  {65, 1, 2922, 0},
+  {97, 1, 2923, 0},
+  {110, 1, 2924, 0},
+  {108, 1, 2925, 0},
+  {114, 1, 2926, 0},
+  {117, 0, 0, 255},
+  {114, 1, 2927, 0},
+  {97, 1, 2928, 0},
+  {101, 1, 2929, 0},
+  {121, 0, 0, 256},
+  {111, 1, 2930, 0},
+  {108, 1, 2931, 0},
+  {114, 0, 0, 257},
+  {101, 2, 2932, 0},
+  {105, 2, 2934, 0},
+  {107, 2, 2936, 0},
+  {111, 1, 2938, 0},
+  {108, 1, 2939, 0},
+  {109, 1, 2940, 0},
+  {110, 1, 2941, 0},
+  {101, 1, 2942, 0},
+  {112, 3, 2943, 258},
+  {115, 1, 2946, 0},
+  {114, 1, 2947, 0},
+  {97, 1, 2948, 0},
+  {105, 7, 2949, 0},
+  {112, 1, 2956, 0},
+  {99, 2, 2957, 0},
+  {104, 1, 2959, 0},
+  {116, 1, 2960, 0},
+  {105, 1, 2961, 0},
+  {111, 1, 2962, 0},
+  {114, 1, 2963, 0},
+  {97, 1, 2964, 0},
+  {99, 1, 2965, 0},
+  {114, 1, 2966, 0},
+  {114, 2, 2967, 0},
+  {105, 1, 2969, 0},
+  {121, 0, 0, 259},
+  {97, 1, 2970, 0},
+  {98, 1, 2971, 0},
+  {104, 1, 2972, 0},
+  {105, 1, 2973, 0},
+  {114, 0, 0, 260},
+  {114, 1, 2974, 0},
+  {97, 1, 2975, 0},
+  {98, 1, 2976, 0},
+  {99, 2, 2977, 0},
+  {116, 1, 2979, 0},
+  {97, 1, 2980, 0},
+  {108, 0, 0, 261},
+  {103, 1, 2981, 0},
+  {112, 1, 2982, 0},
+  {97, 1, 2983, 0},
+  {100, 1, 2984, 0},
+  {104, 1, 2985, 0},
+  {108, 1, 2986, 0},
+  {115, 1, 2987, 0},
+  {117, 1, 2988, 0},
+  {99, 2, 2989, 0},
+  {105, 1, 2991, 0},
+  {116, 1, 2992, 0},
+  {99, 1, 2993, 0},
+  {100, 1, 2994, 0},
+  {105, 1, 2995, 0},
+  {114, 1, 2996, 0},
+  {97, 1, 2997, 0},
+  {109, 1, 2998, 0},
+  {97, 1, 2999, 0},
+  {114, 1, 3000, 0},
+  {97, 1, 3001, 0},
+  {97, 1, 3002, 0},
+  {110, 1, 3003, 0},
+  {114, 7, 3004, 0},
+  {121, 0, 0, 262},
+  {97, 1, 3011, 0},
+  {101, 2, 3012, 263},
+  {108, 1, 3014, 0},
+  {114, 2, 3015, 0},
+  {114, 0, 0, 264},
+  {116, 1, 3017, 0},
+  {115, 1, 3018, 0},
+  {112, 1, 3019, 0},
+  {114, 1, 3020, 0},
+  {116, 1, 3021, 0},
+  {99, 1, 3022, 0},
+  {117, 2, 3023, 0},
+  {105, 1, 3025, 0},
+  {105, 1, 3026, 0},
+  {100, 2, 3027, 0},
+  {105, 1, 3029, 0},
+  {114, 0, 0, 265},
+  {112, 1, 3030, 0},
+  {101, 1, 3031, 0},
+  {99, 1, 3032, 0},
+  {97, 1, 3033, 0},
+  {105, 1, 3034, 0},
+  {117, 1, 3035, 0},
+  {116, 1, 3036, 0},
+  {114, 0, 0, 266},
+  {65, 1, 3037, 0},
+  {97, 1, 3038, 0},
+  {65, 1, 3039, 0},
+  {97, 1, 3040, 0},
+  {97, 1, 3041, 0},
+  {105, 1, 3042, 0},
+  {100, 1, 3043, 0},
+  {112, 2, 3044, 0},
+  {116, 1, 3046, 0},
+  {65, 1, 3047, 0},
+  {97, 1, 3048, 0},
+  {99, 1, 3049, 0},
+  {113, 1, 3050, 0},
+  {112, 1, 3051, 0},
+  {116, 1, 3052, 0},
+  {101, 1, 3053, 0},
+  {101, 1, 3054, 0},
+  {99, 2, 3055, 0},
+  {105, 1, 3057, 0},
+  {121, 0, 0, 267},
+  {110, 0, 0, 268},
+  {114, 0, 0, 269},
+  {99, 1, 3058, 0},
+  {112, 1, 3059, 0},
+  {99, 1, 3060, 0},
+  {99, 1, 3061, 0},
+  {109, 1, 3062, 0},
+  {99, 1, 3063, 0},
+  {97, 1, 3064, 0},
+  {121, 0, 0, 270},
+  {111, 1, 3065, 0},
+  {101, 1, 3066, 0},
+  {116, 1, 3067, 0},
+  {114, 0, 0, 271},
+  {99, 1, 3068, 0},
+  {103, 1, 3069, 0},
+  {112, 1, 3070, 0},
+  {99, 1, 3071, 0},
+  {106, 0, 0, 272},
+  {110, 1, 3072, 0},
+  {105, 1, 3073, 0},
+  {117, 1, 3074, 0},
+  {101, 1, 3075, 0},
+  {114, 1, 3076, 0},
+  {97, 1, 3077, 0},
+  {104, 1, 3078, 0},
+  {99, 1, 3079, 0},
+  {111, 1, 3080, 0},
+  {102, 0, 0, 273},
+  {108, 1, 3081, 0},
+  {110, 1, 3082, 0},
+  {114, 0, 0, 274},
+  {105, 1, 3083, 0},
+  {108, 1, 3084, 0},
+  {108, 0, 0, 275},
+  {107, 1, 3085, 0},
+  {118, 0, 0, 276},
+  {119, 1, 3086, 0},
+  {97, 1, 3087, 0},
+  {110, 1, 3088, 0},
+  {97, 0, 0, 277},
+  {102, 0, 0, 278},
+  {118, 1, 3089, 0},
+  {114, 0, 0, 279},
+  {112, 1, 3090, 0},
+  {121, 0, 0, 280},
+  {89, 0, 0, 281},
+  {117, 1, 3091, 0},
+  {105, 1, 3092, 0},
+  {108, 1, 3093, 0},
+  {114, 1, 3094, 0},
+  {100, 1, 3095, 0},
+  {114, 1, 3096, 0},
+  {110, 1, 3097, 0},
+  {116, 0, 0, 282},
+  {105, 1, 3098, 0},
+  {116, 1, 3099, 0},
+  {99, 1, 3100, 0},
+  {99, 1, 3101, 0},
+  {115, 1, 3102, 0},
+  {111, 1, 3103, 0},
+  {103, 1, 3104, 0},
+  {105, 1, 3105, 0},
+  {116, 1, 3106, 0},
+  {102, 0, 0, 283},
+  {114, 1, 3107, 0},
+  {110, 1, 3108, 0},
+  {115, 1, 3109, 0},
+  {114, 0, 0, 284},
+  {67, 1, 3110, 0},
+  {116, 1, 3111, 0},
+  {121, 0, 0, 285},
+  {121, 0, 0, 286},
+  {121, 0, 0, 287},
+  {103, 1, 3112, 0},
+  {114, 0, 0, 288},
+  {104, 1, 3113, 0},
+  {114, 1, 3114, 0},
+  {116, 1, 3115, 0},
+  {99, 1, 3116, 0},
+  {109, 1, 3117, 0},
+  {102, 1, 3118, 0},
+  {102, 0, 0, 289},
+  {68, 1, 3119, 0},
+  {69, 1, 3120, 0},
+  {98, 1, 3121, 0},
+  {110, 6, 3122, 0},
+  {114, 0, 0, 290},
+  {114, 1, 3128, 0},
+  {117, 1, 3129, 0},
+  {114, 1, 3130, 0},
+  {114, 1, 3131, 0},
+  {116, 0, 0, 291},
+  {97, 1, 3132, 0},
+  {109, 1, 3133, 0},
+  {99, 1, 3134, 0},
+  {116, 1, 3135, 0},
+  {111, 1, 3136, 0},
+  {102, 0, 0, 292},
+  {105, 1, 3137, 0},
+  {97, 1, 3138, 0},
+  {105, 1, 3139, 0},
+  {114, 0, 0, 293},
+  {109, 0, 0, 294},
+  {108, 0, 0, 295},
+  {115, 1, 3140, 0},
+  {111, 1, 3141, 0},
+  {108, 1, 3142, 0},
+  {102, 0, 0, 296},
+  {65, 1, 3143, 0},
+  {114, 1, 3144, 0},
+  {114, 0, 0, 297},
+  {121, 0, 0, 298},
+  {109, 1, 3145, 0},
+  {101, 1, 3146, 0},
+  {100, 1, 3147, 0},
+  {114, 1, 3148, 0},
+  {116, 0, 0, 299},
+  {102, 0, 0, 300},
+  {97, 1, 3149, 0},
+  {114, 0, 0, 301},
+  {68, 1, 3150, 0},
+  {101, 1, 3151, 0},
+  {114, 1, 3152, 0},
+  {98, 1, 3153, 0},
+  {102, 0, 0, 302},
+  {105, 1, 3154, 0},
+  {114, 0, 0, 303},
+  {114, 1, 3155, 0},
+  {112, 2, 3156, 0},
+  {121, 0, 0, 304},
+  {105, 1, 3158, 0},
+  {121, 0, 0, 305},
+  {117, 1, 3159, 0},
+  {114, 1, 3160, 0},
+  {116, 0, 0, 306},
+  {97, 1, 3161, 0},
+  {99, 1, 3162, 0},
+  {103, 1, 3163, 0},
+  {108, 1, 3164, 0},
+  {101, 2, 3165, 0},
+  {105, 1, 3167, 0},
+  {111, 1, 3168, 0},
+  {102, 0, 0, 307},
+  {97, 0, 0, 308},
+  {114, 0, 0, 309},
+  {108, 1, 3169, 0},
+  {99, 1, 3170, 0},
+  {108, 0, 0, 310},
+  {114, 1, 3171, 0},
+  {102, 0, 0, 311},
+  {114, 0, 0, 312},
+  {114, 1, 3172, 0},
+  {99, 1, 3173, 0},
+  {121, 0, 0, 313},
+  {121, 0, 0, 314},
+  {112, 1, 3174, 0},
+  {100, 1, 3175, 0},
+  {102, 0, 0, 315},
+  {114, 0, 0, 316},
+  {121, 0, 0, 317},
+  {117, 1, 3176, 0},
+  {98, 1, 3177, 0},
+  {103, 0, 0, 318},
+  {108, 1, 3178, 0},
+  {114, 0, 0, 319},
+  {114, 1, 3179, 0},
+  {100, 1, 3180, 0},
+  {116, 10, 3181, 0},
+  {115, 6, 3191, 0},
+  {102, 1, 3197, 0},
+  {100, 1, 3198, 0},
+  {103, 4, 3199, 0},
+  {102, 0, 0, 320},
+  {101, 1, 3203, 0},
+  {114, 0, 0, 321},
+  {114, 1, 3204, 0},
+  {105, 1, 3205, 0},
+  {108, 1, 3206, 0},
+  {117, 1, 3207, 0},
+  {102, 0, 0, 322},
+  {114, 0, 0, 323},
+  {121, 0, 0, 324},
+  {117, 1, 3208, 0},
+  {114, 1, 3209, 0},
+  {100, 1, 3210, 0},
+  {97, 1, 3211, 0},
+  {116, 1, 3212, 0},
+  {76, 1, 3213, 0},
+  {114, 1, 3214, 0},
+  {66, 1, 3215, 0},
+  {102, 0, 0, 325},
+  {67, 2, 3216, 0},
+  {68, 1, 3218, 0},
+  {69, 3, 3219, 0},
+  {71, 1, 3222, 0},
+  {72, 1, 3223, 0},
+  {76, 1, 3224, 0},
+  {78, 1, 3225, 0},
+  {80, 1, 3226, 0},
+  {82, 2, 3227, 0},
+  {83, 2, 3229, 0},
+  {84, 1, 3231, 0},
+  {86, 1, 3232, 0},
+  {114, 0, 0, 326},
+  {108, 1, 3233, 0},
+  {105, 1, 3234, 0},
+  {117, 1, 3235, 0},
+  {114, 1, 3236, 0},
+  {108, 1, 3237, 0},
+  {97, 1, 3238, 0},
+  {99, 1, 3239, 0},
+  {103, 1, 3240, 0},
+  {99, 1, 3241, 0},
+  {102, 0, 0, 327},
+  {110, 1, 3242, 0},
+  {114, 0, 0, 328},
+  {97, 1, 3243, 0},
+  {108, 1, 3244, 0},
+  {109, 1, 3245, 0},
+  {108, 0, 0, 329},
+  {114, 2, 3246, 0},
+  {116, 1, 3248, 0},
+  {115, 1, 3249, 0},
+  {110, 1, 3250, 0},
+  {102, 0, 0, 330},
+  {99, 1, 3251, 0},
+  {109, 1, 3252, 0},
+  {100, 1, 3253, 0},
+  {112, 1, 3254, 0},
+  {114, 0, 0, 331},
+  {84, 0, 0, 332},
+  {102, 0, 0, 333},
+  {114, 0, 0, 334},
+  {114, 1, 3255, 0},
+  {117, 1, 3256, 0},
+  {103, 0, 0, 335},
+  {114, 1, 3257, 336},
+  {114, 1, 3258, 0},
+  {100, 1, 3259, 0},
+  {101, 1, 3260, 0},
+  {104, 1, 3261, 0},
+  {102, 0, 0, 337},
+  {110, 1, 3262, 0},
+  {103, 1, 3263, 0},
+  {114, 0, 0, 338},
+  {101, 1, 3264, 0},
+  {72, 1, 3265, 0},
+  {121, 0, 0, 339},
+  {84, 1, 3266, 0},
+  {117, 1, 3267, 0},
+  {114, 1, 3268, 0},
+  {100, 1, 3269, 0},
+  {114, 1, 3270, 0},
+  {114, 1, 3271, 0},
+  {109, 1, 3272, 0},
+  {108, 1, 3273, 0},
+  {102, 0, 0, 340},
+  {116, 0, 0, 341},
+  {97, 1, 3274, 0},
+  {114, 0, 0, 342},
+  {114, 0, 0, 343},
+  {115, 1, 3275, 0},
+  {99, 1, 3276, 0},
+  {104, 1, 3277, 0},
+  {101, 1, 3278, 0},
+  {115, 1, 3279, 0},
+  {82, 1, 3280, 0},
+  {68, 1, 3281, 0},
+  {99, 1, 3282, 0},
+  {121, 0, 0, 344},
+  {114, 1, 3283, 0},
+  {100, 1, 3284, 0},
+  {114, 1, 3285, 0},
+  {116, 1, 3286, 0},
+  {99, 1, 3287, 0},
+  {110, 1, 3288, 0},
+  {100, 1, 3289, 0},
+  {102, 0, 0, 345},
+  {112, 1, 3290, 0},
+  {114, 0, 0, 346},
+  {114, 1, 3291, 0},
+  {117, 1, 3292, 0},
+  {114, 1, 3293, 347},
+  {99, 1, 3294, 0},
+  {101, 1, 3295, 0},
+  {114, 1, 3296, 0},
+  {108, 1, 3297, 0},
+  {97, 1, 3298, 0},
+  {99, 1, 3299, 0},
+  {101, 1, 3300, 0},
+  {111, 1, 3301, 0},
+  {111, 1, 3302, 0},
+  {102, 0, 0, 348},
+  {114, 1, 3303, 0},
+  {111, 1, 3304, 0},
+  {113, 1, 3305, 0},
+  {101, 1, 3306, 0},
+  {114, 1, 3307, 0},
+  {111, 1, 3308, 0},
+  {101, 1, 3309, 0},
+  {105, 1, 3310, 349},
+  {110, 1, 3311, 0},
+  {114, 0, 0, 350},
+  {108, 1, 3312, 0},
+  {108, 0, 0, 351},
+  {115, 1, 3313, 0},
+  {114, 0, 0, 352},
+  {115, 1, 3314, 0},
+  {98, 1, 3315, 0},
+  {116, 1, 3316, 353},
+  {121, 1, 3317, 0},
+  {102, 0, 0, 354},
+  {114, 0, 0, 355},
+  {97, 1, 3318, 0},
+  {114, 1, 3319, 0},
+  {103, 1, 3320, 0},
+  {102, 0, 0, 356},
+  {114, 0, 0, 357},
+  {102, 0, 0, 358},
+  {114, 0, 0, 359},
+  {121, 0, 0, 360},
+  {121, 0, 0, 361},
+  {121, 0, 0, 362},
+  {117, 1, 3321, 0},
+  {114, 1, 3322, 0},
+  {102, 0, 0, 363},
+  {114, 0, 0, 364},
+  {108, 0, 0, 365},
+  {121, 0, 0, 366},
+  {117, 1, 3323, 0},
+  {114, 1, 3324, 0},
+  {116, 0, 0, 367},
+  {111, 1, 3325, 0},
+  {97, 0, 0, 368},
+  {102, 0, 0, 369},
+  {114, 0, 0, 370},
+  {117, 1, 3326, 0},
+  {101, 1, 3327, 0},
+  {114, 1, 3328, 0},
+  {116, 1, 3329, 0},
+  {105, 1, 3330, 0},
+  {97, 1, 3331, 0},
+  {102, 1, 3332, 0},
+  {112, 1, 3333, 0},
+  {104, 1, 3334, 0},
+  {99, 1, 3335, 0},
+  {108, 1, 3336, 0},
+  {97, 1, 3337, 0},
+  {100, 0, 0, 371},
+  {115, 1, 3338, 0},
+  {118, 0, 0, 372},
+  {101, 0, 0, 373},
+  {108, 1, 3339, 0},
+  {109, 1, 3340, 0},
+  {114, 1, 3341, 0},
+  {115, 2, 3342, 0},
+  {122, 1, 3344, 0},
+  {111, 1, 3345, 0},
+  {102, 0, 0, 374},
+  {99, 1, 3346, 0},
+  {100, 0, 0, 375},
+  {115, 0, 0, 376},
+  {114, 1, 3347, 0},
+  {110, 1, 3348, 0},
+  {114, 0, 0, 377},
+  {109, 1, 3349, 0},
+  {108, 1, 3350, 0},
+  {108, 0, 0, 378},
+  {111, 1, 3351, 0},
+  {110, 1, 3352, 0},
+  {116, 0, 0, 379},
+  {107, 4, 3353, 0},
+  {118, 1, 3357, 0},
+  {119, 1, 3358, 0},
+  {107, 1, 3359, 380},
+  {110, 1, 3360, 0},
+  {117, 1, 3361, 0},
+  {97, 1, 3362, 0},
+  {112, 1, 3363, 0},
+  {115, 1, 3364, 0},
+  {110, 1, 3365, 0},
+  {97, 0, 0, 381},
+  {104, 0, 0, 382},
+  {119, 1, 3366, 0},
+  {99, 3, 3367, 0},
+  {111, 3, 3370, 0},
+  {115, 2, 3373, 0},
+  {116, 1, 3375, 0},
+  {117, 1, 3376, 0},
+  {118, 1, 3377, 0},
+  {119, 1, 3378, 0},
+  {114, 1, 3379, 0},
+  {99, 1, 3380, 0},
+  {110, 1, 3381, 0},
+  {49, 2, 3382, 0},
+  {51, 1, 3384, 0},
+  {99, 1, 3385, 0},
+  {113, 1, 3386, 0},
+  {116, 0, 0, 383},
+  {102, 0, 0, 384},
+  {116, 1, 3387, 0},
+  {116, 1, 3388, 0},
+  {68, 4, 3389, 0},
+  {72, 4, 3393, 385},
+  {85, 4, 3397, 0},
+  {86, 6, 3401, 386},
+  {98, 1, 3407, 0},
+  {100, 4, 3408, 0},
+  {104, 4, 3412, 387},
+  {109, 1, 3416, 0},
+  {112, 1, 3417, 0},
+  {116, 1, 3418, 0},
+  {117, 4, 3419, 0},
+  {118, 6, 3423, 388},
+  {105, 1, 3429, 0},
+  {118, 1, 3430, 0},
+  {98, 1, 3431, 0},
+  {114, 0, 0, 389},
+  {109, 1, 3432, 0},
+  {109, 1, 3433, 390},
+  {108, 2, 3434, 391},
+  {108, 1, 3436, 392},
+  {112, 2, 3437, 393},
+  {117, 1, 3439, 0},
+  {97, 1, 3440, 0},
+  {98, 1, 3441, 0},
+  {99, 2, 3442, 0},
+  {100, 1, 3444, 0},
+  {115, 0, 0, 394},
+  {101, 1, 3445, 0},
+  {111, 1, 3446, 0},
+  {112, 1, 3447, 0},
+  {114, 1, 3448, 0},
+  {100, 1, 3449, 0},
+  {114, 1, 3450, 0},
+  {112, 1, 3451, 0},
+  {116, 0, 0, 395},
+  {105, 1, 3452, 0},
+  {112, 1, 3453, 0},
+  {116, 1, 3454, 396},
+  {121, 0, 0, 397},
+  {99, 1, 3455, 0},
+  {69, 0, 0, 398},
+  {99, 2, 3456, 399},
+  {101, 0, 0, 400},
+  {102, 1, 3458, 0},
+  {109, 1, 3459, 0},
+  {115, 1, 3460, 0},
+  {98, 1, 3461, 0},
+  {111, 1, 3462, 0},
+  {109, 1, 3463, 0},
+  {112, 2, 3464, 401},
+  {103, 1, 3466, 402},
+  {105, 1, 3467, 0},
+  {102, 0, 0, 403},
+  {114, 1, 3468, 0},
+  {121, 1, 3469, 404},
+  {114, 1, 3470, 0},
+  {115, 1, 3471, 0},
+  {114, 0, 0, 405},
+  {98, 1, 3472, 406},
+  {112, 1, 3473, 407},
+  {111, 1, 3474, 0},
+  {97, 1, 3475, 0},
+  {112, 1, 3476, 0},
+  {115, 1, 3477, 0},
+  {97, 1, 3478, 0},
+  {98, 1, 3479, 0},
+  {99, 2, 3480, 0},
+  {100, 1, 3482, 0},
+  {111, 1, 3483, 0},
+  {115, 0, 0, 408},
+  {97, 1, 3484, 0},
+  {108, 1, 3485, 0},
+  {114, 1, 3486, 0},
+  {118, 1, 3487, 0},
+  {101, 1, 3488, 0},
+  {101, 1, 3489, 0},
+  {111, 1, 3490, 0},
+  {110, 1, 3491, 0},
+  {99, 1, 3492, 0},
+  {114, 0, 0, 409},
+  {114, 0, 0, 410},
+  {103, 1, 3493, 0},
+  {101, 1, 3494, 0},
+  {114, 0, 0, 411},
+  {104, 1, 3495, 412},
+  {97, 1, 3496, 0},
+  {97, 1, 3497, 0},
+  {114, 1, 3498, 0},
+  {103, 1, 3499, 0},
+  {114, 1, 3500, 0},
+  {116, 1, 3501, 0},
+  {116, 1, 3502, 0},
+  {112, 1, 3503, 0},
+  {115, 1, 3504, 0},
+  {114, 2, 3505, 0},
+  {109, 2, 3507, 413},
+  {97, 1, 3509, 0},
+  {105, 1, 3510, 0},
+  {105, 1, 3511, 0},
+  {111, 1, 3512, 0},
+  {121, 0, 0, 414},
+  {111, 1, 3513, 0},
+  {114, 1, 3514, 0},
+  {108, 1, 3515, 0},
+  {102, 0, 0, 415},
+  {101, 1, 3516, 0},
+  {109, 1, 3517, 0},
+  {112, 1, 3518, 0},
+  {115, 1, 3519, 0},
+  {98, 1, 3520, 0},
+  {110, 3, 3521, 0},
+  {107, 1, 3524, 0},
+  {111, 1, 3525, 0},
+  {114, 1, 3526, 0},
+  {114, 0, 0, 416},
+  {121, 0, 0, 417},
+  {108, 0, 0, 418},
+  {114, 1, 3527, 0},
+  {111, 1, 3528, 0},
+  {105, 1, 3529, 419},
+  {114, 1, 3530, 0},
+  {97, 1, 3531, 0},
+  {110, 1, 3532, 0},
+  {121, 0, 0, 420},
+  {103, 1, 3533, 0},
+  {111, 1, 3534, 0},
+  {116, 0, 0, 421},
+  {117, 1, 3535, 0},
+  {116, 1, 3536, 0},
+  {114, 1, 3537, 0},
+  {114, 1, 3538, 422},
+  {108, 1, 3539, 0},
+  {116, 0, 0, 423},
+  {111, 1, 3540, 0},
+  {97, 1, 3541, 0},
+  {100, 1, 3542, 0},
+  {110, 1, 3543, 0},
+  {100, 1, 3544, 0},
+  {99, 1, 3545, 0},
+  {116, 1, 3546, 0},
+  {112, 1, 3547, 424},
+  {112, 0, 0, 425},
+  {111, 1, 3548, 0},
+  {102, 0, 0, 426},
+  {114, 1, 3549, 427},
+  {117, 1, 3550, 0},
+  {105, 2, 3551, 428},
+  {105, 1, 3553, 0},
+  {111, 1, 3554, 0},
+  {105, 1, 3555, 0},
+  {108, 1, 3556, 0},
+  {97, 1, 3557, 0},
+  {101, 1, 3558, 0},
+  {105, 1, 3559, 0},
+  {112, 1, 3560, 0},
+  {111, 1, 3561, 0},
+  {114, 1, 3562, 0},
+  {114, 0, 0, 429},
+  {111, 1, 3563, 0},
+  {109, 0, 0, 430},
+  {108, 0, 0, 431},
+  {111, 0, 0, 432},
+  {108, 0, 0, 433},
+  {115, 1, 3564, 0},
+  {101, 1, 3565, 0},
+  {111, 1, 3566, 0},
+  {108, 1, 3567, 0},
+  {97, 1, 3568, 0},
+  {108, 1, 3569, 0},
+  {105, 1, 3570, 0},
+  {108, 1, 3571, 0},
+  {105, 1, 3572, 0},
+  {105, 1, 3573, 0},
+  {116, 0, 0, 434},
+  {105, 1, 3574, 0},
+  {110, 1, 3575, 0},
+  {102, 0, 0, 435},
+  {102, 0, 0, 436},
+  {97, 1, 3576, 0},
+  {107, 1, 3577, 437},
+  {114, 1, 3578, 0},
+  {99, 6, 3579, 0},
+  {115, 1, 3585, 0},
+  {119, 1, 3586, 0},
+  {114, 0, 0, 438},
+  {117, 1, 3587, 0},
+  {109, 1, 3588, 0},
+  {101, 1, 3589, 0},
+  {114, 1, 3590, 0},
+  {116, 0, 0, 439},
+  {113, 0, 0, 440},
+  {115, 1, 3591, 0},
+  {99, 1, 3592, 0},
+  {100, 1, 3593, 0},
+  {108, 1, 3594, 441},
+  {101, 1, 3595, 0},
+  {121, 0, 0, 442},
+  {112, 1, 3596, 443},
+  {113, 1, 3597, 444},
+  {105, 1, 3598, 0},
+  {102, 0, 0, 445},
+  {118, 1, 3599, 0},
+  {114, 0, 0, 446},
+  {109, 2, 3600, 447},
+  {99, 0, 0, 448},
+  {105, 1, 3602, 0},
+  {111, 1, 3603, 0},
+  {80, 1, 3604, 0},
+  {117, 1, 3605, 0},
+  {97, 2, 3606, 0},
+  {100, 1, 3608, 0},
+  {101, 1, 3609, 0},
+  {108, 1, 3610, 0},
+  {115, 1, 3611, 0},
+  {114, 1, 3612, 0},
+  {69, 0, 0, 449},
+  {114, 0, 0, 450},
+  {114, 1, 3613, 0},
+  {102, 0, 0, 451},
+  {105, 1, 3614, 0},
+  {100, 1, 3615, 0},
+  {114, 2, 3616, 452},
+  {114, 0, 0, 453},
+  {114, 1, 3618, 0},
+  {114, 1, 3619, 0},
+  {108, 1, 3620, 0},
+  {99, 1, 3621, 0},
+  {101, 1, 3622, 0},
+  {119, 1, 3623, 0},
+  {114, 1, 3624, 0},
+  {116, 1, 3625, 0},
+  {107, 2, 3626, 0},
+  {102, 0, 0, 454},
+  {98, 1, 3628, 0},
+  {114, 0, 0, 455},
+  {97, 1, 3629, 0},
+  {114, 1, 3630, 0},
+  {117, 1, 3631, 0},
+  {104, 1, 3632, 0},
+  {117, 1, 3633, 0},
+  {114, 1, 3634, 0},
+  {121, 0, 0, 456},
+  {99, 1, 3635, 0},
+  {97, 1, 3636, 0},
+  {105, 1, 3637, 0},
+  {110, 1, 3638, 0},
+  {102, 1, 3639, 0},
+  {116, 1, 3640, 0},
+  {105, 1, 3641, 0},
+  {99, 1, 3642, 0},
+  {103, 3, 3643, 0},
+  {116, 1, 3646, 0},
+  {102, 0, 0, 457},
+  {101, 1, 3647, 0},
+  {97, 1, 3648, 0},
+  {105, 1, 3649, 0},
+  {100, 1, 3650, 0},
+  {99, 1, 3651, 0},
+  {101, 2, 3652, 0},
+  {108, 1, 3654, 0},
+  {112, 1, 3655, 0},
+  {121, 0, 0, 458},
+  {111, 1, 3656, 0},
+  {102, 0, 0, 459},
+  {97, 0, 0, 460},
+  {111, 1, 3657, 0},
+  {101, 1, 3658, 0},
+  {114, 0, 0, 461},
+  {110, 4, 3659, 462},
+  {108, 1, 3663, 0},
+  {99, 1, 3664, 0},
+  {108, 0, 0, 463},
+  {114, 1, 3665, 0},
+  {116, 1, 3666, 0},
+  {102, 0, 0, 464},
+  {114, 0, 0, 465},
+  {114, 1, 3667, 0},
+  {99, 1, 3668, 0},
+  {112, 1, 3669, 0},
+  {100, 1, 3670, 0},
+  {101, 1, 3671, 0},
+  {121, 0, 0, 466},
+  {121, 0, 0, 467},
+  {102, 0, 0, 468},
+  {114, 0, 0, 469},
+  {114, 1, 3672, 0},
+  {114, 0, 0, 470},
+  {97, 1, 3673, 0},
+  {114, 1, 3674, 0},
+  {114, 0, 0, 471},
+  {117, 1, 3675, 0},
+  {109, 1, 3676, 0},
+  {114, 1, 3677, 0},
+  {98, 1, 3678, 0},
+  {103, 2, 3679, 472},
+  {117, 1, 3681, 0},
+  {114, 7, 3682, 473},
+  {97, 1, 3689, 0},
+  {101, 1, 3690, 474},
+  {114, 1, 3691, 0},
+  {114, 1, 3692, 0},
+  {97, 1, 3693, 0},
+  {107, 2, 3694, 0},
+  {114, 1, 3696, 0},
+  {100, 1, 3697, 0},
+  {105, 1, 3698, 0},
+  {98, 0, 0, 475},
+  {97, 0, 0, 476},
+  {117, 1, 3699, 0},
+  {100, 1, 3700, 0},
+  {117, 1, 3701, 0},
+  {104, 0, 0, 477},
+  {116, 5, 3702, 0},
+  {113, 0, 0, 478},
+  {115, 1, 3707, 0},
+  {99, 1, 3708, 0},
+  {100, 1, 3709, 0},
+  {103, 1, 3710, 479},
+  {115, 5, 3711, 0},
+  {115, 1, 3716, 0},
+  {111, 1, 3717, 0},
+  {114, 2, 3718, 0},
+  {108, 1, 3720, 0},
+  {121, 0, 0, 480},
+  {114, 1, 3721, 0},
+  {111, 1, 3722, 0},
+  {97, 1, 3723, 0},
+  {114, 1, 3724, 0},
+  {100, 1, 3725, 0},
+  {117, 1, 3726, 0},
+  {112, 1, 3727, 481},
+  {113, 1, 3728, 482},
+  {105, 1, 3729, 0},
+  {110, 1, 3730, 0},
+  {114, 1, 3731, 0},
+  {114, 1, 3732, 0},
+  {103, 3, 3733, 0},
+  {112, 1, 3736, 0},
+  {97, 1, 3737, 0},
+  {102, 0, 0, 483},
+  {108, 1, 3738, 0},
+  {105, 1, 3739, 0},
+  {97, 1, 3740, 0},
+  {98, 1, 3741, 0},
+  {101, 1, 3742, 0},
+  {102, 0, 0, 484},
+  {114, 1, 3743, 485},
+  {114, 1, 3744, 0},
+  {111, 1, 3745, 0},
+  {97, 1, 3746, 0},
+  {114, 1, 3747, 0},
+  {113, 1, 3748, 0},
+  {114, 0, 0, 486},
+  {109, 2, 3749, 487},
+  {98, 0, 0, 488},
+  {117, 1, 3751, 0},
+  {114, 1, 3752, 0},
+  {99, 0, 0, 489},
+  {105, 1, 3753, 0},
+  {111, 1, 3754, 0},
+  {114, 1, 3755, 0},
+  {109, 1, 3756, 0},
+  {97, 1, 3757, 0},
+  {117, 1, 3758, 0},
+  {80, 1, 3759, 0},
+  {105, 2, 3760, 490},
+  {100, 1, 3762, 0},
+  {117, 1, 3763, 0},
+  {114, 1, 3764, 0},
+  {69, 0, 0, 491},
+  {111, 1, 3765, 0},
+  {114, 0, 0, 492},
+  {101, 0, 0, 493},
+  {116, 1, 3766, 494},
+  {115, 1, 3767, 0},
+  {107, 1, 3768, 0},
+  {109, 1, 3769, 0},
+  {115, 1, 3770, 0},
+  {115, 1, 3771, 0},
+  {114, 1, 3772, 0},
+  {97, 1, 3773, 0},
+  {99, 1, 3774, 0},
+  {100, 1, 3775, 0},
+  {117, 1, 3776, 0},
+  {112, 0, 0, 495},
+  {114, 0, 0, 496},
+  {108, 1, 3777, 0},
+  {101, 1, 3778, 0},
+  {102, 0, 0, 497},
+  {114, 0, 0, 498},
+  {112, 1, 3779, 0},
+  {116, 1, 3780, 0},
+  {97, 1, 3781, 0},
+  {118, 0, 0, 499},
+  {102, 1, 3782, 0},
+  {118, 0, 0, 500},
+  {103, 1, 3783, 0},
+  {97, 1, 3784, 0},
+  {97, 1, 3785, 0},
+  {108, 1, 3786, 0},
+  {117, 1, 3787, 0},
+  {103, 0, 0, 501},
+  {69, 0, 0, 502},
+  {105, 1, 3788, 0},
+  {111, 1, 3789, 0},
+  {112, 1, 3790, 0},
+  {117, 1, 3791, 0},
+  {112, 0, 0, 503},
+  {109, 1, 3792, 0},
+  {112, 0, 0, 504},
+  {114, 1, 3793, 0},
+  {100, 1, 3794, 0},
+  {110, 1, 3795, 0},
+  {112, 0, 0, 505},
+  {115, 1, 3796, 0},
+  {114, 1, 3797, 0},
+  {114, 2, 3798, 0},
+  {111, 1, 3800, 0},
+  {117, 1, 3801, 0},
+  {101, 1, 3802, 0},
+  {105, 1, 3803, 0},
+  {105, 1, 3804, 0},
+  {113, 2, 3805, 506},
+  {115, 0, 0, 507},
+  {105, 1, 3807, 0},
+  {114, 0, 0, 508},
+  {114, 1, 3808, 0},
+  {114, 1, 3809, 0},
+  {97, 1, 3810, 0},
+  {100, 0, 0, 509},
+  {121, 0, 0, 510},
+  {114, 1, 3811, 0},
+  {114, 1, 3812, 0},
+  {114, 0, 0, 511},
+  {102, 1, 3813, 0},
+  {113, 2, 3814, 512},
+  {115, 1, 3816, 513},
+  {105, 1, 3817, 0},
+  {114, 1, 3818, 0},
+  {100, 0, 0, 514},
+  {102, 0, 0, 515},
+  {105, 1, 3819, 0},
+  {110, 1, 3820, 0},
+  {114, 3, 3821, 516},
+  {108, 1, 3824, 0},
+  {99, 1, 3825, 0},
+  {101, 1, 3826, 517},
+  {114, 1, 3827, 0},
+  {114, 1, 3828, 0},
+  {103, 1, 3829, 0},
+  {114, 1, 3830, 0},
+  {99, 1, 3831, 0},
+  {101, 0, 0, 518},
+  {114, 0, 0, 519},
+  {111, 1, 3832, 0},
+  {109, 1, 3833, 520},
+  {105, 1, 3834, 0},
+  {97, 1, 3835, 0},
+  {115, 1, 3836, 0},
+  {98, 3, 3837, 521},
+  {99, 1, 3840, 0},
+  {112, 3, 3841, 522},
+  {108, 0, 0, 523},
+  {108, 1, 3844, 0},
+  {103, 0, 0, 524},
+  {105, 1, 3845, 0},
+  {101, 1, 3846, 0},
+  {115, 1, 3847, 0},
+  {97, 1, 3848, 0},
+  {97, 1, 3849, 0},
+  {112, 0, 0, 525},
+  {97, 1, 3850, 0},
+  {101, 0, 0, 526},
+  {116, 0, 0, 527},
+  {110, 1, 3851, 0},
+  {65, 1, 3852, 0},
+  {101, 0, 0, 528},
+  {116, 1, 3853, 529},
+  {65, 1, 3854, 0},
+  {116, 1, 3855, 0},
+  {105, 1, 3856, 0},
+  {114, 1, 3857, 0},
+  {114, 2, 3858, 0},
+  {101, 1, 3860, 0},
+  {117, 1, 3861, 0},
+  {116, 0, 0, 530},
+  {114, 1, 3862, 531},
+  {115, 1, 3863, 0},
+  {108, 1, 3864, 0},
+  {118, 0, 0, 532},
+  {116, 0, 0, 533},
+  {111, 1, 3865, 0},
+  {105, 1, 3866, 0},
+  {105, 1, 3867, 0},
+  {110, 0, 0, 534},
+  {97, 1, 3868, 0},
+  {97, 1, 3869, 0},
+  {116, 0, 0, 535},
+  {114, 1, 3870, 0},
+  {105, 1, 3871, 0},
+  {114, 1, 3872, 0},
+  {110, 1, 3873, 0},
+  {99, 1, 3874, 0},
+  {103, 1, 3875, 0},
+  {99, 1, 3876, 0},
+  {100, 0, 0, 536},
+  {110, 1, 3877, 0},
+  {102, 0, 0, 537},
+  {114, 0, 0, 538},
+  {114, 1, 3878, 0},
+  {117, 1, 3879, 0},
+  {114, 1, 3880, 0},
+  {101, 1, 3881, 0},
+  {102, 0, 0, 539},
+  {109, 0, 0, 540},
+  {103, 1, 3882, 0},
+  {114, 0, 0, 541},
+  {108, 1, 3883, 0},
+  {114, 0, 0, 542},
+  {97, 1, 3884, 0},
+  {108, 0, 0, 543},
+  {108, 1, 3885, 0},
+  {109, 1, 3886, 0},
+  {108, 0, 0, 544},
+  {97, 1, 3887, 0},
+  {97, 1, 3888, 545},
+  {115, 2, 3889, 0},
+  {116, 0, 0, 546},
+  {99, 1, 3891, 0},
+  {105, 1, 3892, 0},
+  {109, 1, 3893, 0},
+  {112, 0, 0, 547},
+  {116, 1, 3894, 0},
+  {118, 0, 0, 548},
+  {109, 1, 3895, 0},
+  {110, 1, 3896, 0},
+  {99, 1, 3897, 0},
+  {110, 2, 3898, 0},
+  {115, 8, 3900, 549},
+  {110, 1, 3908, 0},
+  {102, 0, 0, 550},
+  {110, 1, 3909, 0},
+  {112, 0, 0, 551},
+  {117, 1, 3910, 0},
+  {99, 5, 3911, 552},
+  {109, 1, 3916, 0},
+  {69, 0, 0, 553},
+  {97, 1, 3917, 0},
+  {115, 1, 3918, 0},
+  {100, 0, 0, 554},
+  {102, 3, 3919, 0},
+  {112, 1, 3922, 555},
+  {105, 1, 3923, 0},
+  {114, 1, 3924, 0},
+  {114, 0, 0, 556},
+  {99, 1, 3925, 0},
+  {116, 0, 0, 557},
+  {102, 0, 0, 558},
+  {105, 1, 3926, 0},
+  {114, 0, 0, 559},
+  {116, 2, 3927, 0},
+  {115, 1, 3929, 0},
+  {116, 0, 0, 560},
+  {114, 1, 3930, 0},
+  {114, 0, 0, 561},
+  {97, 1, 3931, 0},
+  {114, 1, 3932, 0},
+  {114, 0, 0, 562},
+  {101, 0, 0, 563},
+  {117, 1, 3933, 0},
+  {105, 1, 3934, 0},
+  {109, 1, 3935, 0},
+  {103, 3, 3936, 564},
+  {117, 1, 3939, 0},
+  {114, 10, 3940, 565},
+  {97, 1, 3950, 0},
+  {105, 1, 3951, 0},
+  {114, 1, 3952, 0},
+  {114, 1, 3953, 0},
+  {97, 1, 3954, 0},
+  {107, 2, 3955, 0},
+  {114, 1, 3957, 0},
+  {100, 1, 3958, 0},
+  {105, 1, 3959, 0},
+  {98, 0, 0, 566},
+  {97, 0, 0, 567},
+  {100, 1, 3960, 0},
+  {117, 1, 3961, 0},
+  {104, 0, 0, 568},
+  {108, 3, 3962, 569},
+  {116, 0, 0, 570},
+  {115, 1, 3965, 0},
+  {111, 1, 3966, 0},
+  {114, 2, 3967, 0},
+  {118, 0, 0, 571},
+  {104, 1, 3969, 0},
+  {103, 0, 0, 572},
+  {105, 1, 3970, 0},
+  {114, 1, 3971, 0},
+  {97, 1, 3972, 0},
+  {117, 1, 3973, 0},
+  {105, 1, 3974, 0},
+  {110, 1, 3975, 0},
+  {114, 1, 3976, 0},
+  {114, 1, 3977, 0},
+  {97, 1, 3978, 0},
+  {102, 0, 0, 573},
+  {108, 1, 3979, 0},
+  {105, 1, 3980, 0},
+  {114, 1, 3981, 574},
+  {111, 1, 3982, 0},
+  {114, 1, 3983, 0},
+  {113, 1, 3984, 0},
+  {114, 0, 0, 575},
+  {98, 0, 0, 576},
+  {117, 1, 3985, 0},
+  {114, 1, 3986, 0},
+  {109, 1, 3987, 0},
+  {105, 3, 3988, 577},
+  {117, 1, 3991, 0},
+  {117, 1, 3992, 0},
+  {117, 1, 3993, 0},
+  {112, 0, 0, 578},
+  {114, 1, 3994, 0},
+  {117, 1, 3995, 0},
+  {100, 1, 3996, 0},
+  {114, 1, 3997, 0},
+  {69, 0, 0, 579},
+  {97, 1, 3998, 0},
+  {115, 1, 3999, 0},
+  {111, 1, 4000, 0},
+  {105, 1, 4001, 0},
+  {116, 2, 4002, 580},
+  {114, 1, 4004, 0},
+  {114, 2, 4005, 0},
+  {116, 0, 0, 581},
+  {105, 0, 0, 582},
+  {119, 1, 4007, 0},
+  {109, 2, 4008, 0},
+  {116, 0, 0, 583},
+  {111, 1, 4010, 0},
+  {114, 1, 4011, 0},
+  {104, 1, 4012, 0},
+  {121, 0, 0, 584},
+  {114, 1, 4013, 0},
+  {109, 1, 4014, 0},
+  {100, 1, 4015, 0},
+  {101, 1, 4016, 585},
+  {103, 1, 4017, 586},
+  {108, 1, 4018, 587},
+  {110, 1, 4019, 0},
+  {112, 1, 4020, 0},
+  {114, 1, 4021, 0},
+  {114, 1, 4022, 0},
+  {108, 1, 4023, 0},
+  {115, 1, 4024, 0},
+  {112, 1, 4025, 0},
+  {100, 0, 0, 588},
+  {108, 1, 4026, 0},
+  {101, 1, 4027, 589},
+  {116, 1, 4028, 0},
+  {98, 1, 4029, 590},
+  {102, 0, 0, 591},
+  {100, 1, 4030, 0},
+  {114, 0, 0, 592},
+  {97, 1, 4031, 0},
+  {117, 1, 4032, 0},
+  {117, 2, 4033, 0},
+  {97, 1, 4035, 0},
+  {102, 0, 0, 593},
+  {114, 1, 4036, 0},
+  {114, 0, 0, 594},
+  {116, 1, 4037, 0},
+  {105, 1, 4038, 0},
+  {97, 1, 4039, 0},
+  {114, 1, 4040, 595},
+  {97, 1, 4041, 0},
+  {110, 1, 4042, 0},
+  {69, 0, 0, 596},
+  {100, 1, 4043, 0},
+  {101, 1, 4044, 597},
+  {109, 1, 4045, 0},
+  {110, 2, 4046, 0},
+  {112, 1, 4048, 0},
+  {114, 1, 4049, 0},
+  {115, 3, 4050, 0},
+  {99, 5, 4053, 598},
+  {103, 0, 0, 599},
+  {49, 0, 0, 600},
+  {50, 0, 0, 601},
+  {51, 0, 0, 602},
+  {69, 0, 0, 603},
+  {100, 2, 4058, 0},
+  {101, 1, 4060, 604},
+  {104, 1, 4061, 0},
+  {108, 1, 4062, 0},
+  {109, 1, 4063, 0},
+  {110, 2, 4064, 0},
+  {112, 1, 4066, 0},
+  {115, 3, 4067, 0},
+  {114, 1, 4070, 0},
+  {114, 2, 4071, 0},
+  {119, 1, 4073, 0},
+  {105, 1, 4074, 0},
+  {103, 1, 4075, 0},
+  {107, 0, 0, 605},
+  {114, 1, 4076, 0},
+  {100, 1, 4077, 0},
+  {116, 0, 0, 606},
+  {114, 1, 4078, 0},
+  {114, 1, 4079, 0},
+  {116, 1, 4080, 0},
+  {99, 1, 4081, 0},
+  {110, 1, 4082, 0},
+  {97, 1, 4083, 0},
+  {115, 1, 4084, 0},
+  {114, 1, 4085, 0},
+  {100, 1, 4086, 0},
+  {101, 1, 4087, 0},
+  {116, 0, 0, 607},
+  {97, 0, 0, 608},
+  {98, 1, 4088, 0},
+  {99, 1, 4089, 0},
+  {102, 1, 4090, 609},
+  {97, 0, 0, 610},
+  {105, 1, 4091, 0},
+  {100, 1, 4092, 0},
+  {97, 1, 4093, 0},
+  {100, 1, 4094, 0},
+  {101, 0, 0, 611},
+  {109, 1, 4095, 0},
+  {112, 1, 4096, 0},
+  {115, 1, 4097, 0},
+  {116, 1, 4098, 0},
+  {101, 1, 4099, 0},
+  {114, 0, 0, 612},
+  {121, 0, 0, 613},
+  {99, 1, 4100, 0},
+  {114, 1, 4101, 0},
+  {120, 1, 4102, 0},
+  {104, 1, 4103, 0},
+  {114, 0, 0, 614},
+  {114, 0, 0, 615},
+  {117, 1, 4104, 0},
+  {114, 0, 0, 616},
+  {99, 1, 4105, 0},
+  {101, 1, 4106, 0},
+  {114, 1, 4107, 0},
+  {114, 1, 4108, 0},
+  {108, 1, 4109, 0},
+  {97, 1, 4110, 0},
+  {115, 1, 4111, 0},
+  {97, 1, 4112, 0},
+  {114, 2, 4113, 0},
+  {108, 1, 4115, 0},
+  {111, 1, 4116, 0},
+  {114, 1, 4117, 0},
+  {114, 1, 4118, 0},
+  {99, 1, 4119, 0},
+  {111, 1, 4120, 0},
+  {102, 0, 0, 617},
+  {114, 1, 4121, 0},
+  {111, 1, 4122, 0},
+  {97, 1, 4123, 0},
+  {117, 1, 4124, 0},
+  {105, 2, 4125, 618},
+  {112, 1, 4127, 0},
+  {111, 1, 4128, 0},
+  {114, 1, 4129, 0},
+  {110, 1, 4130, 0},
+  {114, 1, 4131, 0},
+  {114, 0, 0, 619},
+  {111, 1, 4132, 0},
+  {108, 1, 4133, 0},
+  {105, 1, 4134, 620},
+  {114, 1, 4135, 0},
+  {108, 0, 0, 621},
+  {110, 1, 4136, 0},
+  {114, 0, 0, 622},
+  {114, 1, 4137, 623},
+  {115, 1, 4138, 0},
+  {103, 1, 4139, 0},
+  {101, 1, 4140, 0},
+  {107, 1, 4141, 0},
+  {110, 1, 4142, 0},
+  {112, 3, 4143, 0},
+  {114, 1, 4146, 624},
+  {115, 2, 4147, 0},
+  {116, 2, 4149, 0},
+  {115, 1, 4151, 0},
+  {98, 1, 4152, 0},
+  {101, 1, 4153, 0},
+  {108, 1, 4154, 0},
+  {98, 1, 4155, 0},
+  {116, 0, 0, 625},
+  {114, 1, 4156, 0},
+  {117, 2, 4157, 0},
+  {102, 0, 0, 626},
+  {111, 1, 4159, 0},
+  {114, 1, 4160, 0},
+  {114, 0, 0, 627},
+  {98, 1, 4161, 0},
+  {112, 1, 4162, 0},
+  {103, 1, 4163, 0},
+  {114, 1, 4164, 0},
+  {98, 1, 4165, 0},
+  {103, 1, 4166, 0},
+  {101, 1, 4167, 0},
+  {102, 0, 0, 628},
+  {97, 1, 4168, 0},
+  {114, 0, 0, 629},
+  {112, 0, 0, 630},
+  {114, 1, 4169, 0},
+  {112, 0, 0, 631},
+  {114, 1, 4170, 0},
+  {114, 1, 4171, 0},
+  {114, 1, 4172, 0},
+  {114, 1, 4173, 0},
+  {114, 1, 4174, 0},
+  {112, 0, 0, 632},
+  {115, 0, 0, 633},
+  {111, 1, 4175, 0},
+  {102, 0, 0, 634},
+  {108, 1, 4176, 0},
+  {105, 1, 4177, 0},
+  {114, 1, 4178, 0},
+  {114, 1, 4179, 0},
+  {114, 0, 0, 635},
+  {99, 1, 4180, 0},
+  {108, 1, 4181, 0},
+  {114, 1, 4182, 0},
+  {101, 0, 0, 636},
+  {100, 1, 4183, 0},
+  {117, 1, 4184, 0},
+  {121, 0, 0, 637},
+  {114, 1, 4185, 0},
+  {121, 0, 0, 638},
+  {102, 0, 0, 639},
+  {114, 0, 0, 640},
+  {121, 0, 0, 641},
+  {108, 0, 0, 642},
+  {117, 1, 4186, 0},
+  {114, 1, 4187, 0},
+  {116, 0, 0, 643},
+  {116, 1, 4188, 0},
+  {97, 0, 0, 644},
+  {121, 0, 0, 645},
+  {114, 1, 4189, 0},
+  {102, 0, 0, 646},
+  {114, 0, 0, 647},
+  {106, 0, 0, 648},
+  {103, 0, 0, 649},
+  {116, 1, 4190, 0},
+  {118, 1, 4191, 0},
+  {99, 0, 0, 650},
+  {118, 1, 4192, 0},
+  {97, 0, 0, 651},
+  {114, 0, 0, 652},
+  {110, 0, 0, 653},
+  {121, 1, 4193, 0},
+  {103, 0, 0, 654},
+  {103, 1, 4194, 0},
+  {100, 1, 4195, 0},
+  {115, 1, 4196, 0},
+  {101, 1, 4197, 0},
+  {117, 1, 4198, 0},
+  {111, 1, 4199, 0},
+  {101, 0, 0, 655},
+  {101, 1, 4200, 0},
+  {116, 1, 4201, 0},
+  {116, 1, 4202, 0},
+  {101, 1, 4203, 0},
+  {111, 1, 4204, 0},
+  {105, 1, 4205, 0},
+  {99, 0, 0, 656},
+  {105, 1, 4206, 0},
+  {108, 1, 4207, 0},
+  {101, 1, 4208, 0},
+  {108, 1, 4209, 0},
+  {107, 1, 4210, 0},
+  {101, 1, 4211, 0},
+  {110, 1, 4212, 657},
+  {114, 1, 4213, 0},
+  {110, 1, 4214, 0},
+  {111, 1, 4215, 0},
+  {111, 1, 4216, 0},
+  {116, 1, 4217, 0},
+  {115, 0, 0, 658},
+  {97, 1, 4218, 0},
+  {114, 1, 4219, 0},
+  {101, 1, 4220, 0},
+  {118, 0, 0, 659},
+  {111, 1, 4221, 0},
+  {97, 0, 0, 660},
+  {114, 1, 4222, 0},
+  {111, 1, 4223, 0},
+  {101, 1, 4224, 0},
+  {111, 1, 4225, 0},
+  {113, 1, 4226, 0},
+  {108, 1, 4227, 0},
+  {65, 1, 4228, 0},
+  {66, 1, 4229, 0},
+  {76, 1, 4230, 0},
+  {82, 1, 4231, 0},
+  {84, 1, 4232, 0},
+  {97, 1, 4233, 0},
+  {111, 1, 4234, 0},
+  {116, 1, 4235, 0},
+  {111, 1, 4236, 0},
+  {99, 0, 0, 661},
+  {118, 1, 4237, 0},
+  {101, 1, 4238, 0},
+  {114, 0, 0, 662},
+  {121, 2, 4239, 0},
+  {110, 0, 0, 663},
+  {108, 1, 4241, 0},
+  {108, 1, 4242, 664},
+  {108, 1, 4243, 0},
+  {116, 1, 4244, 0},
+  {110, 1, 4245, 0},
+  {101, 1, 4246, 0},
+  {108, 1, 4247, 0},
+  {105, 1, 4248, 0},
+  {97, 1, 4249, 665},
+  {118, 1, 4250, 0},
+  {105, 1, 4251, 0},
+  {99, 0, 0, 666},
+  {116, 1, 4252, 0},
+  {99, 1, 4253, 0},
+  {107, 0, 0, 667},
+  {99, 0, 0, 668},
+  {101, 1, 4254, 0},
+  {122, 1, 4255, 0},
+  {111, 1, 4256, 0},
+  {68, 1, 4257, 0},
+  {69, 1, 4258, 0},
+  {103, 0, 0, 669},
+  {116, 1, 4259, 0},
+  {99, 0, 0, 670},
+  {118, 1, 4260, 0},
+  {114, 0, 0, 671},
+  {105, 1, 4261, 0},
+  {105, 1, 4262, 0},
+  {103, 1, 4263, 0},
+  {114, 1, 4264, 0},
+  {115, 1, 4265, 0},
+  {110, 0, 0, 672},
+  {100, 1, 4266, 0},
+  {121, 0, 0, 673},
+  {99, 0, 0, 674},
+  {99, 1, 4267, 0},
+  {121, 0, 0, 675},
+  {97, 0, 0, 676},
+  {105, 1, 4268, 0},
+  {116, 1, 4269, 0},
+  {100, 1, 4270, 0},
+  {97, 1, 4271, 0},
+  {111, 1, 4272, 0},
+  {105, 1, 4273, 0},
+  {65, 2, 4274, 0},
+  {67, 1, 4276, 0},
+  {68, 1, 4277, 0},
+  {70, 1, 4278, 0},
+  {82, 1, 4279, 0},
+  {84, 2, 4280, 0},
+  {85, 1, 4282, 0},
+  {86, 1, 4283, 0},
+  {97, 1, 4284, 0},
+  {114, 1, 4285, 0},
+  {69, 1, 4286, 0},
+  {70, 1, 4287, 0},
+  {71, 1, 4288, 0},
+  {76, 1, 4289, 0},
+  {83, 1, 4290, 0},
+  {84, 1, 4291, 0},
+  {116, 1, 4292, 0},
+  {111, 1, 4293, 0},
+  {76, 1, 4294, 0},
+  {82, 1, 4295, 0},
+  {108, 1, 4296, 0},
+  {114, 1, 4297, 0},
+  {114, 2, 4298, 0},
+  {111, 1, 4300, 0},
+  {117, 1, 4301, 0},
+  {105, 1, 4302, 0},
+  {115, 1, 4303, 0},
+  {116, 1, 4304, 0},
+  {111, 1, 4305, 0},
+  {105, 1, 4306, 0},
+  {116, 1, 4307, 0},
+  {101, 1, 4308, 0},
+  {105, 1, 4309, 0},
+  {101, 1, 4310, 0},
+  {114, 1, 4311, 0},
+  {111, 1, 4312, 0},
+  {117, 1, 4313, 0},
+  {111, 1, 4314, 0},
+  {108, 1, 4315, 0},
+  {113, 1, 4316, 0},
+  {120, 1, 4317, 0},
+  {114, 1, 4318, 0},
+  {117, 1, 4319, 0},
+  {101, 2, 4320, 0},
+  {101, 1, 4322, 0},
+  {114, 1, 4323, 0},
+  {101, 1, 4324, 0},
+  {105, 1, 4325, 0},
+  {113, 1, 4326, 0},
+  {117, 3, 4327, 0},
+  {105, 1, 4330, 0},
+  {101, 1, 4331, 0},
+  {100, 1, 4332, 0},
+  {103, 0, 0, 677},
+  {116, 1, 4333, 0},
+  {99, 0, 0, 678},
+  {97, 1, 4334, 0},
+  {118, 1, 4335, 0},
+  {114, 0, 0, 679},
+  {97, 0, 0, 680},
+  {114, 1, 4336, 0},
+  {67, 1, 4337, 0},
+  {115, 1, 4338, 0},
+  {100, 1, 4339, 0},
+  {101, 1, 4340, 0},
+  {66, 2, 4341, 0},
+  {80, 1, 4343, 0},
+  {105, 1, 4344, 0},
+  {77, 1, 4345, 0},
+  {99, 1, 4346, 0},
+  {101, 1, 4347, 0},
+  {101, 0, 0, 681},
+  {117, 1, 4348, 0},
+  {111, 1, 4349, 0},
+  {114, 0, 0, 682},
+  {116, 1, 4350, 0},
+  {116, 1, 4351, 0},
+  {111, 1, 4352, 0},
+  {105, 1, 4353, 0},
+  {114, 1, 4354, 0},
+  {116, 8, 4355, 0},
+  {100, 1, 4363, 0},
+  {104, 1, 4364, 0},
+  {68, 1, 4365, 0},
+  {99, 1, 4366, 0},
+  {99, 1, 4367, 0},
+  {116, 1, 4368, 0},
+  {111, 1, 4369, 0},
+  {105, 1, 4370, 0},
+  {99, 0, 0, 683},
+  {116, 4, 4371, 0},
+  {97, 0, 0, 684},
+  {108, 1, 4375, 0},
+  {114, 1, 4376, 0},
+  {101, 1, 4377, 0},
+  {101, 1, 4378, 0},
+  {84, 1, 4379, 0},
+  {114, 1, 4380, 0},
+  {101, 1, 4381, 0},
+  {78, 0, 0, 685},
+  {69, 0, 0, 686},
+  {121, 0, 0, 687},
+  {111, 1, 4382, 0},
+  {105, 1, 4383, 0},
+  {101, 1, 4384, 0},
+  {97, 0, 0, 688},
+  {107, 1, 4385, 0},
+  {83, 1, 4386, 0},
+  {101, 3, 4387, 689},
+  {108, 1, 4390, 0},
+  {111, 1, 4391, 0},
+  {116, 1, 4392, 0},
+  {111, 1, 4393, 0},
+  {121, 0, 0, 690},
+  {118, 1, 4394, 0},
+  {99, 0, 0, 691},
+  {97, 1, 4395, 0},
+  {118, 1, 4396, 0},
+  {114, 0, 0, 692},
+  {114, 2, 4397, 0},
+  {110, 1, 4399, 693},
+  {110, 0, 0, 694},
+  {114, 1, 4400, 0},
+  {119, 1, 4401, 0},
+  {117, 1, 4402, 0},
+  {101, 1, 4403, 695},
+  {114, 1, 4404, 0},
+  {119, 1, 4405, 0},
+  {114, 2, 4406, 0},
+  {108, 1, 4408, 0},
+  {103, 0, 0, 696},
+  {100, 1, 4409, 0},
+  {104, 0, 0, 697},
+  {104, 1, 4410, 698},
+  {97, 1, 4411, 0},
+  {105, 1, 4412, 0},
+  {84, 1, 4413, 0},
+  {115, 1, 4414, 0},
+  {99, 0, 0, 699},
+  {101, 0, 0, 700},
+  {116, 1, 4415, 0},
+  {99, 0, 0, 701},
+  {116, 1, 4416, 0},
+  {111, 1, 4417, 0},
+  {87, 1, 4418, 0},
+  {116, 1, 4419, 0},
+  {118, 1, 4420, 0},
+  {99, 0, 0, 702},
+  {101, 0, 0, 703},
+  {103, 0, 0, 704},
+  {118, 1, 4421, 0},
+  {115, 1, 4422, 0},
+  {104, 0, 0, 705},
+  {97, 0, 0, 706},
+  {114, 0, 0, 707},
+  {103, 0, 0, 708},
+  {110, 1, 4423, 0},
+  {108, 1, 4424, 0},
+  {101, 0, 0, 709},
+  {115, 1, 4425, 0},
+  {116, 1, 4426, 710},
+  {112, 1, 4427, 0},
+  {116, 0, 0, 711},
+  {97, 1, 4428, 0},
+  {110, 0, 0, 712},
+  {105, 1, 4429, 0},
+  {111, 1, 4430, 0},
+  {103, 0, 0, 713},
+  {112, 1, 4431, 714},
+  {100, 1, 4432, 0},
+  {110, 1, 4433, 0},
+  {116, 0, 0, 715},
+  {99, 1, 4434, 0},
+  {101, 1, 4435, 0},
+  {112, 1, 4436, 0},
+  {115, 1, 4437, 0},
+  {101, 1, 4438, 0},
+  {101, 1, 4439, 0},
+  {116, 1, 4440, 0},
+  {103, 0, 0, 716},
+  {111, 0, 0, 717},
+  {117, 1, 4441, 0},
+  {116, 1, 4442, 0},
+  {105, 0, 0, 718},
+  {111, 1, 4443, 0},
+  {101, 1, 4444, 0},
+  {97, 1, 4445, 0},
+  {105, 1, 4446, 0},
+  {117, 1, 4447, 0},
+  {100, 1, 4448, 0},
+  {112, 1, 4449, 0},
+  {116, 1, 4450, 0},
+  {113, 1, 4451, 0},
+  {116, 1, 4452, 0},
+  {114, 1, 4453, 0},
+  {112, 1, 4454, 0},
+  {101, 1, 4455, 0},
+  {101, 1, 4456, 0},
+  {111, 1, 4457, 0},
+  {107, 3, 4458, 0},
+  {107, 0, 0, 719},
+  {50, 0, 0, 720},
+  {52, 0, 0, 721},
+  {52, 0, 0, 722},
+  {107, 0, 0, 723},
+  {117, 1, 4461, 0},
+  {111, 1, 4462, 0},
+  {105, 1, 4463, 0},
+  {76, 0, 0, 724},
+  {82, 0, 0, 725},
+  {108, 0, 0, 726},
+  {114, 0, 0, 727},
+  {68, 0, 0, 728},
+  {85, 0, 0, 729},
+  {100, 0, 0, 730},
+  {117, 0, 0, 731},
+  {76, 0, 0, 732},
+  {82, 0, 0, 733},
+  {108, 0, 0, 734},
+  {114, 0, 0, 735},
+  {72, 0, 0, 736},
+  {76, 0, 0, 737},
+  {82, 0, 0, 738},
+  {104, 0, 0, 739},
+  {108, 0, 0, 740},
+  {114, 0, 0, 741},
+  {111, 1, 4464, 0},
+  {76, 0, 0, 742},
+  {82, 0, 0, 743},
+  {108, 0, 0, 744},
+  {114, 0, 0, 745},
+  {68, 0, 0, 746},
+  {85, 0, 0, 747},
+  {100, 0, 0, 748},
+  {117, 0, 0, 749},
+  {105, 1, 4465, 0},
+  {108, 1, 4466, 0},
+  {105, 1, 4467, 0},
+  {76, 0, 0, 750},
+  {82, 0, 0, 751},
+  {108, 0, 0, 752},
+  {114, 0, 0, 753},
+  {72, 0, 0, 754},
+  {76, 0, 0, 755},
+  {82, 0, 0, 756},
+  {104, 0, 0, 757},
+  {108, 0, 0, 758},
+  {114, 0, 0, 759},
+  {109, 1, 4468, 0},
+  {101, 0, 0, 760},
+  {97, 1, 4469, 0},
+  {105, 0, 0, 761},
+  {101, 0, 0, 762},
+  {98, 0, 0, 763},
+  {104, 1, 4470, 0},
+  {101, 1, 4471, 0},
+  {69, 0, 0, 764},
+  {101, 1, 4472, 765},
+  {116, 1, 4473, 0},
+  {110, 1, 4474, 0},
+  {114, 1, 4475, 0},
+  {97, 1, 4476, 0},
+  {117, 1, 4477, 0},
+  {111, 1, 4478, 0},
+  {116, 0, 0, 766},
+  {110, 0, 0, 767},
+  {115, 0, 0, 768},
+  {111, 1, 4479, 0},
+  {105, 1, 4480, 0},
+  {99, 0, 0, 769},
+  {115, 1, 4481, 770},
+  {108, 0, 0, 771},
+  {116, 1, 4482, 0},
+  {101, 1, 4483, 0},
+  {107, 1, 4484, 772},
+  {101, 1, 4485, 0},
+  {108, 1, 4486, 0},
+  {110, 1, 4487, 0},
+  {105, 1, 4488, 0},
+  {99, 1, 4489, 0},
+  {115, 1, 4490, 773},
+  {110, 1, 4491, 774},
+  {97, 1, 4492, 775},
+  {102, 1, 4493, 0},
+  {108, 1, 4494, 0},
+  {100, 1, 4495, 0},
+  {110, 1, 4496, 0},
+  {111, 1, 4497, 0},
+  {115, 1, 4498, 0},
+  {114, 0, 0, 776},
+  {115, 0, 0, 777},
+  {101, 0, 0, 778},
+  {101, 0, 0, 779},
+  {116, 0, 0, 780},
+  {114, 1, 4499, 0},
+  {114, 0, 0, 781},
+  {99, 0, 0, 782},
+  {114, 1, 4500, 0},
+  {114, 1, 4501, 0},
+  {97, 1, 4502, 0},
+  {117, 1, 4503, 0},
+  {111, 1, 4504, 0},
+  {114, 0, 0, 783},
+  {114, 1, 4505, 0},
+  {121, 3, 4506, 0},
+  {101, 1, 4509, 0},
+  {101, 1, 4510, 0},
+  {101, 0, 0, 784},
+  {100, 0, 0, 785},
+  {110, 1, 4511, 0},
+  {116, 0, 0, 786},
+  {116, 1, 4512, 0},
+  {101, 1, 4513, 0},
+  {116, 1, 4514, 0},
+  {118, 0, 0, 787},
+  {114, 1, 4515, 0},
+  {99, 0, 0, 788},
+  {111, 1, 4516, 0},
+  {103, 1, 4517, 0},
+  {114, 0, 0, 789},
+  {115, 1, 4518, 0},
+  {97, 0, 0, 790},
+  {116, 1, 4519, 0},
+  {104, 1, 4520, 0},
+  {108, 0, 0, 791},
+  {114, 0, 0, 792},
+  {111, 1, 4521, 0},
+  {115, 0, 0, 793},
+  {109, 1, 4522, 0},
+  {110, 0, 0, 794},
+  {100, 1, 4523, 0},
+  {110, 1, 4524, 0},
+  {114, 1, 4525, 0},
+  {111, 1, 4526, 0},
+  {97, 1, 4527, 0},
+  {113, 1, 4528, 795},
+  {105, 1, 4529, 0},
+  {108, 1, 4530, 0},
+  {113, 1, 4531, 0},
+  {108, 1, 4532, 0},
+  {97, 1, 4533, 0},
+  {100, 1, 4534, 0},
+  {104, 1, 4535, 0},
+  {97, 1, 4536, 0},
+  {114, 1, 4537, 0},
+  {111, 1, 4538, 0},
+  {111, 1, 4539, 0},
+  {116, 0, 0, 796},
+  {102, 0, 0, 797},
+  {114, 0, 0, 798},
+  {114, 0, 0, 799},
+  {103, 1, 4540, 0},
+  {114, 1, 4541, 0},
+  {116, 0, 0, 800},
+  {116, 1, 4542, 0},
+  {101, 1, 4543, 0},
+  {111, 1, 4544, 0},
+  {99, 0, 0, 801},
+  {111, 1, 4545, 0},
+  {116, 0, 0, 802},
+  {118, 1, 4546, 0},
+  {111, 1, 4547, 0},
+  {116, 1, 4548, 0},
+  {111, 1, 4549, 0},
+  {114, 0, 0, 803},
+  {121, 2, 4550, 804},
+  {49, 2, 4552, 0},
+  {110, 0, 0, 805},
+  {115, 1, 4554, 0},
+  {115, 0, 0, 806},
+  {108, 1, 4555, 0},
+  {118, 0, 0, 807},
+  {114, 1, 4556, 0},
+  {108, 1, 4557, 0},
+  {109, 0, 0, 808},
+  {97, 1, 4558, 0},
+  {108, 1, 4559, 0},
+  {115, 1, 4560, 0},
+  {118, 1, 4561, 809},
+  {97, 1, 4562, 0},
+  {116, 0, 0, 810},
+  {114, 0, 0, 811},
+  {116, 0, 0, 812},
+  {116, 0, 0, 813},
+  {99, 1, 4563, 0},
+  {110, 1, 4564, 0},
+  {105, 1, 4565, 0},
+  {108, 1, 4566, 0},
+  {105, 1, 4567, 0},
+  {103, 0, 0, 814},
+  {105, 1, 4568, 0},
+  {103, 0, 0, 815},
+  {103, 0, 0, 816},
+  {103, 0, 0, 817},
+  {115, 0, 0, 818},
+  {108, 1, 4569, 0},
+  {118, 0, 0, 819},
+  {116, 1, 4570, 0},
+  {49, 6, 4571, 0},
+  {50, 2, 4577, 0},
+  {51, 3, 4579, 0},
+  {52, 1, 4582, 0},
+  {53, 2, 4583, 0},
+  {55, 1, 4585, 0},
+  {108, 0, 0, 820},
+  {110, 0, 0, 821},
+  {116, 1, 4586, 0},
+  {97, 1, 4587, 822},
+  {118, 1, 4588, 0},
+  {99, 0, 0, 823},
+  {108, 1, 4589, 0},
+  {99, 0, 0, 824},
+  {111, 1, 4590, 0},
+  {101, 1, 4591, 0},
+  {108, 0, 0, 825},
+  {112, 1, 4592, 0},
+  {113, 0, 0, 826},
+  {109, 0, 0, 827},
+  {101, 0, 0, 828},
+  {101, 0, 0, 829},
+  {108, 0, 0, 830},
+  {114, 0, 0, 831},
+  {116, 0, 0, 832},
+  {97, 1, 4593, 0},
+  {101, 1, 4594, 0},
+  {112, 1, 4595, 0},
+  {114, 1, 4596, 0},
+  {111, 1, 4597, 0},
+  {113, 2, 4598, 0},
+  {101, 1, 4600, 0},
+  {105, 1, 4601, 0},
+  {116, 1, 4602, 0},
+  {115, 1, 4603, 0},
+  {108, 1, 4604, 0},
+  {99, 1, 4605, 0},
+  {99, 1, 4606, 0},
+  {119, 0, 0, 833},
+  {99, 0, 0, 834},
+  {116, 1, 4607, 0},
+  {105, 1, 4608, 0},
+  {111, 1, 4609, 0},
+  {97, 1, 4610, 0},
+  {97, 1, 4611, 0},
+  {114, 0, 0, 835},
+  {104, 1, 4612, 0},
+  {108, 1, 4613, 0},
+  {114, 1, 4614, 0},
+  {97, 1, 4615, 0},
+  {115, 1, 4616, 0},
+  {111, 1, 4617, 0},
+  {108, 1, 4618, 0},
+  {101, 1, 4619, 0},
+  {116, 1, 4620, 0},
+  {99, 0, 0, 836},
+  {108, 0, 0, 837},
+  {118, 1, 4621, 0},
+  {110, 1, 4622, 0},
+  {116, 0, 0, 838},
+  {105, 1, 4623, 0},
+  {97, 0, 0, 839},
+  {103, 0, 0, 840},
+  {114, 0, 0, 841},
+  {101, 0, 0, 842},
+  {108, 1, 4624, 0},
+  {112, 1, 4625, 0},
+  {104, 0, 0, 843},
+  {100, 0, 0, 844},
+  {114, 1, 4626, 0},
+  {110, 1, 4627, 845},
+  {111, 1, 4628, 0},
+  {97, 1, 4629, 0},
+  {103, 1, 4630, 0},
+  {114, 1, 4631, 0},
+  {97, 1, 4632, 0},
+  {114, 1, 4633, 0},
+  {110, 0, 0, 846},
+  {100, 0, 0, 847},
+  {115, 1, 4634, 0},
+  {69, 0, 0, 848},
+  {100, 1, 4635, 0},
+  {115, 1, 4636, 849},
+  {118, 0, 0, 850},
+  {100, 1, 4637, 0},
+  {121, 0, 0, 851},
+  {99, 0, 0, 852},
+  {104, 0, 0, 853},
+  {99, 1, 4638, 0},
+  {121, 0, 0, 854},
+  {97, 1, 4639, 855},
+  {105, 1, 4640, 0},
+  {101, 1, 4641, 0},
+  {114, 0, 0, 856},
+  {105, 1, 4642, 0},
+  {114, 0, 0, 857},
+  {116, 1, 4643, 0},
+  {112, 1, 4644, 0},
+  {97, 1, 4645, 0},
+  {100, 1, 4646, 0},
+  {100, 0, 0, 858},
+  {108, 1, 4647, 0},
+  {111, 0, 0, 859},
+  {98, 1, 4648, 860},
+  {102, 1, 4649, 0},
+  {104, 1, 4650, 0},
+  {108, 1, 4651, 0},
+  {112, 1, 4652, 0},
+  {115, 1, 4653, 0},
+  {116, 1, 4654, 0},
+  {105, 1, 4655, 0},
+  {115, 0, 0, 861},
+  {114, 0, 0, 862},
+  {107, 0, 0, 863},
+  {99, 2, 4656, 0},
+  {101, 0, 0, 864},
+  {115, 1, 4658, 0},
+  {111, 1, 4659, 0},
+  {105, 1, 4660, 0},
+  {108, 0, 0, 865},
+  {111, 1, 4661, 866},
+  {104, 1, 4662, 0},
+  {115, 1, 4663, 0},
+  {97, 1, 4664, 0},
+  {104, 1, 4665, 0},
+  {108, 1, 4666, 0},
+  {114, 1, 4667, 0},
+  {116, 1, 4668, 0},
+  {108, 1, 4669, 0},
+  {99, 0, 0, 867},
+  {111, 1, 4670, 0},
+  {101, 1, 4671, 0},
+  {97, 1, 4672, 0},
+  {100, 1, 4673, 0},
+  {101, 1, 4674, 0},
+  {103, 1, 4675, 0},
+  {115, 1, 4676, 0},
+  {104, 1, 4677, 0},
+  {111, 1, 4678, 0},
+  {100, 0, 0, 868},
+  {117, 1, 4679, 869},
+  {107, 0, 0, 870},
+  {114, 0, 0, 871},
+  {114, 1, 4680, 0},
+  {114, 1, 4681, 0},
+  {105, 0, 0, 872},
+  {111, 1, 4682, 0},
+  {115, 1, 4683, 0},
+  {112, 1, 4684, 0},
+  {113, 0, 0, 873},
+  {109, 0, 0, 874},
+  {103, 0, 0, 875},
+  {114, 0, 0, 876},
+  {107, 0, 0, 877},
+  {108, 1, 4685, 0},
+  {109, 1, 4686, 0},
+  {114, 1, 4687, 0},
+  {97, 1, 4688, 0},
+  {114, 0, 0, 878},
+  {117, 1, 4689, 0},
+  {109, 1, 4690, 0},
+  {115, 1, 4691, 0},
+  {97, 1, 4692, 0},
+  {110, 1, 4693, 0},
+  {108, 1, 4694, 0},
+  {114, 0, 0, 879},
+  {114, 1, 4695, 0},
+  {114, 1, 4696, 880},
+  {105, 0, 0, 881},
+  {117, 1, 4697, 0},
+  {101, 0, 0, 882},
+  {103, 0, 0, 883},
+  {111, 1, 4698, 884},
+  {111, 1, 4699, 0},
+  {114, 0, 0, 885},
+  {116, 0, 0, 886},
+  {101, 1, 4700, 0},
+  {101, 1, 4701, 0},
+  {114, 1, 4702, 0},
+  {101, 1, 4703, 0},
+  {97, 1, 4704, 0},
+  {101, 0, 0, 887},
+  {102, 0, 0, 888},
+  {115, 1, 4705, 0},
+  {104, 1, 4706, 0},
+  {116, 1, 4707, 0},
+  {116, 0, 0, 889},
+  {101, 1, 4708, 0},
+  {116, 1, 4709, 0},
+  {101, 1, 4710, 0},
+  {109, 1, 4711, 0},
+  {104, 0, 0, 890},
+  {117, 1, 4712, 0},
+  {111, 0, 0, 891},
+  {115, 1, 4713, 0},
+  {105, 1, 4714, 0},
+  {111, 1, 4715, 0},
+  {115, 2, 4716, 892},
+  {117, 1, 4718, 0},
+  {108, 1, 4719, 0},
+  {111, 1, 4720, 0},
+  {105, 1, 4721, 0},
+  {112, 0, 0, 893},
+  {116, 2, 4722, 0},
+  {104, 1, 4724, 0},
+  {115, 1, 4725, 0},
+  {115, 1, 4726, 0},
+  {97, 0, 0, 894},
+  {116, 1, 4727, 0},
+  {100, 0, 0, 895},
+  {115, 0, 0, 896},
+  {114, 1, 4728, 0},
+  {114, 1, 4729, 897},
+  {112, 1, 4730, 898},
+  {111, 1, 4731, 0},
+  {105, 1, 4732, 0},
+  {103, 1, 4733, 899},
+  {104, 0, 0, 900},
+  {114, 0, 0, 901},
+  {104, 1, 4734, 0},
+  {114, 1, 4735, 902},
+  {116, 0, 0, 903},
+  {105, 1, 4736, 0},
+  {97, 1, 4737, 0},
+  {109, 0, 0, 904},
+  {115, 1, 4738, 0},
+  {113, 0, 0, 905},
+  {115, 1, 4739, 0},
+  {109, 0, 0, 906},
+  {114, 0, 0, 907},
+  {114, 0, 0, 908},
+  {114, 0, 0, 909},
+  {114, 0, 0, 910},
+  {114, 0, 0, 911},
+  {116, 2, 4740, 0},
+  {113, 0, 0, 912},
+  {115, 1, 4742, 0},
+  {115, 0, 0, 913},
+  {109, 0, 0, 914},
+  {105, 1, 4743, 915},
+  {110, 3, 4744, 916},
+  {105, 1, 4747, 917},
+  {97, 1, 4748, 0},
+  {115, 1, 4749, 0},
+  {116, 0, 0, 918},
+  {105, 1, 4750, 0},
+  {117, 1, 4751, 0},
+  {99, 1, 4752, 919},
+  {114, 0, 0, 920},
+  {114, 2, 4753, 921},
+  {104, 1, 4755, 0},
+  {105, 1, 4756, 922},
+  {117, 1, 4757, 0},
+  {114, 1, 4758, 0},
+  {101, 1, 4759, 923},
+  {100, 0, 0, 924},
+  {114, 0, 0, 925},
+  {117, 2, 4760, 0},
+  {69, 0, 0, 926},
+  {101, 0, 0, 927},
+  {115, 1, 4762, 0},
+  {99, 1, 4763, 928},
+  {69, 0, 0, 929},
+  {101, 0, 0, 930},
+  {115, 1, 4764, 0},
+  {100, 1, 4765, 0},
+  {97, 1, 4766, 0},
+  {114, 1, 4767, 0},
+  {112, 0, 0, 931},
+  {115, 1, 4768, 0},
+  {114, 1, 4769, 0},
+  {115, 1, 4770, 0},
+  {102, 1, 4771, 0},
+  {114, 1, 4772, 0},
+  {114, 1, 4773, 0},
+  {114, 1, 4774, 0},
+  {114, 1, 4775, 0},
+  {109, 0, 0, 932},
+  {114, 0, 0, 933},
+  {104, 1, 4776, 0},
+  {114, 1, 4777, 934},
+  {97, 1, 4778, 0},
+  {116, 1, 4779, 0},
+  {99, 0, 0, 935},
+  {104, 0, 0, 936},
+  {97, 1, 4780, 0},
+  {108, 1, 4781, 0},
+  {103, 0, 0, 937},
+  {114, 0, 0, 938},
+  {118, 1, 4782, 0},
+  {114, 0, 0, 939},
+  {114, 0, 0, 940},
+  {114, 0, 0, 941},
+  {111, 1, 4783, 0},
+  {101, 0, 0, 942},
+  {114, 0, 0, 943},
+  {97, 0, 0, 944},
+  {114, 1, 4784, 0},
+  {117, 1, 4785, 0},
+  {112, 0, 0, 945},
+  {115, 0, 0, 946},
+  {114, 0, 0, 947},
+  {114, 1, 4786, 948},
+  {111, 1, 4787, 0},
+  {111, 1, 4788, 0},
+  {115, 1, 4789, 0},
+  {100, 1, 4790, 0},
+  {101, 1, 4791, 0},
+  {114, 0, 0, 949},
+  {108, 1, 4792, 0},
+  {105, 1, 4793, 0},
+  {108, 0, 0, 950},
+  {110, 1, 4794, 0},
+  {111, 1, 4795, 0},
+  {105, 1, 4796, 0},
+  {101, 1, 4797, 0},
+  {97, 1, 4798, 0},
+  {101, 0, 0, 951},
+  {104, 1, 4799, 0},
+  {99, 1, 4800, 0},
+  {107, 1, 4801, 0},
+  {97, 1, 4802, 0},
+  {98, 0, 0, 952},
+  {99, 1, 4803, 0},
+  {100, 2, 4804, 0},
+  {101, 0, 0, 953},
+  {109, 1, 4806, 0},
+  {115, 1, 4807, 0},
+  {116, 1, 4808, 0},
+  {116, 1, 4809, 0},
+  {100, 0, 0, 954},
+  {101, 0, 0, 955},
+  {97, 1, 4810, 0},
+  {99, 1, 4811, 0},
+  {101, 1, 4812, 0},
+  {110, 3, 4813, 0},
+  {115, 1, 4816, 0},
+  {101, 1, 4817, 956},
+  {112, 0, 0, 957},
+  {105, 1, 4818, 0},
+  {97, 1, 4819, 0},
+  {108, 1, 4820, 0},
+  {115, 1, 4821, 0},
+  {116, 1, 4822, 0},
+  {109, 0, 0, 958},
+  {101, 1, 4823, 0},
+  {115, 1, 4824, 0},
+  {109, 1, 4825, 0},
+  {101, 1, 4826, 0},
+  {105, 1, 4827, 0},
+  {116, 1, 4828, 959},
+  {114, 0, 0, 960},
+  {105, 1, 4829, 0},
+  {114, 0, 0, 961},
+  {116, 1, 4830, 0},
+  {99, 0, 0, 962},
+  {112, 1, 4831, 0},
+  {100, 0, 0, 963},
+  {101, 0, 0, 964},
+  {108, 1, 4832, 0},
+  {111, 0, 0, 965},
+  {97, 1, 4833, 0},
+  {98, 1, 4834, 966},
+  {99, 0, 0, 967},
+  {102, 1, 4835, 0},
+  {104, 1, 4836, 0},
+  {108, 1, 4837, 0},
+  {112, 1, 4838, 0},
+  {115, 1, 4839, 0},
+  {116, 1, 4840, 0},
+  {119, 0, 0, 968},
+  {105, 1, 4841, 0},
+  {111, 1, 4842, 969},
+  {114, 0, 0, 970},
+  {107, 0, 0, 971},
+  {99, 2, 4843, 0},
+  {101, 0, 0, 972},
+  {115, 1, 4845, 0},
+  {111, 1, 4846, 0},
+  {105, 1, 4847, 0},
+  {108, 0, 0, 973},
+  {104, 1, 4848, 0},
+  {111, 1, 4849, 974},
+  {105, 1, 4850, 0},
+  {112, 1, 4851, 0},
+  {115, 0, 0, 975},
+  {104, 1, 4852, 0},
+  {111, 1, 4853, 0},
+  {100, 0, 0, 976},
+  {117, 1, 4854, 977},
+  {116, 6, 4855, 0},
+  {110, 1, 4861, 0},
+  {114, 0, 0, 978},
+  {114, 0, 0, 979},
+  {115, 1, 4862, 0},
+  {100, 0, 0, 980},
+  {103, 0, 0, 981},
+  {114, 0, 0, 982},
+  {107, 0, 0, 983},
+  {114, 0, 0, 984},
+  {117, 1, 4863, 0},
+  {109, 1, 4864, 0},
+  {103, 1, 4865, 0},
+  {108, 1, 4866, 0},
+  {114, 0, 0, 985},
+  {117, 1, 4867, 0},
+  {111, 1, 4868, 986},
+  {101, 1, 4869, 0},
+  {101, 1, 4870, 0},
+  {101, 0, 0, 987},
+  {102, 0, 0, 988},
+  {108, 1, 4871, 0},
+  {104, 1, 4872, 0},
+  {116, 1, 4873, 0},
+  {111, 0, 0, 989},
+  {111, 1, 4874, 0},
+  {101, 0, 0, 990},
+  {105, 1, 4875, 0},
+  {99, 0, 0, 991},
+  {112, 0, 0, 992},
+  {105, 1, 4876, 0},
+  {108, 1, 4877, 0},
+  {109, 0, 0, 993},
+  {98, 0, 0, 994},
+  {101, 0, 0, 995},
+  {114, 0, 0, 996},
+  {104, 1, 4878, 0},
+  {114, 1, 4879, 997},
+  {97, 1, 4880, 0},
+  {105, 1, 4881, 0},
+  {110, 0, 0, 998},
+  {119, 1, 4882, 0},
+  {112, 0, 0, 999},
+  {99, 1, 4883, 0},
+  {116, 2, 4884, 0},
+  {97, 2, 4886, 1000},
+  {111, 1, 4888, 0},
+  {113, 0, 0, 1001},
+  {69, 0, 0, 1002},
+  {69, 0, 0, 1003},
+  {101, 0, 0, 1004},
+  {108, 1, 4889, 0},
+  {97, 1, 4890, 0},
+  {114, 0, 0, 1005},
+  {108, 1, 4891, 0},
+  {104, 1, 4892, 0},
+  {97, 1, 4893, 0},
+  {101, 0, 0, 1006},
+  {115, 0, 0, 1007},
+  {99, 1, 4894, 0},
+  {97, 1, 4895, 0},
+  {101, 1, 4896, 0},
+  {112, 1, 4897, 1008},
+  {112, 1, 4898, 1009},
+  {98, 2, 4899, 1010},
+  {112, 2, 4901, 1011},
+  {114, 2, 4903, 0},
+  {114, 0, 0, 1012},
+  {109, 1, 4905, 0},
+  {108, 1, 4906, 0},
+  {114, 1, 4907, 0},
+  {102, 0, 0, 1013},
+  {105, 1, 4908, 0},
+  {115, 0, 0, 1014},
+  {111, 1, 4909, 0},
+  {100, 1, 4910, 0},
+  {117, 1, 4911, 0},
+  {69, 0, 0, 1015},
+  {101, 0, 0, 1016},
+  {108, 1, 4912, 0},
+  {97, 1, 4913, 0},
+  {101, 1, 4914, 0},
+  {105, 1, 4915, 0},
+  {117, 2, 4916, 0},
+  {97, 1, 4918, 0},
+  {99, 1, 4919, 0},
+  {101, 1, 4920, 0},
+  {110, 3, 4921, 0},
+  {115, 1, 4924, 0},
+  {111, 1, 4925, 0},
+  {115, 1, 4926, 0},
+  {100, 1, 4927, 0},
+  {115, 2, 4928, 0},
+  {97, 1, 4930, 0},
+  {117, 1, 4931, 0},
+  {69, 0, 0, 1017},
+  {101, 0, 0, 1018},
+  {108, 1, 4932, 0},
+  {101, 1, 4933, 0},
+  {105, 1, 4934, 0},
+  {117, 2, 4935, 0},
+  {114, 0, 0, 1019},
+  {104, 1, 4937, 0},
+  {114, 1, 4938, 1020},
+  {97, 1, 4939, 0},
+  {103, 0, 0, 1021},
+  {101, 1, 4940, 0},
+  {111, 1, 4941, 0},
+  {105, 1, 4942, 0},
+  {101, 1, 4943, 0},
+  {101, 2, 4944, 0},
+  {97, 2, 4946, 1022},
+  {107, 2, 4948, 0},
+  {115, 1, 4950, 0},
+  {112, 0, 0, 1023},
+  {105, 1, 4951, 0},
+  {110, 0, 0, 1024},
+  {101, 0, 0, 1025},
+  {115, 2, 4952, 1026},
+  {111, 1, 4954, 0},
+  {105, 1, 4955, 0},
+  {111, 1, 4956, 0},
+  {109, 1, 4957, 0},
+  {101, 0, 0, 1027},
+  {110, 1, 4958, 0},
+  {111, 1, 4959, 0},
+  {105, 1, 4960, 0},
+  {108, 1, 4961, 0},
+  {98, 0, 0, 1028},
+  {105, 1, 4962, 0},
+  {122, 1, 4963, 0},
+  {121, 0, 0, 1029},
+  {111, 1, 4964, 0},
+  {116, 0, 0, 1030},
+  {101, 1, 4965, 0},
+  {116, 1, 4966, 0},
+  {121, 0, 0, 1031},
+  {118, 1, 4967, 0},
+  {99, 0, 0, 1032},
+  {114, 0, 0, 1033},
+  {97, 1, 4968, 0},
+  {114, 0, 0, 1034},
+  {104, 1, 4969, 0},
+  {118, 1, 4970, 0},
+  {108, 0, 0, 1035},
+  {114, 0, 0, 1036},
+  {107, 0, 0, 1037},
+  {114, 1, 4971, 0},
+  {111, 1, 4972, 0},
+  {105, 0, 0, 1038},
+  {114, 0, 0, 1039},
+  {110, 0, 0, 1040},
+  {114, 1, 4973, 0},
+  {119, 1, 4974, 0},
+  {114, 1, 4975, 0},
+  {115, 0, 0, 1041},
+  {104, 0, 0, 1042},
+  {108, 1, 4976, 0},
+  {97, 1, 4977, 0},
+  {114, 1, 4978, 0},
+  {111, 1, 4979, 0},
+  {103, 0, 0, 1043},
+  {105, 0, 0, 1044},
+  {116, 0, 0, 1045},
+  {100, 1, 4980, 0},
+  {102, 0, 0, 1046},
+  {114, 0, 0, 1047},
+  {103, 1, 4981, 0},
+  {118, 0, 0, 1048},
+  {104, 0, 0, 1049},
+  {114, 1, 4982, 0},
+  {112, 1, 4983, 0},
+  {97, 1, 4984, 0},
+  {111, 1, 4985, 0},
+  {104, 1, 4986, 0},
+  {105, 0, 0, 1050},
+  {114, 1, 4987, 0},
+  {104, 1, 4988, 0},
+  {105, 1, 4989, 0},
+  {117, 2, 4990, 0},
+  {104, 1, 4992, 0},
+  {114, 1, 4993, 0},
+  {104, 0, 0, 1051},
+  {97, 1, 4994, 0},
+  {113, 0, 0, 1052},
+  {105, 1, 4995, 0},
+  {97, 1, 4996, 0},
+  {105, 0, 0, 1053},
+  {98, 0, 0, 1054},
+  {112, 0, 0, 1055},
+  {112, 0, 0, 1056},
+  {105, 0, 0, 1057},
+  {110, 2, 4997, 0},
+  {110, 2, 4999, 0},
+  {122, 1, 5001, 0},
+  {99, 0, 0, 1058},
+  {97, 1, 5002, 0},
+  {101, 1, 5003, 1059},
+  {114, 1, 5004, 0},
+  {116, 1, 5005, 0},
+  {99, 0, 0, 1060},
+  {105, 0, 0, 1061},
+  {114, 0, 0, 1062},
+  {114, 0, 0, 1063},
+  {114, 0, 0, 1064},
+  {114, 0, 0, 1065},
+  {116, 0, 0, 1066},
+  {117, 1, 5006, 0},
+  {109, 1, 5007, 0},
+  {114, 0, 0, 1067},
+  {114, 0, 0, 1068},
+  {117, 1, 5008, 0},
+  {117, 1, 5009, 0},
+  {105, 0, 0, 1069},
+  {103, 1, 5010, 0},
+  {116, 1, 5011, 0},
+  {99, 0, 0, 1070},
+  {116, 1, 5012, 0},
+  {111, 1, 5013, 0},
+  {114, 1, 5014, 0},
+  {97, 1, 5015, 0},
+  {101, 0, 0, 1071},
+  {101, 0, 0, 1072},
+  {101, 0, 0, 1073},
+  {70, 1, 5016, 0},
+  {110, 0, 0, 1074},
+  {101, 0, 0, 1075},
+  {108, 1, 5017, 0},
+  {100, 0, 0, 1076},
+  {115, 1, 5018, 0},
+  {117, 1, 5019, 0},
+  {113, 0, 0, 1077},
+  {101, 0, 0, 1078},
+  {97, 1, 5020, 0},
+  {121, 1, 5021, 0},
+  {110, 0, 0, 1079},
+  {108, 0, 0, 1080},
+  {110, 1, 5022, 0},
+  {108, 1, 5023, 0},
+  {114, 1, 5024, 0},
+  {101, 4, 5025, 0},
+  {119, 1, 5029, 0},
+  {67, 1, 5030, 0},
+  {101, 0, 0, 1081},
+  {117, 1, 5031, 0},
+  {116, 0, 0, 1082},
+  {117, 1, 5032, 0},
+  {100, 1, 5033, 0},
+  {101, 1, 5034, 0},
+  {112, 0, 0, 1083},
+  {97, 1, 5035, 0},
+  {114, 0, 0, 1084},
+  {110, 0, 0, 1085},
+  {105, 1, 5036, 0},
+  {110, 1, 5037, 0},
+  {114, 1, 5038, 0},
+  {116, 0, 0, 1086},
+  {117, 1, 5039, 0},
+  {101, 6, 5040, 0},
+  {114, 1, 5046, 0},
+  {114, 1, 5047, 0},
+  {101, 1, 5048, 0},
+  {105, 1, 5049, 0},
+  {101, 1, 5050, 0},
+  {114, 1, 5051, 0},
+  {107, 0, 0, 1087},
+  {101, 0, 0, 1088},
+  {110, 0, 0, 1089},
+  {101, 0, 0, 1090},
+  {110, 1, 5052, 0},
+  {83, 1, 5053, 0},
+  {86, 1, 5054, 0},
+  {111, 1, 5055, 0},
+  {84, 1, 5056, 0},
+  {105, 1, 5057, 0},
+  {115, 0, 0, 1091},
+  {101, 1, 5058, 0},
+  {100, 2, 5059, 0},
+  {108, 0, 0, 1092},
+  {101, 1, 5061, 0},
+  {100, 0, 0, 1093},
+  {101, 0, 0, 1094},
+  {108, 0, 0, 1095},
+  {101, 1, 5062, 0},
+  {121, 0, 0, 1096},
+  {114, 1, 5063, 0},
+  {111, 1, 5064, 0},
+  {107, 0, 0, 1097},
+  {111, 1, 5065, 0},
+  {113, 1, 5066, 0},
+  {101, 0, 0, 1098},
+  {101, 0, 0, 1099},
+  {110, 1, 5067, 0},
+  {101, 1, 5068, 0},
+  {114, 1, 5069, 0},
+  {115, 1, 5070, 0},
+  {105, 1, 5071, 0},
+  {101, 0, 0, 1100},
+  {121, 0, 0, 1101},
+  {108, 0, 0, 1102},
+  {101, 0, 0, 1103},
+  {97, 0, 0, 1104},
+  {99, 1, 5072, 0},
+  {110, 0, 0, 1105},
+  {108, 0, 0, 1106},
+  {110, 1, 5073, 0},
+  {114, 1, 5074, 0},
+  {101, 1, 5075, 0},
+  {111, 2, 5076, 0},
+  {108, 1, 5078, 0},
+  {105, 1, 5079, 0},
+  {101, 1, 5080, 0},
+  {114, 1, 5081, 0},
+  {112, 3, 5082, 0},
+  {101, 1, 5085, 0},
+  {114, 1, 5086, 0},
+  {105, 1, 5087, 0},
+  {113, 1, 5088, 0},
+  {117, 1, 5089, 0},
+  {114, 1, 5090, 0},
+  {101, 1, 5091, 0},
+  {108, 1, 5092, 0},
+  {105, 1, 5093, 0},
+  {97, 1, 5094, 0},
+  {116, 0, 0, 1107},
+  {101, 1, 5095, 0},
+  {105, 1, 5096, 0},
+  {101, 1, 5097, 0},
+  {105, 1, 5098, 0},
+  {76, 1, 5099, 0},
+  {82, 1, 5100, 0},
+  {107, 0, 0, 1108},
+  {109, 1, 5101, 0},
+  {110, 1, 5102, 0},
+  {80, 1, 5103, 0},
+  {101, 0, 0, 1109},
+  {110, 0, 0, 1110},
+  {108, 0, 0, 1111},
+  {105, 1, 5104, 0},
+  {100, 2, 5105, 0},
+  {110, 1, 5107, 0},
+  {97, 1, 5108, 0},
+  {101, 1, 5109, 0},
+  {110, 1, 5110, 0},
+  {112, 1, 5111, 0},
+  {117, 1, 5112, 0},
+  {101, 1, 5113, 0},
+  {117, 1, 5114, 0},
+  {105, 1, 5115, 0},
+  {101, 1, 5116, 0},
+  {109, 1, 5117, 0},
+  {102, 1, 5118, 0},
+  {115, 1, 5119, 0},
+  {115, 1, 5120, 0},
+  {101, 1, 5121, 0},
+  {118, 1, 5122, 0},
+  {103, 1, 5123, 0},
+  {117, 1, 5124, 0},
+  {98, 1, 5125, 0},
+  {99, 1, 5126, 0},
+  {112, 1, 5127, 0},
+  {108, 1, 5128, 0},
+  {114, 1, 5129, 0},
+  {101, 0, 0, 1112},
+  {101, 0, 0, 1113},
+  {99, 0, 0, 1114},
+  {101, 0, 0, 1115},
+  {111, 1, 5130, 0},
+  {117, 1, 5131, 0},
+  {104, 0, 0, 1116},
+  {101, 0, 0, 1117},
+  {115, 0, 0, 1118},
+  {97, 1, 5132, 0},
+  {114, 1, 5133, 0},
+  {97, 1, 5134, 0},
+  {97, 1, 5135, 0},
+  {105, 1, 5136, 0},
+  {97, 1, 5137, 0},
+  {100, 1, 5138, 0},
+  {99, 1, 5139, 0},
+  {114, 1, 5140, 0},
+  {101, 0, 0, 1119},
+  {108, 0, 0, 1120},
+  {110, 0, 0, 1121},
+  {108, 0, 0, 1122},
+  {115, 1, 5141, 0},
+  {65, 2, 5142, 0},
+  {67, 1, 5144, 0},
+  {68, 1, 5145, 0},
+  {70, 1, 5146, 0},
+  {84, 2, 5147, 0},
+  {85, 1, 5149, 0},
+  {86, 1, 5150, 0},
+  {97, 1, 5151, 0},
+  {73, 1, 5152, 0},
+  {116, 1, 5153, 0},
+  {101, 1, 5154, 0},
+  {121, 0, 0, 1123},
+  {121, 0, 0, 1124},
+  {101, 0, 0, 1125},
+  {110, 0, 0, 1126},
+  {108, 0, 0, 1127},
+  {68, 1, 5155, 0},
+  {76, 1, 5156, 0},
+  {82, 1, 5157, 0},
+  {85, 1, 5158, 0},
+  {67, 1, 5159, 0},
+  {101, 3, 5160, 1128},
+  {116, 1, 5163, 1129},
+  {101, 1, 5164, 0},
+  {104, 1, 5165, 0},
+  {115, 1, 5166, 0},
+  {116, 0, 0, 1130},
+  {110, 0, 0, 1131},
+  {108, 0, 0, 1132},
+  {102, 1, 5167, 0},
+  {83, 1, 5168, 0},
+  {112, 1, 5169, 0},
+  {69, 1, 5170, 0},
+  {70, 1, 5171, 0},
+  {84, 1, 5172, 0},
+  {101, 1, 5173, 0},
+  {107, 0, 0, 1133},
+  {101, 0, 0, 1134},
+  {99, 1, 5174, 0},
+  {101, 0, 0, 1135},
+  {99, 0, 0, 1136},
+  {101, 0, 0, 1137},
+  {66, 2, 5175, 0},
+  {80, 1, 5177, 0},
+  {80, 1, 5178, 0},
+  {111, 1, 5179, 0},
+  {110, 1, 5180, 0},
+  {105, 1, 5181, 0},
+  {65, 1, 5182, 0},
+  {111, 1, 5183, 0},
+  {110, 1, 5184, 0},
+  {76, 1, 5185, 0},
+  {82, 1, 5186, 0},
+  {111, 1, 5187, 0},
+  {101, 0, 0, 1138},
+  {108, 0, 0, 1139},
+  {114, 0, 0, 1140},
+  {99, 1, 5188, 0},
+  {104, 1, 5189, 0},
+  {104, 0, 0, 1141},
+  {101, 0, 0, 1142},
+  {101, 0, 0, 1143},
+  {110, 0, 0, 1144},
+  {105, 1, 5190, 0},
+  {101, 0, 0, 1145},
+  {101, 0, 0, 1146},
+  {101, 0, 0, 1147},
+  {121, 1, 5191, 0},
+  {100, 0, 0, 1148},
+  {111, 1, 5192, 0},
+  {100, 1, 5193, 1149},
+  {118, 1, 5194, 0},
+  {104, 0, 0, 1150},
+  {114, 1, 5195, 0},
+  {114, 0, 0, 1151},
+  {120, 1, 5196, 1152},
+  {101, 1, 5197, 0},
+  {101, 0, 0, 1153},
+  {105, 1, 5198, 0},
+  {111, 1, 5199, 0},
+  {112, 1, 5200, 0},
+  {114, 1, 5201, 0},
+  {105, 1, 5202, 0},
+  {101, 0, 0, 1154},
+  {100, 1, 5203, 1155},
+  {98, 1, 5204, 0},
+  {115, 1, 5205, 1156},
+  {121, 1, 5206, 0},
+  {117, 0, 0, 1157},
+  {101, 1, 5207, 0},
+  {112, 0, 0, 1158},
+  {114, 1, 5208, 0},
+  {112, 0, 0, 1159},
+  {111, 1, 5209, 0},
+  {108, 1, 5210, 0},
+  {105, 1, 5211, 0},
+  {99, 1, 5212, 0},
+  {97, 1, 5213, 0},
+  {105, 1, 5214, 0},
+  {108, 1, 5215, 0},
+  {101, 0, 0, 1160},
+  {100, 1, 5216, 0},
+  {119, 0, 0, 1161},
+  {108, 1, 5217, 0},
+  {115, 1, 5218, 0},
+  {116, 1, 5219, 0},
+  {105, 1, 5220, 0},
+  {109, 0, 0, 1162},
+  {101, 0, 0, 1163},
+  {120, 0, 0, 1164},
+  {110, 1, 5221, 0},
+  {117, 1, 5222, 0},
+  {109, 1, 5223, 0},
+  {101, 0, 0, 1165},
+  {114, 0, 0, 1166},
+  {115, 1, 5224, 0},
+  {116, 0, 0, 1167},
+  {113, 0, 0, 1168},
+  {101, 0, 0, 1169},
+  {100, 0, 0, 1170},
+  {99, 1, 5225, 0},
+  {112, 0, 0, 1171},
+  {112, 0, 0, 1172},
+  {116, 0, 0, 1173},
+  {110, 0, 0, 1174},
+  {108, 0, 0, 1175},
+  {115, 1, 5226, 0},
+  {121, 1, 5227, 0},
+  {114, 1, 5228, 0},
+  {109, 1, 5229, 0},
+  {113, 0, 0, 1176},
+  {101, 2, 5230, 0},
+  {105, 1, 5232, 0},
+  {100, 0, 0, 1177},
+  {105, 1, 5233, 0},
+  {117, 1, 5234, 0},
+  {101, 1, 5235, 1178},
+  {116, 0, 0, 1179},
+  {110, 0, 0, 1180},
+  {101, 2, 5236, 0},
+  {111, 1, 5238, 0},
+  {116, 0, 0, 1181},
+  {100, 0, 0, 1182},
+  {114, 0, 0, 1183},
+  {114, 2, 5239, 0},
+  {114, 1, 5241, 1184},
+  {99, 1, 5242, 0},
+  {112, 0, 0, 1185},
+  {112, 0, 0, 1186},
+  {116, 0, 0, 1187},
+  {114, 1, 5243, 1188},
+  {101, 1, 5244, 0},
+  {118, 1, 5245, 0},
+  {119, 1, 5246, 0},
+  {110, 0, 0, 1189},
+  {97, 1, 5247, 0},
+  {105, 1, 5248, 0},
+  {121, 0, 0, 1190},
+  {114, 0, 0, 1191},
+  {104, 0, 0, 1192},
+  {111, 1, 5249, 0},
+  {110, 0, 0, 1193},
+  {101, 1, 5250, 0},
+  {101, 1, 5251, 0},
+  {121, 1, 5252, 0},
+  {116, 0, 0, 1194},
+  {110, 1, 5253, 0},
+  {109, 1, 5254, 0},
+  {101, 1, 5255, 1195},
+  {120, 0, 0, 1196},
+  {110, 0, 0, 1197},
+  {112, 0, 0, 1198},
+  {114, 0, 0, 1199},
+  {100, 1, 5256, 0},
+  {110, 1, 5257, 0},
+  {117, 1, 5258, 0},
+  {117, 1, 5259, 0},
+  {101, 1, 5260, 0},
+  {114, 1, 5261, 0},
+  {111, 1, 5262, 0},
+  {97, 1, 5263, 0},
+  {114, 1, 5264, 0},
+  {110, 0, 0, 1200},
+  {112, 0, 0, 1201},
+  {107, 0, 0, 1202},
+  {108, 1, 5265, 0},
+  {97, 1, 5266, 0},
+  {101, 0, 0, 1203},
+  {114, 0, 0, 1204},
+  {110, 0, 0, 1205},
+  {110, 0, 0, 1206},
+  {101, 0, 0, 1207},
+  {116, 0, 0, 1208},
+  {101, 1, 5267, 0},
+  {116, 0, 0, 1209},
+  {115, 1, 5268, 0},
+  {118, 0, 0, 1210},
+  {51, 0, 0, 1211},
+  {52, 0, 0, 1212},
+  {108, 0, 0, 1213},
+  {111, 1, 5269, 0},
+  {99, 0, 0, 1214},
+  {111, 1, 5270, 0},
+  {110, 1, 5271, 0},
+  {115, 0, 0, 1215},
+  {116, 0, 0, 1216},
+  {68, 1, 5272, 0},
+  {114, 1, 5273, 0},
+  {116, 1, 5274, 0},
+  {101, 1, 5275, 0},
+  {110, 1, 5276, 0},
+  {101, 0, 0, 1217},
+  {103, 0, 0, 1218},
+  {103, 0, 0, 1219},
+  {108, 0, 0, 1220},
+  {105, 1, 5277, 0},
+  {50, 0, 0, 1221},
+  {51, 0, 0, 1222},
+  {52, 0, 0, 1223},
+  {53, 0, 0, 1224},
+  {54, 0, 0, 1225},
+  {56, 0, 0, 1226},
+  {51, 0, 0, 1227},
+  {53, 0, 0, 1228},
+  {52, 0, 0, 1229},
+  {53, 0, 0, 1230},
+  {56, 0, 0, 1231},
+  {53, 0, 0, 1232},
+  {54, 0, 0, 1233},
+  {56, 0, 0, 1234},
+  {56, 0, 0, 1235},
+  {101, 0, 0, 1236},
+  {100, 0, 0, 1237},
+  {101, 0, 0, 1238},
+  {97, 1, 5278, 0},
+  {116, 1, 5279, 1239},
+  {115, 0, 0, 1240},
+  {114, 1, 5280, 0},
+  {114, 0, 0, 1241},
+  {115, 1, 5281, 0},
+  {112, 1, 5282, 0},
+  {114, 0, 0, 1242},
+  {116, 0, 0, 1243},
+  {108, 1, 5283, 0},
+  {113, 1, 5284, 0},
+  {115, 1, 5285, 0},
+  {109, 0, 0, 1244},
+  {110, 1, 5286, 0},
+  {112, 0, 0, 1245},
+  {116, 0, 0, 1246},
+  {121, 0, 0, 1247},
+  {105, 1, 5287, 0},
+  {115, 1, 5288, 1248},
+  {112, 0, 0, 1249},
+  {110, 0, 0, 1250},
+  {114, 1, 5289, 0},
+  {114, 1, 5290, 0},
+  {116, 0, 0, 1251},
+  {101, 1, 5291, 0},
+  {105, 1, 5292, 0},
+  {114, 0, 0, 1252},
+  {104, 0, 0, 1253},
+  {107, 0, 0, 1254},
+  {108, 0, 0, 1255},
+  {110, 0, 0, 1256},
+  {101, 0, 0, 1257},
+  {101, 0, 0, 1258},
+  {116, 0, 0, 1259},
+  {110, 0, 0, 1260},
+  {105, 1, 5293, 0},
+  {97, 1, 5294, 0},
+  {101, 0, 0, 1261},
+  {116, 1, 5295, 0},
+  {116, 0, 0, 1262},
+  {108, 0, 0, 1263},
+  {101, 1, 5296, 0},
+  {99, 1, 5297, 0},
+  {114, 1, 5298, 0},
+  {111, 1, 5299, 0},
+  {116, 0, 0, 1264},
+  {111, 1, 5300, 0},
+  {118, 0, 0, 1265},
+  {101, 0, 0, 1266},
+  {121, 0, 0, 1267},
+  {118, 0, 0, 1268},
+  {108, 0, 0, 1269},
+  {110, 0, 0, 1270},
+  {108, 0, 0, 1271},
+  {101, 0, 0, 1272},
+  {116, 1, 5301, 0},
+  {110, 0, 0, 1273},
+  {97, 0, 0, 1274},
+  {101, 0, 0, 1275},
+  {102, 1, 5302, 0},
+  {115, 0, 0, 1276},
+  {107, 0, 0, 1277},
+  {112, 0, 0, 1278},
+  {108, 0, 0, 1279},
+  {105, 1, 5303, 0},
+  {108, 0, 0, 1280},
+  {108, 0, 0, 1281},
+  {101, 0, 0, 1282},
+  {107, 0, 0, 1283},
+  {108, 2, 5304, 0},
+  {110, 0, 0, 1284},
+  {108, 0, 0, 1285},
+  {114, 0, 0, 1286},
+  {97, 1, 5306, 0},
+  {104, 1, 5307, 0},
+  {114, 1, 5308, 0},
+  {97, 1, 5309, 0},
+  {101, 1, 5310, 0},
+  {105, 1, 5311, 0},
+  {104, 1, 5312, 0},
+  {97, 1, 5313, 0},
+  {116, 1, 5314, 1287},
+  {115, 0, 0, 1288},
+  {112, 1, 5315, 0},
+  {111, 1, 5316, 0},
+  {113, 2, 5317, 0},
+  {116, 1, 5319, 0},
+  {105, 1, 5320, 0},
+  {116, 0, 0, 1289},
+  {114, 0, 0, 1290},
+  {108, 0, 0, 1291},
+  {110, 1, 5321, 0},
+  {100, 0, 0, 1292},
+  {116, 0, 0, 1293},
+  {116, 1, 5322, 1294},
+  {114, 1, 5323, 0},
+  {101, 1, 5324, 0},
+  {97, 1, 5325, 0},
+  {105, 1, 5326, 0},
+  {114, 1, 5327, 0},
+  {115, 0, 0, 1295},
+  {101, 1, 5328, 0},
+  {116, 0, 0, 1296},
+  {114, 0, 0, 1297},
+  {103, 1, 5329, 0},
+  {116, 0, 0, 1298},
+  {110, 1, 5330, 0},
+  {100, 0, 0, 1299},
+  {111, 0, 0, 1300},
+  {114, 0, 0, 1301},
+  {107, 0, 0, 1302},
+  {101, 0, 0, 1303},
+  {115, 0, 0, 1304},
+  {114, 0, 0, 1305},
+  {115, 1, 5331, 0},
+  {114, 0, 0, 1306},
+  {104, 1, 5332, 0},
+  {97, 1, 5333, 0},
+  {110, 1, 5334, 0},
+  {115, 1, 5335, 0},
+  {111, 3, 5336, 1307},
+  {114, 0, 0, 1308},
+  {97, 0, 0, 1309},
+  {114, 1, 5339, 0},
+  {116, 0, 0, 1310},
+  {114, 0, 0, 1311},
+  {116, 0, 0, 1312},
+  {98, 0, 0, 1313},
+  {100, 1, 5340, 1314},
+  {115, 0, 0, 1315},
+  {115, 0, 0, 1316},
+  {115, 0, 0, 1317},
+  {109, 1, 5341, 0},
+  {97, 1, 5342, 0},
+  {114, 1, 5343, 0},
+  {116, 1, 5344, 0},
+  {104, 0, 0, 1318},
+  {104, 0, 0, 1319},
+  {101, 0, 0, 1320},
+  {111, 1, 5345, 0},
+  {97, 1, 5346, 0},
+  {101, 0, 0, 1321},
+  {110, 0, 0, 1322},
+  {108, 0, 0, 1323},
+  {100, 1, 5347, 0},
+  {107, 0, 0, 1324},
+  {111, 1, 5348, 0},
+  {118, 0, 0, 1325},
+  {114, 0, 0, 1326},
+  {116, 1, 5349, 1327},
+  {108, 1, 5350, 0},
+  {97, 1, 5351, 0},
+  {114, 1, 5352, 0},
+  {108, 1, 5353, 0},
+  {101, 0, 0, 1328},
+  {69, 0, 0, 1329},
+  {100, 1, 5354, 0},
+  {118, 3, 5355, 0},
+  {118, 3, 5358, 0},
+  {108, 1, 5361, 0},
+  {108, 0, 0, 1330},
+  {110, 1, 5362, 0},
+  {101, 0, 0, 1331},
+  {101, 1, 5363, 0},
+  {99, 0, 0, 1332},
+  {119, 0, 0, 1333},
+  {116, 1, 5364, 0},
+  {101, 0, 0, 1334},
+  {101, 0, 0, 1335},
+  {116, 2, 5365, 0},
+  {113, 0, 0, 1336},
+  {98, 1, 5367, 0},
+  {112, 1, 5368, 0},
+  {101, 1, 5369, 0},
+  {101, 1, 5370, 0},
+  {101, 1, 5371, 0},
+  {101, 0, 0, 1337},
+  {110, 1, 5372, 0},
+  {111, 0, 0, 1338},
+  {104, 0, 0, 1339},
+  {114, 0, 0, 1340},
+  {104, 0, 0, 1341},
+  {105, 1, 5373, 0},
+  {114, 0, 0, 1342},
+  {105, 1, 5374, 0},
+  {114, 0, 0, 1343},
+  {105, 1, 5375, 0},
+  {107, 0, 0, 1344},
+  {111, 1, 5376, 0},
+  {114, 0, 0, 1345},
+  {101, 0, 0, 1346},
+  {99, 0, 0, 1347},
+  {100, 0, 0, 1348},
+  {101, 0, 0, 1349},
+  {115, 1, 5377, 0},
+  {111, 1, 5378, 0},
+  {115, 0, 0, 1350},
+  {111, 1, 5379, 0},
+  {102, 0, 0, 1351},
+  {112, 1, 5380, 0},
+  {104, 0, 0, 1352},
+  {101, 0, 0, 1353},
+  {115, 1, 5381, 1354},
+  {108, 1, 5382, 0},
+  {109, 0, 0, 1355},
+  {116, 0, 0, 1356},
+  {100, 0, 0, 1357},
+  {108, 0, 0, 1358},
+  {110, 1, 5383, 0},
+  {116, 0, 0, 1359},
+  {102, 1, 5384, 0},
+  {107, 1, 5385, 1360},
+  {118, 0, 0, 1361},
+  {99, 1, 5386, 0},
+  {105, 1, 5387, 0},
+  {111, 0, 0, 1362},
+  {117, 0, 0, 1363},
+  {110, 0, 0, 1364},
+  {105, 1, 5388, 0},
+  {119, 1, 5389, 0},
+  {105, 1, 5390, 0},
+  {112, 1, 5391, 0},
+  {117, 1, 5392, 0},
+  {113, 0, 0, 1365},
+  {97, 1, 5393, 0},
+  {101, 1, 5394, 0},
+  {115, 1, 5395, 0},
+  {105, 1, 5396, 0},
+  {115, 0, 0, 1366},
+  {109, 0, 0, 1367},
+  {108, 1, 5397, 0},
+  {105, 1, 5398, 0},
+  {117, 1, 5399, 0},
+  {111, 0, 0, 1368},
+  {108, 0, 0, 1369},
+  {112, 0, 0, 1370},
+  {101, 0, 0, 1371},
+  {114, 1, 5400, 0},
+  {110, 1, 5401, 0},
+  {101, 1, 5402, 0},
+  {108, 0, 0, 1372},
+  {101, 0, 0, 1373},
+  {116, 1, 5403, 0},
+  {101, 0, 0, 1374},
+  {112, 0, 0, 1375},
+  {102, 1, 5404, 0},
+  {115, 0, 0, 1376},
+  {107, 0, 0, 1377},
+  {112, 0, 0, 1378},
+  {108, 0, 0, 1379},
+  {105, 1, 5405, 0},
+  {108, 0, 0, 1380},
+  {108, 0, 0, 1381},
+  {110, 1, 5406, 0},
+  {101, 0, 0, 1382},
+  {107, 0, 0, 1383},
+  {108, 2, 5407, 0},
+  {110, 0, 0, 1384},
+  {108, 0, 0, 1385},
+  {97, 1, 5409, 0},
+  {114, 0, 0, 1386},
+  {110, 1, 5410, 0},
+  {97, 1, 5411, 0},
+  {116, 0, 0, 1387},
+  {114, 0, 0, 1388},
+  {108, 0, 0, 1389},
+  {97, 1, 5412, 0},
+  {104, 1, 5413, 0},
+  {108, 1, 5414, 0},
+  {114, 1, 5415, 0},
+  {115, 1, 5416, 0},
+  {116, 1, 5417, 0},
+  {103, 1, 5418, 0},
+  {116, 1, 5419, 1390},
+  {115, 0, 0, 1391},
+  {101, 1, 5420, 0},
+  {116, 0, 0, 1392},
+  {105, 1, 5421, 0},
+  {111, 0, 0, 1393},
+  {114, 0, 0, 1394},
+  {101, 0, 0, 1395},
+  {115, 0, 0, 1396},
+  {116, 1, 5422, 0},
+  {97, 1, 5423, 0},
+  {101, 0, 0, 1397},
+  {110, 0, 0, 1398},
+  {108, 0, 0, 1399},
+  {109, 0, 0, 1400},
+  {105, 1, 5424, 0},
+  {107, 0, 0, 1401},
+  {111, 1, 5425, 0},
+  {114, 0, 0, 1402},
+  {110, 1, 5426, 0},
+  {110, 0, 0, 1403},
+  {121, 0, 0, 1404},
+  {109, 1, 5427, 0},
+  {112, 1, 5428, 0},
+  {102, 0, 0, 1405},
+  {118, 0, 0, 1406},
+  {116, 0, 0, 1407},
+  {117, 1, 5429, 0},
+  {114, 1, 5430, 0},
+  {115, 1, 5431, 0},
+  {112, 0, 0, 1408},
+  {114, 1, 5432, 0},
+  {121, 0, 0, 1409},
+  {114, 0, 0, 1410},
+  {115, 1, 5433, 1411},
+  {115, 0, 0, 1412},
+  {115, 0, 0, 1413},
+  {101, 0, 0, 1414},
+  {115, 1, 5434, 0},
+  {101, 0, 0, 1415},
+  {115, 1, 5435, 0},
+  {101, 0, 0, 1416},
+  {102, 0, 0, 1417},
+  {110, 0, 0, 1418},
+  {101, 0, 0, 1419},
+  {102, 0, 0, 1420},
+  {103, 1, 5436, 0},
+  {116, 0, 0, 1421},
+  {111, 1, 5437, 0},
+  {108, 1, 5438, 0},
+  {117, 1, 5439, 0},
+  {114, 1, 5440, 0},
+  {116, 2, 5441, 1422},
+  {109, 0, 0, 1423},
+  {98, 0, 0, 1424},
+  {112, 0, 0, 1425},
+  {112, 1, 5443, 0},
+  {117, 1, 5444, 0},
+  {113, 0, 0, 1426},
+  {97, 1, 5445, 0},
+  {101, 1, 5446, 0},
+  {115, 1, 5447, 0},
+  {105, 1, 5448, 0},
+  {116, 0, 0, 1427},
+  {117, 1, 5449, 0},
+  {111, 1, 5450, 0},
+  {111, 1, 5451, 0},
+  {117, 1, 5452, 0},
+  {114, 1, 5453, 0},
+  {108, 1, 5454, 0},
+  {117, 1, 5455, 0},
+  {116, 2, 5456, 1428},
+  {109, 0, 0, 1429},
+  {98, 0, 0, 1430},
+  {112, 0, 0, 1431},
+  {107, 0, 0, 1432},
+  {111, 1, 5458, 0},
+  {114, 0, 0, 1433},
+  {116, 0, 0, 1434},
+  {110, 0, 0, 1435},
+  {108, 0, 0, 1436},
+  {99, 0, 0, 1437},
+  {52, 0, 0, 1438},
+  {102, 1, 5459, 0},
+  {115, 1, 5460, 0},
+  {118, 0, 0, 1439},
+  {97, 1, 5461, 0},
+  {115, 1, 5462, 0},
+  {112, 0, 0, 1440},
+  {109, 0, 0, 1441},
+  {98, 1, 5463, 1442},
+  {100, 0, 0, 1443},
+  {116, 0, 0, 1444},
+  {114, 0, 0, 1445},
+  {114, 1, 5464, 0},
+  {101, 0, 0, 1446},
+  {103, 1, 5465, 0},
+  {116, 0, 0, 1447},
+  {110, 1, 5466, 0},
+  {117, 1, 5467, 0},
+  {109, 1, 5468, 0},
+  {105, 1, 5469, 0},
+  {107, 0, 0, 1448},
+  {97, 1, 5470, 0},
+  {101, 0, 0, 1449},
+  {101, 0, 0, 1450},
+  {99, 0, 0, 1451},
+  {116, 0, 0, 1452},
+  {101, 0, 0, 1453},
+  {110, 1, 5471, 1454},
+  {112, 0, 0, 1455},
+  {111, 1, 5472, 0},
+  {110, 1, 5473, 0},
+  {112, 1, 5474, 0},
+  {111, 1, 5475, 0},
+  {114, 1, 5476, 0},
+  {110, 1, 5477, 1456},
+  {112, 0, 0, 1457},
+  {101, 0, 0, 1458},
+  {108, 1, 5478, 0},
+  {116, 0, 0, 1459},
+  {115, 1, 5479, 0},
+  {112, 1, 5480, 0},
+  {116, 1, 5481, 0},
+  {105, 0, 0, 1460},
+  {111, 1, 5482, 0},
+  {111, 0, 0, 1461},
+  {103, 1, 5483, 0},
+  {98, 1, 5484, 0},
+  {112, 1, 5485, 0},
+  {101, 1, 5486, 0},
+  {105, 1, 5487, 0},
+  {114, 0, 0, 1462},
+  {112, 0, 0, 1463},
+  {114, 0, 0, 1464},
+  {69, 0, 0, 1465},
+  {101, 0, 0, 1466},
+  {69, 0, 0, 1467},
+  {101, 0, 0, 1468},
+  {97, 1, 5488, 0},
+  {114, 0, 0, 1469},
+  {113, 0, 0, 1470},
+  {112, 0, 0, 1471},
+  {104, 0, 0, 1472},
+  {115, 0, 0, 1473},
+  {101, 0, 0, 1474},
+  {112, 0, 0, 1475},
+  {115, 0, 0, 1476},
+  {101, 0, 0, 1477},
+  {101, 0, 0, 1478},
+  {101, 0, 0, 1479},
+  {110, 0, 0, 1480},
+  {102, 0, 0, 1481},
+  {114, 1, 5489, 0},
+  {117, 1, 5490, 0},
+  {97, 1, 5491, 0},
+  {101, 0, 0, 1482},
+  {108, 1, 5492, 0},
+  {108, 1, 5493, 0},
+  {115, 0, 0, 1483},
+  {116, 0, 0, 1484},
+  {97, 0, 0, 1485},
+  {68, 1, 5494, 0},
+  {68, 1, 5495, 0},
+  {77, 1, 5496, 0},
+  {80, 1, 5497, 0},
+  {84, 1, 5498, 0},
+  {105, 1, 5499, 0},
+  {117, 1, 5500, 0},
+  {101, 1, 5501, 0},
+  {114, 1, 5502, 0},
+  {117, 1, 5503, 0},
+  {114, 1, 5504, 0},
+  {104, 1, 5505, 0},
+  {116, 1, 5506, 0},
+  {100, 0, 0, 1486},
+  {101, 1, 5507, 0},
+  {97, 1, 5508, 0},
+  {67, 1, 5509, 0},
+  {68, 1, 5510, 0},
+  {76, 2, 5511, 0},
+  {82, 1, 5513, 0},
+  {85, 1, 5514, 0},
+  {86, 1, 5515, 0},
+  {114, 1, 5516, 0},
+  {101, 1, 5517, 0},
+  {102, 1, 5518, 0},
+  {103, 1, 5519, 0},
+  {101, 1, 5520, 1487},
+  {114, 1, 5521, 0},
+  {116, 0, 0, 1488},
+  {109, 1, 5522, 0},
+  {101, 1, 5523, 0},
+  {110, 0, 0, 1489},
+  {105, 1, 5524, 0},
+  {98, 1, 5525, 0},
+  {110, 1, 5526, 0},
+  {83, 1, 5527, 0},
+  {86, 1, 5528, 0},
+  {114, 1, 5529, 0},
+  {114, 6, 5530, 0},
+  {116, 1, 5536, 0},
+  {110, 1, 5537, 0},
+  {119, 1, 5538, 0},
+  {117, 1, 5539, 0},
+  {97, 1, 5540, 0},
+  {115, 0, 0, 1490},
+  {97, 1, 5541, 0},
+  {101, 1, 5542, 0},
+  {98, 1, 5543, 0},
+  {101, 1, 5544, 0},
+  {103, 1, 5545, 0},
+  {114, 1, 5546, 0},
+  {105, 1, 5547, 0},
+  {117, 1, 5548, 0},
+  {119, 1, 5549, 0},
+  {111, 1, 5550, 0},
+  {103, 1, 5551, 0},
+  {101, 2, 5552, 1491},
+  {105, 1, 5554, 0},
+  {68, 1, 5555, 0},
+  {84, 1, 5556, 0},
+  {86, 1, 5557, 0},
+  {99, 1, 5558, 0},
+  {114, 1, 5559, 0},
+  {103, 1, 5560, 0},
+  {117, 1, 5561, 0},
+  {108, 1, 5562, 0},
+  {101, 1, 5563, 0},
+  {115, 1, 5564, 0},
+  {97, 1, 5565, 0},
+  {108, 1, 5566, 0},
+  {114, 1, 5567, 0},
+  {102, 1, 5568, 0},
+  {103, 1, 5569, 0},
+  {102, 1, 5570, 0},
+  {103, 1, 5571, 0},
+  {101, 1, 5572, 0},
+  {105, 1, 5573, 0},
+  {83, 1, 5574, 0},
+  {116, 1, 5575, 0},
+  {108, 1, 5576, 0},
+  {118, 1, 5577, 0},
+  {71, 1, 5578, 0},
+  {76, 1, 5579, 0},
+  {101, 0, 0, 1492},
+  {107, 0, 0, 1493},
+  {97, 1, 5580, 0},
+  {103, 1, 5581, 0},
+  {67, 1, 5582, 0},
+  {98, 1, 5583, 0},
+  {109, 1, 5584, 0},
+  {97, 1, 5585, 0},
+  {115, 1, 5586, 0},
+  {97, 1, 5587, 0},
+  {112, 2, 5588, 0},
+  {116, 1, 5590, 0},
+  {115, 5, 5591, 1494},
+  {116, 1, 5596, 0},
+  {99, 1, 5597, 0},
+  {101, 1, 5598, 0},
+  {104, 1, 5599, 0},
+  {97, 1, 5600, 0},
+  {115, 1, 5601, 0},
+  {99, 1, 5602, 0},
+  {101, 1, 5603, 0},
+  {100, 1, 5604, 0},
+  {116, 1, 5605, 0},
+  {110, 0, 0, 1495},
+  {114, 1, 5606, 0},
+  {114, 0, 0, 1496},
+  {97, 1, 5607, 0},
+  {114, 1, 5608, 0},
+  {108, 1, 5609, 0},
+  {110, 1, 5610, 0},
+  {114, 1, 5611, 0},
+  {101, 1, 5612, 0},
+  {116, 0, 0, 1497},
+  {116, 1, 5613, 0},
+  {101, 2, 5614, 0},
+  {110, 1, 5616, 0},
+  {114, 1, 5617, 0},
+  {101, 1, 5618, 0},
+  {111, 2, 5619, 0},
+  {108, 1, 5621, 0},
+  {101, 1, 5622, 0},
+  {114, 1, 5623, 0},
+  {112, 3, 5624, 0},
+  {101, 1, 5627, 0},
+  {114, 1, 5628, 0},
+  {109, 1, 5629, 0},
+  {97, 1, 5630, 0},
+  {108, 1, 5631, 0},
+  {111, 1, 5632, 0},
+  {101, 1, 5633, 0},
+  {105, 1, 5634, 0},
+  {112, 1, 5635, 0},
+  {105, 1, 5636, 0},
+  {73, 1, 5637, 0},
+  {83, 1, 5638, 0},
+  {85, 1, 5639, 0},
+  {69, 1, 5640, 0},
+  {100, 1, 5641, 0},
+  {97, 1, 5642, 0},
+  {101, 1, 5643, 0},
+  {111, 1, 5644, 0},
+  {112, 1, 5645, 0},
+  {97, 1, 5646, 0},
+  {113, 1, 5647, 0},
+  {117, 1, 5648, 0},
+  {105, 1, 5649, 0},
+  {68, 1, 5650, 0},
+  {105, 1, 5651, 0},
+  {97, 1, 5652, 0},
+  {114, 1, 5653, 0},
+  {97, 1, 5654, 0},
+  {108, 1, 5655, 0},
+  {119, 2, 5656, 1498},
+  {65, 1, 5658, 0},
+  {108, 1, 5659, 0},
+  {114, 1, 5660, 0},
+  {119, 0, 0, 1499},
+  {97, 1, 5661, 0},
+  {101, 1, 5662, 0},
+  {105, 1, 5663, 0},
+  {110, 0, 0, 1500},
+  {97, 1, 5664, 0},
+  {105, 1, 5665, 0},
+  {100, 1, 5666, 0},
+  {109, 0, 0, 1501},
+  {112, 1, 5667, 0},
+  {97, 8, 5668, 0},
+  {98, 1, 5676, 1502},
+  {114, 0, 0, 1503},
+  {101, 1, 5677, 0},
+  {113, 0, 0, 1504},
+  {110, 1, 5678, 0},
+  {110, 1, 5679, 0},
+  {115, 1, 5680, 0},
+  {105, 1, 5681, 0},
+  {109, 1, 5682, 1505},
+  {103, 1, 5683, 0},
+  {114, 1, 5684, 0},
+  {101, 0, 0, 1506},
+  {118, 0, 0, 1507},
+  {110, 0, 0, 1508},
+  {99, 0, 0, 1509},
+  {116, 0, 0, 1510},
+  {117, 1, 5685, 0},
+  {109, 1, 5686, 0},
+  {117, 1, 5687, 0},
+  {114, 0, 0, 1511},
+  {97, 1, 5688, 0},
+  {117, 1, 5689, 0},
+  {103, 1, 5690, 0},
+  {111, 1, 5691, 0},
+  {113, 1, 5692, 0},
+  {114, 1, 5693, 0},
+  {118, 0, 0, 1512},
+  {117, 1, 5694, 0},
+  {115, 0, 0, 1513},
+  {101, 1, 5695, 0},
+  {117, 1, 5696, 0},
+  {117, 1, 5697, 0},
+  {109, 0, 0, 1514},
+  {118, 0, 0, 1515},
+  {100, 1, 5698, 0},
+  {97, 1, 5699, 0},
+  {97, 1, 5700, 0},
+  {100, 5, 5701, 0},
+  {110, 1, 5706, 0},
+  {114, 0, 0, 1516},
+  {105, 1, 5707, 0},
+  {113, 0, 0, 1517},
+  {109, 1, 5708, 0},
+  {120, 1, 5709, 0},
+  {116, 0, 0, 1518},
+  {108, 0, 0, 1519},
+  {114, 0, 0, 1520},
+  {112, 0, 0, 1521},
+  {97, 1, 5710, 0},
+  {109, 0, 0, 1522},
+  {113, 2, 5711, 0},
+  {101, 1, 5713, 0},
+  {101, 1, 5714, 0},
+  {114, 1, 5715, 0},
+  {110, 1, 5716, 0},
+  {119, 0, 0, 1523},
+  {114, 0, 0, 1524},
+  {113, 0, 0, 1525},
+  {118, 0, 0, 1526},
+  {100, 1, 5717, 1527},
+  {97, 0, 0, 1528},
+  {111, 1, 5718, 0},
+  {111, 1, 5719, 0},
+  {117, 1, 5720, 0},
+  {115, 0, 0, 1529},
+  {97, 1, 5721, 0},
+  {98, 1, 5722, 0},
+  {114, 1, 5723, 0},
+  {119, 1, 5724, 0},
+  {114, 1, 5725, 0},
+  {111, 1, 5726, 0},
+  {101, 0, 0, 1530},
+  {114, 1, 5727, 0},
+  {114, 1, 5728, 0},
+  {101, 1, 5729, 0},
+  {110, 0, 0, 1531},
+  {110, 0, 0, 1532},
+  {116, 2, 5730, 0},
+  {68, 0, 0, 1533},
+  {115, 1, 5732, 0},
+  {97, 1, 5733, 0},
+  {110, 1, 5734, 0},
+  {103, 1, 5735, 0},
+  {110, 1, 5736, 0},
+  {110, 1, 5737, 0},
+  {111, 1, 5738, 1534},
+  {111, 1, 5739, 0},
+  {116, 0, 0, 1535},
+  {114, 1, 5740, 0},
+  {101, 1, 5741, 0},
+  {108, 1, 5742, 0},
+  {115, 0, 0, 1536},
+  {101, 1, 5743, 0},
+  {114, 0, 0, 1537},
+  {117, 1, 5744, 0},
+  {111, 1, 5745, 0},
+  {111, 1, 5746, 0},
+  {102, 1, 5747, 0},
+  {103, 1, 5748, 0},
+  {110, 1, 5749, 0},
+  {114, 1, 5750, 0},
+  {105, 1, 5751, 0},
+  {114, 1, 5752, 0},
+  {97, 1, 5753, 0},
+  {104, 1, 5754, 0},
+  {100, 0, 0, 1538},
+  {116, 0, 0, 1539},
+  {121, 1, 5755, 0},
+  {115, 0, 0, 1540},
+  {109, 0, 0, 1541},
+  {100, 0, 0, 1542},
+  {117, 0, 0, 1543},
+  {114, 0, 0, 1544},
+  {97, 1, 5756, 0},
+  {114, 1, 5757, 0},
+  {114, 1, 5758, 0},
+  {102, 1, 5759, 0},
+  {103, 1, 5760, 0},
+  {114, 1, 5761, 0},
+  {110, 1, 5762, 0},
+  {111, 1, 5763, 1545},
+  {112, 1, 5764, 0},
+  {116, 0, 0, 1546},
+  {103, 1, 5765, 0},
+  {113, 1, 5766, 0},
+  {114, 0, 0, 1547},
+  {109, 0, 0, 1548},
+  {101, 1, 5767, 0},
+  {97, 1, 5768, 0},
+  {111, 1, 5769, 0},
+  {102, 1, 5770, 0},
+  {112, 1, 5771, 0},
+  {103, 1, 5772, 0},
+  {114, 1, 5773, 0},
+  {115, 0, 0, 1549},
+  {101, 0, 0, 1550},
+  {101, 1, 5774, 0},
+  {116, 0, 0, 1551},
+  {97, 1, 5775, 0},
+  {114, 0, 0, 1552},
+  {101, 1, 5776, 0},
+  {101, 0, 0, 1553},
+  {100, 1, 5777, 0},
+  {108, 1, 5778, 0},
+  {117, 1, 5779, 0},
+  {101, 1, 5780, 0},
+  {117, 0, 0, 1554},
+  {97, 1, 5781, 0},
+  {114, 1, 5782, 0},
+  {105, 1, 5783, 0},
+  {97, 1, 5784, 0},
+  {120, 0, 0, 1555},
+  {108, 1, 5785, 1556},
+  {111, 1, 5786, 0},
+  {119, 0, 0, 1557},
+  {115, 0, 0, 1558},
+  {97, 1, 5787, 0},
+  {114, 1, 5788, 0},
+  {105, 1, 5789, 0},
+  {97, 1, 5790, 0},
+  {111, 1, 5791, 0},
+  {97, 0, 0, 1559},
+  {98, 0, 0, 1560},
+  {99, 0, 0, 1561},
+  {97, 0, 0, 1562},
+  {98, 0, 0, 1563},
+  {99, 0, 0, 1564},
+  {108, 1, 5792, 0},
+  {116, 0, 0, 1565},
+  {113, 0, 0, 1566},
+  {97, 1, 5793, 0},
+  {109, 1, 5794, 0},
+  {112, 1, 5795, 0},
+  {101, 0, 0, 1567},
+  {101, 0, 0, 1568},
+  {116, 1, 5796, 1569},
+  {113, 0, 0, 1570},
+  {116, 1, 5797, 1571},
+  {103, 1, 5798, 0},
+  {110, 0, 0, 1572},
+  {101, 0, 0, 1573},
+  {101, 0, 0, 1574},
+  {119, 0, 0, 1575},
+  {115, 0, 0, 1576},
+  {110, 0, 0, 1577},
+  {102, 0, 0, 1578},
+  {101, 0, 0, 1579},
+  {97, 1, 5799, 0},
+  {101, 1, 5800, 0},
+  {107, 0, 0, 1580},
+  {111, 1, 5801, 0},
+  {104, 0, 0, 1581},
+  {105, 1, 5802, 0},
+  {114, 0, 0, 1582},
+  {109, 0, 0, 1583},
+  {111, 0, 0, 1584},
+  {110, 1, 5803, 0},
+  {112, 1, 5804, 0},
+  {114, 1, 5805, 0},
+  {112, 1, 5806, 0},
+  {113, 1, 5807, 0},
+  {105, 1, 5808, 0},
+  {109, 0, 0, 1585},
+  {97, 1, 5809, 0},
+  {110, 1, 5810, 0},
+  {114, 1, 5811, 0},
+  {110, 1, 5812, 0},
+  {116, 0, 0, 1586},
+  {113, 0, 0, 1587},
+  {121, 1, 5813, 0},
+  {115, 0, 0, 1588},
+  {109, 0, 0, 1589},
+  {97, 1, 5814, 0},
+  {100, 0, 0, 1590},
+  {117, 0, 0, 1591},
+  {114, 0, 0, 1592},
+  {101, 0, 0, 1593},
+  {114, 1, 5815, 0},
+  {114, 1, 5816, 0},
+  {97, 1, 5817, 0},
+  {101, 1, 5818, 0},
+  {105, 1, 5819, 0},
+  {113, 1, 5820, 0},
+  {104, 1, 5821, 0},
+  {100, 1, 5822, 0},
+  {97, 1, 5823, 0},
+  {115, 0, 0, 1594},
+  {110, 1, 5824, 0},
+  {114, 1, 5825, 0},
+  {114, 0, 0, 1595},
+  {110, 1, 5826, 0},
+  {119, 0, 0, 1596},
+  {117, 1, 5827, 0},
+  {105, 1, 5828, 0},
+  {97, 1, 5829, 0},
+  {115, 0, 0, 1597},
+  {114, 0, 0, 1598},
+  {101, 1, 5830, 0},
+  {115, 1, 5831, 0},
+  {117, 1, 5832, 0},
+  {101, 1, 5833, 0},
+  {101, 1, 5834, 0},
+  {104, 1, 5835, 0},
+  {116, 0, 0, 1599},
+  {116, 0, 0, 1600},
+  {115, 0, 0, 1601},
+  {114, 0, 0, 1602},
+  {101, 1, 5836, 0},
+  {110, 1, 5837, 0},
+  {112, 1, 5838, 0},
+  {114, 1, 5839, 0},
+  {112, 1, 5840, 0},
+  {113, 1, 5841, 0},
+  {105, 1, 5842, 0},
+  {109, 0, 0, 1603},
+  {98, 0, 0, 1604},
+  {116, 0, 0, 1605},
+  {108, 0, 0, 1606},
+  {98, 0, 0, 1607},
+  {114, 0, 0, 1608},
+  {116, 0, 0, 1609},
+  {115, 0, 0, 1610},
+  {101, 1, 5843, 0},
+  {110, 1, 5844, 0},
+  {119, 0, 0, 1611},
+  {111, 1, 5845, 0},
+  {121, 1, 5846, 0},
+  {112, 1, 5847, 0},
+  {105, 1, 5848, 0},
+  {97, 1, 5849, 0},
+  {107, 0, 0, 1612},
+  {108, 1, 5850, 0},
+  {117, 1, 5851, 0},
+  {115, 0, 0, 1613},
+  {101, 0, 0, 1614},
+  {117, 1, 5852, 0},
+  {100, 2, 5853, 0},
+  {101, 1, 5855, 0},
+  {119, 0, 0, 1615},
+  {97, 1, 5856, 0},
+  {111, 1, 5857, 0},
+  {110, 0, 0, 1616},
+  {114, 1, 5858, 0},
+  {101, 1, 5859, 0},
+  {101, 0, 0, 1617},
+  {105, 1, 5860, 0},
+  {112, 1, 5861, 0},
+  {104, 1, 5862, 0},
+  {112, 1, 5863, 0},
+  {109, 1, 5864, 0},
+  {115, 1, 5865, 0},
+  {115, 1, 5866, 0},
+  {116, 1, 5867, 0},
+  {97, 1, 5868, 0},
+  {103, 0, 0, 1618},
+  {114, 0, 0, 1619},
+  {110, 1, 5869, 0},
+  {115, 1, 5870, 0},
+  {108, 1, 5871, 0},
+  {68, 1, 5872, 0},
+  {111, 1, 5873, 0},
+  {111, 1, 5874, 0},
+  {105, 1, 5875, 0},
+  {108, 1, 5876, 0},
+  {105, 1, 5877, 0},
+  {115, 1, 5878, 0},
+  {114, 1, 5879, 0},
+  {110, 1, 5880, 0},
+  {73, 1, 5881, 0},
+  {99, 1, 5882, 0},
+  {67, 1, 5883, 0},
+  {100, 0, 0, 1620},
+  {105, 1, 5884, 0},
+  {110, 1, 5885, 0},
+  {108, 0, 0, 1621},
+  {111, 1, 5886, 0},
+  {111, 2, 5887, 0},
+  {101, 1, 5889, 0},
+  {111, 1, 5890, 0},
+  {105, 1, 5891, 0},
+  {112, 2, 5892, 0},
+  {101, 1, 5894, 0},
+  {111, 1, 5895, 0},
+  {118, 1, 5896, 0},
+  {116, 3, 5897, 0},
+  {104, 1, 5900, 0},
+  {65, 1, 5901, 0},
+  {111, 1, 5902, 0},
+  {97, 1, 5903, 0},
+  {114, 1, 5904, 0},
+  {108, 1, 5905, 0},
+  {114, 1, 5906, 0},
+  {116, 1, 5907, 0},
+  {109, 1, 5908, 0},
+  {101, 1, 5909, 0},
+  {116, 1, 5910, 0},
+  {69, 1, 5911, 0},
+  {70, 1, 5912, 0},
+  {71, 1, 5913, 0},
+  {76, 1, 5914, 0},
+  {83, 1, 5915, 0},
+  {84, 1, 5916, 0},
+  {83, 1, 5917, 0},
+  {116, 1, 5918, 0},
+  {110, 1, 5919, 0},
+  {97, 1, 5920, 0},
+  {114, 1, 5921, 0},
+  {108, 0, 0, 1622},
+  {99, 1, 5922, 0},
+  {108, 1, 5923, 0},
+  {116, 1, 5924, 0},
+  {108, 1, 5925, 0},
+  {111, 1, 5926, 0},
+  {108, 1, 5927, 0},
+  {98, 1, 5928, 0},
+  {110, 2, 5929, 0},
+  {111, 1, 5931, 0},
+  {104, 1, 5932, 0},
+  {65, 1, 5933, 0},
+  {86, 1, 5934, 0},
+  {97, 1, 5935, 0},
+  {111, 1, 5936, 0},
+  {101, 1, 5937, 0},
+  {101, 1, 5938, 0},
+  {116, 1, 5939, 0},
+  {111, 1, 5940, 0},
+  {104, 1, 5941, 0},
+  {97, 1, 5942, 0},
+  {108, 1, 5943, 0},
+  {97, 1, 5944, 0},
+  {115, 0, 0, 1623},
+  {110, 1, 5945, 0},
+  {100, 1, 5946, 0},
+  {114, 1, 5947, 0},
+  {116, 2, 5948, 0},
+  {104, 1, 5950, 0},
+  {116, 2, 5951, 0},
+  {104, 1, 5953, 0},
+  {102, 1, 5954, 0},
+  {103, 1, 5955, 0},
+  {112, 1, 5956, 0},
+  {114, 1, 5957, 0},
+  {117, 1, 5958, 0},
+  {101, 3, 5959, 0},
+  {114, 1, 5962, 0},
+  {101, 1, 5963, 0},
+  {107, 1, 5964, 0},
+  {114, 1, 5965, 0},
+  {97, 1, 5966, 0},
+  {108, 1, 5967, 0},
+  {101, 1, 5968, 0},
+  {108, 1, 5969, 1624},
+  {116, 1, 5970, 0},
+  {116, 1, 5971, 0},
+  {68, 1, 5972, 0},
+  {69, 1, 5973, 0},
+  {84, 1, 5974, 0},
+  {69, 1, 5975, 0},
+  {71, 1, 5976, 0},
+  {76, 1, 5977, 0},
+  {83, 1, 5978, 0},
+  {84, 1, 5979, 0},
+  {101, 1, 5980, 0},
+  {101, 1, 5981, 0},
+  {114, 1, 5982, 0},
+  {116, 1, 5983, 0},
+  {114, 1, 5984, 0},
+  {101, 1, 5985, 0},
+  {101, 1, 5986, 0},
+  {114, 1, 5987, 0},
+  {101, 3, 5988, 1625},
+  {105, 1, 5991, 0},
+  {108, 1, 5992, 0},
+  {99, 2, 5993, 0},
+  {101, 1, 5995, 0},
+  {68, 0, 0, 1626},
+  {117, 1, 5996, 0},
+  {101, 1, 5997, 0},
+  {115, 3, 5998, 1627},
+  {105, 1, 6001, 0},
+  {69, 2, 6002, 0},
+  {85, 1, 6004, 0},
+  {103, 1, 6005, 0},
+  {114, 1, 6006, 0},
+  {105, 1, 6007, 0},
+  {117, 1, 6008, 0},
+  {119, 1, 6009, 0},
+  {111, 1, 6010, 0},
+  {101, 2, 6011, 1628},
+  {105, 1, 6013, 0},
+  {68, 1, 6014, 0},
+  {84, 1, 6015, 0},
+  {86, 1, 6016, 0},
+  {99, 1, 6017, 0},
+  {114, 1, 6018, 0},
+  {112, 1, 6019, 0},
+  {114, 1, 6020, 0},
+  {97, 1, 6021, 0},
+  {119, 1, 6022, 0},
+  {102, 1, 6023, 0},
+  {103, 1, 6024, 0},
+  {65, 1, 6025, 0},
+  {114, 1, 6026, 0},
+  {110, 1, 6027, 0},
+  {117, 2, 6028, 0},
+  {110, 1, 6030, 0},
+  {113, 1, 6031, 0},
+  {115, 3, 6032, 1629},
+  {116, 0, 0, 1630},
+  {116, 1, 6035, 1631},
+  {114, 1, 6036, 0},
+  {97, 1, 6037, 0},
+  {99, 1, 6038, 0},
+  {117, 1, 6039, 0},
+  {108, 1, 6040, 0},
+  {108, 1, 6041, 0},
+  {111, 1, 6042, 0},
+  {114, 0, 0, 1632},
+  {114, 0, 0, 1633},
+  {97, 1, 6043, 0},
+  {114, 1, 6044, 0},
+  {117, 1, 6045, 0},
+  {66, 1, 6046, 0},
+  {68, 1, 6047, 0},
+  {114, 1, 6048, 0},
+  {105, 1, 6049, 0},
+  {114, 1, 6050, 0},
+  {114, 1, 6051, 0},
+  {102, 1, 6052, 0},
+  {103, 1, 6053, 0},
+  {108, 4, 6054, 0},
+  {110, 1, 6058, 0},
+  {116, 1, 6059, 0},
+  {101, 0, 0, 1634},
+  {97, 0, 0, 1635},
+  {98, 0, 0, 1636},
+  {99, 0, 0, 1637},
+  {100, 0, 0, 1638},
+  {101, 0, 0, 1639},
+  {102, 0, 0, 1640},
+  {103, 0, 0, 1641},
+  {104, 0, 0, 1642},
+  {100, 0, 0, 1643},
+  {113, 0, 0, 1644},
+  {116, 0, 0, 1645},
+  {103, 0, 0, 1646},
+  {105, 1, 6060, 0},
+  {109, 1, 6061, 0},
+  {101, 1, 6062, 0},
+  {101, 0, 0, 1647},
+  {107, 0, 0, 1648},
+  {115, 0, 0, 1649},
+  {101, 1, 6063, 0},
+  {112, 0, 0, 1650},
+  {110, 1, 6064, 0},
+  {115, 0, 0, 1651},
+  {101, 0, 0, 1652},
+  {122, 1, 6065, 0},
+  {117, 1, 6066, 0},
+  {105, 1, 6067, 0},
+  {115, 0, 0, 1653},
+  {115, 0, 0, 1654},
+  {98, 0, 0, 1655},
+  {112, 0, 0, 1656},
+  {111, 1, 6068, 0},
+  {114, 1, 6069, 0},
+  {114, 1, 6070, 0},
+  {82, 0, 0, 1657},
+  {83, 0, 0, 1658},
+  {97, 1, 6071, 0},
+  {99, 1, 6072, 0},
+  {100, 1, 6073, 0},
+  {116, 0, 0, 1659},
+  {116, 0, 0, 1660},
+  {101, 1, 6074, 0},
+  {101, 1, 6075, 0},
+  {112, 0, 0, 1661},
+  {112, 1, 6076, 0},
+  {115, 1, 6077, 0},
+  {101, 0, 0, 1662},
+  {100, 1, 6078, 0},
+  {114, 1, 6079, 0},
+  {116, 0, 0, 1663},
+  {115, 1, 6080, 0},
+  {110, 1, 6081, 0},
+  {116, 0, 0, 1664},
+  {115, 0, 0, 1665},
+  {114, 1, 6082, 0},
+  {97, 1, 6083, 0},
+  {111, 1, 6084, 0},
+  {110, 1, 6085, 0},
+  {112, 1, 6086, 0},
+  {119, 0, 0, 1666},
+  {114, 0, 0, 1667},
+  {115, 0, 0, 1668},
+  {116, 0, 0, 1669},
+  {103, 1, 6087, 0},
+  {108, 1, 6088, 0},
+  {108, 0, 0, 1670},
+  {116, 1, 6089, 0},
+  {116, 1, 6090, 0},
+  {100, 1, 6091, 0},
+  {116, 0, 0, 1671},
+  {116, 0, 0, 1672},
+  {108, 0, 0, 1673},
+  {120, 0, 0, 1674},
+  {111, 1, 6092, 0},
+  {115, 1, 6093, 0},
+  {101, 1, 6094, 0},
+  {113, 1, 6095, 0},
+  {105, 1, 6096, 0},
+  {119, 0, 0, 1675},
+  {119, 0, 0, 1676},
+  {116, 1, 6097, 0},
+  {104, 1, 6098, 0},
+  {101, 0, 0, 1677},
+  {116, 0, 0, 1678},
+  {101, 0, 0, 1679},
+  {115, 0, 0, 1680},
+  {108, 0, 0, 1681},
+  {107, 0, 0, 1682},
+  {118, 0, 0, 1683},
+  {114, 0, 0, 1684},
+  {111, 1, 6099, 0},
+  {112, 1, 6100, 0},
+  {116, 1, 6101, 0},
+  {104, 1, 6102, 0},
+  {101, 1, 6103, 0},
+  {116, 0, 0, 1685},
+  {114, 0, 0, 1686},
+  {114, 1, 6104, 0},
+  {116, 1, 6105, 0},
+  {103, 1, 6106, 0},
+  {114, 0, 0, 1687},
+  {99, 1, 6107, 0},
+  {120, 0, 0, 1688},
+  {116, 2, 6108, 0},
+  {115, 1, 6110, 0},
+  {104, 1, 6111, 0},
+  {111, 1, 6112, 0},
+  {114, 0, 0, 1689},
+  {114, 0, 0, 1690},
+  {113, 1, 6113, 0},
+  {111, 1, 6114, 0},
+  {101, 1, 6115, 0},
+  {112, 0, 0, 1691},
+  {100, 1, 6116, 0},
+  {112, 0, 0, 1692},
+  {114, 1, 6117, 0},
+  {103, 1, 6118, 0},
+  {114, 1, 6119, 0},
+  {115, 0, 0, 1693},
+  {116, 0, 0, 1694},
+  {110, 1, 6120, 0},
+  {114, 1, 6121, 0},
+  {103, 1, 6122, 0},
+  {110, 1, 6123, 0},
+  {116, 0, 0, 1695},
+  {101, 1, 6124, 0},
+  {114, 1, 6125, 0},
+  {105, 1, 6126, 0},
+  {97, 1, 6127, 0},
+  {101, 1, 6128, 0},
+  {101, 1, 6129, 0},
+  {108, 1, 6130, 0},
+  {115, 0, 0, 1696},
+  {108, 0, 0, 1697},
+  {114, 1, 6131, 0},
+  {114, 0, 0, 1698},
+  {116, 0, 0, 1699},
+  {114, 1, 6132, 0},
+  {108, 1, 6133, 0},
+  {112, 1, 6134, 0},
+  {113, 0, 0, 1700},
+  {109, 0, 0, 1701},
+  {114, 0, 0, 1702},
+  {101, 0, 0, 1703},
+  {102, 0, 0, 1704},
+  {105, 1, 6135, 0},
+  {118, 0, 0, 1705},
+  {108, 1, 6136, 0},
+  {116, 0, 0, 1706},
+  {114, 1, 6137, 0},
+  {114, 1, 6138, 0},
+  {102, 1, 6139, 0},
+  {103, 1, 6140, 0},
+  {117, 1, 6141, 0},
+  {114, 1, 6142, 0},
+  {111, 1, 6143, 0},
+  {99, 1, 6144, 0},
+  {116, 0, 0, 1707},
+  {105, 0, 0, 1708},
+  {116, 0, 0, 1709},
+  {115, 0, 0, 1710},
+  {100, 0, 0, 1711},
+  {114, 1, 6145, 0},
+  {116, 1, 6146, 0},
+  {108, 0, 0, 1712},
+  {105, 1, 6147, 0},
+  {116, 1, 6148, 1713},
+  {116, 1, 6149, 1714},
+  {116, 2, 6150, 0},
+  {113, 1, 6152, 1715},
+  {101, 1, 6153, 0},
+  {114, 1, 6154, 0},
+  {108, 1, 6155, 0},
+  {112, 1, 6156, 0},
+  {113, 0, 0, 1716},
+  {109, 0, 0, 1717},
+  {113, 1, 6157, 1718},
+  {101, 1, 6158, 0},
+  {114, 1, 6159, 0},
+  {109, 0, 0, 1719},
+  {112, 1, 6160, 0},
+  {109, 0, 0, 1720},
+  {114, 0, 0, 1721},
+  {101, 4, 6161, 1722},
+  {115, 0, 0, 1723},
+  {109, 0, 0, 1724},
+  {108, 1, 6165, 0},
+  {114, 1, 6166, 0},
+  {114, 0, 0, 1725},
+  {114, 1, 6167, 0},
+  {111, 1, 6168, 0},
+  {111, 1, 6169, 0},
+  {114, 0, 0, 1726},
+  {108, 1, 6170, 0},
+  {97, 0, 0, 1727},
+  {105, 1, 6171, 0},
+  {116, 1, 6172, 0},
+  {97, 0, 0, 1728},
+  {101, 1, 6173, 0},
+  {101, 1, 6174, 0},
+  {97, 0, 0, 1729},
+  {110, 1, 6175, 0},
+  {99, 1, 6176, 0},
+  {104, 0, 0, 1730},
+  {105, 1, 6177, 0},
+  {105, 1, 6178, 0},
+  {116, 0, 0, 1731},
+  {116, 0, 0, 1732},
+  {110, 1, 6179, 0},
+  {117, 1, 6180, 0},
+  {109, 1, 6181, 0},
+  {101, 1, 6182, 0},
+  {108, 1, 6183, 0},
+  {116, 0, 0, 1733},
+  {110, 1, 6184, 0},
+  {116, 0, 0, 1734},
+  {108, 1, 6185, 0},
+  {99, 1, 6186, 0},
+  {116, 1, 6187, 0},
+  {110, 1, 6188, 0},
+  {116, 0, 0, 1735},
+  {119, 1, 6189, 0},
+  {102, 1, 6190, 0},
+  {110, 1, 6191, 0},
+  {103, 1, 6192, 0},
+  {65, 1, 6193, 0},
+  {68, 1, 6194, 0},
+  {114, 1, 6195, 0},
+  {119, 2, 6196, 1736},
+  {101, 0, 0, 1737},
+  {82, 1, 6198, 0},
+  {84, 1, 6199, 0},
+  {86, 1, 6200, 0},
+  {116, 2, 6201, 0},
+  {114, 1, 6203, 0},
+  {119, 0, 0, 1738},
+  {108, 1, 6204, 0},
+  {121, 1, 6205, 0},
+  {100, 1, 6206, 0},
+  {105, 1, 6207, 0},
+  {105, 1, 6208, 0},
+  {97, 1, 6209, 0},
+  {114, 1, 6210, 0},
+  {114, 1, 6211, 0},
+  {113, 1, 6212, 0},
+  {117, 1, 6213, 0},
+  {114, 1, 6214, 0},
+  {101, 1, 6215, 0},
+  {108, 1, 6216, 0},
+  {105, 1, 6217, 0},
+  {112, 1, 6218, 0},
+  {97, 1, 6219, 0},
+  {72, 1, 6220, 0},
+  {108, 0, 0, 1739},
+  {121, 1, 6221, 0},
+  {116, 1, 6222, 0},
+  {101, 2, 6223, 0},
+  {114, 1, 6225, 0},
+  {101, 1, 6226, 0},
+  {119, 2, 6227, 1740},
+  {105, 1, 6229, 0},
+  {108, 1, 6230, 0},
+  {84, 1, 6231, 0},
+  {86, 1, 6232, 0},
+  {114, 0, 0, 1741},
+  {116, 2, 6233, 0},
+  {114, 1, 6235, 0},
+  {101, 1, 6236, 0},
+  {110, 1, 6237, 0},
+  {119, 1, 6238, 0},
+  {101, 1, 6239, 0},
+  {99, 1, 6240, 0},
+  {111, 1, 6241, 0},
+  {119, 0, 0, 1742},
+  {116, 1, 6242, 0},
+  {108, 1, 6243, 0},
+  {69, 1, 6244, 0},
+  {116, 1, 6245, 0},
+  {116, 1, 6246, 0},
+  {101, 0, 0, 1743},
+  {111, 1, 6247, 0},
+  {65, 1, 6248, 0},
+  {82, 1, 6249, 0},
+  {116, 1, 6250, 0},
+  {97, 1, 6251, 0},
+  {114, 1, 6252, 0},
+  {116, 1, 6253, 0},
+  {116, 1, 6254, 0},
+  {104, 1, 6255, 0},
+  {97, 1, 6256, 0},
+  {102, 0, 0, 1744},
+  {115, 0, 0, 1745},
+  {77, 1, 6257, 0},
+  {84, 1, 6258, 0},
+  {86, 1, 6259, 0},
+  {101, 1, 6260, 0},
+  {115, 1, 6261, 0},
+  {105, 1, 6262, 0},
+  {117, 1, 6263, 0},
+  {112, 0, 0, 1746},
+  {101, 1, 6264, 0},
+  {110, 1, 6265, 0},
+  {84, 1, 6266, 0},
+  {115, 0, 0, 1747},
+  {101, 1, 6267, 0},
+  {111, 1, 6268, 0},
+  {113, 1, 6269, 0},
+  {114, 1, 6270, 0},
+  {113, 1, 6271, 0},
+  {114, 1, 6272, 0},
+  {101, 1, 6273, 0},
+  {108, 1, 6274, 0},
+  {105, 1, 6275, 0},
+  {100, 2, 6276, 0},
+  {100, 1, 6278, 0},
+  {115, 1, 6279, 0},
+  {84, 1, 6280, 0},
+  {101, 1, 6281, 0},
+  {116, 1, 6282, 1748},
+  {101, 1, 6283, 0},
+  {115, 1, 6284, 0},
+  {69, 1, 6285, 0},
+  {70, 1, 6286, 0},
+  {84, 1, 6287, 0},
+  {99, 1, 6288, 0},
+  {121, 2, 6289, 0},
+  {101, 0, 0, 1749},
+  {107, 1, 6291, 0},
+  {110, 1, 6292, 0},
+  {115, 0, 0, 1750},
+  {112, 1, 6293, 0},
+  {69, 1, 6294, 0},
+  {83, 1, 6295, 0},
+  {84, 1, 6296, 0},
+  {111, 1, 6297, 0},
+  {108, 1, 6298, 0},
+  {113, 1, 6299, 0},
+  {112, 1, 6300, 0},
+  {108, 1, 6301, 0},
+  {111, 1, 6302, 0},
+  {108, 1, 6303, 0},
+  {98, 1, 6304, 0},
+  {110, 2, 6305, 0},
+  {111, 1, 6307, 0},
+  {65, 1, 6308, 0},
+  {86, 1, 6309, 0},
+  {97, 1, 6310, 0},
+  {111, 1, 6311, 0},
+  {101, 1, 6312, 0},
+  {101, 1, 6313, 0},
+  {116, 1, 6314, 0},
+  {111, 1, 6315, 0},
+  {108, 1, 6316, 0},
+  {114, 1, 6317, 0},
+  {121, 1, 6318, 0},
+  {110, 1, 6319, 0},
+  {116, 1, 6320, 0},
+  {104, 1, 6321, 0},
+  {114, 1, 6322, 0},
+  {99, 1, 6323, 0},
+  {116, 1, 6324, 0},
+  {98, 1, 6325, 0},
+  {112, 1, 6326, 0},
+  {105, 1, 6327, 0},
+  {117, 1, 6328, 0},
+  {69, 1, 6329, 0},
+  {83, 1, 6330, 0},
+  {84, 1, 6331, 0},
+  {69, 1, 6332, 0},
+  {101, 0, 0, 1751},
+  {99, 1, 6333, 0},
+  {101, 0, 0, 1752},
+  {97, 1, 6334, 0},
+  {108, 1, 6335, 0},
+  {100, 1, 6336, 0},
+  {116, 0, 0, 1753},
+  {99, 2, 6337, 0},
+  {101, 1, 6339, 0},
+  {115, 0, 0, 1754},
+  {97, 1, 6340, 0},
+  {111, 1, 6341, 0},
+  {114, 1, 6342, 0},
+  {98, 1, 6343, 0},
+  {111, 1, 6344, 0},
+  {114, 1, 6345, 0},
+  {116, 1, 6346, 0},
+  {104, 1, 6347, 0},
+  {66, 1, 6348, 0},
+  {76, 1, 6349, 0},
+  {83, 1, 6350, 0},
+  {84, 1, 6351, 0},
+  {83, 1, 6352, 0},
+  {104, 1, 6353, 0},
+  {108, 1, 6354, 0},
+  {101, 0, 0, 1755},
+  {113, 0, 0, 1756},
+  {115, 0, 0, 1757},
+  {103, 1, 6355, 0},
+  {101, 1, 6356, 0},
+  {97, 1, 6357, 0},
+  {97, 1, 6358, 0},
+  {116, 0, 0, 1758},
+  {107, 0, 0, 1759},
+  {114, 1, 6359, 0},
+  {115, 1, 6360, 0},
+  {105, 1, 6361, 0},
+  {97, 1, 6362, 0},
+  {110, 1, 6363, 0},
+  {115, 0, 0, 1760},
+  {114, 1, 6364, 0},
+  {117, 1, 6365, 0},
+  {103, 1, 6366, 0},
+  {111, 1, 6367, 0},
+  {117, 1, 6368, 0},
+  {116, 1, 6369, 0},
+  {101, 0, 0, 1761},
+  {114, 1, 6370, 0},
+  {119, 0, 0, 1762},
+  {97, 1, 6371, 0},
+  {111, 1, 6372, 0},
+  {116, 1, 6373, 0},
+  {101, 1, 6374, 0},
+  {105, 1, 6375, 0},
+  {105, 1, 6376, 0},
+  {111, 1, 6377, 0},
+  {120, 0, 0, 1763},
+  {115, 0, 0, 1764},
+  {115, 1, 6378, 0},
+  {113, 0, 0, 1765},
+  {116, 0, 0, 1766},
+  {97, 1, 6379, 0},
+  {116, 1, 6380, 0},
+  {119, 1, 6381, 1767},
+  {111, 1, 6382, 0},
+  {97, 1, 6383, 0},
+  {116, 3, 6384, 0},
+  {101, 1, 6387, 0},
+  {111, 1, 6388, 0},
+  {114, 0, 0, 1768},
+  {116, 1, 6389, 0},
+  {104, 1, 6390, 0},
+  {97, 1, 6391, 0},
+  {114, 1, 6392, 0},
+  {116, 1, 6393, 0},
+  {116, 1, 6394, 0},
+  {119, 2, 6395, 0},
+  {113, 0, 0, 1769},
+  {119, 1, 6397, 0},
+  {102, 1, 6398, 0},
+  {97, 1, 6399, 0},
+  {111, 1, 6400, 0},
+  {104, 1, 6401, 0},
+  {114, 1, 6402, 0},
+  {116, 0, 0, 1770},
+  {111, 1, 6403, 0},
+  {104, 1, 6404, 0},
+  {116, 0, 0, 1771},
+  {108, 0, 0, 1772},
+  {114, 1, 6405, 0},
+  {100, 0, 0, 1773},
+  {114, 1, 6406, 0},
+  {113, 1, 6407, 1774},
+  {113, 1, 6408, 1775},
+  {101, 2, 6409, 0},
+  {107, 0, 0, 1776},
+  {111, 1, 6411, 0},
+  {121, 1, 6412, 0},
+  {114, 1, 6413, 0},
+  {111, 1, 6414, 0},
+  {115, 0, 0, 1777},
+  {111, 1, 6415, 0},
+  {112, 1, 6416, 0},
+  {116, 2, 6417, 0},
+  {104, 1, 6419, 0},
+  {105, 1, 6420, 0},
+  {101, 1, 6421, 0},
+  {116, 1, 6422, 0},
+  {104, 1, 6423, 0},
+  {97, 1, 6424, 0},
+  {109, 1, 6425, 0},
+  {116, 0, 0, 1778},
+  {101, 1, 6426, 0},
+  {101, 1, 6427, 0},
+  {101, 1, 6428, 0},
+  {112, 1, 6429, 0},
+  {113, 0, 0, 1779},
+  {113, 1, 6430, 1780},
+  {111, 1, 6431, 0},
+  {121, 1, 6432, 0},
+  {114, 1, 6433, 0},
+  {113, 0, 0, 1781},
+  {113, 1, 6434, 1782},
+  {101, 0, 0, 1783},
+  {114, 1, 6435, 0},
+  {100, 1, 6436, 0},
+  {108, 1, 6437, 0},
+  {113, 0, 0, 1784},
+  {114, 1, 6438, 0},
+  {101, 1, 6439, 0},
+  {105, 1, 6440, 0},
+  {114, 1, 6441, 0},
+  {110, 2, 6442, 0},
+  {119, 1, 6444, 0},
+  {111, 1, 6445, 0},
+  {110, 1, 6446, 0},
+  {111, 0, 0, 1785},
+  {116, 1, 6447, 0},
+  {116, 1, 6448, 0},
+  {103, 1, 6449, 0},
+  {116, 1, 6450, 0},
+  {115, 0, 0, 1786},
+  {102, 1, 6451, 0},
+  {117, 1, 6452, 0},
+  {115, 0, 0, 1787},
+  {101, 1, 6453, 0},
+  {67, 1, 6454, 0},
+  {121, 2, 6455, 0},
+  {116, 1, 6457, 0},
+  {111, 1, 6458, 0},
+  {97, 1, 6459, 0},
+  {105, 1, 6460, 0},
+  {116, 1, 6461, 0},
+  {110, 1, 6462, 0},
+  {116, 3, 6463, 0},
+  {103, 2, 6466, 0},
+  {104, 1, 6468, 0},
+  {114, 1, 6469, 0},
+  {111, 1, 6470, 0},
+  {116, 1, 6471, 0},
+  {66, 1, 6472, 0},
+  {85, 1, 6473, 0},
+  {105, 1, 6474, 0},
+  {101, 1, 6475, 0},
+  {101, 1, 6476, 0},
+  {84, 1, 6477, 0},
+  {86, 1, 6478, 0},
+  {114, 1, 6479, 0},
+  {108, 1, 6480, 0},
+  {83, 1, 6481, 0},
+  {101, 0, 0, 1788},
+  {117, 1, 6482, 0},
+  {97, 1, 6483, 0},
+  {108, 1, 6484, 0},
+  {121, 1, 6485, 0},
+  {102, 0, 0, 1789},
+  {117, 1, 6486, 0},
+  {108, 1, 6487, 0},
+  {101, 1, 6488, 0},
+  {115, 1, 6489, 0},
+  {97, 1, 6490, 0},
+  {108, 1, 6491, 0},
+  {97, 1, 6492, 0},
+  {108, 1, 6493, 0},
+  {117, 1, 6494, 0},
+  {73, 0, 0, 1790},
+  {105, 1, 6495, 0},
+  {67, 1, 6496, 0},
+  {84, 1, 6497, 0},
+  {102, 0, 0, 1791},
+  {66, 1, 6498, 0},
+  {66, 1, 6499, 0},
+  {82, 1, 6500, 0},
+  {110, 1, 6501, 0},
+  {101, 1, 6502, 0},
+  {101, 1, 6503, 0},
+  {101, 1, 6504, 0},
+  {65, 1, 6505, 0},
+  {86, 1, 6506, 0},
+  {114, 1, 6507, 0},
+  {99, 1, 6508, 0},
+  {103, 1, 6509, 0},
+  {110, 1, 6510, 0},
+  {86, 1, 6511, 0},
+  {116, 1, 6512, 0},
+  {114, 1, 6513, 1792},
+  {97, 1, 6514, 0},
+  {71, 1, 6515, 0},
+  {113, 1, 6516, 0},
+  {101, 1, 6517, 0},
+  {69, 1, 6518, 0},
+  {119, 0, 0, 1793},
+  {114, 1, 6519, 0},
+  {105, 1, 6520, 0},
+  {65, 1, 6521, 0},
+  {114, 1, 6522, 0},
+  {105, 1, 6523, 0},
+  {97, 1, 6524, 0},
+  {65, 1, 6525, 0},
+  {116, 1, 6526, 0},
+  {99, 1, 6527, 0},
+  {101, 1, 6528, 0},
+  {104, 1, 6529, 0},
+  {101, 1, 6530, 0},
+  {97, 1, 6531, 0},
+  {115, 1, 6532, 0},
+  {110, 1, 6533, 0},
+  {101, 1, 6534, 0},
+  {86, 1, 6535, 0},
+  {116, 0, 0, 1794},
+  {105, 1, 6536, 0},
+  {114, 6, 6537, 1795},
+  {119, 1, 6543, 0},
+  {117, 1, 6544, 0},
+  {105, 1, 6545, 0},
+  {117, 1, 6546, 0},
+  {101, 1, 6547, 0},
+  {115, 1, 6548, 0},
+  {97, 1, 6549, 0},
+  {108, 1, 6550, 0},
+  {71, 1, 6551, 0},
+  {76, 1, 6552, 0},
+  {101, 1, 6553, 0},
+  {101, 1, 6554, 0},
+  {114, 1, 6555, 0},
+  {83, 1, 6556, 0},
+  {69, 1, 6557, 0},
+  {100, 1, 6558, 0},
+  {101, 1, 6559, 0},
+  {113, 1, 6560, 0},
+  {117, 1, 6561, 0},
+  {105, 1, 6562, 0},
+  {97, 1, 6563, 0},
+  {68, 1, 6564, 0},
+  {81, 1, 6565, 0},
+  {101, 1, 6566, 0},
+  {116, 1, 6567, 0},
+  {108, 1, 6568, 0},
+  {113, 1, 6569, 0},
+  {108, 1, 6570, 0},
+  {105, 1, 6571, 0},
+  {110, 1, 6572, 1796},
+  {101, 1, 6573, 0},
+  {117, 1, 6574, 0},
+  {69, 1, 6575, 0},
+  {101, 1, 6576, 0},
+  {119, 2, 6577, 1797},
+  {105, 1, 6579, 0},
+  {108, 1, 6580, 0},
+  {84, 1, 6581, 0},
+  {86, 1, 6582, 0},
+  {114, 0, 0, 1798},
+  {114, 1, 6583, 0},
+  {101, 1, 6584, 0},
+  {110, 1, 6585, 0},
+  {119, 1, 6586, 0},
+  {101, 1, 6587, 0},
+  {99, 1, 6588, 0},
+  {111, 1, 6589, 0},
+  {119, 0, 0, 1799},
+  {105, 1, 6590, 0},
+  {111, 1, 6591, 0},
+  {101, 1, 6592, 0},
+  {65, 1, 6593, 0},
+  {65, 1, 6594, 0},
+  {116, 1, 6595, 0},
+  {114, 1, 6596, 0},
+  {108, 1, 6597, 0},
+  {101, 1, 6598, 0},
+  {115, 1, 6599, 0},
+  {101, 1, 6600, 0},
+  {111, 1, 6601, 0},
+  {97, 1, 6602, 0},
+  {113, 1, 6603, 0},
+  {108, 1, 6604, 0},
+  {105, 1, 6605, 0},
+  {113, 1, 6606, 0},
+  {101, 0, 0, 1800},
+  {108, 0, 0, 1801},
+  {69, 1, 6607, 0},
+  {101, 0, 0, 1802},
+  {101, 0, 0, 1803},
+  {107, 1, 6608, 0},
+  {110, 1, 6609, 0},
+  {114, 0, 0, 1804},
+  {119, 1, 6610, 0},
+  {111, 1, 6611, 0},
+  {114, 1, 6612, 0},
+  {119, 0, 0, 1805},
+  {111, 1, 6613, 0},
+  {65, 1, 6614, 0},
+  {116, 1, 6615, 0},
+  {97, 1, 6616, 0},
+  {105, 1, 6617, 0},
+  {101, 1, 6618, 0},
+  {105, 1, 6619, 0},
+  {112, 1, 6620, 0},
+  {83, 1, 6621, 0},
+  {111, 1, 6622, 0},
+  {108, 1, 6623, 0},
+  {110, 1, 6624, 0},
+  {114, 1, 6625, 0},
+  {110, 1, 6626, 0},
+  {111, 1, 6627, 0},
+  {116, 0, 0, 1806},
+  {114, 1, 6628, 0},
+  {115, 1, 6629, 0},
+  {116, 0, 0, 1807},
+  {101, 1, 6630, 0},
+  {99, 1, 6631, 0},
+  {101, 0, 0, 1808},
+  {119, 2, 6632, 0},
+  {105, 1, 6634, 0},
+  {105, 1, 6635, 0},
+  {119, 1, 6636, 0},
+  {114, 1, 6637, 0},
+  {111, 1, 6638, 0},
+  {114, 0, 0, 1809},
+  {115, 1, 6639, 0},
+  {111, 1, 6640, 0},
+  {97, 1, 6641, 0},
+  {116, 1, 6642, 0},
+  {115, 0, 0, 1810},
+  {114, 1, 6643, 0},
+  {97, 1, 6644, 0},
+  {116, 1, 6645, 0},
+  {111, 1, 6646, 0},
+  {114, 1, 6647, 0},
+  {97, 1, 6648, 0},
+  {104, 1, 6649, 0},
+  {115, 1, 6650, 0},
+  {116, 1, 6651, 0},
+  {120, 0, 0, 1811},
+  {114, 0, 0, 1812},
+  {101, 0, 0, 1813},
+  {114, 1, 6652, 0},
+  {105, 1, 6653, 0},
+  {111, 0, 0, 1814},
+  {97, 1, 6654, 0},
+  {108, 1, 6655, 0},
+  {114, 1, 6656, 0},
+  {110, 0, 0, 1815},
+  {116, 0, 0, 1816},
+  {110, 1, 6657, 0},
+  {119, 0, 0, 1817},
+  {116, 1, 6658, 0},
+  {111, 1, 6659, 0},
+  {119, 0, 0, 1818},
+  {116, 1, 6660, 0},
+  {111, 1, 6661, 0},
+  {97, 1, 6662, 0},
+  {113, 0, 0, 1819},
+  {113, 0, 0, 1820},
+  {108, 1, 6663, 0},
+  {114, 1, 6664, 0},
+  {120, 0, 0, 1821},
+  {101, 1, 6665, 0},
+  {111, 1, 6666, 0},
+  {110, 1, 6667, 0},
+  {119, 1, 6668, 1822},
+  {111, 1, 6669, 0},
+  {97, 1, 6670, 0},
+  {104, 1, 6671, 0},
+  {116, 1, 6672, 0},
+  {103, 1, 6673, 0},
+  {101, 1, 6674, 0},
+  {115, 1, 6675, 0},
+  {101, 0, 0, 1823},
+  {108, 1, 6676, 0},
+  {105, 1, 6677, 0},
+  {113, 0, 0, 1824},
+  {113, 0, 0, 1825},
+  {112, 1, 6678, 0},
+  {104, 1, 6679, 0},
+  {113, 0, 0, 1826},
+  {120, 0, 0, 1827},
+  {101, 1, 6680, 0},
+  {111, 1, 6681, 0},
+  {113, 0, 0, 1828},
+  {111, 1, 6682, 0},
+  {111, 1, 6683, 0},
+  {101, 1, 6684, 0},
+  {105, 1, 6685, 0},
+  {102, 1, 6686, 0},
+  {103, 1, 6687, 0},
+  {111, 1, 6688, 0},
+  {108, 1, 6689, 0},
+  {114, 1, 6690, 0},
+  {115, 0, 0, 1829},
+  {110, 0, 0, 1830},
+  {103, 0, 0, 1831},
+  {110, 1, 6691, 0},
+  {110, 1, 6692, 0},
+  {108, 1, 6693, 0},
+  {105, 1, 6694, 0},
+  {102, 1, 6695, 0},
+  {115, 0, 0, 1832},
+  {115, 0, 0, 1833},
+  {111, 1, 6696, 0},
+  {68, 1, 6697, 0},
+  {81, 1, 6698, 0},
+  {101, 1, 6699, 0},
+  {99, 1, 6700, 0},
+  {108, 4, 6701, 0},
+  {97, 1, 6705, 0},
+  {111, 1, 6706, 0},
+  {65, 1, 6707, 0},
+  {65, 1, 6708, 0},
+  {82, 1, 6709, 0},
+  {84, 1, 6710, 0},
+  {76, 1, 6711, 0},
+  {82, 1, 6712, 0},
+  {116, 2, 6713, 0},
+  {114, 1, 6715, 0},
+  {119, 1, 6716, 0},
+  {105, 1, 6717, 0},
+  {97, 1, 6718, 0},
+  {112, 1, 6719, 0},
+  {103, 1, 6720, 0},
+  {101, 1, 6721, 0},
+  {99, 1, 6722, 0},
+  {101, 1, 6723, 0},
+  {101, 1, 6724, 0},
+  {111, 1, 6725, 0},
+  {83, 1, 6726, 0},
+  {109, 1, 6727, 0},
+  {109, 0, 0, 1834},
+  {108, 1, 6728, 0},
+  {108, 1, 6729, 0},
+  {83, 1, 6730, 0},
+  {97, 1, 6731, 0},
+  {108, 1, 6732, 0},
+  {97, 1, 6733, 0},
+  {115, 0, 0, 1835},
+  {110, 1, 6734, 0},
+  {100, 1, 6735, 0},
+  {99, 1, 6736, 0},
+  {76, 1, 6737, 0},
+  {109, 1, 6738, 0},
+  {111, 1, 6739, 0},
+  {111, 1, 6740, 0},
+  {105, 1, 6741, 0},
+  {114, 1, 6742, 0},
+  {97, 1, 6743, 0},
+  {105, 1, 6744, 0},
+  {103, 0, 0, 1836},
+  {66, 1, 6745, 0},
+  {101, 1, 6746, 0},
+  {99, 1, 6747, 0},
+  {114, 1, 6748, 0},
+  {101, 1, 6749, 0},
+  {111, 1, 6750, 0},
+  {116, 1, 6751, 0},
+  {108, 1, 6752, 0},
+  {86, 1, 6753, 0},
+  {101, 1, 6754, 0},
+  {111, 1, 6755, 0},
+  {66, 1, 6756, 0},
+  {114, 1, 6757, 0},
+  {114, 1, 6758, 0},
+  {117, 1, 6759, 0},
+  {114, 0, 0, 1837},
+  {113, 1, 6760, 0},
+  {114, 1, 6761, 0},
+  {103, 1, 6762, 0},
+  {114, 1, 6763, 0},
+  {114, 1, 6764, 0},
+  {103, 1, 6765, 0},
+  {114, 1, 6766, 0},
+  {114, 1, 6767, 0},
+  {65, 1, 6768, 0},
+  {101, 0, 0, 1838},
+  {100, 1, 6769, 0},
+  {105, 2, 6770, 0},
+  {114, 1, 6772, 0},
+  {116, 1, 6773, 0},
+  {76, 1, 6774, 0},
+  {103, 1, 6775, 0},
+  {110, 1, 6776, 0},
+  {101, 1, 6777, 0},
+  {108, 1, 6778, 0},
+  {69, 1, 6779, 0},
+  {70, 1, 6780, 0},
+  {71, 1, 6781, 0},
+  {76, 1, 6782, 0},
+  {83, 1, 6783, 0},
+  {84, 1, 6784, 0},
+  {110, 1, 6785, 0},
+  {97, 1, 6786, 0},
+  {97, 1, 6787, 0},
+  {97, 1, 6788, 0},
+  {97, 1, 6789, 0},
+  {115, 0, 0, 1839},
+  {110, 1, 6790, 0},
+  {100, 1, 6791, 0},
+  {114, 1, 6792, 0},
+  {101, 1, 6793, 0},
+  {115, 2, 6794, 1840},
+  {69, 1, 6796, 0},
+  {105, 1, 6797, 0},
+  {117, 2, 6798, 0},
+  {113, 1, 6800, 0},
+  {115, 3, 6801, 1841},
+  {116, 1, 6804, 1842},
+  {117, 1, 6805, 0},
+  {108, 1, 6806, 0},
+  {108, 1, 6807, 0},
+  {108, 1, 6808, 0},
+  {111, 1, 6809, 0},
+  {117, 1, 6810, 0},
+  {116, 0, 0, 1843},
+  {104, 1, 6811, 0},
+  {97, 1, 6812, 0},
+  {117, 1, 6813, 0},
+  {97, 1, 6814, 0},
+  {108, 1, 6815, 0},
+  {97, 1, 6816, 0},
+  {109, 1, 6817, 0},
+  {105, 1, 6818, 0},
+  {113, 1, 6819, 0},
+  {66, 1, 6820, 0},
+  {66, 1, 6821, 0},
+  {76, 1, 6822, 0},
+  {110, 1, 6823, 0},
+  {101, 1, 6824, 0},
+  {101, 1, 6825, 0},
+  {101, 1, 6826, 0},
+  {114, 1, 6827, 0},
+  {99, 1, 6828, 0},
+  {103, 1, 6829, 0},
+  {110, 1, 6830, 0},
+  {86, 1, 6831, 0},
+  {116, 1, 6832, 0},
+  {114, 1, 6833, 1844},
+  {101, 1, 6834, 0},
+  {119, 0, 0, 1845},
+  {100, 0, 0, 1846},
+  {114, 1, 6835, 0},
+  {114, 1, 6836, 0},
+  {65, 1, 6837, 0},
+  {111, 1, 6838, 0},
+  {101, 0, 0, 1847},
+  {114, 1, 6839, 0},
+  {101, 1, 6840, 0},
+  {114, 1, 6841, 0},
+  {110, 0, 0, 1848},
+  {108, 0, 0, 1849},
+  {117, 1, 6842, 0},
+  {97, 1, 6843, 0},
+  {108, 1, 6844, 0},
+  {117, 1, 6845, 0},
+  {113, 1, 6846, 0},
+  {101, 1, 6847, 0},
+  {116, 1, 6848, 0},
+  {110, 1, 6849, 0},
+  {119, 0, 0, 1850},
+  {105, 1, 6850, 0},
+  {119, 0, 0, 1851},
+  {114, 1, 6851, 0},
+  {65, 1, 6852, 0},
+  {114, 0, 0, 1852},
+  {110, 1, 6853, 0},
+  {112, 1, 6854, 0},
+  {108, 1, 6855, 0},
+  {97, 1, 6856, 0},
+  {112, 1, 6857, 0},
+  {110, 0, 0, 1853},
+  {101, 2, 6858, 0},
+  {103, 1, 6860, 0},
+  {101, 0, 0, 1854},
+  {103, 1, 6861, 0},
+  {119, 2, 6862, 0},
+  {99, 0, 0, 1855},
+  {104, 0, 0, 1856},
+  {99, 0, 0, 1857},
+  {99, 0, 0, 1858},
+  {108, 1, 6864, 0},
+  {114, 1, 6865, 0},
+  {116, 0, 0, 1859},
+  {109, 1, 6866, 0},
+  {101, 1, 6867, 0},
+  {114, 1, 6868, 0},
+  {110, 2, 6869, 0},
+  {115, 0, 0, 1860},
+  {110, 0, 0, 1861},
+  {108, 1, 6871, 0},
+  {115, 1, 6872, 0},
+  {114, 1, 6873, 0},
+  {114, 1, 6874, 0},
+  {97, 1, 6875, 0},
+  {110, 2, 6876, 0},
+  {114, 1, 6878, 0},
+  {114, 1, 6879, 0},
+  {97, 1, 6880, 0},
+  {113, 1, 6881, 0},
+  {105, 1, 6882, 0},
+  {114, 1, 6883, 0},
+  {103, 1, 6884, 0},
+  {114, 1, 6885, 0},
+  {101, 1, 6886, 0},
+  {105, 1, 6887, 0},
+  {103, 1, 6888, 0},
+  {97, 1, 6889, 0},
+  {119, 0, 0, 1862},
+  {97, 1, 6890, 0},
+  {119, 0, 0, 1863},
+  {108, 1, 6891, 0},
+  {101, 1, 6892, 0},
+  {105, 1, 6893, 0},
+  {113, 0, 0, 1864},
+  {120, 0, 0, 1865},
+  {115, 0, 0, 1866},
+  {116, 1, 6894, 0},
+  {111, 1, 6895, 0},
+  {114, 1, 6896, 0},
+  {97, 1, 6897, 0},
+  {97, 1, 6898, 0},
+  {97, 1, 6899, 0},
+  {116, 1, 6900, 0},
+  {101, 1, 6901, 0},
+  {108, 1, 6902, 0},
+  {110, 1, 6903, 0},
+  {115, 1, 6904, 0},
+  {105, 0, 0, 1867},
+  {113, 0, 0, 1868},
+  {120, 0, 0, 1869},
+  {120, 0, 0, 1870},
+  {119, 1, 6905, 0},
+  {102, 1, 6906, 0},
+  {103, 1, 6907, 0},
+  {116, 1, 6908, 0},
+  {104, 1, 6909, 0},
+  {119, 0, 0, 1871},
+  {101, 1, 6910, 0},
+  {105, 1, 6911, 0},
+  {101, 1, 6912, 0},
+  {101, 1, 6913, 0},
+  {101, 2, 6914, 0},
+  {111, 1, 6916, 0},
+  {101, 1, 6917, 0},
+  {110, 1, 6918, 0},
+  {111, 1, 6919, 0},
+  {117, 1, 6920, 0},
+  {103, 1, 6921, 0},
+  {107, 1, 6922, 0},
+  {65, 1, 6923, 0},
+  {68, 1, 6924, 0},
+  {71, 1, 6925, 0},
+  {84, 1, 6926, 0},
+  {108, 1, 6927, 0},
+  {117, 1, 6928, 0},
+  {114, 1, 6929, 0},
+  {114, 1, 6930, 0},
+  {105, 1, 6931, 0},
+  {101, 1, 6932, 0},
+  {101, 1, 6933, 0},
+  {105, 1, 6934, 0},
+  {65, 1, 6935, 0},
+  {84, 1, 6936, 0},
+  {111, 1, 6937, 0},
+  {110, 1, 6938, 0},
+  {99, 1, 6939, 0},
+  {114, 0, 0, 1872},
+  {65, 1, 6940, 0},
+  {104, 1, 6941, 0},
+  {86, 1, 6942, 0},
+  {116, 1, 6943, 0},
+  {101, 1, 6944, 0},
+  {99, 1, 6945, 0},
+  {119, 0, 0, 1873},
+  {113, 1, 6946, 0},
+  {97, 1, 6947, 0},
+  {69, 0, 0, 1874},
+  {83, 1, 6948, 0},
+  {109, 1, 6949, 0},
+  {108, 1, 6950, 1875},
+  {69, 1, 6951, 0},
+  {116, 1, 6952, 0},
+  {116, 1, 6953, 0},
+  {101, 0, 0, 1876},
+  {101, 0, 0, 1877},
+  {105, 1, 6954, 0},
+  {112, 0, 0, 1878},
+  {110, 0, 0, 1879},
+  {109, 1, 6955, 0},
+  {109, 1, 6956, 0},
+  {97, 1, 6957, 0},
+  {114, 0, 0, 1880},
+  {103, 1, 6958, 0},
+  {114, 1, 6959, 0},
+  {86, 1, 6960, 0},
+  {116, 1, 6961, 0},
+  {114, 1, 6962, 0},
+  {99, 1, 6963, 0},
+  {119, 0, 0, 1881},
+  {111, 1, 6964, 0},
+  {101, 2, 6965, 1882},
+  {101, 1, 6967, 0},
+  {99, 1, 6968, 0},
+  {114, 1, 6969, 1883},
+  {97, 1, 6970, 0},
+  {114, 1, 6971, 0},
+  {101, 1, 6972, 0},
+  {97, 1, 6973, 0},
+  {117, 1, 6974, 0},
+  {111, 1, 6975, 0},
+  {104, 1, 6976, 0},
+  {114, 1, 6977, 0},
+  {111, 1, 6978, 0},
+  {104, 1, 6979, 0},
+  {114, 1, 6980, 0},
+  {114, 1, 6981, 0},
+  {114, 1, 6982, 0},
+  {105, 1, 6983, 0},
+  {99, 1, 6984, 0},
+  {110, 1, 6985, 0},
+  {121, 1, 6986, 0},
+  {101, 1, 6987, 0},
+  {101, 1, 6988, 0},
+  {83, 1, 6989, 0},
+  {116, 0, 0, 1884},
+  {114, 1, 6990, 0},
+  {100, 1, 6991, 0},
+  {113, 1, 6992, 0},
+  {117, 1, 6993, 0},
+  {114, 1, 6994, 0},
+  {101, 1, 6995, 0},
+  {108, 1, 6996, 0},
+  {105, 1, 6997, 0},
+  {72, 1, 6998, 0},
+  {108, 0, 0, 1885},
+  {110, 1, 6999, 0},
+  {108, 0, 0, 1886},
+  {116, 1, 7000, 0},
+  {116, 1, 7001, 0},
+  {101, 0, 0, 1887},
+  {101, 1, 7002, 0},
+  {115, 1, 7003, 0},
+  {69, 1, 7004, 0},
+  {83, 1, 7005, 0},
+  {108, 1, 7006, 0},
+  {97, 1, 7007, 0},
+  {98, 1, 7008, 0},
+  {112, 1, 7009, 0},
+  {117, 1, 7010, 0},
+  {69, 1, 7011, 0},
+  {83, 1, 7012, 0},
+  {84, 1, 7013, 0},
+  {69, 1, 7014, 0},
+  {97, 1, 7015, 0},
+  {108, 1, 7016, 0},
+  {100, 1, 7017, 0},
+  {66, 1, 7018, 0},
+  {117, 1, 7019, 0},
+  {111, 1, 7020, 0},
+  {101, 1, 7021, 0},
+  {110, 1, 7022, 0},
+  {97, 1, 7023, 0},
+  {110, 1, 7024, 0},
+  {100, 1, 7025, 0},
+  {108, 0, 0, 1888},
+  {101, 1, 7026, 0},
+  {108, 1, 7027, 0},
+  {117, 1, 7028, 0},
+  {114, 1, 7029, 0},
+  {97, 1, 7030, 0},
+  {101, 1, 7031, 0},
+  {103, 0, 0, 1889},
+  {66, 1, 7032, 0},
+  {101, 1, 7033, 0},
+  {99, 1, 7034, 0},
+  {111, 1, 7035, 0},
+  {116, 1, 7036, 0},
+  {108, 1, 7037, 0},
+  {86, 1, 7038, 0},
+  {101, 1, 7039, 0},
+  {111, 1, 7040, 0},
+  {66, 1, 7041, 0},
+  {115, 0, 0, 1890},
+  {114, 1, 7042, 0},
+  {114, 1, 7043, 0},
+  {114, 1, 7044, 0},
+  {119, 0, 0, 1891},
+  {115, 1, 7045, 0},
+  {116, 1, 7046, 1892},
+  {115, 1, 7047, 0},
+  {97, 1, 7048, 0},
+  {110, 1, 7049, 0},
+  {100, 1, 7050, 0},
+  {97, 1, 7051, 0},
+  {117, 1, 7052, 0},
+  {116, 0, 0, 1893},
+  {104, 1, 7053, 0},
+  {65, 1, 7054, 0},
+  {117, 1, 7055, 0},
+  {114, 1, 7056, 0},
+  {114, 1, 7057, 0},
+  {101, 0, 0, 1894},
+  {97, 1, 7058, 0},
+  {100, 1, 7059, 0},
+  {99, 1, 7060, 0},
+  {97, 1, 7061, 0},
+  {100, 1, 7062, 0},
+  {117, 1, 7063, 0},
+  {101, 0, 0, 1895},
+  {108, 1, 7064, 0},
+  {108, 1, 7065, 0},
+  {114, 1, 7066, 0},
+  {101, 1, 7067, 0},
+  {105, 1, 7068, 0},
+  {101, 1, 7069, 0},
+  {100, 1, 7070, 0},
+  {111, 1, 7071, 0},
+  {108, 1, 7072, 0},
+  {114, 1, 7073, 0},
+  {101, 0, 0, 1896},
+  {101, 1, 7074, 0},
+  {111, 1, 7075, 0},
+  {114, 1, 7076, 0},
+  {105, 1, 7077, 0},
+  {100, 1, 7078, 0},
+  {117, 1, 7079, 0},
+  {111, 1, 7080, 0},
+  {114, 1, 7081, 0},
+  {114, 1, 7082, 0},
+  {117, 1, 7083, 0},
+  {109, 1, 7084, 0},
+  {111, 1, 7085, 0},
+  {104, 1, 7086, 0},
+  {114, 1, 7087, 0},
+  {102, 1, 7088, 0},
+  {103, 1, 7089, 0},
+  {108, 1, 7090, 0},
+  {114, 1, 7091, 0},
+  {114, 1, 7092, 0},
+  {108, 1, 7093, 0},
+  {102, 1, 7094, 0},
+  {103, 1, 7095, 0},
+  {97, 1, 7096, 0},
+  {110, 2, 7097, 0},
+  {114, 1, 7099, 0},
+  {114, 1, 7100, 0},
+  {114, 1, 7101, 0},
+  {114, 1, 7102, 0},
+  {105, 1, 7103, 0},
+  {113, 0, 0, 1897},
+  {101, 1, 7104, 0},
+  {117, 1, 7105, 0},
+  {105, 1, 7106, 0},
+  {110, 0, 0, 1898},
+  {116, 1, 7107, 1899},
+  {104, 1, 7108, 0},
+  {97, 1, 7109, 0},
+  {116, 1, 7110, 0},
+  {102, 1, 7111, 0},
+  {103, 1, 7112, 0},
+  {113, 1, 7113, 1900},
+  {113, 1, 7114, 1901},
+  {108, 1, 7115, 0},
+  {114, 1, 7116, 0},
+  {110, 0, 0, 1902},
+  {114, 1, 7117, 0},
+  {116, 1, 7118, 0},
+  {117, 1, 7119, 0},
+  {111, 1, 7120, 0},
+  {114, 1, 7121, 0},
+  {119, 1, 7122, 0},
+  {99, 1, 7123, 0},
+  {111, 2, 7124, 0},
+  {114, 1, 7126, 0},
+  {105, 1, 7127, 0},
+  {68, 0, 0, 1903},
+  {114, 1, 7128, 0},
+  {114, 1, 7129, 0},
+  {114, 1, 7130, 0},
+  {103, 1, 7131, 0},
+  {101, 0, 0, 1904},
+  {102, 1, 7132, 0},
+  {103, 1, 7133, 0},
+  {114, 1, 7134, 0},
+  {101, 1, 7135, 0},
+  {119, 0, 0, 1905},
+  {65, 1, 7136, 0},
+  {97, 1, 7137, 0},
+  {114, 1, 7138, 0},
+  {116, 1, 7139, 0},
+  {101, 1, 7140, 0},
+  {111, 1, 7141, 0},
+  {86, 1, 7142, 0},
+  {116, 1, 7143, 0},
+  {117, 1, 7144, 0},
+  {108, 1, 7145, 0},
+  {113, 1, 7146, 0},
+  {97, 1, 7147, 0},
+  {76, 1, 7148, 0},
+  {113, 1, 7149, 0},
+  {101, 1, 7150, 0},
+  {69, 1, 7151, 0},
+  {110, 1, 7152, 0},
+  {109, 1, 7153, 0},
+  {101, 1, 7154, 0},
+  {99, 1, 7155, 0},
+  {104, 1, 7156, 0},
+  {97, 1, 7157, 0},
+  {101, 1, 7158, 0},
+  {111, 1, 7159, 0},
+  {111, 1, 7160, 0},
+  {116, 1, 7161, 0},
+  {114, 0, 0, 1906},
+  {66, 1, 7162, 0},
+  {69, 1, 7163, 0},
+  {99, 1, 7164, 0},
+  {116, 1, 7165, 0},
+  {66, 1, 7166, 0},
+  {114, 0, 0, 1907},
+  {111, 1, 7167, 0},
+  {97, 1, 7168, 0},
+  {108, 0, 0, 1908},
+  {97, 1, 7169, 0},
+  {119, 0, 0, 1909},
+  {116, 1, 7170, 0},
+  {111, 1, 7171, 0},
+  {119, 0, 0, 1910},
+  {116, 1, 7172, 0},
+  {111, 1, 7173, 0},
+  {111, 1, 7174, 0},
+  {114, 1, 7175, 0},
+  {117, 1, 7176, 0},
+  {107, 1, 7177, 0},
+  {83, 1, 7178, 0},
+  {84, 1, 7179, 0},
+  {114, 1, 7180, 0},
+  {115, 1, 7181, 0},
+  {112, 1, 7182, 0},
+  {116, 1, 7183, 0},
+  {101, 0, 0, 1911},
+  {117, 1, 7184, 0},
+  {108, 1, 7185, 0},
+  {101, 1, 7186, 0},
+  {115, 1, 7187, 0},
+  {97, 1, 7188, 0},
+  {108, 1, 7189, 0},
+  {117, 1, 7190, 0},
+  {103, 1, 7191, 0},
+  {101, 1, 7192, 0},
+  {69, 1, 7193, 0},
+  {97, 1, 7194, 0},
+  {115, 1, 7195, 0},
+  {113, 1, 7196, 0},
+  {108, 1, 7197, 0},
+  {101, 1, 7198, 0},
+  {110, 1, 7199, 0},
+  {115, 1, 7200, 0},
+  {101, 1, 7201, 0},
+  {97, 1, 7202, 0},
+  {113, 1, 7203, 0},
+  {108, 1, 7204, 0},
+  {105, 1, 7205, 0},
+  {113, 1, 7206, 0},
+  {108, 0, 0, 1912},
+  {69, 1, 7207, 0},
+  {101, 0, 0, 1913},
+  {97, 1, 7208, 0},
+  {98, 1, 7209, 0},
+  {116, 1, 7210, 0},
+  {115, 1, 7211, 0},
+  {101, 0, 0, 1914},
+  {108, 0, 0, 1915},
+  {116, 1, 7212, 0},
+  {101, 0, 0, 1916},
+  {110, 1, 7213, 0},
+  {105, 1, 7214, 0},
+  {105, 1, 7215, 0},
+  {97, 1, 7216, 0},
+  {114, 0, 0, 1917},
+  {102, 1, 7217, 0},
+  {114, 1, 7218, 0},
+  {86, 1, 7219, 0},
+  {116, 1, 7220, 0},
+  {119, 0, 0, 1918},
+  {111, 1, 7221, 0},
+  {101, 2, 7222, 1919},
+  {101, 1, 7224, 0},
+  {99, 1, 7225, 0},
+  {114, 1, 7226, 1920},
+  {97, 1, 7227, 0},
+  {111, 1, 7228, 0},
+  {111, 1, 7229, 0},
+  {114, 1, 7230, 0},
+  {101, 1, 7231, 0},
+  {69, 1, 7232, 0},
+  {101, 1, 7233, 0},
+  {108, 0, 0, 1921},
+  {116, 1, 7234, 0},
+  {101, 0, 0, 1922},
+  {108, 0, 0, 1923},
+  {97, 1, 7235, 0},
+  {101, 1, 7236, 0},
+  {114, 1, 7237, 0},
+  {109, 0, 0, 1924},
+  {111, 1, 7238, 0},
+  {114, 1, 7239, 0},
+  {114, 1, 7240, 0},
+  {101, 0, 0, 1925},
+  {101, 0, 0, 1926},
+  {99, 1, 7241, 0},
+  {111, 1, 7242, 0},
+  {112, 0, 0, 1927},
+  {101, 3, 7243, 1928},
+  {101, 1, 7246, 0},
+  {105, 1, 7247, 0},
+  {102, 1, 7248, 0},
+  {103, 1, 7249, 0},
+  {115, 0, 0, 1929},
+  {103, 1, 7250, 0},
+  {119, 1, 7251, 0},
+  {101, 1, 7252, 0},
+  {105, 1, 7253, 0},
+  {113, 0, 0, 1930},
+  {119, 0, 0, 1931},
+  {111, 1, 7254, 0},
+  {108, 0, 0, 1932},
+  {111, 1, 7255, 0},
+  {112, 0, 0, 1933},
+  {119, 1, 7256, 0},
+  {111, 1, 7257, 0},
+  {112, 1, 7258, 0},
+  {105, 1, 7259, 0},
+  {101, 1, 7260, 0},
+  {119, 0, 0, 1934},
+  {116, 1, 7261, 0},
+  {111, 1, 7262, 0},
+  {116, 0, 0, 1935},
+  {104, 1, 7263, 0},
+  {101, 0, 0, 1936},
+  {114, 1, 7264, 0},
+  {114, 1, 7265, 0},
+  {101, 1, 7266, 0},
+  {116, 1, 7267, 1937},
+  {104, 1, 7268, 0},
+  {105, 1, 7269, 0},
+  {100, 1, 7270, 0},
+  {117, 1, 7271, 0},
+  {111, 1, 7272, 0},
+  {112, 1, 7273, 0},
+  {114, 1, 7274, 0},
+  {114, 1, 7275, 0},
+  {109, 1, 7276, 0},
+  {108, 0, 0, 1938},
+  {115, 0, 0, 1939},
+  {108, 1, 7277, 0},
+  {101, 1, 7278, 0},
+  {116, 1, 7279, 1940},
+  {114, 1, 7280, 0},
+  {97, 1, 7281, 0},
+  {116, 0, 0, 1941},
+  {104, 1, 7282, 0},
+  {113, 0, 0, 1942},
+  {113, 0, 0, 1943},
+  {101, 1, 7283, 0},
+  {105, 1, 7284, 0},
+  {101, 1, 7285, 0},
+  {111, 1, 7286, 0},
+  {98, 1, 7287, 0},
+  {116, 1, 7288, 0},
+  {97, 1, 7289, 0},
+  {105, 1, 7290, 0},
+  {117, 1, 7291, 0},
+  {116, 0, 0, 1944},
+  {117, 1, 7292, 0},
+  {97, 1, 7293, 0},
+  {108, 1, 7294, 0},
+  {73, 1, 7295, 0},
+  {111, 1, 7296, 0},
+  {111, 1, 7297, 0},
+  {104, 1, 7298, 0},
+  {116, 2, 7299, 0},
+  {104, 1, 7301, 0},
+  {114, 1, 7302, 0},
+  {101, 0, 0, 1945},
+  {114, 1, 7303, 0},
+  {108, 1, 7304, 0},
+  {114, 1, 7305, 0},
+  {86, 1, 7306, 0},
+  {99, 1, 7307, 0},
+  {114, 1, 7308, 1946},
+  {101, 1, 7309, 0},
+  {111, 1, 7310, 0},
+  {97, 1, 7311, 0},
+  {108, 1, 7312, 0},
+  {117, 1, 7313, 0},
+  {108, 1, 7314, 0},
+  {101, 1, 7315, 0},
+  {117, 1, 7316, 0},
+  {114, 0, 0, 1947},
+  {113, 1, 7317, 0},
+  {101, 0, 0, 1948},
+  {97, 0, 0, 1949},
+  {115, 0, 0, 1950},
+  {107, 1, 7318, 0},
+  {116, 1, 7319, 0},
+  {99, 1, 7320, 0},
+  {99, 1, 7321, 0},
+  {114, 1, 7322, 1951},
+  {119, 0, 0, 1952},
+  {111, 1, 7323, 0},
+  {97, 1, 7324, 0},
+  {113, 1, 7325, 0},
+  {116, 1, 7326, 0},
+  {111, 1, 7327, 0},
+  {97, 1, 7328, 0},
+  {119, 0, 0, 1953},
+  {116, 1, 7329, 0},
+  {108, 0, 0, 1954},
+  {65, 1, 7330, 0},
+  {119, 0, 0, 1955},
+  {97, 1, 7331, 0},
+  {119, 0, 0, 1956},
+  {119, 0, 0, 1957},
+  {111, 1, 7332, 0},
+  {109, 1, 7333, 0},
+  {83, 1, 7334, 0},
+  {112, 1, 7335, 0},
+  {104, 1, 7336, 0},
+  {71, 1, 7337, 0},
+  {115, 0, 0, 1958},
+  {97, 1, 7338, 0},
+  {105, 1, 7339, 0},
+  {97, 1, 7340, 0},
+  {108, 1, 7341, 0},
+  {97, 1, 7342, 0},
+  {115, 0, 0, 1959},
+  {110, 1, 7343, 0},
+  {100, 1, 7344, 0},
+  {109, 1, 7345, 0},
+  {108, 1, 7346, 0},
+  {114, 0, 0, 1960},
+  {113, 1, 7347, 0},
+  {116, 1, 7348, 0},
+  {76, 1, 7349, 0},
+  {117, 1, 7350, 0},
+  {97, 1, 7351, 0},
+  {109, 1, 7352, 0},
+  {103, 1, 7353, 0},
+  {101, 1, 7354, 0},
+  {114, 1, 7355, 0},
+  {108, 0, 0, 1961},
+  {117, 1, 7356, 0},
+  {97, 1, 7357, 0},
+  {108, 1, 7358, 0},
+  {117, 1, 7359, 0},
+  {113, 1, 7360, 0},
+  {114, 0, 0, 1962},
+  {108, 1, 7361, 0},
+  {101, 0, 0, 1963},
+  {105, 1, 7362, 0},
+  {69, 1, 7363, 0},
+  {116, 0, 0, 1964},
+  {98, 1, 7364, 0},
+  {108, 1, 7365, 0},
+  {99, 1, 7366, 0},
+  {116, 1, 7367, 0},
+  {97, 1, 7368, 0},
+  {101, 1, 7369, 0},
+  {111, 1, 7370, 0},
+  {114, 0, 0, 1965},
+  {66, 1, 7371, 0},
+  {69, 1, 7372, 0},
+  {99, 1, 7373, 0},
+  {116, 1, 7374, 0},
+  {66, 1, 7375, 0},
+  {114, 0, 0, 1966},
+  {119, 0, 0, 1967},
+  {119, 0, 0, 1968},
+  {111, 1, 7376, 0},
+  {99, 1, 7377, 0},
+  {113, 1, 7378, 0},
+  {116, 1, 7379, 1969},
+  {69, 1, 7380, 0},
+  {108, 0, 0, 1970},
+  {115, 1, 7381, 0},
+  {114, 1, 7382, 0},
+  {119, 0, 0, 1971},
+  {111, 1, 7383, 0},
+  {97, 1, 7384, 0},
+  {101, 0, 0, 1972},
+  {119, 1, 7385, 0},
+  {100, 1, 7386, 0},
+  {108, 1, 7387, 0},
+  {114, 1, 7388, 0},
+  {102, 1, 7389, 0},
+  {103, 1, 7390, 0},
+  {116, 0, 0, 1973},
+  {104, 1, 7391, 0},
+  {101, 0, 0, 1974},
+  {115, 0, 0, 1975},
+  {102, 1, 7392, 0},
+  {103, 1, 7393, 0},
+  {119, 0, 0, 1976},
+  {119, 1, 7394, 0},
+  {115, 0, 0, 1977},
+  {119, 1, 7395, 1978},
+  {111, 1, 7396, 0},
+  {103, 1, 7397, 0},
+  {115, 0, 0, 1979},
+  {97, 1, 7398, 0},
+  {119, 0, 0, 1980},
+  {116, 0, 0, 1981},
+  {111, 1, 7399, 0},
+  {111, 1, 7400, 0},
+  {108, 0, 0, 1982},
+  {101, 1, 7401, 0},
+  {116, 1, 7402, 1983},
+  {108, 0, 0, 1984},
+  {111, 1, 7403, 0},
+  {112, 0, 0, 1985},
+  {119, 1, 7404, 0},
+  {111, 1, 7405, 0},
+  {111, 1, 7406, 0},
+  {111, 1, 7407, 0},
+  {101, 1, 7408, 0},
+  {111, 1, 7409, 0},
+  {113, 0, 0, 1986},
+  {101, 1, 7410, 0},
+  {114, 1, 7411, 0},
+  {114, 1, 7412, 0},
+  {116, 0, 0, 1987},
+  {102, 1, 7413, 0},
+  {103, 1, 7414, 0},
+  {110, 1, 7415, 0},
+  {117, 1, 7416, 0},
+  {108, 1, 7417, 0},
+  {101, 0, 0, 1988},
+  {108, 0, 0, 1989},
+  {115, 1, 7418, 0},
+  {116, 1, 7419, 0},
+  {98, 1, 7420, 0},
+  {118, 1, 7421, 0},
+  {100, 1, 7422, 0},
+  {110, 1, 7423, 0},
+  {119, 0, 0, 1990},
+  {119, 0, 0, 1991},
+  {116, 1, 7424, 0},
+  {65, 1, 7425, 0},
+  {82, 1, 7426, 0},
+  {116, 1, 7427, 0},
+  {111, 1, 7428, 0},
+  {114, 1, 7429, 0},
+  {66, 1, 7430, 0},
+  {111, 1, 7431, 0},
+  {101, 1, 7432, 0},
+  {116, 1, 7433, 0},
+  {66, 1, 7434, 0},
+  {99, 1, 7435, 0},
+  {114, 1, 7436, 1992},
+  {114, 1, 7437, 0},
+  {83, 1, 7438, 0},
+  {97, 1, 7439, 0},
+  {108, 1, 7440, 0},
+  {115, 1, 7441, 0},
+  {97, 1, 7442, 0},
+  {117, 1, 7443, 0},
+  {101, 1, 7444, 0},
+  {65, 1, 7445, 0},
+  {107, 1, 7446, 0},
+  {116, 1, 7447, 0},
+  {66, 1, 7448, 0},
+  {114, 0, 0, 1993},
+  {114, 0, 0, 1994},
+  {117, 1, 7449, 0},
+  {111, 1, 7450, 0},
+  {114, 0, 0, 1995},
+  {114, 0, 0, 1996},
+  {101, 1, 7451, 0},
+  {114, 1, 7452, 0},
+  {114, 1, 7453, 0},
+  {119, 0, 0, 1997},
+  {83, 1, 7454, 0},
+  {112, 1, 7455, 0},
+  {97, 1, 7456, 0},
+  {105, 1, 7457, 0},
+  {114, 1, 7458, 0},
+  {99, 1, 7459, 0},
+  {99, 1, 7460, 0},
+  {108, 0, 0, 1998},
+  {69, 1, 7461, 0},
+  {116, 1, 7462, 0},
+  {116, 1, 7463, 0},
+  {101, 0, 0, 1999},
+  {112, 0, 0, 2000},
+  {101, 2, 7464, 2001},
+  {117, 1, 7466, 0},
+  {101, 1, 7467, 0},
+  {101, 1, 7468, 0},
+  {97, 1, 7469, 0},
+  {110, 1, 7470, 0},
+  {101, 1, 7471, 0},
+  {108, 1, 7472, 0},
+  {116, 1, 7473, 2002},
+  {115, 1, 7474, 0},
+  {97, 1, 7475, 0},
+  {110, 1, 7476, 0},
+  {100, 1, 7477, 0},
+  {97, 1, 7478, 0},
+  {117, 1, 7479, 0},
+  {101, 1, 7480, 0},
+  {115, 0, 0, 2003},
+  {113, 1, 7481, 0},
+  {114, 1, 7482, 0},
+  {105, 1, 7483, 0},
+  {107, 1, 7484, 0},
+  {65, 1, 7485, 0},
+  {99, 1, 7486, 0},
+  {99, 1, 7487, 0},
+  {114, 1, 7488, 2004},
+  {97, 1, 7489, 0},
+  {113, 1, 7490, 0},
+  {116, 1, 7491, 0},
+  {111, 1, 7492, 0},
+  {97, 1, 7493, 0},
+  {119, 0, 0, 2005},
+  {116, 1, 7494, 0},
+  {117, 1, 7495, 0},
+  {69, 1, 7496, 0},
+  {113, 1, 7497, 0},
+  {105, 1, 7498, 0},
+  {111, 1, 7499, 0},
+  {119, 0, 0, 2006},
+  {116, 1, 7500, 0},
+  {110, 0, 0, 2007},
+  {111, 1, 7501, 0},
+  {101, 1, 7502, 0},
+  {105, 1, 7503, 0},
+  {116, 0, 0, 2008},
+  {104, 1, 7504, 0},
+  {116, 0, 0, 2009},
+  {116, 0, 0, 2010},
+  {104, 1, 7505, 0},
+  {110, 0, 0, 2011},
+  {115, 0, 0, 2012},
+  {111, 1, 7506, 0},
+  {97, 1, 7507, 0},
+  {114, 1, 7508, 0},
+  {119, 0, 0, 2013},
+  {119, 0, 0, 2014},
+  {113, 0, 0, 2015},
+  {101, 1, 7509, 0},
+  {119, 1, 7510, 0},
+  {115, 0, 0, 2016},
+  {111, 1, 7511, 0},
+  {119, 1, 7512, 0},
+  {119, 0, 0, 2017},
+  {115, 0, 0, 2018},
+  {110, 0, 0, 2019},
+  {113, 0, 0, 2020},
+  {111, 1, 7513, 0},
+  {114, 1, 7514, 0},
+  {116, 0, 0, 2021},
+  {104, 1, 7515, 0},
+  {116, 1, 7516, 0},
+  {114, 1, 7517, 0},
+  {101, 1, 7518, 0},
+  {101, 1, 7519, 0},
+  {101, 0, 0, 2022},
+  {108, 1, 7520, 0},
+  {101, 0, 0, 2023},
+  {101, 0, 0, 2024},
+  {116, 1, 7521, 0},
+  {65, 1, 7522, 0},
+  {114, 1, 7523, 0},
+  {105, 1, 7524, 0},
+  {65, 1, 7525, 0},
+  {119, 0, 0, 2025},
+  {111, 1, 7526, 0},
+  {97, 1, 7527, 0},
+  {119, 0, 0, 2026},
+  {99, 1, 7528, 0},
+  {111, 1, 7529, 0},
+  {97, 1, 7530, 0},
+  {116, 1, 7531, 0},
+  {66, 1, 7532, 0},
+  {101, 0, 0, 2027},
+  {113, 1, 7533, 0},
+  {114, 1, 7534, 0},
+  {83, 1, 7535, 0},
+  {115, 0, 0, 2028},
+  {108, 0, 0, 2029},
+  {97, 1, 7536, 0},
+  {116, 0, 0, 2030},
+  {114, 1, 7537, 0},
+  {101, 1, 7538, 0},
+  {111, 1, 7539, 0},
+  {97, 1, 7540, 0},
+  {97, 1, 7541, 0},
+  {114, 0, 0, 2031},
+  {114, 0, 0, 2032},
+  {114, 1, 7542, 0},
+  {114, 1, 7543, 0},
+  {112, 1, 7544, 0},
+  {97, 1, 7545, 0},
+  {99, 1, 7546, 0},
+  {110, 1, 7547, 0},
+  {101, 1, 7548, 0},
+  {101, 0, 0, 2033},
+  {97, 1, 7549, 0},
+  {113, 1, 7550, 0},
+  {101, 1, 7551, 0},
+  {69, 1, 7552, 0},
+  {66, 1, 7553, 0},
+  {69, 1, 7554, 0},
+  {97, 1, 7555, 0},
+  {114, 1, 7556, 0},
+  {115, 1, 7557, 0},
+  {108, 0, 0, 2034},
+  {116, 1, 7558, 0},
+  {110, 1, 7559, 0},
+  {101, 2, 7560, 2035},
+  {69, 1, 7562, 0},
+  {101, 1, 7563, 0},
+  {108, 0, 0, 2036},
+  {116, 1, 7564, 0},
+  {101, 0, 0, 2037},
+  {108, 0, 0, 2038},
+  {97, 1, 7565, 0},
+  {81, 1, 7566, 0},
+  {117, 1, 7567, 0},
+  {105, 1, 7568, 0},
+  {98, 1, 7569, 0},
+  {101, 1, 7570, 0},
+  {114, 1, 7571, 0},
+  {107, 1, 7572, 0},
+  {116, 1, 7573, 0},
+  {66, 1, 7574, 0},
+  {114, 0, 0, 2039},
+  {117, 1, 7575, 0},
+  {111, 1, 7576, 0},
+  {114, 0, 0, 2040},
+  {114, 0, 0, 2041},
+  {105, 1, 7577, 0},
+  {97, 1, 7578, 0},
+  {113, 1, 7579, 0},
+  {117, 1, 7580, 0},
+  {115, 0, 0, 2042},
+  {119, 0, 0, 2043},
+  {111, 1, 7581, 0},
+  {119, 1, 7582, 0},
+  {102, 1, 7583, 0},
+  {103, 1, 7584, 0},
+  {116, 0, 0, 2044},
+  {116, 0, 0, 2045},
+  {110, 1, 7585, 0},
+  {114, 1, 7586, 0},
+  {114, 1, 7587, 0},
+  {113, 0, 0, 2046},
+  {110, 0, 0, 2047},
+  {110, 1, 7588, 0},
+  {115, 0, 0, 2048},
+  {119, 0, 0, 2049},
+  {111, 1, 7589, 0},
+  {116, 0, 0, 2050},
+  {105, 1, 7590, 0},
+  {73, 1, 7591, 0},
+  {81, 1, 7592, 0},
+  {67, 1, 7593, 0},
+  {101, 1, 7594, 0},
+  {101, 1, 7595, 0},
+  {114, 1, 7596, 0},
+  {114, 1, 7597, 0},
+  {103, 1, 7598, 0},
+  {114, 1, 7599, 0},
+  {119, 0, 0, 2051},
+  {114, 0, 0, 2052},
+  {116, 1, 7600, 0},
+  {114, 0, 0, 2053},
+  {114, 0, 0, 2054},
+  {111, 1, 7601, 0},
+  {97, 1, 7602, 0},
+  {117, 1, 7603, 0},
+  {101, 0, 0, 2055},
+  {113, 1, 7604, 0},
+  {108, 0, 0, 2056},
+  {114, 1, 7605, 0},
+  {116, 0, 0, 2057},
+  {114, 0, 0, 2058},
+  {114, 0, 0, 2059},
+  {108, 0, 0, 2060},
+  {111, 1, 7606, 0},
+  {111, 1, 7607, 0},
+  {97, 1, 7608, 0},
+  {99, 1, 7609, 0},
+  {101, 0, 0, 2061},
+  {83, 1, 7610, 0},
+  {97, 1, 7611, 0},
+  {108, 1, 7612, 0},
+  {117, 1, 7613, 0},
+  {114, 0, 0, 2062},
+  {113, 1, 7614, 0},
+  {97, 1, 7615, 0},
+  {113, 1, 7616, 0},
+  {108, 0, 0, 2063},
+  {71, 1, 7617, 0},
+  {115, 0, 0, 2064},
+  {69, 1, 7618, 0},
+  {116, 0, 0, 2065},
+  {66, 1, 7619, 0},
+  {69, 1, 7620, 0},
+  {113, 1, 7621, 0},
+  {116, 1, 7622, 2066},
+  {69, 1, 7623, 0},
+  {108, 0, 0, 2067},
+  {117, 1, 7624, 0},
+  {97, 1, 7625, 0},
+  {117, 1, 7626, 0},
+  {114, 1, 7627, 0},
+  {116, 0, 0, 2068},
+  {114, 1, 7628, 0},
+  {101, 1, 7629, 0},
+  {111, 1, 7630, 0},
+  {97, 1, 7631, 0},
+  {97, 1, 7632, 0},
+  {114, 0, 0, 2069},
+  {111, 1, 7633, 0},
+  {108, 0, 0, 2070},
+  {117, 1, 7634, 0},
+  {97, 1, 7635, 0},
+  {114, 0, 0, 2071},
+  {110, 0, 0, 2072},
+  {116, 0, 0, 2073},
+  {104, 1, 7636, 0},
+  {115, 0, 0, 2074},
+  {114, 1, 7637, 0},
+  {111, 1, 7638, 0},
+  {115, 0, 0, 2075},
+  {119, 0, 0, 2076},
+  {97, 1, 7639, 0},
+  {110, 1, 7640, 0},
+  {117, 1, 7641, 0},
+  {111, 1, 7642, 0},
+  {65, 1, 7643, 0},
+  {103, 1, 7644, 0},
+  {114, 1, 7645, 0},
+  {111, 1, 7646, 0},
+  {104, 1, 7647, 0},
+  {114, 1, 7648, 0},
+  {111, 1, 7649, 0},
+  {114, 0, 0, 2077},
+  {114, 0, 0, 2078},
+  {97, 1, 7650, 0},
+  {117, 1, 7651, 0},
+  {111, 1, 7652, 0},
+  {119, 0, 0, 2079},
+  {119, 0, 0, 2080},
+  {99, 1, 7653, 0},
+  {101, 0, 0, 2081},
+  {112, 1, 7654, 0},
+  {116, 1, 7655, 0},
+  {66, 1, 7656, 0},
+  {97, 1, 7657, 0},
+  {117, 1, 7658, 0},
+  {114, 0, 0, 2082},
+  {117, 1, 7659, 0},
+  {114, 1, 7660, 0},
+  {113, 1, 7661, 0},
+  {97, 1, 7662, 0},
+  {113, 1, 7663, 0},
+  {117, 1, 7664, 0},
+  {69, 1, 7665, 0},
+  {113, 1, 7666, 0},
+  {111, 1, 7667, 0},
+  {108, 0, 0, 2083},
+  {109, 0, 0, 2084},
+  {105, 1, 7668, 0},
+  {111, 1, 7669, 0},
+  {116, 0, 0, 2085},
+  {114, 0, 0, 2086},
+  {114, 0, 0, 2087},
+  {108, 0, 0, 2088},
+  {110, 0, 0, 2089},
+  {97, 1, 7670, 0},
+  {108, 0, 0, 2090},
+  {116, 0, 0, 2091},
+  {111, 1, 7671, 0},
+  {119, 0, 0, 2092},
+  {108, 1, 7672, 0},
+  {116, 1, 7673, 0},
+  {111, 1, 7674, 0},
+  {110, 1, 7675, 0},
+  {99, 1, 7676, 0},
+  {114, 1, 7677, 0},
+  {111, 1, 7678, 0},
+  {119, 0, 0, 2093},
+  {116, 1, 7679, 0},
+  {111, 1, 7680, 0},
+  {114, 0, 0, 2094},
+  {114, 1, 7681, 0},
+  {97, 1, 7682, 0},
+  {119, 0, 0, 2095},
+  {101, 0, 0, 2096},
+  {97, 1, 7683, 0},
+  {101, 1, 7684, 0},
+  {97, 1, 7685, 0},
+  {108, 0, 0, 2097},
+  {97, 1, 7686, 0},
+  {97, 1, 7687, 0},
+  {101, 1, 7688, 0},
+  {117, 1, 7689, 0},
+  {114, 0, 0, 2098},
+  {117, 1, 7690, 0},
+  {97, 1, 7691, 0},
+  {113, 1, 7692, 0},
+  {117, 1, 7693, 0},
+  {116, 1, 7694, 0},
+  {117, 1, 7695, 0},
+  {119, 0, 0, 2099},
+  {108, 0, 0, 2100},
+  {119, 0, 0, 2101},
+  {68, 0, 0, 2102},
+  {101, 1, 7696, 0},
+  {116, 1, 7697, 0},
+  {116, 1, 7698, 0},
+  {117, 1, 7699, 0},
+  {97, 1, 7700, 0},
+  {119, 0, 0, 2103},
+  {65, 1, 7701, 0},
+  {119, 0, 0, 2104},
+  {101, 0, 0, 2105},
+  {114, 1, 7702, 0},
+  {99, 1, 7703, 0},
+  {114, 0, 0, 2106},
+  {114, 0, 0, 2107},
+  {108, 0, 0, 2108},
+  {108, 0, 0, 2109},
+  {97, 1, 7704, 0},
+  {97, 1, 7705, 0},
+  {97, 1, 7706, 0},
+  {108, 0, 0, 2110},
+  {117, 1, 7707, 0},
+  {97, 1, 7708, 0},
+  {101, 0, 0, 2111},
+  {109, 0, 0, 2112},
+  {103, 1, 7709, 0},
+  {101, 0, 0, 2113},
+  {111, 1, 7710, 0},
+  {116, 1, 7711, 0},
+  {108, 0, 0, 2114},
+  {114, 1, 7712, 0},
+  {101, 0, 0, 2115},
+  {101, 0, 0, 2116},
+  {116, 1, 7713, 0},
+  {108, 0, 0, 2117},
+  {108, 0, 0, 2118},
+  {97, 1, 7714, 0},
+  {108, 0, 0, 2119},
+  {114, 1, 7715, 0},
+  {117, 1, 7716, 0},
+  {101, 0, 0, 2120},
+  {114, 1, 7717, 0},
+  {101, 1, 7718, 0},
+  {108, 0, 0, 2121},
+  {97, 1, 7719, 0},
+  {114, 1, 7720, 0},
+  {111, 1, 7721, 0},
+  {114, 0, 0, 2122},
+  {108, 0, 0, 2123},
+  {73, 1, 7722, 0},
+  {119, 0, 0, 2124},
+  {110, 1, 7723, 0},
+  {116, 1, 7724, 0},
+  {101, 1, 7725, 0},
+  {103, 1, 7726, 0},
+  {114, 1, 7727, 0},
+  {97, 1, 7728, 0},
+  {108, 0, 0, 2125},
+};
+
+const char32_t entity_value[2126][2] = {
+  {0},
+  {0x2145, 0x0000},
+  {0x003e, 0x0000},
+  {0x22d9, 0x0000},
+  {0x226b, 0x0000},
+  {0x2111, 0x0000},
+  {0x003c, 0x0000},
+  {0x22d8, 0x0000},
+  {0x226a, 0x0000},
+  {0x039c, 0x0000},
+  {0x039d, 0x0000},
+  {0x2a54, 0x0000},
+  {0x03a0, 0x0000},
+  {0x2abb, 0x0000},
+  {0x211c, 0x0000},
+  {0x2abc, 0x0000},
+  {0x039e, 0x0000},
+  {0x223e, 0x0000},
+  {0x2061, 0x0000},
+  {0x2248, 0x0000},
+  {0x2146, 0x0000},
+  {0x2147, 0x0000},
+  {0x2a9a, 0x0000},
+  {0x2a99, 0x0000},
+  {0x2267, 0x0000},
+  {0x2265, 0x0000},
+  {0x226b, 0x0000},
+  {0x2277, 0x0000},
+  {0x003e, 0x0000},
+  {0x2063, 0x0000},
+  {0x2148, 0x0000},
+  {0x2208, 0x0000},
+  {0x2062, 0x0000},
+  {0x2266, 0x0000},
+  {0x2264, 0x0000},
+  {0x2276, 0x0000},
+  {0x226a, 0x0000},
+  {0x003c, 0x0000},
+  {0x2213, 0x0000},
+  {0x03bc, 0x0000},
+  {0x2260, 0x0000},
+  {0x220b, 0x0000},
+  {0x03bd, 0x0000},
+  {0x24c8, 0x0000},
+  {0x2228, 0x0000},
+  {0x03c0, 0x0000},
+  {0x00b1, 0x0000},
+  {0x227a, 0x0000},
+  {0x211e, 0x0000},
+  {0x227b, 0x0000},
+  {0x2118, 0x0000},
+  {0x2240, 0x0000},
+  {0x03be, 0x0000},
+  {0x0026, 0x0000},
+  {0x0410, 0x0000},
+  {0x1d504, 0x0000},
+  {0x2a53, 0x0000},
+  {0x0411, 0x0000},
+  {0x1d505, 0x0000},
+  {0x22d2, 0x0000},
+  {0x212d, 0x0000},
+  {0x03a7, 0x0000},
+  {0x22d3, 0x0000},
+  {0x0414, 0x0000},
+  {0x2207, 0x0000},
+  {0x1d507, 0x0000},
+  {0x00a8, 0x0000},
+  {0x014a, 0x0000},
+  {0x00d0, 0x0000},
+  {0x042d, 0x0000},
+  {0x1d508, 0x0000},
+  {0x0397, 0x0000},
+  {0x0424, 0x0000},
+  {0x1d509, 0x0000},
+  {0x0413, 0x0000},
+  {0x1d50a, 0x0000},
+  {0x005e, 0x0000},
+  {0x210c, 0x0000},
+  {0x0418, 0x0000},
+  {0x2111, 0x0000},
+  {0x222c, 0x0000},
+  {0x0419, 0x0000},
+  {0x1d50d, 0x0000},
+  {0x041a, 0x0000},
+  {0x1d50e, 0x0000},
+  {0x041b, 0x0000},
+  {0x1d50f, 0x0000},
+  {0x21b0, 0x0000},
+  {0x2905, 0x0000},
+  {0x041c, 0x0000},
+  {0x1d510, 0x0000},
+  {0x041d, 0x0000},
+  {0x1d511, 0x0000},
+  {0x2aec, 0x0000},
+  {0x041e, 0x0000},
+  {0x1d512, 0x0000},
+  {0x041f, 0x0000},
+  {0x1d513, 0x0000},
+  {0x03a6, 0x0000},
+  {0x03a8, 0x0000},
+  {0x1d514, 0x0000},
+  {0x00ae, 0x0000},
+  {0x0420, 0x0000},
+  {0x211c, 0x0000},
+  {0x03a1, 0x0000},
+  {0x21b1, 0x0000},
+  {0x0421, 0x0000},
+  {0x1d516, 0x0000},
+  {0x22d0, 0x0000},
+  {0x2211, 0x0000},
+  {0x22d1, 0x0000},
+  {0x0009, 0x0000},
+  {0x03a4, 0x0000},
+  {0x0422, 0x0000},
+  {0x1d517, 0x0000},
+  {0x0423, 0x0000},
+  {0x1d518, 0x0000},
+  {0x0412, 0x0000},
+  {0x22c1, 0x0000},
+  {0x1d519, 0x0000},
+  {0x1d51a, 0x0000},
+  {0x1d51b, 0x0000},
+  {0x042b, 0x0000},
+  {0x1d51c, 0x0000},
+  {0x0417, 0x0000},
+  {0x2128, 0x0000},
+  {0x223e, 0x0333},
+  {0x223f, 0x0000},
+  {0x0430, 0x0000},
+  {0x1d51e, 0x0000},
+  {0x0026, 0x0000},
+  {0x2227, 0x0000},
+  {0x2220, 0x0000},
+  {0x2a70, 0x0000},
+  {0x224a, 0x0000},
+  {0x002a, 0x0000},
+  {0x0431, 0x0000},
+  {0x1d51f, 0x0000},
+  {0x003d, 0x20e5},
+  {0x22a5, 0x0000},
+  {0x2229, 0x0000},
+  {0x1d520, 0x0000},
+  {0x03c7, 0x0000},
+  {0x25cb, 0x0000},
+  {0x222a, 0x0000},
+  {0x0434, 0x0000},
+  {0x00b0, 0x0000},
+  {0x1d521, 0x0000},
+  {0x00a8, 0x0000},
+  {0x00f7, 0x0000},
+  {0x02d9, 0x0000},
+  {0x044d, 0x0000},
+  {0x1d522, 0x0000},
+  {0x2a96, 0x0000},
+  {0x2113, 0x0000},
+  {0x2a95, 0x0000},
+  {0x014b, 0x0000},
+  {0x03b7, 0x0000},
+  {0x00f0, 0x0000},
+  {0x0444, 0x0000},
+  {0x1d523, 0x0000},
+  {0x2a8c, 0x0000},
+  {0x2a86, 0x0000},
+  {0x0433, 0x0000},
+  {0x22db, 0x0000},
+  {0x2265, 0x0000},
+  {0x2a7e, 0x0000},
+  {0x1d524, 0x0000},
+  {0x22d9, 0x0000},
+  {0x2a92, 0x0000},
+  {0x2aa5, 0x0000},
+  {0x2aa4, 0x0000},
+  {0x2269, 0x0000},
+  {0x2a88, 0x0000},
+  {0x1d525, 0x0000},
+  {0x0438, 0x0000},
+  {0x21d4, 0x0000},
+  {0x1d526, 0x0000},
+  {0x222b, 0x0000},
+  {0x0439, 0x0000},
+  {0x1d527, 0x0000},
+  {0x043a, 0x0000},
+  {0x1d528, 0x0000},
+  {0x2a8b, 0x0000},
+  {0x2a85, 0x0000},
+  {0x2aab, 0x0000},
+  {0x043b, 0x0000},
+  {0x22da, 0x0000},
+  {0x2264, 0x0000},
+  {0x2a7d, 0x0000},
+  {0x1d529, 0x0000},
+  {0x2a91, 0x0000},
+  {0x2268, 0x0000},
+  {0x2a87, 0x0000},
+  {0x25ca, 0x0000},
+  {0x200e, 0x0000},
+  {0x21b0, 0x0000},
+  {0x21a6, 0x0000},
+  {0x043c, 0x0000},
+  {0x1d52a, 0x0000},
+  {0x2127, 0x0000},
+  {0x2223, 0x0000},
+  {0x22d9, 0x0338},
+  {0x226b, 0x20d2},
+  {0x22d8, 0x0338},
+  {0x226a, 0x20d2},
+  {0x2249, 0x0000},
+  {0x043d, 0x0000},
+  {0x1d52b, 0x0000},
+  {0x2267, 0x0338},
+  {0x2271, 0x0000},
+  {0x226f, 0x0000},
+  {0x22fc, 0x0000},
+  {0x220b, 0x0000},
+  {0x2266, 0x0338},
+  {0x2270, 0x0000},
+  {0x226e, 0x0000},
+  {0x00ac, 0x0000},
+  {0x2280, 0x0000},
+  {0x2281, 0x0000},
+  {0x0023, 0x0000},
+  {0x043e, 0x0000},
+  {0x1d52c, 0x0000},
+  {0x29c1, 0x0000},
+  {0x03a9, 0x0000},
+  {0x29c0, 0x0000},
+  {0x2a5d, 0x0000},
+  {0x2a5b, 0x0000},
+  {0x2225, 0x0000},
+  {0x043f, 0x0000},
+  {0x1d52d, 0x0000},
+  {0x03c6, 0x0000},
+  {0x03d6, 0x0000},
+  {0x2ab3, 0x0000},
+  {0x2aaf, 0x0000},
+  {0x03c8, 0x0000},
+  {0x1d52e, 0x0000},
+  {0x0440, 0x0000},
+  {0x00ae, 0x0000},
+  {0x1d52f, 0x0000},
+  {0x03c1, 0x0000},
+  {0x200f, 0x0000},
+  {0x21b1, 0x0000},
+  {0x2ab4, 0x0000},
+  {0x2ab0, 0x0000},
+  {0x0441, 0x0000},
+  {0x1d530, 0x0000},
+  {0x00ad, 0x0000},
+  {0x223c, 0x0000},
+  {0x2aaa, 0x0000},
+  {0x002f, 0x0000},
+  {0x25a1, 0x0000},
+  {0x2282, 0x0000},
+  {0x2211, 0x0000},
+  {0x2283, 0x0000},
+  {0x03c4, 0x0000},
+  {0x0442, 0x0000},
+  {0x1d531, 0x0000},
+  {0x22a4, 0x0000},
+  {0x0443, 0x0000},
+  {0x1d532, 0x0000},
+  {0x00a8, 0x0000},
+  {0x0432, 0x0000},
+  {0x2228, 0x0000},
+  {0x1d533, 0x0000},
+  {0x1d534, 0x0000},
+  {0x1d535, 0x0000},
+  {0x044b, 0x0000},
+  {0x00a5, 0x0000},
+  {0x1d536, 0x0000},
+  {0x0437, 0x0000},
+  {0x1d537, 0x0000},
+  {0x200d, 0x0000},
+  {0x1d538, 0x0000},
+  {0x1d49c, 0x0000},
+  {0x00c4, 0x0000},
+  {0x2ae7, 0x0000},
+  {0x0392, 0x0000},
+  {0x1d539, 0x0000},
+  {0x212c, 0x0000},
+  {0x0427, 0x0000},
+  {0x00a9, 0x0000},
+  {0x010a, 0x0000},
+  {0x2102, 0x0000},
+  {0x1d49e, 0x0000},
+  {0x0402, 0x0000},
+  {0x0405, 0x0000},
+  {0x040f, 0x0000},
+  {0x21a1, 0x0000},
+  {0x1d53b, 0x0000},
+  {0x1d49f, 0x0000},
+  {0x0116, 0x0000},
+  {0x1d53c, 0x0000},
+  {0x2130, 0x0000},
+  {0x2a73, 0x0000},
+  {0x00cb, 0x0000},
+  {0x1d53d, 0x0000},
+  {0x2131, 0x0000},
+  {0x0403, 0x0000},
+  {0x0120, 0x0000},
+  {0x1d53e, 0x0000},
+  {0x1d4a2, 0x0000},
+  {0x210d, 0x0000},
+  {0x210b, 0x0000},
+  {0x0415, 0x0000},
+  {0x0401, 0x0000},
+  {0x0130, 0x0000},
+  {0x1d540, 0x0000},
+  {0x0399, 0x0000},
+  {0x2110, 0x0000},
+  {0x00cf, 0x0000},
+  {0x1d541, 0x0000},
+  {0x1d4a5, 0x0000},
+  {0x0425, 0x0000},
+  {0x040c, 0x0000},
+  {0x1d542, 0x0000},
+  {0x1d4a6, 0x0000},
+  {0x0409, 0x0000},
+  {0x27ea, 0x0000},
+  {0x219e, 0x0000},
+  {0x1d543, 0x0000},
+  {0x2112, 0x0000},
+  {0x1d544, 0x0000},
+  {0x2133, 0x0000},
+  {0x040a, 0x0000},
+  {0x2115, 0x0000},
+  {0x1d4a9, 0x0000},
+  {0x1d546, 0x0000},
+  {0x1d4aa, 0x0000},
+  {0x00d6, 0x0000},
+  {0x2119, 0x0000},
+  {0x1d4ab, 0x0000},
+  {0x0022, 0x0000},
+  {0x211a, 0x0000},
+  {0x1d4ac, 0x0000},
+  {0x27eb, 0x0000},
+  {0x21a0, 0x0000},
+  {0x211d, 0x0000},
+  {0x211b, 0x0000},
+  {0x0428, 0x0000},
+  {0x1d54a, 0x0000},
+  {0x221a, 0x0000},
+  {0x1d4ae, 0x0000},
+  {0x22c6, 0x0000},
+  {0x0426, 0x0000},
+  {0x1d54b, 0x0000},
+  {0x1d4af, 0x0000},
+  {0x219f, 0x0000},
+  {0x1d54c, 0x0000},
+  {0x03d2, 0x0000},
+  {0x1d4b0, 0x0000},
+  {0x00dc, 0x0000},
+  {0x2aeb, 0x0000},
+  {0x2016, 0x0000},
+  {0x1d54d, 0x0000},
+  {0x1d4b1, 0x0000},
+  {0x1d54e, 0x0000},
+  {0x1d4b2, 0x0000},
+  {0x1d54f, 0x0000},
+  {0x1d4b3, 0x0000},
+  {0x042f, 0x0000},
+  {0x0407, 0x0000},
+  {0x042e, 0x0000},
+  {0x1d550, 0x0000},
+  {0x1d4b4, 0x0000},
+  {0x0178, 0x0000},
+  {0x0416, 0x0000},
+  {0x017b, 0x0000},
+  {0x0396, 0x0000},
+  {0x2124, 0x0000},
+  {0x1d4b5, 0x0000},
+  {0x2a5c, 0x0000},
+  {0x2a5a, 0x0000},
+  {0x29a4, 0x0000},
+  {0x1d552, 0x0000},
+  {0x224b, 0x0000},
+  {0x0027, 0x0000},
+  {0x1d4b6, 0x0000},
+  {0x00e4, 0x0000},
+  {0x2aed, 0x0000},
+  {0x23b5, 0x0000},
+  {0x03b2, 0x0000},
+  {0x2136, 0x0000},
+  {0x2310, 0x0000},
+  {0x1d553, 0x0000},
+  {0x2550, 0x0000},
+  {0x2551, 0x0000},
+  {0x2500, 0x0000},
+  {0x2502, 0x0000},
+  {0x1d4b7, 0x0000},
+  {0x223d, 0x0000},
+  {0x005c, 0x0000},
+  {0x2022, 0x0000},
+  {0x224e, 0x0000},
+  {0x2229, 0xfe00},
+  {0x010b, 0x0000},
+  {0x00a2, 0x0000},
+  {0x0447, 0x0000},
+  {0x29c3, 0x0000},
+  {0x02c6, 0x0000},
+  {0x2257, 0x0000},
+  {0x2201, 0x0000},
+  {0x2245, 0x0000},
+  {0x1d554, 0x0000},
+  {0x00a9, 0x0000},
+  {0x1d4b8, 0x0000},
+  {0x2acf, 0x0000},
+  {0x2ad0, 0x0000},
+  {0x222a, 0xfe00},
+  {0x21d3, 0x0000},
+  {0x2965, 0x0000},
+  {0x2193, 0x0000},
+  {0x2010, 0x0000},
+  {0x22c4, 0x0000},
+  {0x0452, 0x0000},
+  {0x1d555, 0x0000},
+  {0x1d4b9, 0x0000},
+  {0x0455, 0x0000},
+  {0x29f6, 0x0000},
+  {0x25bf, 0x0000},
+  {0x045f, 0x0000},
+  {0x2251, 0x0000},
+  {0x2256, 0x0000},
+  {0x0117, 0x0000},
+  {0x2003, 0x0000},
+  {0x2002, 0x0000},
+  {0x1d556, 0x0000},
+  {0x22d5, 0x0000},
+  {0x03b5, 0x0000},
+  {0x212f, 0x0000},
+  {0x2242, 0x0000},
+  {0x00eb, 0x0000},
+  {0x20ac, 0x0000},
+  {0x0021, 0x0000},
+  {0x266d, 0x0000},
+  {0x0192, 0x0000},
+  {0x1d557, 0x0000},
+  {0x22d4, 0x0000},
+  {0x1d4bb, 0x0000},
+  {0x0121, 0x0000},
+  {0x2267, 0x0000},
+  {0x22db, 0xfe00},
+  {0x0453, 0x0000},
+  {0x2a8a, 0x0000},
+  {0x2a88, 0x0000},
+  {0x1d558, 0x0000},
+  {0x210a, 0x0000},
+  {0x2273, 0x0000},
+  {0x2aa7, 0x0000},
+  {0x2269, 0xfe00},
+  {0x21d4, 0x0000},
+  {0x00bd, 0x0000},
+  {0x2194, 0x0000},
+  {0x210f, 0x0000},
+  {0x1d559, 0x0000},
+  {0x1d4bd, 0x0000},
+  {0x0435, 0x0000},
+  {0x22b7, 0x0000},
+  {0x0451, 0x0000},
+  {0x1d55a, 0x0000},
+  {0x03b9, 0x0000},
+  {0x1d4be, 0x0000},
+  {0x2208, 0x0000},
+  {0x00ef, 0x0000},
+  {0x1d55b, 0x0000},
+  {0x1d4bf, 0x0000},
+  {0x0445, 0x0000},
+  {0x045c, 0x0000},
+  {0x1d55c, 0x0000},
+  {0x1d4c0, 0x0000},
+  {0x21d0, 0x0000},
+  {0x2962, 0x0000},
+  {0x27e8, 0x0000},
+  {0x2190, 0x0000},
+  {0x2aad, 0x0000},
+  {0x007b, 0x0000},
+  {0x2936, 0x0000},
+  {0x21b2, 0x0000},
+  {0x2266, 0x0000},
+  {0x22da, 0xfe00},
+  {0x0459, 0x0000},
+  {0x2a89, 0x0000},
+  {0x2a87, 0x0000},
+  {0x1d55d, 0x0000},
+  {0x29eb, 0x0000},
+  {0x0028, 0x0000},
+  {0x1d4c1, 0x0000},
+  {0x2272, 0x0000},
+  {0x005b, 0x0000},
+  {0x2aa6, 0x0000},
+  {0x25c3, 0x0000},
+  {0x2268, 0xfe00},
+  {0x00af, 0x0000},
+  {0x2642, 0x0000},
+  {0x2720, 0x0000},
+  {0x2adb, 0x0000},
+  {0x2026, 0x0000},
+  {0x1d55e, 0x0000},
+  {0x1d4c2, 0x0000},
+  {0x226b, 0x0338},
+  {0x226a, 0x0338},
+  {0x2220, 0x20d2},
+  {0x2a70, 0x0338},
+  {0x00a0, 0x0000},
+  {0x2a43, 0x0000},
+  {0x2a42, 0x0000},
+  {0x2271, 0x0000},
+  {0x2a7e, 0x0338},
+  {0x226f, 0x0000},
+  {0x22fa, 0x0000},
+  {0x045a, 0x0000},
+  {0x2025, 0x0000},
+  {0x2270, 0x0000},
+  {0x2a7d, 0x0338},
+  {0x2224, 0x0000},
+  {0x1d55f, 0x0000},
+  {0x2226, 0x0000},
+  {0x2aaf, 0x0338},
+  {0x2ab0, 0x0338},
+  {0x1d4c3, 0x0000},
+  {0x2241, 0x0000},
+  {0x2284, 0x0000},
+  {0x2285, 0x0000},
+  {0x2279, 0x0000},
+  {0x2278, 0x0000},
+  {0x224d, 0x20d2},
+  {0x2265, 0x20d2},
+  {0x003e, 0x20d2},
+  {0x2264, 0x20d2},
+  {0x003c, 0x20d2},
+  {0x229b, 0x0000},
+  {0x229a, 0x0000},
+  {0x2a38, 0x0000},
+  {0x2299, 0x0000},
+  {0x02db, 0x0000},
+  {0x222e, 0x0000},
+  {0x29b6, 0x0000},
+  {0x1d560, 0x0000},
+  {0x29b7, 0x0000},
+  {0x00aa, 0x0000},
+  {0x00ba, 0x0000},
+  {0x2a56, 0x0000},
+  {0x2134, 0x0000},
+  {0x2298, 0x0000},
+  {0x00f6, 0x0000},
+  {0x00b6, 0x0000},
+  {0x2202, 0x0000},
+  {0x22a5, 0x0000},
+  {0x03d5, 0x0000},
+  {0x002b, 0x0000},
+  {0x1d561, 0x0000},
+  {0x2ab7, 0x0000},
+  {0x227a, 0x0000},
+  {0x2ab5, 0x0000},
+  {0x220f, 0x0000},
+  {0x221d, 0x0000},
+  {0x1d4c5, 0x0000},
+  {0x2a0c, 0x0000},
+  {0x1d562, 0x0000},
+  {0x1d4c6, 0x0000},
+  {0x0022, 0x0000},
+  {0x21d2, 0x0000},
+  {0x2964, 0x0000},
+  {0x223d, 0x0331},
+  {0x27e9, 0x0000},
+  {0x2192, 0x0000},
+  {0x007d, 0x0000},
+  {0x2937, 0x0000},
+  {0x21b3, 0x0000},
+  {0x211c, 0x0000},
+  {0x25ad, 0x0000},
+  {0x03f1, 0x0000},
+  {0x02da, 0x0000},
+  {0x1d563, 0x0000},
+  {0x0029, 0x0000},
+  {0x1d4c7, 0x0000},
+  {0x005d, 0x0000},
+  {0x25b9, 0x0000},
+  {0x2ab8, 0x0000},
+  {0x2ab6, 0x0000},
+  {0x22c5, 0x0000},
+  {0x00a7, 0x0000},
+  {0x003b, 0x0000},
+  {0x2736, 0x0000},
+  {0x0448, 0x0000},
+  {0x2243, 0x0000},
+  {0x2a9e, 0x0000},
+  {0x2a9d, 0x0000},
+  {0x2223, 0x0000},
+  {0x2aac, 0x0000},
+  {0x29c4, 0x0000},
+  {0x1d564, 0x0000},
+  {0x2225, 0x0000},
+  {0x25aa, 0x0000},
+  {0x1d4c8, 0x0000},
+  {0x2606, 0x0000},
+  {0x2ac5, 0x0000},
+  {0x2286, 0x0000},
+  {0x227b, 0x0000},
+  {0x266a, 0x0000},
+  {0x00b9, 0x0000},
+  {0x00b2, 0x0000},
+  {0x00b3, 0x0000},
+  {0x2ac6, 0x0000},
+  {0x2287, 0x0000},
+  {0x23b4, 0x0000},
+  {0x20db, 0x0000},
+  {0x222d, 0x0000},
+  {0x2928, 0x0000},
+  {0x1d565, 0x0000},
+  {0x2929, 0x0000},
+  {0x225c, 0x0000},
+  {0x1d4c9, 0x0000},
+  {0x0446, 0x0000},
+  {0x21d1, 0x0000},
+  {0x2963, 0x0000},
+  {0x2191, 0x0000},
+  {0x1d566, 0x0000},
+  {0x03c5, 0x0000},
+  {0x1d4ca, 0x0000},
+  {0x25b5, 0x0000},
+  {0x00fc, 0x0000},
+  {0x21d5, 0x0000},
+  {0x2ae8, 0x0000},
+  {0x2195, 0x0000},
+  {0x007c, 0x0000},
+  {0x1d567, 0x0000},
+  {0x1d4cb, 0x0000},
+  {0x1d568, 0x0000},
+  {0x1d4cc, 0x0000},
+  {0x22c2, 0x0000},
+  {0x22c3, 0x0000},
+  {0x27fc, 0x0000},
+  {0x22fb, 0x0000},
+  {0x1d569, 0x0000},
+  {0x1d4cd, 0x0000},
+  {0x22c1, 0x0000},
+  {0x044f, 0x0000},
+  {0x0457, 0x0000},
+  {0x1d56a, 0x0000},
+  {0x1d4ce, 0x0000},
+  {0x044e, 0x0000},
+  {0x00ff, 0x0000},
+  {0x017c, 0x0000},
+  {0x03b6, 0x0000},
+  {0x0436, 0x0000},
+  {0x1d56b, 0x0000},
+  {0x1d4cf, 0x0000},
+  {0x200c, 0x0000},
+  {0x00c6, 0x0000},
+  {0x00c2, 0x0000},
+  {0x0391, 0x0000},
+  {0x0100, 0x0000},
+  {0x0104, 0x0000},
+  {0x00c5, 0x0000},
+  {0x02d8, 0x0000},
+  {0x0108, 0x0000},
+  {0x2237, 0x0000},
+  {0x2a2f, 0x0000},
+  {0x2ae4, 0x0000},
+  {0x0394, 0x0000},
+  {0x00ca, 0x0000},
+  {0x0112, 0x0000},
+  {0x0118, 0x0000},
+  {0x2a75, 0x0000},
+  {0x0393, 0x0000},
+  {0x011c, 0x0000},
+  {0x02c7, 0x0000},
+  {0x0124, 0x0000},
+  {0x0132, 0x0000},
+  {0x00ce, 0x0000},
+  {0x012a, 0x0000},
+  {0x012e, 0x0000},
+  {0x0406, 0x0000},
+  {0x0134, 0x0000},
+  {0x0404, 0x0000},
+  {0x039a, 0x0000},
+  {0x0152, 0x0000},
+  {0x00d4, 0x0000},
+  {0x014c, 0x0000},
+  {0x03a9, 0x0000},
+  {0x2033, 0x0000},
+  {0x2910, 0x0000},
+  {0x015c, 0x0000},
+  {0x03a3, 0x0000},
+  {0x00de, 0x0000},
+  {0x2122, 0x0000},
+  {0x040b, 0x0000},
+  {0x0398, 0x0000},
+  {0x223c, 0x0000},
+  {0x040e, 0x0000},
+  {0x00db, 0x0000},
+  {0x016a, 0x0000},
+  {0x22c3, 0x0000},
+  {0x0172, 0x0000},
+  {0x22a5, 0x0000},
+  {0x016e, 0x0000},
+  {0x22ab, 0x0000},
+  {0x22a9, 0x0000},
+  {0x0174, 0x0000},
+  {0x22c0, 0x0000},
+  {0x0176, 0x0000},
+  {0x00e2, 0x0000},
+  {0x00b4, 0x0000},
+  {0x00e6, 0x0000},
+  {0x2135, 0x0000},
+  {0x03b1, 0x0000},
+  {0x0101, 0x0000},
+  {0x2a3f, 0x0000},
+  {0x2220, 0x0000},
+  {0x221f, 0x0000},
+  {0x00c5, 0x0000},
+  {0x0105, 0x0000},
+  {0x00e5, 0x0000},
+  {0x2248, 0x0000},
+  {0x2a11, 0x0000},
+  {0x224c, 0x0000},
+  {0x201e, 0x0000},
+  {0x03f6, 0x0000},
+  {0x2423, 0x0000},
+  {0x2592, 0x0000},
+  {0x2591, 0x0000},
+  {0x2593, 0x0000},
+  {0x2588, 0x0000},
+  {0x2557, 0x0000},
+  {0x2554, 0x0000},
+  {0x2556, 0x0000},
+  {0x2553, 0x0000},
+  {0x2566, 0x0000},
+  {0x2569, 0x0000},
+  {0x2564, 0x0000},
+  {0x2567, 0x0000},
+  {0x255d, 0x0000},
+  {0x255a, 0x0000},
+  {0x255c, 0x0000},
+  {0x2559, 0x0000},
+  {0x256c, 0x0000},
+  {0x2563, 0x0000},
+  {0x2560, 0x0000},
+  {0x256b, 0x0000},
+  {0x2562, 0x0000},
+  {0x255f, 0x0000},
+  {0x2555, 0x0000},
+  {0x2552, 0x0000},
+  {0x2510, 0x0000},
+  {0x250c, 0x0000},
+  {0x2565, 0x0000},
+  {0x2568, 0x0000},
+  {0x252c, 0x0000},
+  {0x2534, 0x0000},
+  {0x255b, 0x0000},
+  {0x2558, 0x0000},
+  {0x2518, 0x0000},
+  {0x2514, 0x0000},
+  {0x256a, 0x0000},
+  {0x2561, 0x0000},
+  {0x255e, 0x0000},
+  {0x253c, 0x0000},
+  {0x2524, 0x0000},
+  {0x251c, 0x0000},
+  {0x02d8, 0x0000},
+  {0x204f, 0x0000},
+  {0x22cd, 0x0000},
+  {0x29c5, 0x0000},
+  {0x2aae, 0x0000},
+  {0x224f, 0x0000},
+  {0x2041, 0x0000},
+  {0x02c7, 0x0000},
+  {0x2a4d, 0x0000},
+  {0x0109, 0x0000},
+  {0x2a4c, 0x0000},
+  {0x00b8, 0x0000},
+  {0x2713, 0x0000},
+  {0x2663, 0x0000},
+  {0x003a, 0x0000},
+  {0x002c, 0x0000},
+  {0x21b5, 0x0000},
+  {0x2717, 0x0000},
+  {0x2ad1, 0x0000},
+  {0x2ad2, 0x0000},
+  {0x22ef, 0x0000},
+  {0x22de, 0x0000},
+  {0x22df, 0x0000},
+  {0x2a45, 0x0000},
+  {0x22ce, 0x0000},
+  {0x22cf, 0x0000},
+  {0x2231, 0x0000},
+  {0x22a3, 0x0000},
+  {0x02dd, 0x0000},
+  {0x21ca, 0x0000},
+  {0x03b4, 0x0000},
+  {0x21c3, 0x0000},
+  {0x21c2, 0x0000},
+  {0x2666, 0x0000},
+  {0x22f2, 0x0000},
+  {0x2250, 0x0000},
+  {0x22f1, 0x0000},
+  {0x25be, 0x0000},
+  {0x21f5, 0x0000},
+  {0x296f, 0x0000},
+  {0x2a77, 0x0000},
+  {0x00ea, 0x0000},
+  {0x2252, 0x0000},
+  {0x0113, 0x0000},
+  {0x2205, 0x0000},
+  {0x0119, 0x0000},
+  {0x2a71, 0x0000},
+  {0x03f5, 0x0000},
+  {0x2242, 0x0000},
+  {0x2261, 0x0000},
+  {0x2253, 0x0000},
+  {0x2971, 0x0000},
+  {0x2250, 0x0000},
+  {0x2203, 0x0000},
+  {0xfb00, 0x0000},
+  {0xfb01, 0x0000},
+  {0x0066, 0x006a},
+  {0xfb02, 0x0000},
+  {0x25b1, 0x0000},
+  {0x2ad9, 0x0000},
+  {0x2044, 0x0000},
+  {0x2322, 0x0000},
+  {0x03b3, 0x0000},
+  {0x011d, 0x0000},
+  {0x2aa9, 0x0000},
+  {0x2137, 0x0000},
+  {0x2269, 0x0000},
+  {0x22e7, 0x0000},
+  {0x0060, 0x0000},
+  {0x2a8e, 0x0000},
+  {0x2a90, 0x0000},
+  {0x2a7a, 0x0000},
+  {0x22d7, 0x0000},
+  {0x21ad, 0x0000},
+  {0x0125, 0x0000},
+  {0x21ff, 0x0000},
+  {0x00ee, 0x0000},
+  {0x00a1, 0x0000},
+  {0x222d, 0x0000},
+  {0x2129, 0x0000},
+  {0x0133, 0x0000},
+  {0x012b, 0x0000},
+  {0x2111, 0x0000},
+  {0x0131, 0x0000},
+  {0x01b5, 0x0000},
+  {0x221e, 0x0000},
+  {0x012f, 0x0000},
+  {0x2a3c, 0x0000},
+  {0x22f9, 0x0000},
+  {0x22f4, 0x0000},
+  {0x2208, 0x0000},
+  {0x0456, 0x0000},
+  {0x0135, 0x0000},
+  {0x0237, 0x0000},
+  {0x0454, 0x0000},
+  {0x03ba, 0x0000},
+  {0x21da, 0x0000},
+  {0x290e, 0x0000},
+  {0x2991, 0x0000},
+  {0x00ab, 0x0000},
+  {0x21e4, 0x0000},
+  {0x2aad, 0xfe00},
+  {0x290c, 0x0000},
+  {0x2772, 0x0000},
+  {0x298b, 0x0000},
+  {0x2308, 0x0000},
+  {0x201c, 0x0000},
+  {0x2aa8, 0x0000},
+  {0x21bd, 0x0000},
+  {0x21bc, 0x0000},
+  {0x2584, 0x0000},
+  {0x21c7, 0x0000},
+  {0x25fa, 0x0000},
+  {0x2268, 0x0000},
+  {0x22e6, 0x0000},
+  {0x27ec, 0x0000},
+  {0x21fd, 0x0000},
+  {0x27e6, 0x0000},
+  {0x2985, 0x0000},
+  {0x21c6, 0x0000},
+  {0x21cb, 0x0000},
+  {0x22bf, 0x0000},
+  {0x2a8d, 0x0000},
+  {0x2a8f, 0x0000},
+  {0x2018, 0x0000},
+  {0x2a79, 0x0000},
+  {0x22d6, 0x0000},
+  {0x22b4, 0x0000},
+  {0x25c2, 0x0000},
+  {0x223a, 0x0000},
+  {0x2014, 0x0000},
+  {0x00b5, 0x0000},
+  {0x2212, 0x0000},
+  {0x22b8, 0x0000},
+  {0x2207, 0x0000},
+  {0x224b, 0x0338},
+  {0x0149, 0x0000},
+  {0x266e, 0x0000},
+  {0x224e, 0x0338},
+  {0x2247, 0x0000},
+  {0x2013, 0x0000},
+  {0x21d7, 0x0000},
+  {0x2197, 0x0000},
+  {0x2250, 0x0338},
+  {0x2242, 0x0338},
+  {0x2267, 0x0338},
+  {0x2275, 0x0000},
+  {0x21ce, 0x0000},
+  {0x21ae, 0x0000},
+  {0x2af2, 0x0000},
+  {0x21cd, 0x0000},
+  {0x219a, 0x0000},
+  {0x2266, 0x0338},
+  {0x226e, 0x0000},
+  {0x2274, 0x0000},
+  {0x22ea, 0x0000},
+  {0x2209, 0x0000},
+  {0x220c, 0x0000},
+  {0x2202, 0x0338},
+  {0x2280, 0x0000},
+  {0x21cf, 0x0000},
+  {0x219b, 0x0000},
+  {0x22eb, 0x0000},
+  {0x2244, 0x0000},
+  {0x2224, 0x0000},
+  {0x2226, 0x0000},
+  {0x2ac5, 0x0338},
+  {0x2288, 0x0000},
+  {0x2281, 0x0000},
+  {0x2ac6, 0x0338},
+  {0x2289, 0x0000},
+  {0x2007, 0x0000},
+  {0x223c, 0x20d2},
+  {0x21d6, 0x0000},
+  {0x2196, 0x0000},
+  {0x00f4, 0x0000},
+  {0x229d, 0x0000},
+  {0x0153, 0x0000},
+  {0x29bf, 0x0000},
+  {0x29b5, 0x0000},
+  {0x21ba, 0x0000},
+  {0x29be, 0x0000},
+  {0x203e, 0x0000},
+  {0x014d, 0x0000},
+  {0x03c9, 0x0000},
+  {0x29b9, 0x0000},
+  {0x2295, 0x0000},
+  {0x21bb, 0x0000},
+  {0x2134, 0x0000},
+  {0x233d, 0x0000},
+  {0x2afd, 0x0000},
+  {0x260e, 0x0000},
+  {0x229e, 0x0000},
+  {0x2a72, 0x0000},
+  {0x00a3, 0x0000},
+  {0x227c, 0x0000},
+  {0x2032, 0x0000},
+  {0x2ab9, 0x0000},
+  {0x227e, 0x0000},
+  {0x003f, 0x0000},
+  {0x21db, 0x0000},
+  {0x290f, 0x0000},
+  {0x221a, 0x0000},
+  {0x2992, 0x0000},
+  {0x29a5, 0x0000},
+  {0x00bb, 0x0000},
+  {0x21e5, 0x0000},
+  {0x2933, 0x0000},
+  {0x219d, 0x0000},
+  {0x2236, 0x0000},
+  {0x290d, 0x0000},
+  {0x2773, 0x0000},
+  {0x298c, 0x0000},
+  {0x2309, 0x0000},
+  {0x201d, 0x0000},
+  {0x211d, 0x0000},
+  {0x21c1, 0x0000},
+  {0x21c0, 0x0000},
+  {0x21c4, 0x0000},
+  {0x21cc, 0x0000},
+  {0x2aee, 0x0000},
+  {0x27ed, 0x0000},
+  {0x21fe, 0x0000},
+  {0x27e7, 0x0000},
+  {0x2986, 0x0000},
+  {0x21c9, 0x0000},
+  {0x2019, 0x0000},
+  {0x22b5, 0x0000},
+  {0x25b8, 0x0000},
+  {0x201a, 0x0000},
+  {0x227d, 0x0000},
+  {0x015d, 0x0000},
+  {0x2aba, 0x0000},
+  {0x227f, 0x0000},
+  {0x22a1, 0x0000},
+  {0x2a66, 0x0000},
+  {0x21d8, 0x0000},
+  {0x2198, 0x0000},
+  {0x2216, 0x0000},
+  {0x266f, 0x0000},
+  {0x03c3, 0x0000},
+  {0x2243, 0x0000},
+  {0x2aa0, 0x0000},
+  {0x2a9f, 0x0000},
+  {0x2246, 0x0000},
+  {0x2190, 0x0000},
+  {0x2323, 0x0000},
+  {0x2aac, 0xfe00},
+  {0x2293, 0x0000},
+  {0x2294, 0x0000},
+  {0x228f, 0x0000},
+  {0x2290, 0x0000},
+  {0x2192, 0x0000},
+  {0x2605, 0x0000},
+  {0x00af, 0x0000},
+  {0x2acb, 0x0000},
+  {0x228a, 0x0000},
+  {0x2acc, 0x0000},
+  {0x228b, 0x0000},
+  {0x21d9, 0x0000},
+  {0x2199, 0x0000},
+  {0x00df, 0x0000},
+  {0x03b8, 0x0000},
+  {0x2248, 0x0000},
+  {0x00fe, 0x0000},
+  {0x02dc, 0x0000},
+  {0x00d7, 0x0000},
+  {0x2122, 0x0000},
+  {0x29cd, 0x0000},
+  {0x045b, 0x0000},
+  {0x226c, 0x0000},
+  {0x045e, 0x0000},
+  {0x00fb, 0x0000},
+  {0x21c5, 0x0000},
+  {0x296e, 0x0000},
+  {0x21bf, 0x0000},
+  {0x21be, 0x0000},
+  {0x2580, 0x0000},
+  {0x25f8, 0x0000},
+  {0x016b, 0x0000},
+  {0x0173, 0x0000},
+  {0x228e, 0x0000},
+  {0x03d2, 0x0000},
+  {0x016f, 0x0000},
+  {0x25f9, 0x0000},
+  {0x22f0, 0x0000},
+  {0x25b4, 0x0000},
+  {0x21c8, 0x0000},
+  {0x2ae9, 0x0000},
+  {0x22a8, 0x0000},
+  {0x03d6, 0x0000},
+  {0x22a2, 0x0000},
+  {0x225a, 0x0000},
+  {0x22b2, 0x0000},
+  {0x2282, 0x20d2},
+  {0x2283, 0x20d2},
+  {0x221d, 0x0000},
+  {0x22b3, 0x0000},
+  {0x0175, 0x0000},
+  {0x2227, 0x0000},
+  {0x25ef, 0x0000},
+  {0x25bd, 0x0000},
+  {0x27fa, 0x0000},
+  {0x27f7, 0x0000},
+  {0x27f8, 0x0000},
+  {0x27f5, 0x0000},
+  {0x2a00, 0x0000},
+  {0x27f9, 0x0000},
+  {0x27f6, 0x0000},
+  {0x25b3, 0x0000},
+  {0x0177, 0x0000},
+  {0x00c1, 0x0000},
+  {0x0102, 0x0000},
+  {0x00c0, 0x0000},
+  {0x2254, 0x0000},
+  {0x00c3, 0x0000},
+  {0x2306, 0x0000},
+  {0x224e, 0x0000},
+  {0x0106, 0x0000},
+  {0x010c, 0x0000},
+  {0x00c7, 0x0000},
+  {0x2a74, 0x0000},
+  {0x222f, 0x0000},
+  {0x224d, 0x0000},
+  {0x2021, 0x0000},
+  {0x010e, 0x0000},
+  {0x20dc, 0x0000},
+  {0x0110, 0x0000},
+  {0x00c9, 0x0000},
+  {0x011a, 0x0000},
+  {0x00c8, 0x0000},
+  {0x2203, 0x0000},
+  {0x2200, 0x0000},
+  {0x03dc, 0x0000},
+  {0x011e, 0x0000},
+  {0x0122, 0x0000},
+  {0x042a, 0x0000},
+  {0x0126, 0x0000},
+  {0x00cd, 0x0000},
+  {0x00cc, 0x0000},
+  {0x0128, 0x0000},
+  {0x0408, 0x0000},
+  {0x0136, 0x0000},
+  {0x0139, 0x0000},
+  {0x039b, 0x0000},
+  {0x013d, 0x0000},
+  {0x013b, 0x0000},
+  {0x013f, 0x0000},
+  {0x0141, 0x0000},
+  {0x0143, 0x0000},
+  {0x0147, 0x0000},
+  {0x0145, 0x0000},
+  {0x00d1, 0x0000},
+  {0x00d3, 0x0000},
+  {0x0150, 0x0000},
+  {0x00d2, 0x0000},
+  {0x00d8, 0x0000},
+  {0x00d5, 0x0000},
+  {0x2a37, 0x0000},
+  {0x0154, 0x0000},
+  {0x2916, 0x0000},
+  {0x0158, 0x0000},
+  {0x0156, 0x0000},
+  {0x0429, 0x0000},
+  {0x042c, 0x0000},
+  {0x015a, 0x0000},
+  {0x0160, 0x0000},
+  {0x015e, 0x0000},
+  {0x25a1, 0x0000},
+  {0x22d0, 0x0000},
+  {0x22d1, 0x0000},
+  {0x0164, 0x0000},
+  {0x0162, 0x0000},
+  {0x0166, 0x0000},
+  {0x00da, 0x0000},
+  {0x016c, 0x0000},
+  {0x0170, 0x0000},
+  {0x00d9, 0x0000},
+  {0x0168, 0x0000},
+  {0x2ae6, 0x0000},
+  {0x2016, 0x0000},
+  {0x22aa, 0x0000},
+  {0x00dd, 0x0000},
+  {0x0179, 0x0000},
+  {0x017d, 0x0000},
+  {0x00e1, 0x0000},
+  {0x0103, 0x0000},
+  {0x00e0, 0x0000},
+  {0x2a55, 0x0000},
+  {0x2221, 0x0000},
+  {0x2222, 0x0000},
+  {0x2a6f, 0x0000},
+  {0x2248, 0x0000},
+  {0x00e3, 0x0000},
+  {0x22bd, 0x0000},
+  {0x2305, 0x0000},
+  {0x2235, 0x0000},
+  {0x212c, 0x0000},
+  {0x22c2, 0x0000},
+  {0x22c3, 0x0000},
+  {0x22c1, 0x0000},
+  {0x290d, 0x0000},
+  {0x22a5, 0x0000},
+  {0x22c8, 0x0000},
+  {0x29c9, 0x0000},
+  {0x2035, 0x0000},
+  {0x00a6, 0x0000},
+  {0x2022, 0x0000},
+  {0x224f, 0x0000},
+  {0x0107, 0x0000},
+  {0x2a44, 0x0000},
+  {0x2a4b, 0x0000},
+  {0x2a47, 0x0000},
+  {0x2a40, 0x0000},
+  {0x010d, 0x0000},
+  {0x00e7, 0x0000},
+  {0x2257, 0x0000},
+  {0x2aef, 0x0000},
+  {0x2254, 0x0000},
+  {0x0040, 0x0000},
+  {0x2218, 0x0000},
+  {0x222e, 0x0000},
+  {0x2210, 0x0000},
+  {0x2117, 0x0000},
+  {0x21b6, 0x0000},
+  {0x2a46, 0x0000},
+  {0x2a4a, 0x0000},
+  {0x228d, 0x0000},
+  {0x21b7, 0x0000},
+  {0x00a4, 0x0000},
+  {0x232d, 0x0000},
+  {0x2020, 0x0000},
+  {0x2138, 0x0000},
+  {0x010f, 0x0000},
+  {0x297f, 0x0000},
+  {0x00f7, 0x0000},
+  {0x22c7, 0x0000},
+  {0x231e, 0x0000},
+  {0x230d, 0x0000},
+  {0x0024, 0x0000},
+  {0x231f, 0x0000},
+  {0x230c, 0x0000},
+  {0x0111, 0x0000},
+  {0x00e9, 0x0000},
+  {0x2a6e, 0x0000},
+  {0x011b, 0x0000},
+  {0x2255, 0x0000},
+  {0x00e8, 0x0000},
+  {0x2a98, 0x0000},
+  {0x2a97, 0x0000},
+  {0x2205, 0x0000},
+  {0x2004, 0x0000},
+  {0x2005, 0x0000},
+  {0x29e3, 0x0000},
+  {0x2256, 0x0000},
+  {0x003d, 0x0000},
+  {0x225f, 0x0000},
+  {0x2640, 0x0000},
+  {0xfb03, 0x0000},
+  {0xfb04, 0x0000},
+  {0x2200, 0x0000},
+  {0x00bd, 0x0000},
+  {0x2153, 0x0000},
+  {0x00bc, 0x0000},
+  {0x2155, 0x0000},
+  {0x2159, 0x0000},
+  {0x215b, 0x0000},
+  {0x2154, 0x0000},
+  {0x2156, 0x0000},
+  {0x00be, 0x0000},
+  {0x2157, 0x0000},
+  {0x215c, 0x0000},
+  {0x2158, 0x0000},
+  {0x215a, 0x0000},
+  {0x215d, 0x0000},
+  {0x215e, 0x0000},
+  {0x01f5, 0x0000},
+  {0x03dd, 0x0000},
+  {0x011f, 0x0000},
+  {0x2a80, 0x0000},
+  {0x2a94, 0x0000},
+  {0x2995, 0x0000},
+  {0x2978, 0x0000},
+  {0x22d7, 0x0000},
+  {0x2273, 0x0000},
+  {0x200a, 0x0000},
+  {0x210b, 0x0000},
+  {0x044a, 0x0000},
+  {0x2665, 0x0000},
+  {0x2026, 0x0000},
+  {0x22b9, 0x0000},
+  {0x223b, 0x0000},
+  {0x2015, 0x0000},
+  {0x210f, 0x0000},
+  {0x0127, 0x0000},
+  {0x2043, 0x0000},
+  {0x2010, 0x0000},
+  {0x00ed, 0x0000},
+  {0x00ec, 0x0000},
+  {0x2a0c, 0x0000},
+  {0x29dc, 0x0000},
+  {0x2105, 0x0000},
+  {0x0131, 0x0000},
+  {0x22ba, 0x0000},
+  {0x00bf, 0x0000},
+  {0x22f3, 0x0000},
+  {0x0129, 0x0000},
+  {0x0458, 0x0000},
+  {0x03f0, 0x0000},
+  {0x0137, 0x0000},
+  {0x0138, 0x0000},
+  {0x291b, 0x0000},
+  {0x013a, 0x0000},
+  {0x2112, 0x0000},
+  {0x03bb, 0x0000},
+  {0x27e8, 0x0000},
+  {0x291d, 0x0000},
+  {0x21a9, 0x0000},
+  {0x21ab, 0x0000},
+  {0x2939, 0x0000},
+  {0x21a2, 0x0000},
+  {0x2919, 0x0000},
+  {0x007b, 0x0000},
+  {0x005b, 0x0000},
+  {0x013e, 0x0000},
+  {0x013c, 0x0000},
+  {0x201e, 0x0000},
+  {0x2a7f, 0x0000},
+  {0x2a93, 0x0000},
+  {0x297c, 0x0000},
+  {0x230a, 0x0000},
+  {0x296a, 0x0000},
+  {0x296b, 0x0000},
+  {0x0140, 0x0000},
+  {0x23b0, 0x0000},
+  {0x2a2d, 0x0000},
+  {0x2217, 0x0000},
+  {0x005f, 0x0000},
+  {0x2993, 0x0000},
+  {0x296d, 0x0000},
+  {0x2039, 0x0000},
+  {0x201a, 0x0000},
+  {0x0142, 0x0000},
+  {0x22cb, 0x0000},
+  {0x22c9, 0x0000},
+  {0x2976, 0x0000},
+  {0x2996, 0x0000},
+  {0x21a6, 0x0000},
+  {0x25ae, 0x0000},
+  {0x2a29, 0x0000},
+  {0x002a, 0x0000},
+  {0x2af0, 0x0000},
+  {0x00b7, 0x0000},
+  {0x229f, 0x0000},
+  {0x2238, 0x0000},
+  {0x2213, 0x0000},
+  {0x22a7, 0x0000},
+  {0x223e, 0x0000},
+  {0x22af, 0x0000},
+  {0x22ae, 0x0000},
+  {0x0144, 0x0000},
+  {0x224f, 0x0338},
+  {0x0148, 0x0000},
+  {0x0146, 0x0000},
+  {0x2924, 0x0000},
+  {0x2262, 0x0000},
+  {0x2928, 0x0000},
+  {0x2204, 0x0000},
+  {0x22ec, 0x0000},
+  {0x22f9, 0x0338},
+  {0x2afd, 0x20e5},
+  {0x22e0, 0x0000},
+  {0x2933, 0x0338},
+  {0x219d, 0x0338},
+  {0x22ed, 0x0000},
+  {0x22e1, 0x0000},
+  {0x2244, 0x0000},
+  {0x00f1, 0x0000},
+  {0x2116, 0x0000},
+  {0x22ad, 0x0000},
+  {0x2904, 0x0000},
+  {0x22ac, 0x0000},
+  {0x2902, 0x0000},
+  {0x2903, 0x0000},
+  {0x2923, 0x0000},
+  {0x2927, 0x0000},
+  {0x00f3, 0x0000},
+  {0x0151, 0x0000},
+  {0x29bc, 0x0000},
+  {0x00f2, 0x0000},
+  {0x2296, 0x0000},
+  {0x22b6, 0x0000},
+  {0x00f8, 0x0000},
+  {0x00f5, 0x0000},
+  {0x2297, 0x0000},
+  {0x2af3, 0x0000},
+  {0x0025, 0x0000},
+  {0x002e, 0x0000},
+  {0x2030, 0x0000},
+  {0x2133, 0x0000},
+  {0x210f, 0x0000},
+  {0x210f, 0x0000},
+  {0x2214, 0x0000},
+  {0x2a25, 0x0000},
+  {0x00b1, 0x0000},
+  {0x2aaf, 0x0000},
+  {0x2119, 0x0000},
+  {0x22e8, 0x0000},
+  {0x221d, 0x0000},
+  {0x22b0, 0x0000},
+  {0x2008, 0x0000},
+  {0x2057, 0x0000},
+  {0x291c, 0x0000},
+  {0x0155, 0x0000},
+  {0x27e9, 0x0000},
+  {0x2975, 0x0000},
+  {0x291e, 0x0000},
+  {0x21aa, 0x0000},
+  {0x21ac, 0x0000},
+  {0x2945, 0x0000},
+  {0x21a3, 0x0000},
+  {0x291a, 0x0000},
+  {0x007d, 0x0000},
+  {0x005d, 0x0000},
+  {0x0159, 0x0000},
+  {0x0157, 0x0000},
+  {0x201d, 0x0000},
+  {0x297d, 0x0000},
+  {0x230b, 0x0000},
+  {0x296c, 0x0000},
+  {0x23b1, 0x0000},
+  {0x2a2e, 0x0000},
+  {0x2994, 0x0000},
+  {0x203a, 0x0000},
+  {0x2019, 0x0000},
+  {0x22cc, 0x0000},
+  {0x22ca, 0x0000},
+  {0x015b, 0x0000},
+  {0x0161, 0x0000},
+  {0x015f, 0x0000},
+  {0x22e9, 0x0000},
+  {0x2925, 0x0000},
+  {0x2929, 0x0000},
+  {0x2322, 0x0000},
+  {0x0449, 0x0000},
+  {0x03c2, 0x0000},
+  {0x03c2, 0x0000},
+  {0x2a6a, 0x0000},
+  {0x2a33, 0x0000},
+  {0x044c, 0x0000},
+  {0x233f, 0x0000},
+  {0x2660, 0x0000},
+  {0x2293, 0xfe00},
+  {0x2294, 0xfe00},
+  {0x2291, 0x0000},
+  {0x2292, 0x0000},
+  {0x25a1, 0x0000},
+  {0x25aa, 0x0000},
+  {0x2216, 0x0000},
+  {0x2323, 0x0000},
+  {0x22c6, 0x0000},
+  {0x2abd, 0x0000},
+  {0x2282, 0x0000},
+  {0x2ac7, 0x0000},
+  {0x2ad5, 0x0000},
+  {0x2ad3, 0x0000},
+  {0x2ab0, 0x0000},
+  {0x2abe, 0x0000},
+  {0x2283, 0x0000},
+  {0x2ac8, 0x0000},
+  {0x2ad4, 0x0000},
+  {0x2ad6, 0x0000},
+  {0x2926, 0x0000},
+  {0x292a, 0x0000},
+  {0x2316, 0x0000},
+  {0x0165, 0x0000},
+  {0x0163, 0x0000},
+  {0x2315, 0x0000},
+  {0x2234, 0x0000},
+  {0x03d1, 0x0000},
+  {0x2009, 0x0000},
+  {0x223c, 0x0000},
+  {0x22a0, 0x0000},
+  {0x2a30, 0x0000},
+  {0x2336, 0x0000},
+  {0x2af1, 0x0000},
+  {0x2034, 0x0000},
+  {0x25ec, 0x0000},
+  {0x0167, 0x0000},
+  {0x00fa, 0x0000},
+  {0x016d, 0x0000},
+  {0x0171, 0x0000},
+  {0x297e, 0x0000},
+  {0x00f9, 0x0000},
+  {0x231c, 0x0000},
+  {0x230f, 0x0000},
+  {0x231d, 0x0000},
+  {0x230e, 0x0000},
+  {0x0169, 0x0000},
+  {0x299c, 0x0000},
+  {0x03d5, 0x0000},
+  {0x03f1, 0x0000},
+  {0x22bb, 0x0000},
+  {0x22ee, 0x0000},
+  {0x007c, 0x0000},
+  {0x2acb, 0xfe00},
+  {0x228a, 0xfe00},
+  {0x2acc, 0xfe00},
+  {0x228b, 0xfe00},
+  {0x2a5f, 0x0000},
+  {0x2259, 0x0000},
+  {0x2118, 0x0000},
+  {0x2240, 0x0000},
+  {0x2a01, 0x0000},
+  {0x2a02, 0x0000},
+  {0x2a06, 0x0000},
+  {0x2a04, 0x0000},
+  {0x22c0, 0x0000},
+  {0x00fd, 0x0000},
+  {0x017a, 0x0000},
+  {0x017e, 0x0000},
+  {0x2128, 0x0000},
+  {0x2235, 0x0000},
+  {0x212d, 0x0000},
+  {0x2230, 0x0000},
+  {0x00b8, 0x0000},
+  {0x22c4, 0x0000},
+  {0x22a4, 0x0000},
+  {0x2208, 0x0000},
+  {0x0395, 0x0000},
+  {0x21d2, 0x0000},
+  {0x22a3, 0x0000},
+  {0x000a, 0x0000},
+  {0x2060, 0x0000},
+  {0x226e, 0x0000},
+  {0x039f, 0x0000},
+  {0x203e, 0x0000},
+  {0x220f, 0x0000},
+  {0x2191, 0x0000},
+  {0x21d1, 0x0000},
+  {0x03a5, 0x0000},
+  {0x2135, 0x0000},
+  {0x22be, 0x0000},
+  {0x237c, 0x0000},
+  {0x224d, 0x0000},
+  {0x223d, 0x0000},
+  {0x2235, 0x0000},
+  {0x29b0, 0x0000},
+  {0x226c, 0x0000},
+  {0x25ef, 0x0000},
+  {0x2a00, 0x0000},
+  {0x2605, 0x0000},
+  {0x2261, 0x20e5},
+  {0x229e, 0x0000},
+  {0x2a50, 0x0000},
+  {0x29b2, 0x0000},
+  {0x29c2, 0x0000},
+  {0x2254, 0x0000},
+  {0x2a6d, 0x0000},
+  {0x2938, 0x0000},
+  {0x2935, 0x0000},
+  {0x293d, 0x0000},
+  {0x293c, 0x0000},
+  {0x290f, 0x0000},
+  {0x2021, 0x0000},
+  {0x2a77, 0x0000},
+  {0x29b1, 0x0000},
+  {0x22c4, 0x0000},
+  {0x03dd, 0x0000},
+  {0x2214, 0x0000},
+  {0x29a6, 0x0000},
+  {0x03b5, 0x0000},
+  {0x2255, 0x0000},
+  {0x2a78, 0x0000},
+  {0x2a82, 0x0000},
+  {0x2a7c, 0x0000},
+  {0x2277, 0x0000},
+  {0x2948, 0x0000},
+  {0x2a3c, 0x0000},
+  {0x22f5, 0x0000},
+  {0x291f, 0x0000},
+  {0x2973, 0x0000},
+  {0x298f, 0x0000},
+  {0x298d, 0x0000},
+  {0x2967, 0x0000},
+  {0x2a81, 0x0000},
+  {0x22d6, 0x0000},
+  {0x2276, 0x0000},
+  {0x2272, 0x0000},
+  {0x2a34, 0x0000},
+  {0x25ca, 0x0000},
+  {0x2a7b, 0x0000},
+  {0x2966, 0x0000},
+  {0x2720, 0x0000},
+  {0x2a2a, 0x0000},
+  {0x2249, 0x0000},
+  {0x266e, 0x0000},
+  {0x2197, 0x0000},
+  {0x2204, 0x0000},
+  {0x2209, 0x0000},
+  {0x22f7, 0x0000},
+  {0x22f6, 0x0000},
+  {0x220c, 0x0000},
+  {0x22fe, 0x0000},
+  {0x22fd, 0x0000},
+  {0x2a14, 0x0000},
+  {0x2aaf, 0x0338},
+  {0x22e2, 0x0000},
+  {0x22e3, 0x0000},
+  {0x2282, 0x20d2},
+  {0x2ab0, 0x0338},
+  {0x2283, 0x20d2},
+  {0x29de, 0x0000},
+  {0x22b4, 0x20d2},
+  {0x22b5, 0x20d2},
+  {0x2196, 0x0000},
+  {0x29bb, 0x0000},
+  {0x03bf, 0x0000},
+  {0x2134, 0x0000},
+  {0x2a57, 0x0000},
+  {0x2031, 0x0000},
+  {0x210e, 0x0000},
+  {0x2a22, 0x0000},
+  {0x2a26, 0x0000},
+  {0x2a27, 0x0000},
+  {0x227e, 0x0000},
+  {0x2a16, 0x0000},
+  {0x225f, 0x0000},
+  {0x2920, 0x0000},
+  {0x2974, 0x0000},
+  {0x298e, 0x0000},
+  {0x2990, 0x0000},
+  {0x2969, 0x0000},
+  {0x211b, 0x0000},
+  {0x2a35, 0x0000},
+  {0x2968, 0x0000},
+  {0x2198, 0x0000},
+  {0x2a24, 0x0000},
+  {0x2972, 0x0000},
+  {0x2ac3, 0x0000},
+  {0x2ac1, 0x0000},
+  {0x2abf, 0x0000},
+  {0x2979, 0x0000},
+  {0x227f, 0x0000},
+  {0x2ad8, 0x0000},
+  {0x2ac4, 0x0000},
+  {0x27c9, 0x0000},
+  {0x2ad7, 0x0000},
+  {0x297b, 0x0000},
+  {0x2ac2, 0x0000},
+  {0x2ac0, 0x0000},
+  {0x2199, 0x0000},
+  {0x2ada, 0x0000},
+  {0x2a39, 0x0000},
+  {0x2a3b, 0x0000},
+  {0x2191, 0x0000},
+  {0x03c5, 0x0000},
+  {0x29a7, 0x0000},
+  {0x299a, 0x0000},
+  {0x21dd, 0x0000},
+  {0x2911, 0x0000},
+  {0x2250, 0x0000},
+  {0x222b, 0x0000},
+  {0x2aa1, 0x0000},
+  {0x2260, 0x0000},
+  {0x2241, 0x0000},
+  {0x2202, 0x0000},
+  {0x227a, 0x0000},
+  {0x22a2, 0x0000},
+  {0x227b, 0x0000},
+  {0x220b, 0x0000},
+  {0x2283, 0x0000},
+  {0x2949, 0x0000},
+  {0x005f, 0x0000},
+  {0x2a58, 0x0000},
+  {0x29a8, 0x0000},
+  {0x29a9, 0x0000},
+  {0x29aa, 0x0000},
+  {0x29ab, 0x0000},
+  {0x29ac, 0x0000},
+  {0x29ad, 0x0000},
+  {0x29ae, 0x0000},
+  {0x29af, 0x0000},
+  {0x299d, 0x0000},
+  {0x224a, 0x0000},
+  {0x2233, 0x0000},
+  {0x224c, 0x0000},
+  {0x2305, 0x0000},
+  {0x23b6, 0x0000},
+  {0x2a01, 0x0000},
+  {0x2a06, 0x0000},
+  {0x2a04, 0x0000},
+  {0x22c0, 0x0000},
+  {0x229f, 0x0000},
+  {0x22a0, 0x0000},
+  {0x27c8, 0x0000},
+  {0x2a49, 0x0000},
+  {0x00ae, 0x0000},
+  {0x24c8, 0x0000},
+  {0x2a10, 0x0000},
+  {0x2663, 0x0000},
+  {0x2a48, 0x0000},
+  {0x22ce, 0x0000},
+  {0x2232, 0x0000},
+  {0x2251, 0x0000},
+  {0x2238, 0x0000},
+  {0x2910, 0x0000},
+  {0x27ff, 0x0000},
+  {0x23e7, 0x0000},
+  {0x2205, 0x0000},
+  {0x29e5, 0x0000},
+  {0x2a0d, 0x0000},
+  {0x2a7e, 0x0000},
+  {0x2a84, 0x0000},
+  {0x2a8a, 0x0000},
+  {0x2925, 0x0000},
+  {0x2926, 0x0000},
+  {0x2110, 0x0000},
+  {0x2111, 0x0000},
+  {0x29dd, 0x0000},
+  {0x2124, 0x0000},
+  {0x22ba, 0x0000},
+  {0x2a17, 0x0000},
+  {0x29b4, 0x0000},
+  {0x294b, 0x0000},
+  {0x2a7d, 0x0000},
+  {0x2a83, 0x0000},
+  {0x231e, 0x0000},
+  {0x2a89, 0x0000},
+  {0x231f, 0x0000},
+  {0x294a, 0x0000},
+  {0x21a5, 0x0000},
+  {0x22b8, 0x0000},
+  {0x2115, 0x0000},
+  {0x2a6d, 0x0338},
+  {0x22f5, 0x0338},
+  {0x2a36, 0x0000},
+  {0x2225, 0x0000},
+  {0x2a23, 0x0000},
+  {0x2a15, 0x0000},
+  {0x2ab5, 0x0000},
+  {0x22e8, 0x0000},
+  {0x232e, 0x0000},
+  {0x2312, 0x0000},
+  {0x2313, 0x0000},
+  {0x29b3, 0x0000},
+  {0x211c, 0x0000},
+  {0x2a12, 0x0000},
+  {0x29ce, 0x0000},
+  {0x2a13, 0x0000},
+  {0x2216, 0x0000},
+  {0x2223, 0x0000},
+  {0x29e4, 0x0000},
+  {0x228f, 0x0000},
+  {0x2290, 0x0000},
+  {0x2286, 0x0000},
+  {0x2ab6, 0x0000},
+  {0x22e9, 0x0000},
+  {0x2287, 0x0000},
+  {0x03d1, 0x0000},
+  {0x223c, 0x0000},
+  {0x2a31, 0x0000},
+  {0x25b5, 0x0000},
+  {0x2a3a, 0x0000},
+  {0x23e2, 0x0000},
+  {0x231c, 0x0000},
+  {0x231d, 0x0000},
+  {0x03f0, 0x0000},
+  {0x03c2, 0x0000},
+  {0x03d1, 0x0000},
+  {0x2216, 0x0000},
+  {0x00b7, 0x0000},
+  {0x2299, 0x0000},
+  {0x2261, 0x0000},
+  {0x2210, 0x0000},
+  {0x00a8, 0x0000},
+  {0x2193, 0x0000},
+  {0x0311, 0x0000},
+  {0x21d3, 0x0000},
+  {0x224f, 0x0000},
+  {0x2190, 0x0000},
+  {0x230a, 0x0000},
+  {0x21d0, 0x0000},
+  {0x2272, 0x0000},
+  {0x2133, 0x0000},
+  {0x2213, 0x0000},
+  {0x226d, 0x0000},
+  {0x2204, 0x0000},
+  {0x2282, 0x20d2},
+  {0x23de, 0x0000},
+  {0x00b1, 0x0000},
+  {0x2234, 0x0000},
+  {0x2009, 0x0000},
+  {0x20db, 0x0000},
+  {0x228e, 0x0000},
+  {0x2035, 0x0000},
+  {0x22cd, 0x0000},
+  {0x2a02, 0x0000},
+  {0x00b7, 0x0000},
+  {0x2713, 0x0000},
+  {0x2102, 0x0000},
+  {0x22a1, 0x0000},
+  {0x2193, 0x0000},
+  {0x2a86, 0x0000},
+  {0x22db, 0x0000},
+  {0x2269, 0xfe00},
+  {0x2665, 0x0000},
+  {0x2190, 0x0000},
+  {0x22da, 0x0000},
+  {0x2268, 0xfe00},
+  {0x2a7e, 0x0338},
+  {0x2a7d, 0x0338},
+  {0x2226, 0x0000},
+  {0x2224, 0x0000},
+  {0x2288, 0x0000},
+  {0x2289, 0x0000},
+  {0x22d4, 0x0000},
+  {0x211a, 0x0000},
+  {0x2660, 0x0000},
+  {0x2ac5, 0x0000},
+  {0x228a, 0x0000},
+  {0x2ac6, 0x0000},
+  {0x228b, 0x0000},
+  {0x2234, 0x0000},
+  {0x225c, 0x0000},
+  {0x221d, 0x0000},
+  {0x212c, 0x0000},
+  {0x2295, 0x0000},
+  {0x2242, 0x0000},
+  {0x2131, 0x0000},
+  {0x2148, 0x0000},
+  {0x2112, 0x0000},
+  {0x21bc, 0x0000},
+  {0x21da, 0x0000},
+  {0x2209, 0x0000},
+  {0x226f, 0x0000},
+  {0x2237, 0x0000},
+  {0x2192, 0x0000},
+  {0x230b, 0x0000},
+  {0x21d2, 0x0000},
+  {0x205f, 0x200a},
+  {0x2243, 0x0000},
+  {0x2248, 0x0000},
+  {0x23df, 0x0000},
+  {0x2912, 0x0000},
+  {0x21a5, 0x0000},
+  {0x229b, 0x0000},
+  {0x2201, 0x0000},
+  {0x22cf, 0x0000},
+  {0x2a96, 0x0000},
+  {0x2a8c, 0x0000},
+  {0x2a85, 0x0000},
+  {0x2a8b, 0x0000},
+  {0x23b0, 0x0000},
+  {0x27fc, 0x0000},
+  {0x21a7, 0x0000},
+  {0x21a4, 0x0000},
+  {0x21cd, 0x0000},
+  {0x219a, 0x0000},
+  {0x2ac5, 0x0338},
+  {0x2ac6, 0x0338},
+  {0x2ab7, 0x0000},
+  {0x2192, 0x0000},
+  {0x23b1, 0x0000},
+  {0x2291, 0x0000},
+  {0x2292, 0x0000},
+  {0x2acb, 0x0000},
+  {0x2ab8, 0x0000},
+  {0x2acc, 0x0000},
+  {0x21c8, 0x0000},
+  {0x03f5, 0x0000},
+  {0x2205, 0x0000},
+  {0x2296, 0x0000},
+  {0x2297, 0x0000},
+  {0x21cc, 0x0000},
+  {0x2277, 0x0000},
+  {0x2308, 0x0000},
+  {0x2276, 0x0000},
+  {0x205f, 0x0000},
+  {0x226a, 0x0338},
+  {0x2280, 0x0000},
+  {0x2281, 0x0000},
+  {0x2283, 0x20d2},
+  {0x23b4, 0x0000},
+  {0x21c0, 0x0000},
+  {0x21db, 0x0000},
+  {0x29f4, 0x0000},
+  {0x2218, 0x0000},
+  {0x2294, 0x0000},
+  {0x2286, 0x0000},
+  {0x2195, 0x0000},
+  {0x21d5, 0x0000},
+  {0x2223, 0x0000},
+  {0x03f6, 0x0000},
+  {0x25aa, 0x0000},
+  {0x229a, 0x0000},
+  {0x229d, 0x0000},
+  {0x22de, 0x0000},
+  {0x22df, 0x0000},
+  {0x2666, 0x0000},
+  {0x2a95, 0x0000},
+  {0x2130, 0x0000},
+  {0x21cf, 0x0000},
+  {0x219b, 0x0000},
+  {0x227c, 0x0000},
+  {0x2ab9, 0x0000},
+  {0x210d, 0x0000},
+  {0x03d5, 0x0000},
+  {0x227d, 0x0000},
+  {0x2aba, 0x0000},
+  {0x2248, 0x0000},
+  {0x2195, 0x0000},
+  {0x2913, 0x0000},
+  {0x21a7, 0x0000},
+  {0x2147, 0x0000},
+  {0x2265, 0x0000},
+  {0x2273, 0x0000},
+  {0x210b, 0x0000},
+  {0x224e, 0x0000},
+  {0x22c2, 0x0000},
+  {0x21e4, 0x0000},
+  {0x21a4, 0x0000},
+  {0x22b2, 0x0000},
+  {0x21bf, 0x0000},
+  {0x2262, 0x0000},
+  {0x224f, 0x0338},
+  {0x2270, 0x0000},
+  {0x2274, 0x0000},
+  {0x221d, 0x0000},
+  {0x2309, 0x0000},
+  {0x2970, 0x0000},
+  {0x2191, 0x0000},
+  {0x228f, 0x0000},
+  {0x23b5, 0x0000},
+  {0x007c, 0x0000},
+  {0x29eb, 0x0000},
+  {0x2147, 0x0000},
+  {0x2253, 0x0000},
+  {0x25bf, 0x0000},
+  {0x25c3, 0x0000},
+  {0x228a, 0xfe00},
+  {0x228b, 0xfe00},
+  {0x2061, 0x0000},
+  {0x2146, 0x0000},
+  {0x2ae4, 0x0000},
+  {0x21d1, 0x0000},
+  {0x295a, 0x0000},
+  {0x2952, 0x0000},
+  {0x2266, 0x0000},
+  {0x27f5, 0x0000},
+  {0x27f8, 0x0000},
+  {0x2242, 0x0338},
+  {0x2244, 0x0000},
+  {0x2249, 0x0000},
+  {0x210c, 0x0000},
+  {0x2aaf, 0x0000},
+  {0x227e, 0x0000},
+  {0x21e5, 0x0000},
+  {0x21a6, 0x0000},
+  {0x22b3, 0x0000},
+  {0x21be, 0x0000},
+  {0x2ab0, 0x0000},
+  {0x227f, 0x0000},
+  {0x2287, 0x0000},
+  {0x296e, 0x0000},
+  {0x2240, 0x0000},
+  {0x200a, 0x0000},
+  {0x25b3, 0x0000},
+  {0x25b4, 0x0000},
+  {0x22c7, 0x0000},
+  {0x2252, 0x0000},
+  {0x21a9, 0x0000},
+  {0x21a2, 0x0000},
+  {0x21bc, 0x0000},
+  {0x27f5, 0x0000},
+  {0x21ab, 0x0000},
+  {0x2221, 0x0000},
+  {0x22ea, 0x0000},
+  {0x2225, 0x0000},
+  {0x2216, 0x0000},
+  {0x25b9, 0x0000},
+  {0x21bf, 0x0000},
+  {0x2acb, 0xfe00},
+  {0x2acc, 0xfe00},
+  {0x02d9, 0x0000},
+  {0x22a8, 0x0000},
+  {0x21bd, 0x0000},
+  {0x2aa2, 0x0000},
+  {0x2500, 0x0000},
+  {0x2063, 0x0000},
+  {0x2062, 0x0000},
+  {0x21c3, 0x0000},
+  {0x2194, 0x0000},
+  {0x21d4, 0x0000},
+  {0x2a7d, 0x0000},
+  {0x27f6, 0x0000},
+  {0x27f9, 0x0000},
+  {0x2199, 0x0000},
+  {0x226a, 0x0000},
+  {0x2279, 0x0000},
+  {0x2278, 0x0000},
+  {0x2288, 0x0000},
+  {0x2224, 0x0000},
+  {0x2018, 0x0000},
+  {0x220b, 0x0000},
+  {0x295b, 0x0000},
+  {0x2953, 0x0000},
+  {0x2193, 0x0000},
+  {0x2190, 0x0000},
+  {0x2290, 0x0000},
+  {0x2245, 0x0000},
+  {0x2196, 0x0000},
+  {0x200b, 0x0000},
+  {0x21b6, 0x0000},
+  {0x2306, 0x0000},
+  {0x21ca, 0x0000},
+  {0x21aa, 0x0000},
+  {0x21c7, 0x0000},
+  {0x2194, 0x0000},
+  {0x22cb, 0x0000},
+  {0x27f6, 0x0000},
+  {0x21ac, 0x0000},
+  {0x2226, 0x0000},
+  {0x22eb, 0x0000},
+  {0x21a3, 0x0000},
+  {0x21c0, 0x0000},
+  {0x22b4, 0x0000},
+  {0x21be, 0x0000},
+  {0x2019, 0x0000},
+  {0x222e, 0x0000},
+  {0x21d3, 0x0000},
+  {0x21d0, 0x0000},
+  {0x21c1, 0x0000},
+  {0x294e, 0x0000},
+  {0x29cf, 0x0000},
+  {0x2960, 0x0000},
+  {0x2958, 0x0000},
+  {0x2198, 0x0000},
+  {0x2271, 0x0000},
+  {0x2275, 0x0000},
+  {0x224e, 0x0338},
+  {0x22ea, 0x0000},
+  {0x228f, 0x0338},
+  {0x23dc, 0x0000},
+  {0x21c2, 0x0000},
+  {0x2192, 0x0000},
+  {0x2197, 0x0000},
+  {0x25bd, 0x0000},
+  {0x21ba, 0x0000},
+  {0x21b7, 0x0000},
+  {0x21c3, 0x0000},
+  {0x21bd, 0x0000},
+  {0x21c6, 0x0000},
+  {0x21ce, 0x0000},
+  {0x21ae, 0x0000},
+  {0x22ec, 0x0000},
+  {0x21c4, 0x0000},
+  {0x219d, 0x0000},
+  {0x22cc, 0x0000},
+  {0x03f5, 0x0000},
+  {0x22b5, 0x0000},
+  {0x22b2, 0x0000},
+  {0x00b4, 0x0000},
+  {0x0060, 0x0000},
+  {0x02dc, 0x0000},
+  {0x21d2, 0x0000},
+  {0x21f5, 0x0000},
+  {0x25fb, 0x0000},
+  {0x22db, 0x0000},
+  {0x2267, 0x0000},
+  {0x27e8, 0x0000},
+  {0x2951, 0x0000},
+  {0x22da, 0x0000},
+  {0x00a0, 0x0000},
+  {0x2aaf, 0x0338},
+  {0x22eb, 0x0000},
+  {0x2ab0, 0x0338},
+  {0x227f, 0x0338},
+  {0x2289, 0x0000},
+  {0x29d0, 0x0000},
+  {0x295c, 0x0000},
+  {0x2954, 0x0000},
+  {0x23dd, 0x0000},
+  {0x21c5, 0x0000},
+  {0x21bb, 0x0000},
+  {0x21c2, 0x0000},
+  {0x22ed, 0x0000},
+  {0x21c1, 0x0000},
+  {0x21c9, 0x0000},
+  {0x219e, 0x0000},
+  {0x22b3, 0x0000},
+  {0x21d5, 0x0000},
+  {0x2225, 0x0000},
+  {0x295e, 0x0000},
+  {0x2956, 0x0000},
+  {0x25fc, 0x0000},
+  {0x2a7e, 0x0000},
+  {0x27e6, 0x0000},
+  {0x2961, 0x0000},
+  {0x2959, 0x0000},
+  {0x22b4, 0x0000},
+  {0x200b, 0x0000},
+  {0x226b, 0x0338},
+  {0x2a7d, 0x0338},
+  {0x2aa1, 0x0338},
+  {0x220c, 0x0000},
+  {0x2290, 0x0338},
+  {0x2247, 0x0000},
+  {0x27e9, 0x0000},
+  {0x294f, 0x0000},
+  {0x2291, 0x0000},
+  {0x2758, 0x0000},
+  {0x25be, 0x0000},
+  {0x25c2, 0x0000},
+  {0x21cb, 0x0000},
+  {0x21cc, 0x0000},
+  {0x21a0, 0x0000},
+  {0x295f, 0x0000},
+  {0x2957, 0x0000},
+  {0x27f7, 0x0000},
+  {0x27fa, 0x0000},
+  {0x200b, 0x0000},
+  {0x29cf, 0x0338},
+  {0x227c, 0x0000},
+  {0x21cb, 0x0000},
+  {0x27e7, 0x0000},
+  {0x295d, 0x0000},
+  {0x2955, 0x0000},
+  {0x22b5, 0x0000},
+  {0x2293, 0x0000},
+  {0x227d, 0x0000},
+  {0x25b8, 0x0000},
+  {0x27f7, 0x0000},
+  {0x27f8, 0x0000},
+  {0x2950, 0x0000},
+  {0x21c6, 0x0000},
+  {0x200b, 0x0000},
+  {0x2267, 0x0338},
+  {0x29d0, 0x0338},
+  {0x21c4, 0x0000},
+  {0x2292, 0x0000},
+  {0x21ad, 0x0000},
+  {0x2145, 0x0000},
+  {0x21d4, 0x0000},
+  {0x27f9, 0x0000},
+  {0x25ab, 0x0000},
+  {0x226b, 0x0000},
+  {0x2226, 0x0000},
+  {0x2a7e, 0x0338},
+  {0x22ec, 0x0000},
+  {0x22e2, 0x0000},
+  {0x201c, 0x0000},
+  {0x296f, 0x0000},
+  {0x201d, 0x0000},
+  {0x222f, 0x0000},
+  {0x25aa, 0x0000},
+  {0x200b, 0x0000},
+  {0x22e0, 0x0000},
+  {0x22ed, 0x0000},
+  {0x22e1, 0x0000},
+  {0x02dd, 0x0000},
+  {0x22e3, 0x0000},
+  {0x2aa2, 0x0338},
+  {0x2232, 0x0000},
+  {0x27fa, 0x0000},
+  {0x2233, 0x0000},
+};
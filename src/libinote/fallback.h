@@ -0,0 +1,91 @@
+#ifndef __FALLBACK_H_
+#define __FALLBACK_H_
+
+/*
+  ASCII fallback of the characters which may have no equivalent in
+  the tlv charset: quotes, dashes, ellipsis, spaces, ligatures,...
+  (sorted by character).
+
+  The characters of this table get the UNICODE_FALLBACK property (see
+  gen_unicode); conv_get_fallback() returns the fallback if the
+  character can't be converted to the charset.
+*/
+
+#include <uchar.h>
+
+typedef struct {
+  char32_t c;
+  const char *ascii;
+} fallback_t;
+
+static const fallback_t fallback[] = {
+  {0x00a0, " "}, // no-break space
+  {0x00ab, "'"}, // quotes
+  {0x00bb, "'"},
+  {0x0152, "OE"}, // ligatures
+  {0x0153, "oe"},
+  {0x13c9, "'"},
+  {0x2002, " "}, // spaces
+  {0x2003, " "},
+  {0x2004, " "},
+  {0x2005, " "},
+  {0x2006, " "},
+  {0x2007, " "},
+  {0x2008, " "},
+  {0x2009, " "},
+  {0x200a, " "},
+  {0x2010, "-"}, // dashes
+  {0x2011, "-"},
+  {0x2012, "-"},
+  {0x2013, "-"},
+  {0x2014, "-"},
+  {0x2015, "-"},
+  {0x2018, "'"}, // quotes
+  {0x2019, "'"},
+  {0x201a, "'"},
+  {0x201b, "'"},
+  {0x201c, "'"},
+  {0x201d, "'"},
+  {0x201e, "'"},
+  {0x201f, "'"},
+  {0x2026, "..."},
+  {0x202f, " "},
+  {0x2039, "'"},
+  {0x203a, "'"},
+  {0x2122, "TM"},
+  {0x2212, "-"},
+  {0x2358, "'"},
+  {0x2359, "'"},
+  {0x235e, "'"},
+  {0x275b, "'"},
+  {0x275c, "'"},
+  {0x275d, "'"},
+  {0x275e, "'"},
+  {0x276e, "'"},
+  {0x276f, "'"},
+  {0x3000, " "},
+  {0x301d, "'"},
+  {0x301e, "'"},
+  {0x301f, "'"},
+  {0xa404, "'"},
+  {0xa405, "'"},
+  {0xa406, "'"},
+  {0xa407, "'"},
+  {0xfb00, "ff"}, // ligatures
+  {0xfb01, "fi"},
+  {0xfb02, "fl"},
+  {0xfb03, "ffi"},
+  {0xfb04, "ffl"},
+  {0xfb05, "st"},
+  {0xfb06, "st"},
+  {0xff02, "'"},
+  {0xe0022, "'"},
+};
+
+#define FALLBACK_NB (sizeof(fallback)/sizeof(*fallback))
+
+#endif
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
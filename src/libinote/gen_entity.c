@@ -0,0 +1,116 @@
+/*
+  Generate the trie of the HTML5 named character references (see
+  entity.h) on the standard output, from the list given as argument
+  (entity.txt).
+
+  The children of a node are stored contiguously, sorted by
+  character, in breadth-first order.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "entity.h"
+
+#define NODE_MAX 0x10000
+#define CHAR_MAX_ASCII 0x80
+
+typedef struct {
+  int child[CHAR_MAX_ASCII]; // index of the child node, 0 if none
+  uint32_t value[ENTITY_VALUE_MAX];
+  bool has_value;
+} node_t;
+
+static node_t node[NODE_MAX];
+static int nb_node = 1; // root
+
+static int add_name(const char *name) {
+  int n = 0;
+  for (; *name; name++) {
+    int c = (unsigned char)*name;
+    if (c >= CHAR_MAX_ASCII)
+      return -1;
+    if (!node[n].child[c]) {
+      if (nb_node == NODE_MAX)
+	return -1;
+      node[n].child[c] = nb_node++;
+    }
+    n = node[n].child[c];
+  }
+  return n;
+}
+
+int main(int argc, char **argv) {
+  static int order[NODE_MAX]; // breadth-first order -> node
+  static int index[NODE_MAX]; // node -> breadth-first order
+  static uint8_t edge[NODE_MAX]; // character leading to the node
+  char line[256];
+  FILE *fd;
+  int nb_order = 1, nb_value = 0;
+  int i, c;
+
+  if ((argc != 2) || !(fd = fopen(argv[1], "r"))) {
+    fprintf(stderr, "usage: gen_entity entity.txt\n");
+    return 1;
+  }
+  while (fgets(line, sizeof(line), fd)) {
+    char name[ENTITY_NAME_MAX+1];
+    unsigned int v[ENTITY_VALUE_MAX] = {0};
+    int n, nb;
+    if ((line[0] == '#') || (line[0] == '\n'))
+      continue;
+    nb = sscanf(line, "%32s %x %x", name, &v[0], &v[1]);
+    if ((nb < 2) || (strlen(name) > ENTITY_NAME_MAX) || ((n = add_name(name)) < 0)) {
+      fprintf(stderr, "gen_entity: invalid line: %s", line);
+      return 1;
+    }
+    node[n].has_value = true;
+    node[n].value[0] = v[0];
+    node[n].value[1] = v[1];
+  }
+  fclose(fd);
+
+  // breadth-first order
+  order[0] = 0;
+  for (i=0; i<nb_order; i++) {
+    for (c=0; c<CHAR_MAX_ASCII; c++) {
+      int child = node[order[i]].child[c];
+      if (child) {
+	edge[child] = c;
+	index[child] = nb_order;
+	order[nb_order++] = child;
+      }
+    }
+  }
+
+  printf("/* generated by gen_entity */\n");
+  printf("#include \"entity.h\"\n\n");
+  printf("const entity_node_t entity_node[%d] = {\n", nb_order);
+  for (i=0; i<nb_order; i++) {
+    const node_t *n = node + order[i];
+    int first = 0, nb_child = 0;
+    for (c=0; c<CHAR_MAX_ASCII; c++) {
+      if (n->child[c]) {
+	if (!nb_child)
+	  first = index[n->child[c]];
+	nb_child++;
+      }
+    }
+    printf("  {%d, %d, %d, %d},\n", edge[order[i]], nb_child, first, n->has_value ? ++nb_value : 0);
+  }
+  printf("};\n\n");
+
+  printf("const char32_t entity_value[%d][%d] = {\n  {0},\n", nb_value+1, ENTITY_VALUE_MAX);
+  for (i=0; i<nb_order; i++) {
+    const node_t *n = node + order[i];
+    if (n->has_value)
+      printf("  {0x%04x, 0x%04x},\n", n->value[0], n->value[1]);
+  }
+  printf("};\n");
+
+  return 0;
+}
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
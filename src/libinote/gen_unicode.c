@@ -0,0 +1,178 @@
+/*
+  Generate the Unicode property tables (see unicode.h) on the
+  standard output, from the character classes given as argument
+  (unicode.txt).
+
+  The tables do not depend on the build machine: unicode.txt is only
+  updated from a UTF-8 locale by "gen_unicode -d" (make
+  update-unicode).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <locale.h>
+#include <wctype.h>
+#include "unicode.h"
+#include "fallback.h"
+
+#define CODE_POINT_NB (UNICODE_MAX+1)
+#define BLOCK_LENGTH (1 << UNICODE_BLOCK_SHIFT)
+#define BLOCK_NB (CODE_POINT_NB/BLOCK_LENGTH)
+
+static const char *locales[] = {"C.UTF-8", "C.utf8", "en_US.UTF-8", "en_US.utf8"};
+
+// character classes of unicode.txt (fallback: from fallback.h)
+static const struct {
+  const char *name;
+  uint8_t property;
+} classes[] = {
+  {"punct", UNICODE_PUNCT},
+  {"blank", UNICODE_BLANK},
+  {"upper", UNICODE_UPPER},
+  {"letter", UNICODE_LETTER},
+};
+#define CLASS_NB (sizeof(classes)/sizeof(*classes))
+
+static uint8_t property[CODE_POINT_NB];
+
+static uint8_t get_locale_property(wint_t c) {
+  uint8_t p = 0;
+  if (iswpunct(c))
+    p |= UNICODE_PUNCT;
+  if (iswblank(c))
+    p |= UNICODE_BLANK;
+  if (iswupper(c))
+    p |= UNICODE_UPPER;
+  if (iswalpha(c))
+    p |= UNICODE_LETTER;
+  return p;
+}
+
+/* write the character classes of the UTF-8 locale (unicode.txt) */
+static int dump_locale(void) {
+  size_t i, c, start;
+
+  for (i=0; i<sizeof(locales)/sizeof(*locales); i++) {
+    if (setlocale(LC_CTYPE, locales[i]))
+      break;
+  }
+  if (i == sizeof(locales)/sizeof(*locales)) {
+    fprintf(stderr, "gen_unicode: no UTF-8 locale found\n");
+    return 1;
+  }
+
+  printf("# Unicode character classes (generated by gen_unicode -d from the %s locale)\n", setlocale(LC_CTYPE, NULL));
+  printf("# first and last code points of the range in hexadecimal followed by the classes\n");
+  for (start=0; start<CODE_POINT_NB; start=c) {
+    uint8_t p = get_locale_property(start);
+    for (c=start+1; (c<CODE_POINT_NB) && (get_locale_property(c) == p); c++)
+      ;
+    if (!p)
+      continue;
+    printf("%04lx %04lx", (long unsigned int)start, (long unsigned int)(c-1));
+    for (i=0; i<CLASS_NB; i++) {
+      if (p & classes[i].property)
+	printf(" %s", classes[i].name);
+    }
+    printf("\n");
+  }
+  return 0;
+}
+
+/* read the character classes (unicode.txt) */
+static int read_classes(const char *filename) {
+  char line[256];
+  FILE *fd = fopen(filename, "r");
+
+  if (!fd) {
+    perror(filename);
+    return 1;
+  }
+  while (fgets(line, sizeof(line), fd)) {
+    unsigned int first, last;
+    uint8_t p = 0;
+    char *name;
+    int offset;
+    size_t i, c;
+    if ((line[0] == '#') || (line[0] == '\n'))
+      continue;
+    if ((sscanf(line, "%x %x%n", &first, &last, &offset) != 2) || (first > last) || (last > UNICODE_MAX)) {
+      fprintf(stderr, "gen_unicode: invalid line: %s", line);
+      return 1;
+    }
+    for (name = strtok(line + offset, " \t\n"); name; name = strtok(NULL, " \t\n")) {
+      for (i=0; (i<CLASS_NB) && strcmp(name, classes[i].name); i++)
+	;
+      if (i == CLASS_NB) {
+	fprintf(stderr, "gen_unicode: unknown class: %s\n", name);
+	return 1;
+      }
+      p |= classes[i].property;
+    }
+    for (c=first; c<=last; c++) {
+      property[c] = p;
+    }
+  }
+  fclose(fd);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  static uint8_t block[BLOCK_NB][BLOCK_LENGTH];
+  static size_t block_index[BLOCK_NB];
+  size_t nb_block = 0;
+  size_t i, j;
+
+  if ((argc == 2) && !strcmp(argv[1], "-d"))
+    return dump_locale();
+  if (argc != 2) {
+    fprintf(stderr, "usage: gen_unicode unicode.txt\n       gen_unicode -d > unicode.txt\n");
+    return 1;
+  }
+  if (read_classes(argv[1]))
+    return 1;
+  for (i=0; i<FALLBACK_NB; i++) {
+    property[fallback[i].c] |= UNICODE_FALLBACK;
+  }
+
+  // identical blocks are stored once
+  for (i=0; i<BLOCK_NB; i++) {
+    const uint8_t *current = property + i*BLOCK_LENGTH;
+    for (j=0; j<nb_block; j++) {
+      if (!memcmp(block[j], current, BLOCK_LENGTH))
+	break;
+    }
+    if (j == nb_block) {
+      memcpy(block[nb_block++], current, BLOCK_LENGTH);
+    }
+    block_index[i] = j;
+  }
+  if (nb_block > UINT8_MAX + 1) {
+    fprintf(stderr, "gen_unicode: too many blocks (%lu)\n", (long unsigned int)nb_block);
+    return 1;
+  }
+
+  printf("/* generated by gen_unicode from %s */\n", argv[1]);
+  printf("#include \"unicode.h\"\n\n");
+  printf("const uint8_t unicode_block[%d] = {", BLOCK_NB);
+  for (i=0; i<BLOCK_NB; i++) {
+    printf("%s%lu,", (i % 16) ? " " : "\n  ", (long unsigned int)block_index[i]);
+  }
+  printf("\n};\n\n");
+  printf("const uint8_t unicode_property[%lu][%d] = {\n", (long unsigned int)nb_block, BLOCK_LENGTH);
+  for (i=0; i<nb_block; i++) {
+    printf("  {");
+    for (j=0; j<BLOCK_LENGTH; j++) {
+      printf("%s%d,", (j % 32) ? "" : "\n    ", block[i][j]);
+    }
+    printf("\n  },\n");
+  }
+  printf("};\n");
+
+  return 0;
+}
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
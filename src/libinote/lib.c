@@ -7,46 +7,27 @@
 #include <stdint.h>
 #include <iconv.h>
 #include <errno.h>
-#include <wctype.h>
 #include <uchar.h>
+#include <time.h>
 #include "inote.h"
+#include "conv.h"
+#include "pool.h"
+#include "allocator.h"
+#include "punct.h"
+#include "scratch.h"
+#include "unicode.h"
+#include "entity.h"
+#include "trace.h"
 #include "debug.h"
 
 #define ICONV_ERROR ((iconv_t)-1)
 #define MAX_INPUT_BYTES 1024
-#define MAX_CHAR32 (TEXT_LENGTH_MAX*sizeof(char32_t))
-#define MAX_PUNCT 50
-#define MAX_TOK 100
 #define MAGIC 0x7E40B171
+#define BATCH_MAGIC 0x7E40B172
 #define TLV_VALUE_LENGTH_THRESHOLD 16
+#define STREAM_PENDING_MAX 8
+#define STREAM_PATTERN_MAX 256 // characters
 
-static const char* charset_name[] = {
-  NULL,
-  "ISO-8859-1//IGNORE",
-  "GBK//IGNORE",
-  "UCS2//IGNORE",
-  "BIG5//IGNORE",
-  "SJIS//IGNORE",
-  "UTF8//IGNORE",
-  "UTF16//IGNORE",
-  "UTF32LE", // UTF32 instead of UTF32LE would add BOM
-};
-#define MAX_CHARSET (sizeof(charset_name)/sizeof(*charset_name))
-
-typedef struct {
-  const char32_t *str;
-  char32_t c;
-  int l;
-} predef_t;
-
-static const predef_t xml_predefined_entity[] = {
-  {U"&quot;", U'"',6},
-  {U"&amp;", U'&',5},
-  {U"&apos;", U'\'',6},
-  {U"&lt;", U'<',4},
-  {U"&gt;", U'>',4},
-};
-#define MAX_ENTITY_NB (sizeof(xml_predefined_entity)/sizeof(xml_predefined_entity[0]))
 
 typedef struct {
   int minor;
@@ -55,18 +36,110 @@ typedef struct {
 } version_t;
 
 #define VERSION_COMPAT_CAPITAL (version_t){1,1,0}
+#define VERSION_COMPAT_TLV_V2 (version_t){1,2,0}
+#define VERSION_COMPAT_SSML (version_t){1,3,0}
+#define VERSION_COMPAT_LANGUAGE (version_t){1,3,0}
+
+// previous character of a text run (capital management)
+enum {SPACE, UPPER_CASE, OTHER_CHAR};
+
+typedef struct {
+  inote_type_t type; // INOTE_TYPE_UNDEFINED if no run
+  int prev_char;
+  int cap_nb; // number of capital letters
+} text_run_t;
+
+/* pattern converted (see observer_t) */
+typedef struct {
+  // position, next: offset of the pattern and of the next one in
+  // the text (in units of the internal buffer, see observer_t)
+  size_t position;
+  size_t next;
+  // new_tlv: true if the conversion of the pattern starts a new tlv
+  // at offset tlv_offset of the tlv message
+  bool new_tlv;
+  size_t tlv_offset;
+  // state and removing_leading_space before the pattern
+  const inote_state_t *state;
+  bool removing_leading_space;
+} pattern_t;
+
+/*
+  observer of the conversion (parallel conversion): called after each
+  pattern converted (and not rolled back by the window logic).
+*/
+typedef struct observer_t {
+  // converted: return true to stop the conversion after this pattern
+  bool (*converted)(struct observer_t *self, const pattern_t *pattern);
+  // base: offset of the converted slice in the text
+  size_t base;
+  // window_offset: offset of the current window in the converted
+  // slice (set by convert_windows)
+  size_t window_offset;
+  // unit: size of a character in the internal buffer
+  size_t unit;
+  // stopped: set to true once converted() returns true
+  bool stopped;
+} observer_t;
+
+/*
+  state carried over between the stream calls: incomplete multibyte
+  sequence which ends the previous call (pending) and pattern (tag,
+  annotation, entity) which may be continued by the next call, in the
+  format of the internal buffer.
+  annotation: the pattern is the beginning of the annotation which
+  stopped the previous call (INOTE_LANGUAGE_SWITCHING), completed by
+  the pending sequence (see inote_stream_take_annotation)
+*/
+typedef struct {
+  inote_charset_t charset;
+  uint8_t pending[STREAM_PENDING_MAX];
+  size_t pending_length;
+  uint8_t pattern[(STREAM_PATTERN_MAX + STREAM_PENDING_MAX)*sizeof(char32_t)];
+  size_t pattern_length;
+  inote_charset_t pattern_charset;
+  bool annotation;
+} stream_t;
 
+/*
+  A handle only keeps its settings and the state carried over between
+  the calls; the internal buffer is in the scratch memory of the call
+  (see scratch.h).
+*/
 typedef struct {
   uint32_t magic;
-  char32_t char32_buf[MAX_CHAR32];
-  iconv_t cd_to_char32[MAX_CHARSET];
-  iconv_t cd_from_char32[MAX_CHARSET];
-  char32_t punctuation_list[MAX_PUNCT];
-  char32_t token[MAX_TOK];
+  // allocator: memory owned by the handle (see
+  // inote_create_with_allocator)
+  allocator_t allocator;
+  // scratch: scratch memory of the current call; attached_scratch:
+  // scratch set by inote_set_scratch (NULL: pool of the thread);
+  // own_scratch: scratch of a handle created with an allocator
+  scratch_t *scratch;
+  scratch_t *attached_scratch;
+  scratch_t *own_scratch;
+  iconv_t cd_to_char32[CONV_MAX_CHARSET];
+  iconv_t cd_from_char32[CONV_MAX_CHARSET];
+  punct_set_t *punctuation_list; // `Pf2 list (NULL if empty)
   // removing_leading_space: true if leading space must still be removed
   // (legacy fix at init for vv in text mode and spaces from the
   // initial and filtered 'gfax)
   bool removing_leading_space;
+  // run:
+  // text run which ends the previous stream call; the first text of
+  // the next call continues it (INOTE_TYPE_UNDEFINED if none)
+  text_run_t run;
+  // language_switching:
+  // annotation which stops the conversion (INOTE_LANGUAGE_SWITCHING),
+  // in the internal buffer
+  const uint8_t *language_switching;
+  // stream: allocated by the first stream call (see stream_t)
+  stream_t *stream;
+  // sink:
+  // if sink.write is set, the tlv blocks are delivered to the sink
+  // (see inote_set_sink)
+  inote_sink_t sink;
+  // observer: NULL except for the parallel conversion
+  observer_t *observer;
   // backward_compatibility:
   // the TLV generated must be compatible with this version.
   version_t backward_compatibility;
@@ -78,17 +151,64 @@ typedef struct {
   // This parameter is significant only if with_feature_capital equals
   // true otherwise it mudt be ignored.
   bool capital_activated; 
+  // with_feature_tlv_v2:
+  // if set to true, the TLV v2 format can be decoded
+  bool with_feature_tlv_v2;
+  // tlv_v2_activated:
+  // If set to true the TLV are generated in v2 format (significant
+  // only if with_feature_tlv_v2 equals true)
+  bool tlv_v2_activated;
+  // with_feature_ssml:
+  // if set to true, the INOTE_TYPE_SSML TLV can be decoded
+  bool with_feature_ssml;
+  // ssml_activated:
+  // If set to true the SSML elements give INOTE_TYPE_SSML TLV
+  // (significant only if with_feature_ssml equals true)
+  bool ssml_activated;
+  // with_feature_language:
+  // if set to true, the INOTE_TYPE_LANGUAGE TLV can be decoded
+  bool with_feature_language;
+  // language_activated:
+  // If set to true the language switching annotations give
+  // INOTE_TYPE_LANGUAGE TLV (significant only if with_feature_language
+  // equals true)
+  bool language_activated;
+  // stats: counters (see inote_get_stats); the time of each stage is
+  // measured if stats_timing equals true
+  inote_stats_t stats;
+  bool stats_timing;
+  // tlv_threshold, tlv_split: chunking policy of the text tlv (see
+  // inote_set_tlv_split)
+  size_t tlv_threshold;
+  inote_split_t tlv_split;
 } inote_t;
 
 typedef struct {
   inote_type_t type;
   inote_slice_t s; // slice on a valid text buffer
+  // examined: end of the characters read since segment_examine()
+  uint8_t *examined;
+  // modified: characters replaced by segment_set_chars() (and their
+  // previous value) since segment_examine()
+  uint8_t *modified;
+  uint8_t saved[ENTITY_VALUE_MAX*sizeof(char32_t)];
+  size_t saved_length;
 } segment_t;
 
 typedef struct {
   inote_slice_t *s;
   inote_tlv_t *header;
   inote_tlv_t *previous_header;
+  const inote_sink_t *sink; // NULL if no sink or once the sink failed
+  bool v2; // TLV v2 format
+  inote_stats_t *stats; // counters of the tlv delivered to the sink
+  // threshold, split: chunking policy of the text tlv (see
+  // inote_set_tlv_split)
+  size_t threshold;
+  inote_split_t split;
+  // closed: the current tlv has been split, the next text starts a
+  // new tlv
+  bool closed;
 } tlv_t;
 
 
@@ -120,8 +240,8 @@ static const char *error_get_string[] = {
     dbg("tlv(previous_header=%p, header(addr=%p, type=%d, length=%d))", \
 	(tlv)->previous_header,						\
 	(tlv)->header,							\
-	(tlv)->header->type,						\
-	(tlv)->header->length);						\
+	inote_tlv_get_type((tlv)->header),				\
+	(int)inote_tlv_get_length((tlv)->header));			\
   }
 
 // TPDP DBG_PRINT_STATE: expected_lang
@@ -139,8 +259,36 @@ const char *inote_error_get_string(inote_error err) {
   return (err < INOTE_ERRNO)? error_get_string[err] : strerror(err-INOTE_ERRNO);
 }
 
+static size_t header_get_size(const inote_tlv_t *self) {
+  return (self->type & INOTE_TLV_V2) ? TLV2_HEADER_LENGTH : TLV_HEADER_LENGTH_MAX;
+}
+
+static void header_set_type(inote_tlv_t *self, inote_type_t type) {
+  self->type = (self->type & INOTE_TLV_V2) | type;
+}
+
+static void header_set_length(inote_tlv_t *self, size_t length) {
+  self->length = length & 0xff;
+  if (self->type & INOTE_TLV_V2) {
+    ((uint8_t*)self)[2] = length >> 8;
+  }
+}
+
 uint8_t *inote_tlv_get_value(const inote_tlv_t *self) {
-  return  self ? (uint8_t *)self + TLV_HEADER_LENGTH_MAX : NULL;
+  return  self ? (uint8_t *)self + header_get_size(self) : NULL;
+}
+
+inote_type_t inote_tlv_get_type(const inote_tlv_t *self) {
+  return  self ? (inote_type_t)(self->type & ~INOTE_TLV_V2) : INOTE_TYPE_UNDEFINED;
+}
+
+size_t inote_tlv_get_length(const inote_tlv_t *self) {
+  if (!self)
+    return 0;
+  if (self->type & INOTE_TLV_V2) {
+    return self->length + (((const uint8_t*)self)[2] << 8);
+  }
+  return self->length;
 }
 
 static size_t min_size(size_t a, size_t b) {
@@ -154,7 +302,7 @@ static bool cb_check(const inote_cb_t *self) {
 static bool slice_check(const inote_slice_t *self) {
   return (self && self->buffer
 	  && (self->buffer + self->length <= self->end_of_buffer)
-	  && (self->charset >= INOTE_CHARSET_UNDEFINED) && (self->charset < MAX_CHARSET));
+	  && (self->charset >= INOTE_CHARSET_UNDEFINED) && (self->charset < CONV_MAX_CHARSET));
 }
 
 static size_t slice_get_free_size(const inote_slice_t *self) {
@@ -179,17 +327,6 @@ static uint8_t *slice_get_free_byte(const inote_slice_t *self) {
   return free_byte;
 }
 
-static uint8_t *slice_get_last_byte(const inote_slice_t *self) {
-  uint8_t *last_byte = NULL;
-  if (self && self->buffer && self->length) {
-    last_byte = self->buffer + self->length -1;
-    if (last_byte >= self->end_of_buffer) {
-      last_byte = NULL;
-    }
-  }
-  return last_byte;
-}
-
 static inote_error segment_init(segment_t *self, const inote_slice_t *text) {
   ENTER();
   inote_error ret = INOTE_ARGS_ERROR;  
@@ -205,23 +342,129 @@ static inote_error segment_init(segment_t *self, const inote_slice_t *text) {
   return ret;
 }
 
-static char32_t *segment_get_buffer(segment_t *self) {
-  char32_t* buffer = NULL;
+static uint8_t *segment_get_buffer(segment_t *self) {
+  uint8_t* buffer = NULL;
   if (self && self->s.buffer) {
-    buffer = (char32_t*)(self->s.buffer);  
+    buffer = self->s.buffer;
     DBG_PRINT_SLICE(&(self->s));
   }
   return buffer;
 }
 
-static char32_t *segment_get_max(segment_t *self) {
-  char32_t* max = NULL;
+static uint8_t *segment_get_max(segment_t *self) {
+  uint8_t* max = NULL;
   if (self && self->s.buffer) {
-    max = (char32_t*)(self->s.end_of_buffer);  
+    max = self->s.end_of_buffer;
   }
   return max;
 }
 
+/*
+  The segment buffer is made of UTF-32 characters or of valid UTF-8
+  sequences (s.charset).
+
+  segment_get_char: return the character at t and set *next (if not
+  NULL) to the following character.
+*/
+static char32_t segment_get_char(segment_t *self, const uint8_t *t, uint8_t **next) {
+  char32_t c;
+  int len = 1;
+
+  if (self->s.charset == INOTE_CHARSET_UTF_32) {
+    c = *(const char32_t*)t;
+    len = sizeof(char32_t);
+  } else if (*t < 0x80) {
+    c = *t;
+  } else if (*t < 0xe0) {
+    c = ((t[0] & 0x1f) << 6) | (t[1] & 0x3f);
+    len = 2;
+  } else if (*t < 0xf0) {
+    c = ((t[0] & 0x0f) << 12) | ((t[1] & 0x3f) << 6) | (t[2] & 0x3f);
+    len = 3;
+  } else {
+    c = ((t[0] & 0x07) << 18) | ((t[1] & 0x3f) << 12) | ((t[2] & 0x3f) << 6) | (t[3] & 0x3f);
+    len = 4;
+  }
+  if (self->examined < t + len) {
+    self->examined = (uint8_t*)t + len;
+  }
+  if (next) {
+    *next = (uint8_t*)t + len;
+  }
+  return c;
+}
+
+/*
+  compare the characters at t to the ascii string str.
+  If they match, return true and set *next (if not NULL) to the
+  character following the pattern.
+*/
+static bool segment_match(segment_t *self, const uint8_t *t, const char *str, uint8_t **next) {
+  const uint8_t *tmax = self->s.end_of_buffer;
+  uint8_t *t1 = (uint8_t*)t;
+
+  for (; *str; str++) {
+    if ((t1 >= tmax) || (segment_get_char(self, t1, &t1) != (uint8_t)*str))
+      return false;
+  }
+  if (next) {
+    *next = t1;
+  }
+  return true;
+}
+
+/*
+  Replace the characters from start to end by the nb characters of c
+  (at most ENTITY_VALUE_MAX); the last characters of c which are
+  longer than the replaced characters are dropped.
+  Return the first byte of c.
+*/
+static uint8_t *segment_set_chars(segment_t *self, uint8_t *start, uint8_t *end, const char32_t *c, size_t nb) {
+  uint8_t *t;
+  if (self->s.charset == INOTE_CHARSET_UTF_32) {
+    nb = min_size(nb, (end - start)/sizeof(char32_t));
+    t = end - nb*sizeof(char32_t);
+    self->modified = t;
+    self->saved_length = end - t;
+    memcpy(self->saved, t, end - t);
+    memcpy(t, c, end - t);
+  } else {
+    uint8_t utf8[ENTITY_VALUE_MAX*sizeof(char32_t)];
+    size_t length;
+    do {
+      char *inbuf = (char*)c;
+      size_t inbytesleft = nb*sizeof(char32_t);
+      char *outbuf = (char*)utf8;
+      size_t outbytesleft = sizeof(utf8);
+      conv_from_char32(INOTE_CHARSET_UTF_8, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+      length = sizeof(utf8) - outbytesleft;
+    } while ((length > (size_t)(end - start)) && --nb);
+    t = end - length;
+    self->modified = t;
+    self->saved_length = end - t;
+    memcpy(self->saved, t, end - t);
+    memcpy(t, utf8, end - t);
+  }
+  return t;
+}
+
+/* 
+   start recording the characters read and the characters replaced
+   from t
+*/
+static void segment_examine(segment_t *self, uint8_t *t) {
+  self->examined = t;
+  self->modified = NULL;
+}
+
+/* restore the characters replaced since segment_examine() */
+static void segment_restore(segment_t *self) {
+  if (self->modified) {
+    memcpy(self->modified, self->saved, self->saved_length);
+    self->modified = NULL;
+  }
+}
+
 static void segment_erase(segment_t *self, uint8_t* buffer) {
   ENTER();
   if (self && (self->s.buffer <= buffer) && (buffer <= self->s.end_of_buffer)) {
@@ -263,6 +506,15 @@ static inote_error tlv_init(tlv_t *self, inote_slice_t *tlv_message) {
   return ret;
 }
 
+// max length of a tlv in the current format
+static size_t tlv_get_length_max(const tlv_t *self) {
+  return self->v2 ? TLV2_LENGTH_MAX : TLV_LENGTH_MAX;
+}
+
+static size_t tlv_get_value_length_max(const tlv_t *self) {
+  return self->v2 ? TLV2_VALUE_LENGTH_MAX : TLV_VALUE_LENGTH_MAX;
+}
+
 static tlv_t *tlv_next(tlv_t *self, inote_type_t type) {
   tlv_t *next = self;
   inote_tlv_t *header;
@@ -279,14 +531,14 @@ static tlv_t *tlv_next(tlv_t *self, inote_type_t type) {
   DBG_PRINT_TLV_HEADER(self);  
   dbg("type=%d", type);
   if (header) {
-    if (header->type == INOTE_TYPE_UNDEFINED) {
-      header->length = 0;
+    if (inote_tlv_get_type(header) == INOTE_TYPE_UNDEFINED) {
+      header_set_length(header, 0);
       goto exit0;
     }
     // if applicable, use the previous tlv
-    if ((type == INOTE_TYPE_TEXT)
-	&& (header->length < TLV_VALUE_LENGTH_MAX-TLV_VALUE_LENGTH_THRESHOLD)) {
-      switch (header->type) {
+    if ((type == INOTE_TYPE_TEXT) && !self->closed
+	&& (inote_tlv_get_length(header) + self->threshold < tlv_get_value_length_max(self))) {
+      switch (inote_tlv_get_type(header)) {
       case INOTE_TYPE_TEXT:
       case INOTE_TYPE_CAPITAL: // "Capital" followed by ":" (a punctuation char which does not have to be spelled)
       case INOTE_TYPE_CAPITALS: // "CAPITAL" followed by ":"
@@ -302,10 +554,11 @@ static tlv_t *tlv_next(tlv_t *self, inote_type_t type) {
   if (free_byte + TLV_LENGTH_MAX <= s->end_of_buffer) {
     self->previous_header = header;
     header = (inote_tlv_t *)free_byte;
-    header->type = type;
-    header->length = 0;
-    s->length += TLV_HEADER_LENGTH_MAX; // used bytes: only header at this stage
+    header->type = type; // v1 header until the value exceeds TLV_VALUE_LENGTH_MAX
+    header_set_length(header, 0);
+    s->length += header_get_size(header); // used bytes: only header at this stage
     self->header = header; // the header of self points on the next tlv
+    self->closed = false;
   } else {
     dbg("out of tlv");
     next = NULL;
@@ -319,7 +572,7 @@ static tlv_t *tlv_next(tlv_t *self, inote_type_t type) {
 static inote_error tlv_add_length(tlv_t *self, uint16_t *length) {
   inote_slice_t *s;
   inote_tlv_t *header;
-  uint8_t len;
+  size_t len, value_length;
   inote_error ret = INOTE_OK;  
 
   if (!self || !self->header || !self->s || !length) {
@@ -336,13 +589,22 @@ static inote_error tlv_add_length(tlv_t *self, uint16_t *length) {
   header = self->header;
   DBG_PRINT_TLV_HEADER(self);    
   dbg("*length=%d", length ? *length : 0);
-  len = min_size(*length, TLV_VALUE_LENGTH_MAX - header->length);
+  len = min_size(*length, tlv_get_value_length_max(self) - inote_tlv_get_length(header));
   if (!len) {
     ret = INOTE_TLV_FULL;
     goto exit0;
   }
+  value_length = inote_tlv_get_length(header) + len;
+  if (!(header->type & INOTE_TLV_V2) && (value_length > TLV_VALUE_LENGTH_MAX)) {
+    // switch to the v2 header: the value is shifted by one byte
+    // (reserved by tlv_get_free_size)
+    uint8_t *value = inote_tlv_get_value(header);
+    memmove(value + 1, value, value_length);
+    header->type |= INOTE_TLV_V2;
+    s->length++;
+  }
   *length -= len;
-  header->length += len;
+  header_set_length(header, value_length);
   self->s->length += len;
 
  exit0:
@@ -353,51 +615,292 @@ static inote_error tlv_add_length(tlv_t *self, uint16_t *length) {
   return ret;
 }
 
+/* current time in nanoseconds if the stages are timed, otherwise 0 */
+static uint64_t stats_get_time(const inote_t *self) {
+  struct timespec ts;
+  if (!self->stats_timing)
+    return 0;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+/* count the tlv of the message by type */
+static void stats_count_tlv(inote_stats_t *self, const uint8_t *buffer, size_t length) {
+  const uint8_t *t = buffer;
+  const uint8_t *tmax = buffer + length;
+  
+  while (t + TLV_HEADER_LENGTH_MAX <= tmax) {
+    const inote_tlv_t *tlv = (const inote_tlv_t*)t;
+    switch (inote_tlv_get_type(tlv)) {
+    case INOTE_TYPE_TEXT:
+      self->tlv_text++;
+      break;
+    case INOTE_TYPE_PUNCTUATION:
+      self->tlv_punctuation++;
+      break;
+    case INOTE_TYPE_ANNOTATION:
+      self->tlv_annotation++;
+      break;
+    case INOTE_TYPE_CAPITAL:
+      self->tlv_capital++;
+      break;
+    case INOTE_TYPE_CAPITALS:
+      self->tlv_capitals++;
+      break;
+    case INOTE_TYPE_SSML:
+      self->tlv_ssml++;
+      break;
+    case INOTE_TYPE_LANGUAGE:
+      self->tlv_language++;
+      break;
+    default:
+      break;
+    }
+    t = inote_tlv_get_value(tlv) + inote_tlv_get_length(tlv);
+  }
+}
+
+/*
+  counters of a conversion which returned ret: the bytes of text
+  processed and the tlv added from offset to the message (the message
+  is not kept on error)
+*/
+static void stats_count_conversion(inote_stats_t *self, inote_error ret, const inote_slice_t *text, size_t text_left, const inote_slice_t *tlv_message, size_t offset, bool sink) {
+  switch (ret) {
+  case INOTE_TLV_MESSAGE_FULL:
+    self->tlv_message_full++;
+    break;
+  case INOTE_LANGUAGE_SWITCHING:
+    self->language_switching++;
+    break;
+  case INOTE_OK:
+    break;
+  default:
+    return;
+  }
+  self->bytes_in += text->length - text_left;
+  if (!sink && (tlv_message->length > offset)) {
+    stats_count_tlv(self, tlv_message->buffer + offset, tlv_message->length - offset);
+  }
+}
+
+/*
+  deliver the tlv block to the sink.
+  If all is false, the current tlv (which may still be extended) is
+  kept and moved to the beginning of the next block.
+*/
+static inote_error tlv_flush(tlv_t *self, bool all) {
+  inote_slice_t *s = self->s;
+  uint8_t current[TLV2_LENGTH_MAX];
+  size_t kept = 0;
+  inote_error ret = INOTE_OK;
+
+  if (!all && self->header) {
+    kept = s->buffer + s->length - (uint8_t*)self->header;
+    memcpy(current, self->header, kept);
+    s->length -= kept;
+  }
+  
+  if (s->length) {
+    trace(INOTE_TRACE_SINK, s->length, kept);
+    if (self->stats) {
+      stats_count_tlv(self->stats, s->buffer, s->length);
+    }
+    ret = self->sink->write(s, self->sink->user_data);
+    if (!ret && (s->buffer + 2*tlv_get_length_max(self) > s->end_of_buffer)) {
+      ret = INOTE_ARGS_ERROR;
+    }
+    if (ret) {
+      dbg("sink error: %s", inote_error_get_string(ret));
+      self->sink = NULL;
+      s->length = 0;
+      self->header = self->previous_header = NULL;
+      return ret;
+    }
+  }
+  
+  memcpy(s->buffer, current, kept);
+  s->length = kept;
+  self->header = kept ? (inote_tlv_t*)s->buffer : NULL;
+  self->previous_header = NULL;
+  return ret;
+}
+
 static uint8_t *tlv_get_free_byte(tlv_t *self) {
   return (self) ? slice_get_free_byte(self->s) : NULL;
 }
 
 // get free size in the current tlv
 static size_t tlv_get_free_size(tlv_t *self) {
-  return (self && self->header) ? TLV_VALUE_LENGTH_MAX - self->header->length : 0;
+  size_t free_size, reserved;
+  if (!self || !self->header)
+    return 0;
+  if (!self->v2)
+    return TLV_VALUE_LENGTH_MAX - inote_tlv_get_length(self->header);
+  
+  // v2: up to the end of the tlv message, minus the byte of the v2
+  // header if the v1 header is still used
+  free_size = slice_get_free_size(self->s);
+  reserved = (self->header->type & INOTE_TLV_V2) ? 0 : 1;
+  if (free_size <= reserved)
+    return 0;
+  return min_size(TLV2_VALUE_LENGTH_MAX - inote_tlv_get_length(self->header),
+		  free_size - reserved);
 }
 
-static inote_error get_charset(const char *tocode, const char *fromcode, iconv_t *cd) {
-  uint32_t ret = 0;
+/* borrow the iconv descriptor from the shared cache if needed */
+static inote_error get_charset(inote_charset_t charset, conv_direction_t direction, iconv_t *cd) {
   if (!cd)
     return INOTE_ARGS_ERROR;
   
-  if (*cd != ICONV_ERROR)
+  if (conv_is_native(charset) || (*cd != ICONV_ERROR))
     return INOTE_OK;
 
-  *cd = iconv_open(tocode, fromcode);
-  if (*cd == ICONV_ERROR) {
-    int status = errno;
-    dbg("Error iconv_open: from %s to %s (%s)", fromcode, tocode, strerror(status));
-    ret = INOTE_CHARSET_ERROR;
+  return conv_cache_get(charset, direction, cd);
+}
+
+/* 
+   iconv() or the built-in converter according to the charset
+*/
+static size_t convert_to_char32(inote_t *self, inote_charset_t charset, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  if (conv_is_native(charset)) {
+    return conv_to_char32(charset, inbuf, inbytesleft, outbuf, outbytesleft);
   }
-  return ret;
+  dbg("iconv");
+  self->stats.iconv_calls++;
+  return iconv(self->cd_to_char32[charset], inbuf, inbytesleft, outbuf, outbytesleft);
+}
+
+static size_t convert_from_char32(inote_t *self, inote_charset_t charset, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  if (conv_is_native(charset)) {
+    return conv_from_char32(charset, inbuf, inbytesleft, outbuf, outbytesleft);
+  }
+  self->stats.iconv_calls++;
+  return iconv(self->cd_from_char32[charset], inbuf, inbytesleft, outbuf, outbytesleft);
+}
+
+/* initialize the iconv state if applicable */
+static void convert_reset(iconv_t *cd, inote_charset_t charset) {
+  if (!conv_is_native(charset)) {
+    iconv(cd[charset], NULL, NULL, NULL, NULL);
+  }
+}
+
+/*
+  same as convert_from_char32(), a character without equivalent in
+  the charset being replaced by its fallback (see conv_get_fallback)
+  instead of being filtered out.
+
+  Single pass: the runs between two replaced characters are
+  converted as is.
+*/
+static size_t convert_from_char32_with_fallback(inote_t *self, inote_charset_t charset, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  const char32_t *end = (const char32_t*)*inbuf + *inbytesleft/sizeof(char32_t);
+  int err = 0;
+
+  if (!conv_has_fallback(charset))
+    return convert_from_char32(self, charset, inbuf, inbytesleft, outbuf, outbytesleft);
+
+  while (*inbytesleft) {
+    const char32_t *c;
+    const char *ascii = NULL;
+    size_t len;
+
+    for (c = (const char32_t*)*inbuf; c < end; c++) {
+      if ((unicode_get_property(*c) & UNICODE_FALLBACK)
+	  && (ascii = conv_get_fallback(charset, *c)))
+	break;
+    }
+
+    if (c != (const char32_t*)*inbuf) {
+      // characters before the fallback
+      size_t left = (end - c)*sizeof(char32_t);
+      size_t status;
+      *inbytesleft -= left;
+      status = convert_from_char32(self, charset, inbuf, inbytesleft, outbuf, outbytesleft);
+      *inbytesleft += left;
+      if (status == (size_t)-1) {
+	if (errno != EILSEQ)
+	  return status;
+	err = errno;
+      }
+    }
+    if (!ascii)
+      break;
+
+    // the fallback is ascii: copied as is in the charset
+    len = strlen(ascii);
+    if (len > *outbytesleft) {
+      errno = E2BIG;
+      return (size_t)-1;
+    }
+    memcpy(*outbuf, ascii, len);
+    *outbuf += len;
+    *outbytesleft -= len;
+    *inbuf += sizeof(char32_t);
+    *inbytesleft -= sizeof(char32_t);
+    self->stats.fallbacks++;
+  }
+
+  if (err) {
+    errno = err;
+    return (size_t)-1;
+  }
+  return 0;
+}
+
+/*
+  convert the segment to the tlv charset (same conventions as iconv).
+
+  A UTF-8 segment is copied as is (the tlv charset is UTF-8 too)
+  without splitting a character.
+*/
+static size_t convert_segment(inote_t *self, segment_t *segment, inote_charset_t charset, char **outbuf, size_t *outbytesleft) {
+  inote_slice_t *s = &segment->s;
+  size_t len;
+
+  if (s->charset == INOTE_CHARSET_UTF_32) {
+    return convert_from_char32_with_fallback(self, charset, (char**)&s->buffer, &s->length, outbuf, outbytesleft);
+  }
+
+  len = min_size(s->length, *outbytesleft);
+  if (len < s->length) {
+    while (len && ((s->buffer[len] & 0xc0) == 0x80)) {
+      len--;
+    }
+  }
+  memcpy(*outbuf, s->buffer, len);
+  *outbuf += len;
+  *outbytesleft -= len;
+  s->buffer += len;
+  s->length -= len;
+  if (s->length) {
+    errno = E2BIG;
+    return (size_t)-1;
+  }
+  return 0;
 }
 
 static inote_error inote_remove_leading_space(inote_t *self, inote_type_t first, segment_t *segment) {
   ENTER();
   inote_error ret = INOTE_OK;  
-  char32_t *t, *t0, *tmax;
+  uint8_t *t, *t0, *tmax, *next;
 
-  t = t0 = segment_get_buffer(segment);
-  tmax = segment_get_max(segment);
   if (!self || !segment) {
     return INOTE_ARGS_ERROR;
   }
 
+  t = t0 = segment_get_buffer(segment);
+  tmax = segment_get_max(segment);
+
   if (first == INOTE_TYPE_TEXT) {
-    while ((t < tmax) && (*t == U' ')) {
-      t++;
+    while ((t < tmax) && (segment_get_char(segment, t, &next) == U' ')) {
+      t = next;
     }
     if (t == tmax)
       goto exit0;
 
-    if (!iswpunct(*t) || (t0 == t)) {
+    if (!unicode_is_punct(segment_get_char(segment, t, NULL)) || (t0 == t)) {
       self->removing_leading_space = false;
     }
   } else {
@@ -409,66 +912,87 @@ static inote_error inote_remove_leading_space(inote_t *self, inote_type_t first,
   }
 
  exit0:
-  segment_erase(segment, (uint8_t*)t);
+  segment_erase(segment, t);
   return ret;
 }
 
 
-/* 
-   convert any wide character equivalent to a quote to the ascii quote
-   character
-   
-   return 0 if no character has been converted
+/*
+  Scan the text from t and compute the number of capital letters
+  (cap_nb) according to these rules:
+
+  - text without punctuation character
+
+  and
+
+  - word with same capitalization, for example:
+    "CAPITAL LETTER": gives text="CAPITAL " + cap_nb=7
+    "capital Letter": text="capital ", cap_nb=0
+
+  - or first word with capital letter and the remaining text as lower case,
+    "Capital letter": text="Capital letter", cap_nb=1
+    "CaPital letter": text="Ca" + cap_nb=1
+
+  - or first word all caps and the remaining text as lower case,
+    "CAPITAL letter": text="CAPITAL letter" + cap_nb=7
+
+  - or text as lower case,
+    "capital letter": text="capital letter", cap_nb=0
+
+  Return the end of the longest text.
 */
-static int convert_quote_to_ascii(wchar_t *buffer, size_t size) {
-  wchar_t *s = buffer;
-  int i;
-  char c = 0;
-
-  for (i=0; i<size/sizeof(wchar_t); i++) {
-    if (s[i]&0x0000ff00) {
-      if ((s[i]&0x0000ff00) == 0x2000) {
-	if (((s[i] >= 0x2018) && (s[i] <= 0x201f))
-	    || (s[i] == 0x2039) || (s[i] == 0x203a)) {
-	  c=s[i]='\'';
-	}
-      } else if ((s[i]&0x0000ff00) == 0x2700) {
-	if (((s[i] >= 0x275b) && (s[i] <= 0x275e))
-	    || (s[i] == 0x276e) || (s[i] == 0x276f)) {
-	  c=s[i]='\'';
-	}
-      } else if ((s[i]&0x0000ff00) == 0xa400) {
-	if ((s[i] >= 0xa404) && (s[i] <= 0xa407)) {
-	  c=s[i]='\'';
-	}
-      } else if ((s[i] == 0x13c9) || (s[i] == 0x13c9)
-		 || (s[i] == 0x235e) || (s[i] == 0x2358) || (s[i] == 0x2359)
-		 || ((s[i] >= 0x301d) && (s[i] <= 0x301f))
-		 || (s[i] == 0xff02)) {
-	c=s[i]='\'';
+static uint8_t *text_scan(inote_t *self, segment_t *segment, uint8_t *t, text_run_t *run) {
+  uint8_t *tmax = segment_get_max(segment);
+  uint8_t *next;
+
+  for (; t < tmax; t = next) {
+    char32_t c = segment_get_char(segment, t, &next);
+    if (unicode_is_punct(c))
+      break;
+
+    if (unicode_is_blank(c)) {
+      run->prev_char = SPACE;
+      continue;
+    }
+
+    if (self->capital_activated && unicode_is_upper(c)) {
+      dbg("uppercase");
+      if (run->prev_char != UPPER_CASE) {
+	// for examples, "CaPital letter" gives "Ca"  
+	// or "CAPITAL LETTER" gives "CAPITAL "
+	break;
       }
-    } else if ((s[i] == 0xe0022) || (s[i] == 0xab) || (s[i] == 0xbb)) {
-      c=s[i]='\'';
+      run->cap_nb++;
+    } else {
+      run->prev_char = OTHER_CHAR;
     }
   }
-  return c;
+  return t;
 }
 
+/* position after the last blank from t to tmax, NULL if none */
+static uint8_t *text_get_word_end(segment_t *segment, uint8_t *t, uint8_t *tmax) {
+  uint8_t *end = NULL;
+  uint8_t *next;
+
+  for (; t < tmax; t = next) {
+    if (unicode_is_blank(segment_get_char(segment, t, &next)))
+      end = next;
+  }
+  return end;
+}
 
 static inote_error inote_push_text(inote_t *self, inote_type_t first, segment_t *segment, inote_state_t *state, tlv_t *tlv) {
   ENTER();
-  char *outbuf0, *outbuf;
-  size_t outbytesleft, outbytesleft0, max_outbytesleft = 0;
-  char *inbuf0;
-  size_t inbytes0;  
+  char *outbuf;
+  size_t outbytesleft, max_outbytesleft = 0;
   inote_error ret = INOTE_ARGS_ERROR;
   int status;
   int err = 0;
-  char32_t *t, *t0, *tmax;
-  int cap_nb = 0;
-  enum {SPACE, UPPER_CASE, OTHER_CHAR};
-  int prev_char = SPACE;
-  wctype_t upper = wctype("upper");
+  uint8_t *t, *t0, *tmax = NULL;
+  char32_t c;
+  text_run_t run = {INOTE_TYPE_UNDEFINED, SPACE, 0};
+  uint64_t encode_start = 0;
 
   if (!self || !segment || !tlv) {
     goto exit0;
@@ -480,156 +1004,135 @@ static inote_error inote_push_text(inote_t *self, inote_type_t first, segment_t
   }
 
   t = t0 = segment_get_buffer(segment);
+  if (t0 >= segment_get_max(segment)) {
+    // already consumed (e.g. by the punctuation tlv which failed)
+    ret = INOTE_OK;
+    goto exit0;
+  }
   tmax = segment_get_max(segment);
 
-  inoteDebugDump("t=", (uint8_t*)t, 20);
+  dump("t=", t, 20);
 
-  dbg("First: %d, capital_activated=%d, upper=%d, (self=%p)", first, self->capital_activated, iswctype(*t, upper), self);
-  
-  if (first == INOTE_TYPE_TEXT) {
-    if (self->capital_activated && iswctype(*t, upper)) {
-      first = INOTE_TYPE_CAPITAL;
-      cap_nb = 1;
-      prev_char = UPPER_CASE;
-      dbg("First char: uppercase");
-    } else if (!iswblank(*(t-1))) {
-      prev_char = OTHER_CHAR;
-    }	
+  if ((first == INOTE_TYPE_TEXT) && self->run.type) {
+    // the text continues the run which ended the previous stream call
+    run = self->run;
+    t = text_scan(self, segment, t0, &run);
+    if (t > t0) {
+      first = run.type;
+    } else {
+      run.prev_char = SPACE;
+      run.cap_nb = 0;
+    }
   }
-  
-  // the first char is considered as text
-  t++;
+  self->run.type = INOTE_TYPE_UNDEFINED;
 
-  tlv = tlv_next(tlv, first);
-  if (!tlv) {
-    ret = INOTE_TLV_MESSAGE_FULL;
-    goto exit0;
-  }
+  if (t == t0) {
+    // the first char is considered as text
+    c = segment_get_char(segment, t, &t);
 
-  if (first == INOTE_TYPE_ANNOTATION) {
-    while (t < tmax) {
-      if (*t == U' ') {
-	t++; // include trailing white space
-	break;
+    dbg("First: %d, capital_activated=%d, upper=%d, (self=%p)", first, self->capital_activated, unicode_is_upper(c), self);
+  
+    if (first == INOTE_TYPE_TEXT) {
+      if (self->capital_activated && unicode_is_upper(c)) {
+	first = INOTE_TYPE_CAPITAL;
+	run.cap_nb = 1;
+	run.prev_char = UPPER_CASE;
+	dbg("First char: uppercase");
       }
-      t++;
     }
-  } else {
-    // retrieve the longest text and compute the number of capital
-    // letters (cap_nb) according to these rules:
-    //
-    // - text without punctuation character
-    //
-    // and
-    //
-    // - word with same capitalization, for example:
-    //   "CAPITAL LETTER": gives text="CAPITAL " + cap_nb=7
-    //   "capital Letter": text="capital ", cap_nb=0
-    //
-    // - or first word with capital letter and the remaining text as lower case,
-    //   "Capital letter": text="Capital letter", cap_nb=1
-    //   "CaPital letter": text="Ca" + cap_nb=1
-    //
-    // - or first word all caps and the remaining text as lower case,
-    //   "CAPITAL letter": text="CAPITAL letter" + cap_nb=7
-    //
-    // - or text as lower case,
-    //   "capital letter": text="capital letter", cap_nb=0
-    //
-
-    for (; (t < tmax) && !iswpunct(*t); t++) {      
-      if (iswblank(*t)) {
-	prev_char = SPACE;
-	continue;
-      }
 
-      if (self->capital_activated && iswctype(*t, upper)) {
-	dbg("uppercase");
-	if (prev_char != UPPER_CASE) {
-	  // for examples, "CaPital letter" gives "Ca"  
-	  // or "CAPITAL LETTER" gives "CAPITAL "
-	  break;
+    if (first == INOTE_TYPE_ANNOTATION) {
+      while (t < tmax) {
+	if (segment_get_char(segment, t, &t) == U' ') {
+	  break; // include trailing white space
 	}
-	cap_nb++;
-      } else {
-	prev_char = OTHER_CHAR;
       }
+    } else {
+      // retrieve the longest text
+      t = text_scan(self, segment, t, &run);
     }
   }
 
-  if (cap_nb > 1) {
-    tlv->header->type = INOTE_TYPE_CAPITALS;
+  tlv = tlv_next(tlv, first);
+  if (!tlv) {
+    ret = INOTE_TLV_MESSAGE_FULL;
+    goto exit0;
+  }
+
+  if (run.cap_nb > 1) {
+    header_set_type(tlv->header, INOTE_TYPE_CAPITALS);
   }
   
-  segment->s.length = inbytes0 = (uint8_t*)t - (uint8_t*)t0;
-  outbuf = outbuf0 = (char*)tlv_get_free_byte(tlv);
-  max_outbytesleft = outbytesleft = outbytesleft0 = tlv_get_free_size(tlv);
-  inbuf0 = (char*)segment->s.buffer;
+  segment->s.length = t - t0;
+  outbuf = (char*)tlv_get_free_byte(tlv);
+  max_outbytesleft = outbytesleft = tlv_get_free_size(tlv);
 
   dbg("iconv1");
-  status = iconv(self->cd_from_char32[tlv->s->charset],
-		 (char**)&segment->s.buffer, &segment->s.length,
-		 &outbuf, &outbytesleft);
+  encode_start = stats_get_time(self);
+  status = convert_segment(self, segment, tlv->s->charset, &outbuf, &outbytesleft);
 
   if (status == -1) {
     err = errno;
     dbg("iconv1: err=%s", strerror(err));
   }
   
-  if (!status || (err == E2BIG)) {
+  if (!status || (err == E2BIG) || (err == EILSEQ)) {
+    /* 
+       EILSEQ:
+       occur (even with //IGNORE) if a wide character has no
+       equivalent in the destination charset (e.g. latin1) nor
+       fallback: it has been filtered out, the buffer is returned.
+    */
     uint16_t length = max_outbytesleft - outbytesleft;
+    if (err == EILSEQ) {
+      err = 0;
+    }
+    if ((err == E2BIG) && (tlv->split == INOTE_SPLIT_WORD)
+	&& ((first == INOTE_TYPE_TEXT) || (first == INOTE_TYPE_CAPITAL) || (first == INOTE_TYPE_CAPITALS))) {
+      // split after the last blank which fits, or start the next tlv
+      // with the word if the tlv is continued
+      uint8_t *end = text_get_word_end(segment, t0, segment_get_buffer(segment));
+      tlv->closed = true;
+      err = 0;
+      convert_reset(self->cd_from_char32, tlv->s->charset);
+      if (!end && inote_tlv_get_length(tlv->header)) {
+	segment->s.buffer = t0;
+	segment->s.length = 0;
+	ret = INOTE_OK;
+	goto exit0;
+      }
+      if (end) {
+	segment->s.buffer = t0;
+	segment->s.length = end - t0;
+	outbuf = (char*)tlv_get_free_byte(tlv);
+	outbytesleft = max_outbytesleft;
+	convert_segment(self, segment, tlv->s->charset, &outbuf, &outbytesleft);
+	length = max_outbytesleft - outbytesleft;
+      }
+    }
     ret = tlv_add_length(tlv, &length);
-  } else if (err != EILSEQ) {
+  } else {
     /* 
        EINVAL: 
        incomplete multibyte sequence in the input:
        unexpected error, complete sequences are expected
     */
     goto exit0;
-  } else {
-    /* 
-       EILSEQ:
-       invalid multibyte sequence in the input:
-       occur (even with //IGNORE) if a wide character has no
-       equivalent in the destination charset (e.g. latin1).
-
-       The wide character is replaced if possible by an ascii quote or
-       is filtered out (iconv + //IGNORE)
-    */
-    if (!convert_quote_to_ascii((wchar_t*)inbuf0, inbytes0)) {
-      // no replaced character: return the filtered buffer
-      uint16_t length = max_outbytesleft - outbytesleft;
-      err = 0;
-      ret = tlv_add_length(tlv, &length);
-      goto exit0;
-    }
-
-    // replay iconv using the new buffer
-    segment->s.buffer = inbuf0;
-    segment->s.length = inbytes0;
-    outbuf = outbuf0;
-    outbytesleft = outbytesleft0;
-    dbg("iconv2");      
-    status = iconv(self->cd_from_char32[tlv->s->charset],
-		   (char**)&segment->s.buffer, &segment->s.length,
-		   &outbuf, &outbytesleft);
-
-    if (status == -1) {
-      err = errno;
-      dbg("iconv2: err=%s", strerror(err));      
-    }
-    
-    if (!status || (err == E2BIG) || (err == EILSEQ)) {
-      // return the whole buffer even in case of filtered characters
-      uint16_t length = max_outbytesleft - outbytesleft;
-      ret = tlv_add_length(tlv, &length);
-    } else {
-      goto exit0;
-    }
   }
-  iconv(self->cd_from_char32[tlv->s->charset], NULL, NULL, NULL, NULL);
+  if (segment->s.charset == INOTE_CHARSET_UTF_32) {
+    convert_reset(self->cd_from_char32, tlv->s->charset);
+  }
 
  exit0:
+  if (encode_start) {
+    self->stats.encode_ns += stats_get_time(self) - encode_start;
+  }
+  if (!ret && tmax && (segment_get_buffer(segment) == tmax)
+      && ((first == INOTE_TYPE_TEXT) || (first == INOTE_TYPE_CAPITAL) || (first == INOTE_TYPE_CAPITALS))) {
+    // end of text: the run may be continued by the next stream call
+    run.type = inote_tlv_get_type(tlv->header);
+    self->run = run;
+  }
   if (err) {
     dbg("unexpected error: %s", strerror(err));
   }
@@ -637,30 +1140,388 @@ static inote_error inote_push_text(inote_t *self, inote_type_t first, segment_t
   return ret;
 }
 
-/* TODO: ssml parser */
-/* Currently any complete tag is simply filtered */
-static inote_error inote_push_tag(inote_t *self, segment_t *segment, inote_state_t *state, tlv_t *tlv) {
-  ENTER();
-  char32_t *t, *tmax;
-  int ret = INOTE_UNPROCESSED;
+/*
+  SSML elements giving an INOTE_TYPE_SSML tlv (see
+  inote_enable_ssml_tlv); the other tags are filtered out.
+*/
+#define SSML_NAME_MAX 16
+#define SSML_ATTRIBUTE_MAX 3
+#define SSML_BREAK_DEFAULT 500 // ms (medium)
 
-  if (!state->ssml)
-    return INOTE_UNPROCESSED;
+typedef struct {
+  const char *name;
+  inote_ssml_t start; // tlv of the start tag
+  inote_ssml_t end; // tlv of the end tag, INOTE_SSML_UNDEFINED for an empty element
+  const char *attribute[SSML_ATTRIBUTE_MAX]; // attributes copied to the tlv
+} ssml_element_t;
 
-  if (!self || !segment || !tlv) {
-    dbg("INOTE_ARGS_ERROR");
-    return INOTE_ARGS_ERROR;
+static const ssml_element_t ssml_element[] = {
+  {"break", INOTE_SSML_BREAK, INOTE_SSML_UNDEFINED, {"time", "strength"}},
+  {"lang", INOTE_SSML_LANG, INOTE_SSML_LANG_END, {"xml:lang"}},
+  {"mark", INOTE_SSML_MARK, INOTE_SSML_UNDEFINED, {"name"}},
+  {"prosody", INOTE_SSML_PROSODY, INOTE_SSML_PROSODY_END, {"rate", "pitch", "volume"}},
+  {"say-as", INOTE_SSML_SAY_AS, INOTE_SSML_SAY_AS_END, {"interpret-as", "format", "detail"}},
+  {"voice", INOTE_SSML_VOICE, INOTE_SSML_VOICE_END, {"name", "gender", "xml:lang"}},
+};
+
+#define SSML_ELEMENT_NB (sizeof(ssml_element)/sizeof(*ssml_element))
+
+// duration of a break without time attribute
+static const struct {
+  const char *name;
+  uint32_t ms;
+} ssml_strength[] = {
+  {"none", 0},
+  {"x-weak", 100},
+  {"weak", 250},
+  {"medium", 500},
+  {"strong", 1000},
+  {"x-strong", 2000},
+};
+
+// step of the tokenizer of a tag
+typedef enum {
+  SSML_STEP_NAME, // element name
+  SSML_STEP_SPACE, // before an attribute
+  SSML_STEP_ATTRIBUTE, // attribute name
+  SSML_STEP_EQUAL, // '=' expected
+  SSML_STEP_QUOTE, // quoted value expected
+  SSML_STEP_VALUE, // attribute value
+  SSML_STEP_SKIP, // the remaining characters are ignored
+} ssml_step_t;
+
+typedef struct {
+  ssml_step_t step;
+  const ssml_element_t *element; // NULL if unknown
+  bool end_tag; // </name>
+  bool empty; // <name/>
+  char name[SSML_NAME_MAX]; // element or attribute name being read
+  size_t name_length; // SSML_NAME_MAX+1 if too long
+  int attribute; // attribute being read (index in element), -1 if ignored
+  char32_t quote;
+  // c: characters of the attribute values (a tlv value has at most
+  // TLV_VALUE_LENGTH_MAX bytes)
+  char32_t c[TLV_VALUE_LENGTH_MAX];
+  size_t nb_char;
+  // offset and length in c of the value of each attribute (found: the
+  // value has been read)
+  size_t offset[SSML_ATTRIBUTE_MAX];
+  size_t value_length[SSML_ATTRIBUTE_MAX];
+  bool found[SSML_ATTRIBUTE_MAX];
+} ssml_tag_t;
+
+static bool ssml_is_blank(char32_t c) {
+  return (c == U' ') || (c == U'\t') || (c == U'\n') || (c == U'\r');
+}
+
+static void ssml_add_name(ssml_tag_t *self, char32_t c) {
+  if ((self->name_length < SSML_NAME_MAX) && (c < 0x80)) {
+    self->name[self->name_length++] = (char)c;
+  } else {
+    self->name_length = SSML_NAME_MAX+1;
+  }
+}
+
+static bool ssml_is_name(const ssml_tag_t *self, const char *name) {
+  return (self->name_length == strlen(name)) && !memcmp(self->name, name, self->name_length);
+}
+
+/* the element name has been read */
+static void ssml_set_element(ssml_tag_t *self) {
+  size_t i;
+  for (i=0; i<SSML_ELEMENT_NB; i++) {
+    if (ssml_is_name(self, ssml_element[i].name)) {
+      self->element = ssml_element + i;
+      break;
+    }
+  }
+  // no attribute expected for an end tag
+  self->step = (self->element && !self->end_tag) ? SSML_STEP_SPACE : SSML_STEP_SKIP;
+}
+
+/* append c to the attribute value; the attribute is dropped if it does not fit */
+static void ssml_add_value(ssml_tag_t *self, char32_t c) {
+  if (self->attribute < 0)
+    return;
+  if (self->nb_char < TLV_VALUE_LENGTH_MAX) {
+    self->c[self->nb_char++] = c;
+  } else {
+    self->nb_char = self->offset[self->attribute];
+    self->attribute = -1;
+  }
+}
+
+/* the attribute name has been read: its value is expected */
+static void ssml_set_attribute(ssml_tag_t *self) {
+  const char *name;
+  int i;
+  self->attribute = -1;
+  for (i=0; (i<SSML_ATTRIBUTE_MAX) && (name = self->element->attribute[i]); i++) {
+    if (ssml_is_name(self, name)) {
+      self->attribute = i;
+      break;
+    }
+  }
+  self->step = SSML_STEP_QUOTE;
+}
+
+static void ssml_start_value(ssml_tag_t *self) {
+  self->step = SSML_STEP_VALUE;
+  if (self->attribute >= 0) {
+    self->offset[self->attribute] = self->nb_char;
+  }
+}
+
+static void ssml_end_value(ssml_tag_t *self) {
+  if (self->attribute >= 0) {
+    self->value_length[self->attribute] = self->nb_char - self->offset[self->attribute];
+    self->found[self->attribute] = true;
+  }
+  self->step = SSML_STEP_SPACE;
+}
+
+/* process the character c of a tag ('<' excluded, up to '>' excluded) */
+static void ssml_tag_step(ssml_tag_t *self, char32_t c) {
+  switch (self->step) {
+  case SSML_STEP_NAME:
+    if ((c == U'/') && !self->name_length && !self->end_tag) {
+      self->end_tag = true;
+    } else if (ssml_is_blank(c) || (c == U'/')) {
+      self->empty = (c == U'/');
+      ssml_set_element(self);
+    } else {
+      ssml_add_name(self, c);
+    }
+    break;
+  case SSML_STEP_SPACE:
+    if (c == U'/') {
+      self->empty = true;
+    } else if (!ssml_is_blank(c)) {
+      self->name_length = 0;
+      ssml_add_name(self, c);
+      self->step = SSML_STEP_ATTRIBUTE;
+    }
+    break;
+  case SSML_STEP_ATTRIBUTE:
+    if (c == U'=') {
+      ssml_set_attribute(self);
+    } else if (ssml_is_blank(c)) {
+      self->step = SSML_STEP_EQUAL;
+    } else {
+      ssml_add_name(self, c);
+    }
+    break;
+  case SSML_STEP_EQUAL:
+    if (c == U'=') {
+      ssml_set_attribute(self);
+    } else if (!ssml_is_blank(c)) {
+      // attribute without value: next attribute
+      self->name_length = 0;
+      ssml_add_name(self, c);
+      self->step = SSML_STEP_ATTRIBUTE;
+    }
+    break;
+  case SSML_STEP_QUOTE:
+    if ((c == U'"') || (c == U'\'')) {
+      self->quote = c;
+      ssml_start_value(self);
+    } else if (!ssml_is_blank(c)) {
+      self->step = SSML_STEP_SKIP; // unquoted value
+    }
+    break;
+  case SSML_STEP_VALUE:
+    if (c == self->quote) {
+      ssml_end_value(self);
+    } else {
+      ssml_add_value(self, c);
+    }
+    break;
+  default:
+    break;
+  }
+}
+
+/* true if the characters from t to tmax are the ASCII string s */
+static bool ssml_is_string(const char32_t *t, const char32_t *tmax, const char *s) {
+  for (; (t < tmax) && *s; t++, s++) {
+    if (*t != (unsigned char)*s)
+      return false;
+  }
+  return (t == tmax) && !*s;
+}
+
+/*
+  duration of the break: "250ms", "1.5s",... otherwise from the
+  strength attribute
+*/
+static uint32_t ssml_get_break_duration(const ssml_tag_t *self) {
+  const char32_t *t = self->c + self->offset[0];
+  const char32_t *tmax = t + self->value_length[0];
+  uint64_t n = 0, scale = 1; // duration: n/scale
+  bool digit = false;
+  size_t i;
+
+  if (self->found[0]) {
+    for (; (t < tmax) && (*t >= U'0') && (*t <= U'9'); t++, digit = true) {
+      n = min_size(n*10 + (*t - U'0'), UINT32_MAX);
+    }
+    if ((t < tmax) && (*t == U'.')) {
+      for (t++; (t < tmax) && (*t >= U'0') && (*t <= U'9'); t++, digit = true) {
+	if (scale < 1000000) {
+	  n = n*10 + (*t - U'0');
+	  scale *= 10;
+	}
+      }
+    }
+    if (digit && ssml_is_string(t, tmax, "ms"))
+      return n/scale;
+    if (digit && ssml_is_string(t, tmax, "s"))
+      return min_size(n*1000/scale, UINT32_MAX);
+  }
+
+  if (self->found[1]) {
+    t = self->c + self->offset[1];
+    tmax = t + self->value_length[1];
+    for (i=0; i<sizeof(ssml_strength)/sizeof(*ssml_strength); i++) {
+      if (ssml_is_string(t, tmax, ssml_strength[i].name))
+	return ssml_strength[i].ms;
+    }
+  }
+  return SSML_BREAK_DEFAULT;
+}
+
+/*
+  append the nb characters c to value (length bytes) in the tlv
+  charset, preceded by their length in bytes. Return false if they do
+  not fit.
+*/
+static bool ssml_add_string(inote_t *self, inote_charset_t charset, const char32_t *c, size_t nb, uint8_t *value, size_t *length) {
+  char *inbuf = (char*)c;
+  size_t inbytesleft = nb*sizeof(char32_t);
+  char *outbuf;
+  size_t outbytesleft;
+  size_t status;
+
+  if (*length >= TLV_VALUE_LENGTH_MAX)
+    return false;
+  outbuf = (char*)value + *length + 1;
+  outbytesleft = TLV_VALUE_LENGTH_MAX - *length - 1;
+  // as in a text tlv, a character without equivalent in the charset
+  // is replaced by its fallback or filtered out
+  status = convert_from_char32_with_fallback(self, charset, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+  convert_reset(self->cd_from_char32, charset);
+  if ((status == (size_t)-1) && (errno != EILSEQ))
+    return false;
+  value[*length] = (uint8_t*)outbuf - value - *length - 1;
+  *length = (uint8_t*)outbuf - value;
+  return true;
+}
+
+/* append the attribute i of the tag to value; dropped if it does not fit */
+static void ssml_add_attribute(inote_t *self, inote_charset_t charset, const ssml_tag_t *tag, int i, uint8_t *value, size_t *length) {
+  const char *name = tag->element->attribute[i];
+  char32_t name32[SSML_NAME_MAX];
+  size_t start = *length;
+  size_t n;
+
+  for (n=0; name[n]; n++) {
+    name32[n] = (unsigned char)name[n];
+  }
+  if (!ssml_add_string(self, charset, name32, n, value, length)
+      || !ssml_add_string(self, charset, tag->c + tag->offset[i], tag->value_length[i], value, length)) {
+    *length = start;
+  }
+}
+
+/* add the INOTE_TYPE_SSML tlv of the tag, if any */
+static inote_error ssml_add_tlv(inote_t *self, const ssml_tag_t *tag, tlv_t *tlv) {
+  uint8_t value[TLV_VALUE_LENGTH_MAX];
+  size_t length = 1;
+  inote_ssml_t ssml;
+  uint16_t tlv_length;
+  uint32_t ms;
+  int i;
+
+  if (!tag->element)
+    return INOTE_OK;
+  ssml = tag->end_tag ? tag->element->end : tag->element->start;
+  if (!ssml || (tag->empty && tag->element->end))
+    return INOTE_OK;
+
+  value[0] = ssml;
+  if (ssml == INOTE_SSML_BREAK) {
+    ms = ssml_get_break_duration(tag);
+    value[1] = ms & 0xff;
+    value[2] = (ms >> 8) & 0xff;
+    value[3] = (ms >> 16) & 0xff;
+    value[4] = ms >> 24;
+    length = 5;
+  } else {
+    for (i=0; (i<SSML_ATTRIBUTE_MAX) && tag->element->attribute[i]; i++) {
+      if (tag->found[i]) {
+	ssml_add_attribute(self, tlv->s->charset, tag, i, value, &length);
+      }
+    }
+  }
+
+  tlv = tlv_next(tlv, INOTE_TYPE_SSML);
+  if (!tlv)
+    return INOTE_TLV_MESSAGE_FULL;
+  memcpy(tlv_get_free_byte(tlv), value, length);
+  tlv_length = length;
+  return tlv_add_length(tlv, &tlv_length);
+}
+
+/*
+  SSML tag: tokenized in one pass up to the first '>', without
+  allocation. If enabled, the SSML elements give an INOTE_TYPE_SSML
+  tlv; the tag is filtered out.
+*/
+static inote_error inote_push_tag(inote_t *self, segment_t *segment, inote_state_t *state, tlv_t *tlv) {
+  ENTER();
+  uint8_t *t, *tmax;
+  ssml_tag_t tag;
+  char32_t c;
+  int ret = INOTE_UNPROCESSED;
+
+  if (!state->ssml)
+    return INOTE_UNPROCESSED;
+
+  if (!self || !segment || !tlv) {
+    dbg("INOTE_ARGS_ERROR");
+    return INOTE_ARGS_ERROR;
   }
 
   t = segment_get_buffer(segment);
   tmax = segment_get_max(segment);
-  while ((t < tmax) && (*t != U'>')) {
-    t++;
+  segment_get_char(segment, t, &t); // '<'
+  if (self->ssml_activated) {
+    tag.step = SSML_STEP_NAME;
+    tag.element = NULL;
+    tag.end_tag = tag.empty = false;
+    tag.name_length = 0;
+    tag.attribute = -1;
+    tag.nb_char = 0;
+    memset(tag.found, 0, sizeof(tag.found));
   }
-
-  if (*t == U'>') {
-    segment_erase(segment, (uint8_t*)(t+1));
-    ret = INOTE_OK;
+  while (t < tmax) {
+    c = segment_get_char(segment, t, &t);
+    if (c == U'>') {
+      if (self->ssml_activated) {
+	if (tag.step == SSML_STEP_NAME) {
+	  ssml_set_element(&tag);
+	}
+	ret = ssml_add_tlv(self, &tag, tlv);
+	if (ret)
+	  break;
+      }
+      segment_erase(segment, t);
+      ret = INOTE_OK;
+      break;
+    }
+    if (self->ssml_activated) {
+      ssml_tag_step(&tag, c);
+    }
   }
   
   return ret;
@@ -669,7 +1530,7 @@ static inote_error inote_push_tag(inote_t *self, segment_t *segment, inote_state
 static inote_error inote_push_punct(inote_t *self, segment_t *segment, inote_state_t *state, tlv_t *tlv) {
   ENTER();
   int ret = 0;
-  char32_t *t, *tmax;
+  uint8_t *t, *tmax;
   bool signal_punctuation = false;
   
   if (!self || !segment || !tlv) {
@@ -681,15 +1542,8 @@ static inote_error inote_push_punct(inote_t *self, segment_t *segment, inote_sta
   tmax = segment_get_max(segment);
   
   switch (state->punct_mode) {
-  case INOTE_PUNCT_MODE_SOME: {
-    int i;
-    for (i=0; i<MAX_PUNCT && self->punctuation_list[i]; i++) {
-      if (self->punctuation_list[i] == *t) {
-	signal_punctuation = true;
-	break;
-      }
-    }
-  }	  
+  case INOTE_PUNCT_MODE_SOME:
+    signal_punctuation = punct_set_has(self->punctuation_list, segment_get_char(segment, t, NULL));
     break;
   case INOTE_PUNCT_MODE_ALL:
     signal_punctuation = true;
@@ -708,10 +1562,145 @@ static inote_error inote_push_punct(inote_t *self, segment_t *segment, inote_sta
   return ret;
 }
 
+/*
+  set the punctuation list from the characters between t and tmax;
+  the set is rebuilt only if the list changes
+*/
+static inote_error set_punctuation_list(inote_t *self, segment_t *segment, uint8_t *t, uint8_t *tmax) {
+  punct_set_t *set = self->punctuation_list;
+  uint8_t *next;
+  size_t len = 0;
+  bool same = true;
+
+  for (next = t; next < tmax; len++) {
+    char32_t c = segment_get_char(segment, next, &next);
+    same = same && set && (len < set->length) && (set->list[len] == c);
+  }
+  if (same && (len == (set ? set->length : 0)))
+    return INOTE_OK;
+
+  set = NULL;
+  if (len) {
+    set = punct_set_new(len, &self->allocator);
+    if (!set)
+      return INOTE_ERRNO + ENOMEM;
+    while (t < tmax) {
+      punct_set_add(set, segment_get_char(segment, t, &t));
+    }
+  }
+  punct_set_unref(self->punctuation_list);
+  self->punctuation_list = set;
+  return INOTE_OK;
+}
+
+/* value of the hexadecimal or decimal digit d, -1 if d is not a digit */
+static int get_digit(char32_t d, int base) {
+  int value = -1;
+  if ((d >= U'0') && (d <= U'9')) {
+    value = d - U'0';
+  } else if ((d >= U'a') && (d <= U'f')) {
+    value = d - U'a' + 10;
+  } else if ((d >= U'A') && (d <= U'F')) {
+    value = d - U'A' + 10;
+  }
+  return (value < base) ? value : -1;
+}
+
+/*
+  language of the annotation from t to tmax: "0x10000", "65536" or
+  "1.0" (dialect: major << 16 | minor).
+  Return false if the language is invalid.
+*/
+static bool segment_get_language(segment_t *segment, uint8_t *t, uint8_t *tmax, uint32_t *lang) {
+  uint64_t value = 0, major = 0;
+  size_t nb = 0; // digits of the current number
+  int base = 10;
+  int digit;
+  bool dialect = false;
+
+  if (segment_match(segment, t, "0x", &t) || segment_match(segment, t, "0X", &t)) {
+    base = 16;
+  }
+  while (t < tmax) {
+    char32_t c = segment_get_char(segment, t, &t);
+    if ((c == U'.') && (base == 10) && nb && !dialect) {
+      dialect = true;
+      major = value;
+      value = 0;
+      nb = 0;
+      continue;
+    }
+    digit = get_digit(c, base);
+    if (digit < 0)
+      return false;
+    value = value*base + digit;
+    if (value > (dialect ? UINT16_MAX : UINT32_MAX))
+      return false;
+    nb++;
+  }
+  if (!nb || (dialect && (major > UINT16_MAX)))
+    return false;
+  *lang = dialect ? (uint32_t)(major << 16 | value) : (uint32_t)value;
+  return true;
+}
+
+static bool state_is_expected_lang(const inote_state_t *state, uint32_t lang) {
+  uint32_t i;
+  if (!state->expected_lang)
+    return false;
+  for (i=0; i<state->max_expected_lang; i++) {
+    if (state->expected_lang[i] == lang)
+      return true;
+  }
+  return false;
+}
+
+/*
+  language switching annotation: if enabled and expected, the
+  language gives an INOTE_TYPE_LANGUAGE tlv and the conversion goes
+  on (otherwise see inote_push_annotation).
+*/
+static inote_error inote_push_language(inote_t *self, segment_t *segment, inote_state_t *state, tlv_t *tlv) {
+  ENTER();
+  uint8_t *t, *tmax, *value, *next;
+  uint8_t *v;
+  uint32_t lang;
+  uint16_t length = sizeof(lang);
+  inote_error ret;
+
+  if (!state->annotation || !self->language_activated)
+    return INOTE_UNPROCESSED;
+
+  t = segment_get_buffer(segment);
+  tmax = segment_get_max(segment);
+  if (!segment_match(segment, t, "`l", &value))
+    return INOTE_UNPROCESSED;
+  for (t = value; (t < tmax) && (segment_get_char(segment, t, &next) != U' '); t = next);
+  if ((t >= tmax) || !segment_get_language(segment, value, t, &lang)
+      || !state_is_expected_lang(state, lang))
+    return INOTE_UNPROCESSED;
+
+  tlv = tlv_next(tlv, INOTE_TYPE_LANGUAGE);
+  if (!tlv)
+    return INOTE_TLV_MESSAGE_FULL;
+  v = tlv_get_free_byte(tlv);
+  v[0] = lang & 0xff;
+  v[1] = (lang >> 8) & 0xff;
+  v[2] = (lang >> 16) & 0xff;
+  v[3] = lang >> 24;
+  ret = tlv_add_length(tlv, &length);
+  if (ret)
+    return ret;
+
+  dbg("language switching: %x", lang);
+  state->lang = lang;
+  segment_erase(segment, next); // skip the trailing space
+  return INOTE_OK;
+}
+
 static inote_error inote_push_annotation(inote_t *self, segment_t *segment, inote_state_t *state, tlv_t *tlv) {
   ENTER();
-  char32_t *t0, *t, *tmax;  
-  size_t len;
+  uint8_t *t0, *t, *tmax, *next, *value;
   inote_type_t first = INOTE_TYPE_UNDEFINED;
   int ret = INOTE_OK;
   
@@ -725,8 +1714,8 @@ static inote_error inote_push_annotation(inote_t *self, segment_t *segment, inot
 
   t0 = t = segment_get_buffer(segment);
   tmax = segment_get_max(segment);
-  while ((t < tmax) && (*t != U' ')) {
-    t++;
+  while ((t < tmax) && (segment_get_char(segment, t, &next) != U' ')) {
+    t = next;
   }
 
   if (t >= tmax) {
@@ -734,11 +1723,9 @@ static inote_error inote_push_annotation(inote_t *self, segment_t *segment, inot
     goto exit0;
   }	
 
-  char32_t gfa[] = U"`gfa";
-  char32_t pf[] = U"`Pf";
-  char32_t lang[] = U"`l";
-  if (!memcmp(t0, gfa, sizeof(gfa) - 4)) {
-    switch(t0[4]) {
+  // value: character following the annotation name
+  if (segment_match(segment, t0, "`gfa", &value)) {
+    switch(segment_get_char(segment, value, NULL)) {
     case U'1':
       state->ssml = 1;
       goto exit0;
@@ -748,8 +1735,8 @@ static inote_error inote_push_annotation(inote_t *self, segment_t *segment, inot
     }
   }
   
-  if (!memcmp(t0, pf, sizeof(pf) - 4)) {
-    switch(t0[3]) {
+  if (segment_match(segment, t0, "`Pf", &value)) {
+    switch(segment_get_char(segment, value, &value)) {
     case U'0':
       state->punct_mode = INOTE_PUNCT_MODE_NONE;
       break;
@@ -758,9 +1745,9 @@ static inote_error inote_push_annotation(inote_t *self, segment_t *segment, inot
       break;
     case U'2':
       state->punct_mode = INOTE_PUNCT_MODE_SOME;	  
-      len = min_size(t - (t0 + 4), MAX_PUNCT-1);
-      memcpy(self->punctuation_list, t0+4, len*sizeof(*t0));
-      self->punctuation_list[len] = 0;
+      ret = set_punctuation_list(self, segment, value, t);
+      if (ret)
+	goto exit1;
       break;
     default:
       first = INOTE_TYPE_TEXT; // unexpected value
@@ -770,7 +1757,7 @@ static inote_error inote_push_annotation(inote_t *self, segment_t *segment, inot
     goto exit0;
   }
   
-  if (!memcmp(t0, lang, sizeof(lang) - 4)) {
+  if (segment_match(segment, t0, "`l", NULL)) {
     dbg("language switching");
     ret = INOTE_LANGUAGE_SWITCHING;
     goto exit1;
@@ -783,17 +1770,71 @@ static inote_error inote_push_annotation(inote_t *self, segment_t *segment, inot
   if (ret == INOTE_UNPROCESSED) {
     ret = inote_push_text(self, first, segment, state, tlv);	
   } else {
-    segment_erase(segment, (uint8_t*)(t+1));
+    segment_erase(segment, next); // skip the trailing space
   }
  exit1:
   return ret;
 }
 
+/*
+  decode the character reference at t in one pass: "&name;" (HTML5
+  named character reference), "&#NNN;" or "&#xHH;".
+  If t is a valid reference, return the number of characters copied
+  to c and set *end to the character following ';'; otherwise
+  return 0.
+*/
+static size_t segment_get_entity(segment_t *segment, uint8_t *t, char32_t *c, uint8_t **end) {
+  uint8_t *tmax = segment_get_max(segment);
+  char32_t x;
+  size_t i;
+
+  segment_get_char(segment, t, &t); // '&'
+  if (t >= tmax)
+    return 0;
+  x = segment_get_char(segment, t, &t);
+  
+  if (x == U'#') {
+    char32_t value = 0;
+    int base = 10;
+    int digit;
+    if ((t < tmax) && ((segment_get_char(segment, t, NULL) | 0x20) == U'x')) {
+      base = 16;
+      segment_get_char(segment, t, &t);
+    }
+    for (i=0; (t < tmax) && ((x = segment_get_char(segment, t, &t)) != U';'); i++) {
+      digit = get_digit(x, base);
+      if (digit < 0)
+	return 0;
+      value = value*base + digit;
+      if (value > UNICODE_MAX)
+	return 0;
+    }
+    if ((x != U';') || !i || !value || ((value >= 0xd800) && (value <= 0xdfff)))
+      return 0;
+    c[0] = value;
+    i = 1;
+  } else {
+    uint16_t node = 0;
+    for (i=0; x != U';'; i++) {
+      if ((x >= 0x80) || (i == ENTITY_NAME_MAX) || (t >= tmax)
+	  || !(node = entity_get_child(node, x)))
+	return 0;
+      x = segment_get_char(segment, t, &t);
+    }
+    if (!entity_node[node].value)
+      return 0;
+    memcpy(c, entity_value[entity_node[node].value], ENTITY_VALUE_MAX*sizeof(char32_t));
+    i = c[1] ? 2 : 1;
+  }
+  *end = t;
+  return i;
+}
+
 static inote_error inote_push_entity(inote_t *self, segment_t *segment, inote_state_t *state, tlv_t *tlv) {
   ENTER();
-  char32_t *t, *tmax;  
-  size_t len;  
-  int i;
+  uint8_t *t, *end;
+  char32_t c[ENTITY_VALUE_MAX];
+  size_t nb;
   inote_error ret = INOTE_UNPROCESSED;
   
   if (!state->ssml)
@@ -805,23 +1846,16 @@ static inote_error inote_push_entity(inote_t *self, segment_t *segment, inote_st
   }
 
   t = segment_get_buffer(segment);
-  tmax = segment_get_max(segment);
-  
-  len = tmax - t;
-  for (i=0; i < MAX_ENTITY_NB; i++) {	
-    if ((len >= xml_predefined_entity[i].l) && !memcmp(t, xml_predefined_entity[i].str, sizeof(*t)*xml_predefined_entity[i].l)) {
-      break;
-    }
-  }
-  if (i == MAX_ENTITY_NB) {
+  nb = segment_get_entity(segment, t, c, &end);
+  if (!nb) {
     return INOTE_ARGS_ERROR;
   }
 
-  t += xml_predefined_entity[i].l -1;
-  *t = xml_predefined_entity[i].c;
+  // the last characters of the entity are replaced by the corresponding characters
+  t = segment_set_chars(segment, t, end, c, nb);
 
-  segment_erase(segment, (uint8_t*)t);
-  if (iswpunct(*t)) {
+  segment_erase(segment, t);
+  if (unicode_is_punct(c[0])) {
     ret = inote_push_punct(self, segment, state, tlv);
   } else {
     ret = inote_push_text(self, INOTE_TYPE_TEXT, segment, state, tlv);
@@ -830,48 +1864,175 @@ static inote_error inote_push_entity(inote_t *self, segment_t *segment, inote_st
   return ret;
 }
 
-static inote_error inote_get_type_length_value(inote_t *self, const inote_slice_t *text, inote_state_t *state, inote_slice_t *tlv_message) {
+/* convert the pattern or the text at the beginning of the segment */
+static inote_error inote_push_next(inote_t *self, segment_t *segment, inote_state_t *state, tlv_t *tlv) {
+  inote_error ret = INOTE_UNPROCESSED;
+  char32_t c = segment_get_char(segment, segment_get_buffer(segment), NULL);
+
+  if (unicode_is_punct(c)) { 
+    switch(c) {
+    case U'<':
+      ret = inote_push_tag(self, segment, state, tlv);
+      if (ret == INOTE_TLV_MESSAGE_FULL)
+	return ret; // no room for the ssml tlv: the tag is kept
+      break;
+    case U'`':
+      ret = inote_push_language(self, segment, state, tlv);
+      if (ret == INOTE_TLV_MESSAGE_FULL)
+	return ret; // no room for the language tlv: the annotation is kept
+      if (ret) {
+	ret = inote_push_annotation(self, segment, state, tlv);
+      }
+      break;
+    case U'&':
+      ret = inote_push_entity(self, segment, state, tlv);
+      break;
+    default:
+      break;
+    }
+    if (ret == INOTE_LANGUAGE_SWITCHING)
+      return ret;
+    else if (ret) {
+      ret = inote_push_punct(self, segment, state, tlv);
+    }
+  }
+  if (ret) {
+    ret = inote_push_text(self, INOTE_TYPE_TEXT, segment, state, tlv);
+  }
+  return ret;
+}
+
+/* state modified by inote_push_next() */
+typedef struct {
+  tlv_t tlv;
+  size_t tlv_message_length;
+  uint8_t header[TLV2_HEADER_LENGTH];
+  bool removing_leading_space;
+  text_run_t run;
+  inote_state_t state;
+} snapshot_t;
+
+static void snapshot_take(snapshot_t *self, inote_t *inote, inote_state_t *state, tlv_t *tlv) {
+  self->tlv = *tlv;
+  self->tlv_message_length = tlv->s->length;
+  if (tlv->header) {
+    memcpy(self->header, tlv->header, header_get_size(tlv->header));
+  }
+  self->removing_leading_space = inote->removing_leading_space;
+  self->run = inote->run;
+  self->state = *state;
+}
+
+static void snapshot_restore(const snapshot_t *self, inote_t *inote, inote_state_t *state, tlv_t *tlv) {
+  *tlv = self->tlv;
+  tlv->s->length = self->tlv_message_length;
+  if (tlv->header) {
+    const inote_tlv_t *header = (const inote_tlv_t*)self->header;
+    if (header_get_size(tlv->header) != header_get_size(header)) {
+      // the header has switched to v2: shift back the value
+      memmove((uint8_t*)tlv->header + header_get_size(header),
+	      inote_tlv_get_value(tlv->header),
+	      inote_tlv_get_length(header));
+    }
+    memcpy(tlv->header, header, header_get_size(header));
+  }
+  inote->removing_leading_space = self->removing_leading_space;
+  inote->run = self->run;
+  *state = self->state;
+}
+
+/*
+  true if the pattern at t may be continued by the next stream call: a
+  tag, an annotation or an entity of at most STREAM_PATTERN_MAX
+  characters up to the end of the segment
+*/
+static bool stream_is_pattern(segment_t *segment, uint8_t *t) {
+  size_t unit = (segment->s.charset == INOTE_CHARSET_UTF_8) ? 1 : sizeof(char32_t);
+  switch (segment_get_char(segment, t, NULL)) {
+  case U'<':
+  case U'`':
+  case U'&':
+    return ((size_t)(segment_get_max(segment) - t) <= STREAM_PATTERN_MAX*unit);
+  default:
+    return false;
+  }
+}
+
+/*
+  convert the text (a window of the supplied text) to tlv.
+
+  stop: NULL if the window ends the text. Otherwise, the conversion
+  stops before the pattern or text whose conversion may depend on the
+  next window (the characters read reach the end of the window) and
+  *stop is set to its first byte; the state is restored as it was
+  before this pattern.
+  The first pattern of the window is always converted (bounded
+  lookahead).
+
+  pending: the window ends a stream call; only a tag, an annotation or
+  an entity which reaches the end of the window stops the conversion
+  (even the first one, see stream_keep_pattern).
+*/
+static inote_error inote_get_type_length_value(inote_t *self, const inote_slice_t *text, inote_state_t *state, tlv_t *tlv, uint8_t **stop, bool pending) {
   ENTER();
-  char32_t *tmax;
-  char32_t *t;
+  uint8_t *tmax;
+  uint8_t *t;
   segment_t segment;
-  tlv_t tlv;
+  snapshot_t snapshot;
+  inote_state_t previous_state;
+  pattern_t pattern;
   inote_error ret = INOTE_ARGS_ERROR;
   
-  if (!self || !slice_check(text) || !state || !slice_check(tlv_message))
+  if (!self || !slice_check(text) || !state || !tlv)
     return INOTE_ARGS_ERROR;
 
   segment_init(&segment, text);
-  tlv_init(&tlv, tlv_message);
   
   tmax = segment_get_max(&segment);  
   while (((t=segment_get_buffer(&segment)) < tmax) && t) {
-    ret = INOTE_UNPROCESSED;
-    // TODO: parsing a fragmented pattern (tag, annotation, entity)
-    if (iswpunct(*t)) { 
-      switch(*t) {
-      case U'<':
-	ret = inote_push_tag(self, &segment, state, &tlv);
-	break;
-      case U'`':
-	ret = inote_push_annotation(self, &segment, state, &tlv);
-	break;
-      case U'&':
-	ret = inote_push_entity(self, &segment, state, &tlv);
-	break;
-      default:
-	break;
-      }
-      if (ret == INOTE_LANGUAGE_SWITCHING)
-	break;
-      else if (ret) {
-	ret = inote_push_punct(self, &segment, state, &tlv);
-      }
+    if (t != text->buffer) {
+      // only the first text can continue the run of the previous call
+      self->run.type = INOTE_TYPE_UNDEFINED;
     }
-    if (ret) {
-      ret = inote_push_text(self, INOTE_TYPE_TEXT, &segment, state, &tlv);
-      if (ret) {
+    if (tlv->sink && (slice_get_free_size(tlv->s) < tlv_get_length_max(tlv))) {
+      // room for the next tlv (one tlv at most per pattern)
+      ret = tlv_flush(tlv, false);
+      if (ret)
 	break;
+    }
+    if (stop) {
+      snapshot_take(&snapshot, self, state, tlv);
+    }
+    if (self->observer) {
+      previous_state = *state;
+      pattern.state = &previous_state;
+      pattern.removing_leading_space = self->removing_leading_space;
+      pattern.tlv_offset = tlv->s->length;
+    }
+    segment_examine(&segment, t);
+    ret = inote_push_next(self, &segment, state, tlv);
+    if (ret == INOTE_LANGUAGE_SWITCHING) {
+      self->language_switching = t;
+    }
+    if (stop && (segment.examined >= tmax)
+	&& (pending ? stream_is_pattern(&segment, t) : (t != text->buffer))) {
+      dbg("stop before %p", t);
+      segment_restore(&segment);
+      snapshot_restore(&snapshot, self, state, tlv);
+      *stop = t;
+      return INOTE_OK;
+    }
+    if (ret)
+      break;
+    if (self->observer) {
+      observer_t *observer = self->observer;
+      size_t offset = observer->base + observer->window_offset;
+      pattern.position = offset + (t - text->buffer)/observer->unit;
+      pattern.next = offset + (segment_get_buffer(&segment) - text->buffer)/observer->unit;
+      pattern.new_tlv = tlv->header && ((uint8_t*)tlv->header == tlv->s->buffer + pattern.tlv_offset);
+      if (observer->converted(observer, &pattern)) {
+	observer->stopped = true;
+	return INOTE_OK;
       }
     }
   }
@@ -880,25 +2041,44 @@ static inote_error inote_get_type_length_value(inote_t *self, const inote_slice_
     dbg("Error: char32_t text not fully processed!");
     ret = INOTE_UNEMPTIED_BUFFER;
   }
+  if (stop) {
+    *stop = tmax;
+  }
 
   return ret;
 }
 
 void *inote_create() {
+  return inote_create_with_allocator(NULL, NULL, NULL);
+}
+
+void *inote_create_with_allocator(inote_alloc_t alloc, inote_free_t release, void *user_data) {
   ENTER();
-  inote_t *self = (inote_t*)calloc(1, sizeof(inote_t));
+  allocator_t allocator = {alloc, release, user_data};
+  inote_t *self = NULL;
+  if (!alloc != !release) {
+    dbg("INOTE_ARGS_ERROR");
+    return NULL;
+  }
+  self = (inote_t*)allocator_calloc(&allocator, 1, sizeof(inote_t));
   if (self) {
     int i;
     self->magic = MAGIC;
+    self->allocator = allocator;
     self->removing_leading_space = true;
     dbg("removing_leading_space = true");	
-    for (i=0; i<MAX_CHARSET; i++) {
+    for (i=0; i<CONV_MAX_CHARSET; i++) {
       self->cd_to_char32[i] = ICONV_ERROR;
       self->cd_from_char32[i] = ICONV_ERROR;
     }
     self->capital_activated = false;
     self->with_feature_capital = true;
+    self->with_feature_tlv_v2 = true;
+    self->with_feature_ssml = true;
+    self->with_feature_language = true;
+    self->tlv_threshold = TLV_VALUE_LENGTH_THRESHOLD;
     dbg("capital deactivated");
+    conv_cache_ref();
   }
   dbg("self=%p", self);
   return self;
@@ -914,137 +2094,1720 @@ void inote_delete(void *handle) {
   self = (inote_t*)handle;
   if (self->magic == MAGIC) {
     int i;
-    for (i=0; i<MAX_CHARSET; i++) {
-      if (self->cd_to_char32[i] != ICONV_ERROR) {
-	iconv_close(self->cd_to_char32[i]);
-      }
-      if (self->cd_from_char32[i] != ICONV_ERROR) {
-	iconv_close(self->cd_from_char32[i]);
-      }
+    for (i=0; i<CONV_MAX_CHARSET; i++) {
+      conv_cache_put(i, CONV_TO_CHAR32, self->cd_to_char32[i]);
+      conv_cache_put(i, CONV_FROM_CHAR32, self->cd_from_char32[i]);
     }	
+    conv_cache_unref();
+    allocator_t allocator = self->allocator;
+    punct_set_unref(self->punctuation_list);
+    scratch_free(self->own_scratch);
+    allocator_free(&allocator, self->stream);
     memset(self, 0, sizeof(*self));
-    free(self);
+    allocator_free(&allocator, self);
   }
 }
 
-inote_error inote_convert_text_to_tlv(void *handle, const inote_slice_t *text, inote_state_t *state, inote_slice_t *tlv_message, size_t *text_left) {
-  dbg("ENTER self=%p", (inote_t*)handle);
+inote_error inote_prewarm(const inote_charset_t *charset, size_t nb) {
+  ENTER();
   inote_error ret = INOTE_OK;
-  inote_slice_t output;
-  char *inbuf;
-  size_t inbytesleft = 0;
-  char *outbuf;
-  size_t outbytesleft = 0;
-  size_t outbytesleftmax = 0;
-  inote_t *self;
-  int iconv_status; // nb of non reversible conv char or -1
-  
-  if (!handle || ( (self=(inote_t*)handle)->magic != MAGIC)) {
+  size_t i;
+
+  if (!charset && nb) {
     ret = INOTE_ARGS_ERROR;
     goto exit0;
   }
-  if (!slice_check(text) || !slice_check(tlv_message)) {
-    ret = INOTE_ARGS_ERROR;
-    goto exit0;
-  }  
+  
+  for (i=0; i<nb; i++) {
+    ret = conv_cache_prewarm(charset[i]);
+    if (ret)
+      goto exit0;
+  }
 
-  if (slice_get_free_size(text) > TEXT_LENGTH_MAX) {
-    ret = INOTE_ARGS_ERROR;
-    goto exit0;
+  // scratch of the calling thread
+  scratch_release(scratch_borrow());
+
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));
+  return ret;
+}
+
+/*
+  scratch memory of the call: the scratch set by inote_set_scratch(),
+  otherwise the scratch of the handle if it has an allocator (created
+  by the first call), otherwise a scratch borrowed from the pool of
+  the calling thread
+*/
+static inote_error handle_get_scratch(inote_t *self) {
+  if (self->attached_scratch) {
+    self->scratch = self->attached_scratch;
+  } else if (self->allocator.alloc) {
+    if (!self->own_scratch) {
+      self->own_scratch = scratch_new(&self->allocator);
+    }
+    self->scratch = self->own_scratch;
+  } else {
+    self->scratch = scratch_borrow();
+  }
+  return self->scratch ? INOTE_OK : INOTE_ERRNO + ENOMEM;
+}
+
+static void handle_put_scratch(inote_t *self) {
+  if ((self->scratch != self->attached_scratch) && (self->scratch != self->own_scratch)) {
+    scratch_release(self->scratch);
+  }
+  self->scratch = NULL;
+}
+
+/* check the arguments of a conversion */
+static inote_error convert_check_args(void *handle, const inote_slice_t *text, inote_state_t *state, inote_slice_t *tlv_message, size_t *text_left) {
+  if (!handle || ( ((inote_t*)handle)->magic != MAGIC)) {
+    return INOTE_ARGS_ERROR;
+  }
+  if (!slice_check(text) || !slice_check(tlv_message)) {
+    return INOTE_ARGS_ERROR;
   }  
 
-  if (slice_get_free_size(tlv_message) > TLV_MESSAGE_LENGTH_MAX) {
-    ret = INOTE_ARGS_ERROR;
-    goto exit0;
-  }  
+  if (!state || !text_left) {
+    return INOTE_ARGS_ERROR;
+  }	
+
+  if (((inote_t*)handle)->sink.write
+      && (slice_get_free_size(tlv_message) < (((inote_t*)handle)->tlv_v2_activated ?
+					      TLV2_BLOCK_LENGTH_MIN : TLV_BLOCK_LENGTH_MIN))) {
+    return INOTE_ARGS_ERROR;
+  }
+  return INOTE_OK;
+}
+
+/* 
+   init the output slice (internal buffer) and the converters
+   according to the text and tlv charsets
+*/
+static inote_error convert_init(inote_t *self, const inote_slice_t *text, const inote_slice_t *tlv_message, inote_slice_t *output) {
+  output->buffer = (uint8_t*)self->scratch->char32_buf;
+  output->length = 0;
+  // UTF-8 to UTF-8: the text is processed as is (without UTF-32 conversion)
+  output->charset = ((text->charset == INOTE_CHARSET_UTF_8) && (tlv_message->charset == INOTE_CHARSET_UTF_8)) ?
+    INOTE_CHARSET_UTF_8 : INOTE_CHARSET_UTF_32;
+  output->end_of_buffer = output->buffer + sizeof(self->scratch->char32_buf);
+  
+  if (get_charset(text->charset, CONV_TO_CHAR32, &self->cd_to_char32[text->charset])
+      || get_charset(tlv_message->charset, CONV_FROM_CHAR32, &self->cd_from_char32[tlv_message->charset]))  {
+    return INOTE_CHARSET_ERROR;
+  }
+  return INOTE_OK;
+}
+
+/* 
+   decode the text into the output charset (UTF-32 or valid UTF-8),
+   same conventions as iconv
+*/
+static size_t convert_text(inote_t *self, inote_charset_t charset, const inote_slice_t *output, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  if (output->charset == INOTE_CHARSET_UTF_8) {
+    return conv_check_utf8(inbuf, inbytesleft, outbuf, outbytesleft);
+  }
+  return convert_to_char32(self, charset, inbuf, inbytesleft, outbuf, outbytesleft);
+}
+
+/* error returned for errno (decoding) */
+static inote_error convert_get_error(int err) {
+  switch (err) {
+  case EILSEQ:
+    return INOTE_INVALID_MULTIBYTE;
+  case EINVAL:
+    return INOTE_INCOMPLETE_MULTIBYTE;
+  default:
+    return INOTE_ERRNO + err;
+  }
+}
+
+/*
+  append a space to the output in place of an invalid byte
+*/
+static inote_error stream_put_space(const inote_slice_t *output, char **outbuf, size_t *outbytesleft) {
+  size_t len = (output->charset == INOTE_CHARSET_UTF_8) ? 1 : sizeof(char32_t);
+  char32_t c = U' ';
+  if (*outbytesleft < len)
+    return INOTE_ERRNO + E2BIG;
+  
+  memcpy(*outbuf, (output->charset == INOTE_CHARSET_UTF_8) ? " " : (char*)&c, len);
+  *outbuf += len;
+  *outbytesleft -= len;
+  return INOTE_OK;
+}
+
+/*
+  complete the pending multibyte sequence with the first bytes of the
+  text (at most STREAM_PENDING_MAX bytes are decoded twice: in the
+  pending buffer and then in the text).
+  inbuf and inbytesleft are updated to the text still to decode.
+*/
+static inote_error stream_decode_pending(inote_t *self, const inote_slice_t *output, char **inbuf, size_t *inbytesleft, char **outbuf, size_t *outbytesleft) {
+  inote_error ret = INOTE_OK;
+  
+  while (self->stream->pending_length) {
+    uint8_t buf[2*STREAM_PENDING_MAX];
+    size_t n = self->stream->pending_length;
+    size_t k = min_size(*inbytesleft, STREAM_PENDING_MAX);
+    char *b = (char*)buf;
+    size_t bl = n + k;
+    size_t consumed;
+    int err = 0;
+    
+    memcpy(buf, self->stream->pending, n);
+    memcpy(buf + n, *inbuf, k);
+    if (convert_text(self, self->stream->charset, output, &b, &bl, outbuf, outbytesleft) == (size_t)-1) {
+      err = errno;
+    }
+    consumed = b - (char*)buf;
+    if (consumed >= n) {
+      // pending sequence completed; the next bytes are decoded from the text
+      *inbuf += consumed - n;
+      *inbytesleft -= consumed - n;
+      self->stream->pending_length = 0;
+      break;
+    }
+    
+    if ((err == EINVAL) && (k == *inbytesleft) && (bl <= STREAM_PENDING_MAX)) {
+      // still incomplete: the whole text is pending
+      memmove(self->stream->pending, b, bl);
+      self->stream->pending_length = bl;
+      *inbuf += k;
+      *inbytesleft = 0;
+      break;
+    }
+
+    if ((err != EILSEQ) && (err != EINVAL)) {
+      ret = INOTE_ERRNO + err;
+      break;
+    }
+
+    // invalid sequence: its first byte is replaced by a space
+    ret = stream_put_space(output, outbuf, outbytesleft);
+    if (ret)
+      break;
+    memmove(self->stream->pending, b + 1, n - consumed - 1);
+    self->stream->pending_length = n - consumed - 1;
+  }
+  return ret;
+}
+
+/*
+  decode the next bytes of the text after the characters already in
+  output, until output is full.
+
+  In stream mode, a final incomplete sequence is kept for the next
+  call and each invalid byte is replaced by a space; otherwise the
+  decoding error is returned and inbuf points to the erroneous byte.
+*/
+static inote_error window_decode(inote_t *self, inote_charset_t charset, inote_slice_t *output, char **inbuf, size_t *inbytesleft, bool stream) {
+  inote_error ret = INOTE_OK;
+  // each byte is decoded to a character at most
+  size_t unit = (output->charset == INOTE_CHARSET_UTF_8) ? 1 : sizeof(char32_t);
+  char *outbuf = (char *)(output->buffer + output->length);
+  size_t outbytesleft = slice_get_free_size(output);
+  size_t outbytesleftmax = outbytesleft;
+  
+  while (!ret && *inbytesleft && (outbytesleft >= unit)) {
+    size_t len = min_size(*inbytesleft, outbytesleft/unit);
+    size_t left = len;
+    int err;
+    
+    if (convert_text(self, charset, output, inbuf, &left, &outbuf, &outbytesleft) != (size_t)-1) {
+      *inbytesleft -= len;
+      continue;
+    }
+    
+    err = errno;
+    *inbytesleft -= len - left;
+    if ((err == EINVAL) && (len < *inbytesleft + (len - left))) {
+      // sequence split by the window
+      if (len == left)
+	break; // window full
+      continue;
+    }
+    
+    dbg("%s", strerror(err));
+    if (!stream) {
+      ret = convert_get_error(err);
+      break;
+    }
+    
+    if ((err == EINVAL) && (*inbytesleft <= STREAM_PENDING_MAX)) {
+      memcpy(self->stream->pending, *inbuf, *inbytesleft);
+      self->stream->pending_length = *inbytesleft;
+      self->stream->charset = charset;
+      *inbuf += *inbytesleft;
+      *inbytesleft = 0;
+      break;
+    }
+    if ((err != EILSEQ) && (err != EINVAL)) {
+      ret = INOTE_ERRNO + err;
+      break;
+    }
+    ret = stream_put_space(output, &outbuf, &outbytesleft);
+    (*inbuf)++;
+    (*inbytesleft)--;
+  }
+  output->length += outbytesleftmax - outbytesleft;
+  return ret;
+}
+
+/*
+  offset of the character at index in the text: the text is decoded
+  again up to this character, as by window_decode (stream: an invalid
+  byte is decoded to a space).
+*/
+static inote_error text_get_offset(const inote_slice_t *text, size_t index, bool stream, size_t *offset) {
+  inote_error ret = INOTE_OK;
+  bool native = conv_is_native(text->charset);
+  iconv_t cd = ICONV_ERROR;
+  char *inbuf = (char *)(text->buffer);
+  size_t inbytesleft = text->length;
+
+  if (!native) {
+    ret = conv_cache_get(text->charset, CONV_TO_CHAR32, &cd);
+    if (ret)
+      return ret;
+  }
+  while (index && inbytesleft) {
+    char32_t buf[64];
+    char *outbuf = (char*)buf;
+    size_t outbytesleft = min_size(index, sizeof(buf)/sizeof(*buf))*sizeof(char32_t);
+    size_t outbytesleftmax = outbytesleft;
+    size_t status = native
+      ? conv_to_char32(text->charset, &inbuf, &inbytesleft, &outbuf, &outbytesleft)
+      : iconv(cd, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+    int err = errno;
+    
+    index -= (outbytesleftmax - outbytesleft)/sizeof(char32_t);
+    if ((status != (size_t)-1) || (err == E2BIG))
+      continue;
+    if (!stream || (err != EILSEQ) || !index)
+      break;
+    inbuf++;
+    inbytesleft--;
+    index--;
+  }
+  conv_cache_put(text->charset, CONV_TO_CHAR32, cd);
+  *offset = inbuf - (char *)(text->buffer);
+  return ret;
+}
+
+/* init the tlv appended to tlv_message according to the handle settings */
+static void convert_tlv_init(inote_t *self, tlv_t *tlv, inote_slice_t *tlv_message) {
+  tlv_init(tlv, tlv_message);
+  if (self->sink.write) {
+    tlv->sink = &self->sink;
+    tlv->stats = &self->stats;
+  }
+  tlv->v2 = self->tlv_v2_activated;
+  tlv->threshold = self->tlv_threshold;
+  tlv->split = self->tlv_split;
+}
+
+/* keep the pattern from stop to the end of output for the next stream call */
+static void stream_keep_pattern(inote_t *self, const inote_slice_t *output, const uint8_t *stop) {
+  self->stream->pattern_length = output->buffer + output->length - stop;
+  self->stream->pattern_charset = output->charset;
+  self->stream->annotation = false;
+  memcpy(self->stream->pattern, stop, self->stream->pattern_length);
+}
+
+/*
+  copy the pattern kept by the previous stream call to the beginning of
+  output (converted to the format of output if needed)
+*/
+static void stream_restore_pattern(inote_t *self, inote_slice_t *output) {
+  char *inbuf = (char*)self->stream->pattern;
+  size_t inbytesleft = self->stream->pattern_length;
+  char *outbuf = (char*)output->buffer;
+  size_t outbytesleft = slice_get_free_size(output);
+
+  if (self->stream->pattern_charset == output->charset) {
+    memcpy(outbuf, inbuf, inbytesleft);
+    outbuf += inbytesleft;
+  } else if (output->charset == INOTE_CHARSET_UTF_8) {
+    conv_from_char32(INOTE_CHARSET_UTF_8, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+  } else {
+    conv_to_char32(INOTE_CHARSET_UTF_8, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+  }
+  output->length = outbuf - (char*)output->buffer;
+  self->stream->pattern_length = 0;
+  self->stream->annotation = false;
+}
+
+/*
+  convert the text by windows of the internal buffer: the characters
+  whose conversion depends on the next window are moved to the
+  beginning of the buffer and converted with the next window.
+  The tlv are appended to tlv->s (see convert_tlv_init).
+
+  keep_pattern (stream): the pattern which ends the text and may be
+  continued by the next call is kept by the handle (see
+  stream_is_pattern); the pattern kept by the previous call is
+  converted first.
+*/
+static inote_error convert_windows(inote_t *self, const inote_slice_t *text, inote_state_t *state, tlv_t *tlv, size_t *text_left, bool stream, bool keep_pattern) {
+  inote_error ret;
+  inote_slice_t output;
+  inote_slice_t *tlv_message = tlv->s;
+  char *inbuf = (char *)(text->buffer);
+  size_t inbytesleft = text->length;
+  size_t carry = 0;
+  size_t unit;
+  // decoded: number of characters decoded before the current window
+  // (prefix included)
+  size_t decoded = 0;
+  // window: index of the first character of the current window
+  size_t window = 0;
+  // prefix (stream): characters which precede the text, from the
+  // previous call (pattern kept and pending sequence)
+  size_t prefix = 0;
+  // skipped (stream): bytes of text which complete the pending sequence
+  size_t skipped = 0;
+  // initial: state restored if a decoding error is found in a window
+  // after the first one (then the text is not converted), unless the
+  // tlv have already been delivered to the sink
+  struct {
+    bool saved;
+    size_t tlv_message_length;
+    inote_state_t state;
+    bool removing_leading_space;
+    punct_set_t *punctuation_list;
+  } initial;
+  
+  ret = convert_init(self, text, tlv_message, &output);
+  if (ret)
+    return ret;
+
+  unit = (output.charset == INOTE_CHARSET_UTF_8) ? 1 : sizeof(char32_t);
+  initial.saved = false;
+  if (stream) {
+    char *outbuf;
+    size_t outbytesleft;
+    if (self->stream->pattern_length) {
+      stream_restore_pattern(self, &output);
+      carry = output.length;
+    }
+    outbuf = (char *)(output.buffer + output.length);
+    outbytesleft = slice_get_free_size(&output);
+    ret = stream_decode_pending(self, &output, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+    if (ret)
+      return ret;
+    output.length = outbuf - (char *)(output.buffer);
+    self->stats.units_decoded += (output.length - carry)/unit;
+    carry = output.length;
+    decoded = prefix = carry/unit;
+    skipped = inbuf - (char *)(text->buffer);
+  }
+  
+  do {
+    uint8_t *stop;
+    uint64_t start, encode_ns;
+    output.length = carry;
+    start = stats_get_time(self);
+    ret = window_decode(self, text->charset, &output, &inbuf, &inbytesleft, stream);
+    if (start) {
+      self->stats.decode_ns += stats_get_time(self) - start;
+    }
+    if (ret || !output.length)
+      break;
+    trace(INOTE_TRACE_WINDOW, output.length - carry, carry);
+    self->stats.units_decoded += (output.length - carry)/unit;
+
+    window = decoded - carry/unit;
+    decoded += (output.length - carry)/unit;
+    if (self->observer) {
+      self->observer->window_offset = window;
+    }
+    
+    if (inbytesleft && !stream && !tlv->sink && !initial.saved) {
+      initial.saved = true;
+      initial.tlv_message_length = tlv_message->length;
+      initial.state = *state;
+      initial.removing_leading_space = self->removing_leading_space;
+      initial.punctuation_list = punct_set_ref(self->punctuation_list);
+    }
+    
+    start = stats_get_time(self);
+    encode_ns = self->stats.encode_ns;
+    ret = inote_get_type_length_value(self, &output, state, tlv,
+				      (inbytesleft || keep_pattern) ? &stop : NULL, !inbytesleft);
+    if (start) {
+      self->stats.scan_ns += stats_get_time(self) - start - (self->stats.encode_ns - encode_ns);
+    }
+    if (ret || (self->observer && self->observer->stopped))
+      break;
+    
+    if (inbytesleft) {
+      carry = output.buffer + output.length - stop;
+      memmove(output.buffer, stop, carry);
+    } else if (keep_pattern) {
+      stream_keep_pattern(self, &output, stop);
+    }
+  } while (inbytesleft);
+
+  if (ret && !stream) {
+    // as for a single window, a decoding error in the text left takes precedence
+    while (inbytesleft) {
+      inote_error err;
+      output.length = 0;
+      err = window_decode(self, text->charset, &output, &inbuf, &inbytesleft, stream);
+      if (err) {
+	ret = err;
+	break;
+      }
+    }
+  }
+  
+  if (tlv->sink) {
+    // deliver the last tlv
+    inote_error err = tlv_flush(tlv, true);
+    if (!ret) {
+      ret = err;
+    }
+  }
+  
+  switch (ret) {
+  case INOTE_LANGUAGE_SWITCHING: {
+    // index of the annotation in the decoded characters
+    size_t index = window + (self->language_switching - output.buffer)/unit;
+    if (stream) {
+      // the text left (including the pending bytes) will be supplied again
+      self->stream->pending_length = 0;
+      self->stream->pattern_length = 0;
+    }
+    if (index < prefix) {
+      // the annotation starts in the previous call: its beginning is
+      // kept, the text left follows it
+      inote_slice_t head = output;
+      head.length = (self->language_switching - output.buffer) + (prefix - index)*unit;
+      stream_keep_pattern(self, &head, self->language_switching);
+      self->stream->annotation = true;
+      *text_left = text->length - skipped;
+    } else if (output.charset == INOTE_CHARSET_UTF_8) {
+      // one byte per byte of text
+      *text_left = text->length - skipped - (index - prefix);
+    } else {
+      inote_slice_t left = *text;
+      size_t offset;
+      inote_error err;
+      left.buffer += skipped;
+      left.length -= skipped;
+      err = text_get_offset(&left, index - prefix, stream, &offset);
+      if (err) {
+	ret = err;
+	break;
+      }
+      *text_left = left.length - offset;
+    }
+  }
+    break;
+  case INOTE_INVALID_MULTIBYTE:
+  case INOTE_INCOMPLETE_MULTIBYTE:
+    *text_left = text->buffer + text->length - (uint8_t*)inbuf;
+    if (initial.saved) {
+      tlv_message->length = initial.tlv_message_length;
+      *state = initial.state;
+      self->removing_leading_space = initial.removing_leading_space;
+      self->run.type = INOTE_TYPE_UNDEFINED;
+      punct_set_assign(&self->punctuation_list, initial.punctuation_list);
+    }
+    break;
+  default:
+    break;
+  }
+  if (initial.saved) {
+    punct_set_unref(initial.punctuation_list);
+  }
+  return ret;
+}
+
+inote_error inote_convert_text_to_tlv(void *handle, const inote_slice_t *text, inote_state_t *state, inote_slice_t *tlv_message, size_t *text_left) {
+  dbg("ENTER self=%p", (inote_t*)handle);
+  inote_error ret = INOTE_OK;
+  inote_t *self = (inote_t*)handle;
+  tlv_t tlv;
+  size_t offset;
+  
+  ret = convert_check_args(handle, text, state, tlv_message, text_left);
+  if (ret)
+    goto exit0;
+  
+  trace(INOTE_TRACE_CONVERT_START, text->length, text->charset);
+  *text_left = 0;
+  offset = tlv_message->length;
+
+  if (!text->length) {
+    tlv_message->length = 0;
+    ret = INOTE_OK;
+    goto exit0;
+  }
+
+  DBG_PRINT_SLICE(text);
+  DBG_PRINT_STATE(state);
+
+  ret = handle_get_scratch(self);
+  if (ret)
+    goto exit0;
+
+  self->run.type = INOTE_TYPE_UNDEFINED;
+  convert_tlv_init(self, &tlv, tlv_message);
+  ret = convert_windows(self, text, state, &tlv, text_left, false, false);
+  handle_put_scratch(self);
+  
+  /* initialize iconv state */
+  convert_reset(self->cd_to_char32, text->charset);
+  //  DebugDump("tlv: ", tlv_message->buffer, min_size(tlv_message->length, 256));
+
+  stats_count_conversion(&self->stats, ret, text, *text_left, tlv_message, offset, self->sink.write);
+  
+ exit0:
+  trace(INOTE_TRACE_CONVERT_END, ret, tlv_message ? tlv_message->length : 0);
+  DBG_PRINT_SLICE(tlv_message);
+  dbg("LEAVE(%s), *text_left=%lu", inote_error_get_string(ret), text_left ? (long unsigned int)(*text_left) : 0);  
+  return ret;
+}
+
+/* forget the pending bytes and the text run, initialize the decoders */
+static void stream_reset(inote_t *self) {
+  int i;
+  self->run.type = INOTE_TYPE_UNDEFINED;
+  if (self->stream) {
+    self->stream->pending_length = 0;
+    self->stream->pattern_length = 0;
+    self->stream->annotation = false;
+  }
+  for (i=0; i<CONV_MAX_CHARSET; i++) {
+    if (self->cd_to_char32[i] != ICONV_ERROR) {
+      convert_reset(self->cd_to_char32, i);
+    }
+  }
+}
+
+inote_error inote_stream_start(void *handle) {
+  dbg("ENTER self=%p", (inote_t*)handle);
+  inote_t *self = (inote_t*)handle;
+
+  if (!self || (self->magic != MAGIC))
+    return INOTE_ARGS_ERROR;
+
+  if (!self->stream) {
+    self->stream = (stream_t*)allocator_calloc(&self->allocator, 1, sizeof(*self->stream));
+    if (!self->stream)
+      return INOTE_ERRNO + ENOMEM;
+  }
+  self->removing_leading_space = true;
+  stream_reset(self);
+  return INOTE_OK;
+}
+
+inote_error inote_stream_feed(void *handle, const inote_slice_t *text, inote_state_t *state, inote_slice_t *tlv_message, size_t *text_left) {
+  dbg("ENTER self=%p", (inote_t*)handle);
+  inote_error ret = INOTE_OK;
+  inote_t *self = (inote_t*)handle;
+  tlv_t tlv;
+  size_t offset;
+  
+  ret = convert_check_args(handle, text, state, tlv_message, text_left);
+  if (ret)
+    goto exit0;
+  
+  trace(INOTE_TRACE_CONVERT_START, text->length, text->charset);
+  *text_left = 0;
+
+  if (!self->stream) {
+    // stream started by the first call
+    self->stream = (stream_t*)allocator_calloc(&self->allocator, 1, sizeof(*self->stream));
+    if (!self->stream) {
+      ret = INOTE_ERRNO + ENOMEM;
+      goto exit0;
+    }
+  }
+
+  if (self->stream->pending_length && (self->stream->charset != text->charset)) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+
+  if (!text->length)
+    goto exit0;
+
+  DBG_PRINT_SLICE(text);
+  DBG_PRINT_STATE(state);
+
+  ret = handle_get_scratch(self);
+  if (ret)
+    goto exit0;
+
+  self->stream->charset = text->charset;
+  offset = tlv_message->length;
+  convert_tlv_init(self, &tlv, tlv_message);
+  ret = convert_windows(self, text, state, &tlv, text_left, true, true);
+  handle_put_scratch(self);
+  stats_count_conversion(&self->stats, ret, text, *text_left, tlv_message, offset, self->sink.write);
+  
+ exit0:
+  trace(INOTE_TRACE_CONVERT_END, ret, tlv_message ? tlv_message->length : 0);
+  DBG_PRINT_SLICE(tlv_message);
+  dbg("LEAVE(%s), *text_left=%lu", inote_error_get_string(ret), text_left ? (long unsigned int)(*text_left) : 0);  
+  return ret;
+}
+
+inote_error inote_stream_flush(void *handle, inote_state_t *state, inote_slice_t *tlv_message) {
+  dbg("ENTER self=%p", (inote_t*)handle);
+  inote_error ret = INOTE_OK;
+  inote_t *self = (inote_t*)handle;
+  
+  if (!self || (self->magic != MAGIC) || !state || !slice_check(tlv_message)) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+
+  if (!self->stream)
+    goto exit0;
+
+  if (self->stream->pattern_length) {
+    // the pattern kept by the last call ends the stream: converted as is
+    uint8_t empty = 0;
+    inote_slice_t text = {&empty, 0, self->stream->charset, &empty};
+    size_t text_left;
+    size_t pending_length = self->stream->pending_length;
+    tlv_t tlv;
+    
+    self->stream->pending_length = 0;
+    ret = handle_get_scratch(self);
+    if (!ret) {
+      convert_tlv_init(self, &tlv, tlv_message);
+      ret = convert_windows(self, &text, state, &tlv, &text_left, true, false);
+      handle_put_scratch(self);
+    }
+    self->stream->pending_length = pending_length;
+  }
+  if (!ret && self->stream->pending_length) {
+    dbg("incomplete sequence (%lu bytes) discarded", (long unsigned int)self->stream->pending_length);
+    ret = INOTE_INCOMPLETE_MULTIBYTE;
+  }
+  stream_reset(self);
+  
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));
+  return ret;
+}
+
+inote_error inote_stream_take_annotation(void *handle, inote_slice_t *annotation) {
+  dbg("ENTER self=%p", (inote_t*)handle);
+  inote_error ret = INOTE_OK;
+  inote_t *self = (inote_t*)handle;
+  char32_t buf[STREAM_PATTERN_MAX + STREAM_PENDING_MAX];
+  char *inbuf;
+  size_t inbytesleft;
+  char *outbuf;
+  size_t outbytesleft;
+
+  if (!self || (self->magic != MAGIC) || !slice_check(annotation)) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+
+  if (!self->stream || !self->stream->annotation)
+    goto exit0;
+
+  inbuf = (char*)self->stream->pattern;
+  inbytesleft = self->stream->pattern_length;
+  if (self->stream->pattern_charset == INOTE_CHARSET_UTF_8) {
+    // UTF-8 internal buffer: to UTF-32 first
+    outbuf = (char*)buf;
+    outbytesleft = sizeof(buf);
+    conv_to_char32(INOTE_CHARSET_UTF_8, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+    inbuf = (char*)buf;
+    inbytesleft = outbuf - (char*)buf;
+  }
+
+  ret = get_charset(annotation->charset, CONV_FROM_CHAR32, &self->cd_from_char32[annotation->charset]);
+  if (ret)
+    goto exit0;
+
+  outbuf = (char*)(annotation->buffer + annotation->length);
+  outbytesleft = slice_get_free_size(annotation);
+  if (convert_from_char32(self, annotation->charset, &inbuf, &inbytesleft, &outbuf, &outbytesleft) == (size_t)-1) {
+    ret = INOTE_ERRNO + errno;
+  }
+  convert_reset(self->cd_from_char32, annotation->charset);
+  if (ret)
+    goto exit0;
+
+  annotation->length = outbuf - (char*)annotation->buffer;
+  self->stream->pattern_length = 0;
+  self->stream->annotation = false;
+
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));
+  return ret;
+}
+
+inote_error inote_set_sink(void *handle, const inote_sink_t *sink) {
+  dbg("ENTER self=%p", (inote_t*)handle);
+  inote_t *self = (inote_t*)handle;
+
+  if (!self || (self->magic != MAGIC))
+    return INOTE_ARGS_ERROR;
+
+  if (sink) {
+    self->sink = *sink;
+  } else {
+    memset(&self->sink, 0, sizeof(self->sink));
+  }
+  return INOTE_OK;
+}
+
+typedef struct {
+  uint32_t magic;
+  void *pool;
+  // worker: one instance per worker of the pool (scratch memory)
+  inote_t **worker;
+  size_t nb_worker;
+} batch_t;
+
+typedef struct {
+  batch_t *batch;
+  const inote_t *handle;
+  inote_job_t *job;
+} batch_run_t;
+
+/* 
+   copy the settings and the state kept between the conversions
+   (no sink: the worker fills the tlv message of the job)
+*/
+static void handle_copy_settings(inote_t *self, const inote_t *handle) {
+  self->removing_leading_space = handle->removing_leading_space;
+  punct_set_assign(&self->punctuation_list, handle->punctuation_list);
+  self->backward_compatibility = handle->backward_compatibility;
+  self->with_feature_capital = handle->with_feature_capital;
+  self->capital_activated = handle->capital_activated;
+  self->with_feature_tlv_v2 = handle->with_feature_tlv_v2;
+  self->tlv_v2_activated = handle->tlv_v2_activated;
+  self->with_feature_ssml = handle->with_feature_ssml;
+  self->ssml_activated = handle->ssml_activated;
+  self->with_feature_language = handle->with_feature_language;
+  self->language_activated = handle->language_activated;
+  self->stats_timing = handle->stats_timing;
+  self->tlv_threshold = handle->tlv_threshold;
+  self->tlv_split = handle->tlv_split;
+}
+
+static void batch_convert_job(size_t worker, size_t index, void *user_data) {
+  batch_run_t *run = (batch_run_t*)user_data;
+  inote_t *self = run->batch->worker[worker];
+  inote_job_t *job = run->job + index;
+
+  handle_copy_settings(self, run->handle);
+  job->ret = inote_convert_text_to_tlv(self, &job->text, job->state, &job->tlv_message, &job->text_left);
+  // the set may belong to the allocator of the handle: not kept by the worker
+  punct_set_assign(&self->punctuation_list, NULL);
+}
+
+void *inote_batch_create(unsigned int nb_thread) {
+  ENTER();
+  batch_t *self = (batch_t*)calloc(1, sizeof(batch_t));
+  size_t i;
+  
+  if (!self)
+    goto exit0;
+
+  self->magic = BATCH_MAGIC;
+  self->pool = pool_create(nb_thread);
+  if (!self->pool)
+    goto exit1;
+
+  self->nb_worker = pool_get_worker_nb(self->pool);
+  self->worker = (inote_t**)calloc(self->nb_worker, sizeof(*self->worker));
+  if (!self->worker)
+    goto exit1;
+  
+  for (i=0; i<self->nb_worker; i++) {
+    self->worker[i] = inote_create();
+    if (!self->worker[i])
+      goto exit1;
+  }
+  goto exit0;
+
+ exit1:
+  inote_batch_delete(self);
+  self = NULL;
+ exit0:
+  dbg("self=%p", self);
+  return self;
+}
+
+void inote_batch_delete(void *batch) {
+  ENTER();
+  batch_t *self = (batch_t*)batch;
+  size_t i;
+  
+  if (!self || (self->magic != BATCH_MAGIC))
+    return;
+
+  pool_delete(self->pool);
+  if (self->worker) {
+    for (i=0; i<self->nb_worker; i++) {
+      inote_delete(self->worker[i]);
+    }
+    free(self->worker);
+  }
+  memset(self, 0, sizeof(*self));
+  free(self);
+}
+
+inote_error inote_batch_convert(void *batch, const void *handle, inote_job_t *job, size_t nb_job) {
+  dbg("ENTER batch=%p, nb_job=%lu", batch, (long unsigned int)nb_job);
+  batch_t *self = (batch_t*)batch;
+  batch_run_t run;
+  
+  if (!self || (self->magic != BATCH_MAGIC)
+      || !handle || (((const inote_t*)handle)->magic != MAGIC)
+      || (!job && nb_job)) {
+    return INOTE_ARGS_ERROR;
+  }
+
+  run.batch = self;
+  run.handle = (const inote_t*)handle;
+  run.job = job;
+  pool_run(self->pool, nb_job, batch_convert_job, &run);
+  return INOTE_OK;
+}
+
+/*
+  Parallel conversion of a text
+
+  The text is split into chunks, converted in parallel by the workers
+  of the batch converter from the state expected at their beginning
+  (prepass on the annotations). Then the chunks are joined in order by
+  the handle: the text between two chunks is converted sequentially
+  until a pattern starts a new tlv at the same position and in the
+  same state as in the chunk (sync point); the tlv of the chunk are
+  copied from there.
+  The conversion of the patterns does not depend on the windows,
+  so the result is the same as the sequential conversion.
+*/
+
+#define PARALLEL_TEXT_LENGTH_MIN (64*1024)
+#define SYNC_POINT_MAX 4096
+#define SYNC_PUNCT_LIST_MAX 8
+
+typedef struct {
+  size_t position;
+  size_t tlv_offset;
+  inote_state_t state;
+  bool removing_leading_space;
+  size_t punctuation_list; // index in chunk_t.punctuation_list
+} sync_point_t;
+
+typedef struct {
+  observer_t observer; // first member (see chunk_converted)
+  inote_t *handle; // worker converting the chunk
+  // start: first byte of the chunk, position: same offset in units of
+  // the internal buffer
+  size_t start;
+  size_t position;
+  // limit: position of the next chunk; the conversion stops after the
+  // pattern which reaches it
+  size_t limit;
+  // state expected at the beginning of the chunk
+  inote_state_t state;
+  // punctuation_list: history of the punctuation lists of the sync points
+  punct_set_t *punctuation_list[SYNC_PUNCT_LIST_MAX];
+  size_t nb_punctuation_list;
+  sync_point_t *point;
+  size_t nb_point;
+  // results: valid is false if the conversion failed
+  bool valid;
+  inote_slice_t tlv_message;
+  size_t end; // position after the last pattern
+  inote_state_t end_state;
+  bool end_removing_leading_space;
+  text_run_t end_run;
+  punct_set_t *end_punctuation_list;
+  uint8_t *end_header; // last tlv
+  inote_stats_t stats; // work of the worker
+} chunk_t;
+
+typedef struct {
+  batch_t *batch;
+  const inote_t *handle;
+  const inote_slice_t *text;
+  inote_charset_t tlv_charset;
+  size_t unit;
+  chunk_t *chunk;
+  size_t nb_chunk;
+} parallel_t;
+
+typedef struct {
+  observer_t observer; // first member (see join_converted)
+  parallel_t *parallel;
+  inote_t *handle;
+  const inote_slice_t *tlv_message;
+  // next sync point to compare (chunk, point)
+  size_t chunk;
+  size_t point;
+  // sync point found and tlv offset of its pattern in tlv_message
+  chunk_t *synced;
+  const sync_point_t *synced_point;
+  size_t tlv_offset;
+} join_t;
+
+static bool state_equal(const inote_state_t *a, const inote_state_t *b) {
+  return ((a->punct_mode == b->punct_mode)
+	  && (a->spelling == b->spelling)
+	  && (a->lang == b->lang)
+	  && (a->expected_lang == b->expected_lang)
+	  && (a->max_expected_lang == b->max_expected_lang)
+	  && (a->ssml == b->ssml)
+	  && (a->annotation == b->annotation));
+}
+
+/* 
+   true if the positions are counted in characters (UTF-8 text
+   decoded to UTF-32), otherwise in bytes
+*/
+static bool parallel_in_char(const parallel_t *self) {
+  return (self->text->charset == INOTE_CHARSET_UTF_8) && (self->unit != 1);
+}
+
+/* number of characters of the valid UTF-8 bytes */
+static size_t utf8_get_char_nb(const uint8_t *b, size_t length) {
+  size_t i, nb = 0;
+  for (i=0; i<length; i++) {
+    nb += ((b[i] & 0xC0) != 0x80);
+  }
+  return nb;
+}
+
+/* byte offset of position in the text (the chunk starts before position) */
+static size_t chunk_get_byte(const chunk_t *self, const parallel_t *parallel, size_t position) {
+  const uint8_t *b = parallel->text->buffer;
+  size_t i = self->start;
+  size_t nb = position - self->position;
+  if (!parallel_in_char(parallel))
+    return i + nb;
+  for (; nb; nb--) {
+    for (i++; (i < parallel->text->length) && ((b[i] & 0xC0) == 0x80); i++) {
+    }
+  }
+  return i;
+}
+
+/* record the sync points and stop once the pattern reaches the limit */
+static bool chunk_converted(observer_t *observer, const pattern_t *pattern) {
+  chunk_t *self = (chunk_t*)observer;
+  inote_t *handle = self->handle;
+
+  if (self->tlv_message.buffer + pattern->tlv_offset + 2*TLV2_LENGTH_MAX > self->tlv_message.end_of_buffer) {
+    // the pattern may have been converted differently (close to the
+    // end of the tlv message)
+    self->valid = false;
+    return true;
+  }
+  
+  if (pattern->new_tlv && (self->nb_point < SYNC_POINT_MAX)) {
+    // a pattern which starts a tlv does not modify the punctuation list
+    sync_point_t *point = self->point + self->nb_point;
+    size_t i = self->nb_punctuation_list - 1;
+    if (!punct_set_equal(self->punctuation_list[i], handle->punctuation_list)) {
+      i++;
+      if (i < SYNC_PUNCT_LIST_MAX) {
+	self->punctuation_list[i] = punct_set_ref(handle->punctuation_list);
+	self->nb_punctuation_list++;
+      }
+    }
+    if (i < SYNC_PUNCT_LIST_MAX) {
+      point->position = pattern->position;
+      point->tlv_offset = pattern->tlv_offset;
+      point->state = *pattern->state;
+      point->removing_leading_space = pattern->removing_leading_space;
+      point->punctuation_list = i;
+      self->nb_point++;
+    }
+  }
+  self->end = pattern->next;
+  return (pattern->next >= self->limit);
+}
+
+static void chunk_convert_job(size_t worker, size_t index, void *user_data) {
+  parallel_t *parallel = (parallel_t*)user_data;
+  chunk_t *chunk = parallel->chunk + index;
+  inote_t *self = parallel->batch->worker[worker];
+  const inote_slice_t *text = parallel->text;
+  inote_slice_t slice = *text;
+  inote_state_t state = chunk->state;
+  size_t text_left;
+  tlv_t tlv;
+  inote_error ret;
+  
+  handle_copy_settings(self, parallel->handle);
+  if (index) {
+    // expected state (the first chunk is converted as is)
+    self->removing_leading_space = false;
+    punct_set_assign(&self->punctuation_list, chunk->punctuation_list[0]);
+  }
+  self->run.type = INOTE_TYPE_UNDEFINED;
+  slice.buffer += chunk->start;
+  slice.length -= chunk->start;
+
+  chunk->handle = self;
+  chunk->valid = true;
+  chunk->end = chunk->position;
+  chunk->observer.base = chunk->position;
+  chunk->observer.unit = parallel->unit;
+  self->observer = &chunk->observer;
+  memset(&self->stats, 0, sizeof(self->stats));
+  ret = handle_get_scratch(self);
+  if (!ret) {
+    convert_tlv_init(self, &tlv, &chunk->tlv_message);
+    ret = convert_windows(self, &slice, &state, &tlv, &text_left, false, false);
+    handle_put_scratch(self);
+  }
+  self->observer = NULL;
+  convert_reset(self->cd_to_char32, text->charset);
+  chunk->stats = self->stats;
+  
+  if (ret) {
+    chunk->valid = false;
+  }
+  chunk->end_state = state;
+  chunk->end_removing_leading_space = self->removing_leading_space;
+  chunk->end_run = self->run;
+  chunk->end_punctuation_list = punct_set_ref(self->punctuation_list);
+  chunk->end_header = (uint8_t*)tlv.header;
+  punct_set_assign(&self->punctuation_list, NULL);
+}
+
+/* stop at the first pattern which matches a sync point of the next chunks */
+static bool join_converted(observer_t *observer, const pattern_t *pattern) {
+  join_t *self = (join_t*)observer;
+  parallel_t *parallel = self->parallel;
+
+  if (!pattern->new_tlv)
+    return false;
+  
+  while (self->chunk < parallel->nb_chunk) {
+    chunk_t *chunk = parallel->chunk + self->chunk;
+    const sync_point_t *point;
+    size_t length;
+    
+    for (; self->point < chunk->nb_point; self->point++) {
+      if (chunk->point[self->point].position >= pattern->position)
+	break;
+    }
+    if (!chunk->valid || (self->point == chunk->nb_point)) {
+      // no sync point left in this chunk
+      self->chunk++;
+      self->point = 0;
+      continue;
+    }
+    
+    point = chunk->point + self->point;
+    if ((point->position != pattern->position)
+	|| !state_equal(&point->state, pattern->state)
+	|| (point->removing_leading_space != pattern->removing_leading_space)
+	|| !punct_set_equal(chunk->punctuation_list[point->punctuation_list], self->handle->punctuation_list))
+      return false;
+
+    // room for the tlv of the chunk (converted as with a larger tlv message)
+    length = chunk->tlv_message.length - point->tlv_offset;
+    if (self->tlv_message->buffer + pattern->tlv_offset + length + 2*TLV2_LENGTH_MAX > self->tlv_message->end_of_buffer)
+      return false;
+    
+    self->synced = chunk;
+    self->synced_point = point;
+    self->tlv_offset = pattern->tlv_offset;
+    return true;
+  }
+  return false;
+}
+
+/* 
+   expected state at each chunk: the annotations which modify the
+   state are searched in the text before the chunk
+*/
+static void parallel_predict_state(parallel_t *self, const inote_state_t *state, punct_set_t *punctuation_list) {
+  const inote_slice_t *text = self->text;
+  const uint8_t *b = text->buffer;
+  const uint8_t *bmax = b + text->length;
+  inote_state_t current = *state;
+  punct_set_t *list = punct_set_ref(punctuation_list);
+  size_t i;
+
+  for (i=0; i<self->nb_chunk; i++) {
+    chunk_t *chunk = self->chunk + i;
+    const uint8_t *start = text->buffer + chunk->start;
+    const uint8_t *t;
+    
+    while (current.annotation && (b < start)
+	   && (t = (const uint8_t*)memchr(b, '`', start - b))) {
+      const uint8_t *end = (const uint8_t*)memchr(t, ' ', bmax - t);
+      b = t + 1;
+      if (!end)
+	break;
+      if ((end - t >= 5) && !memcmp(t, "`gfa1", 5)) {
+	current.ssml = 1;
+      } else if ((end - t >= 4) && !memcmp(t, "`Pf", 3)) {
+	switch (t[3]) {
+	case '0':
+	  current.punct_mode = INOTE_PUNCT_MODE_NONE;
+	  break;
+	case '1':
+	  current.punct_mode = INOTE_PUNCT_MODE_ALL;
+	  break;
+	case '2': {
+	  // at most one character per byte
+	  char32_t *buf = (char32_t*)allocator_malloc(&self->handle->allocator, (end - (t + 4))*sizeof(char32_t));
+	  char *inbuf = (char*)(t + 4);
+	  size_t inbytesleft = end - (t + 4);
+	  char *outbuf = (char*)buf;
+	  size_t outbytesleft = inbytesleft*sizeof(char32_t);
+	  size_t j, n;
+	  current.punct_mode = INOTE_PUNCT_MODE_SOME;
+	  punct_set_unref(list);
+	  list = NULL;
+	  if (!buf)
+	    break; // mispredicted: the chunk won't be synced
+	  conv_to_char32(text->charset, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+	  n = (outbuf - (char*)buf)/sizeof(char32_t);
+	  list = n ? punct_set_new(n, &self->handle->allocator) : NULL;
+	  for (j=0; list && (j<n); j++) {
+	    punct_set_add(list, buf[j]);
+	  }
+	  allocator_free(&self->handle->allocator, buf);
+	}
+	  break;
+	default:
+	  break;
+	}
+      }
+    }
+    chunk->state = current;
+    chunk->punctuation_list[0] = punct_set_ref(list);
+  }
+  punct_set_unref(list);
+}
+
+/* 
+   split the text into chunks starting after a space; return false if
+   the text can't be split
+*/
+static bool parallel_split(parallel_t *self, size_t nb_chunk) {
+  const inote_slice_t *text = self->text;
+  const uint8_t *b = text->buffer;
+  size_t lookahead = sizeof(((scratch_t*)NULL)->char32_buf);
+  size_t i, start = 0, position = 0;
+
+  self->nb_chunk = 0;
+  for (i=0; i<nb_chunk; i++) {
+    chunk_t *chunk = self->chunk + self->nb_chunk;
+    size_t s = text->length*i/nb_chunk;
+    
+    for (; (s < text->length) && (s > 0) && (b[s-1] != ' ') && (b[s-1] != '\n'); s++) {
+    }
+    if ((s >= text->length) || (i && (s <= start)))
+      continue;
+    position += parallel_in_char(self) ? utf8_get_char_nb(b + start, s - start) : s - start;
+    start = s;
+    chunk->start = start;
+    chunk->position = position;
+    self->nb_chunk++;
+  }
+
+  for (i=0; i<self->nb_chunk; i++) {
+    chunk_t *chunk = self->chunk + i;
+    size_t end = (i+1 < self->nb_chunk) ? self->chunk[i+1].start : text->length;
+    size_t length = (end - chunk->start + lookahead)*((self->tlv_charset == INOTE_CHARSET_UTF_32) ? 8 : 4)
+      + 4*TLV2_LENGTH_MAX;
+    
+    chunk->limit = (i+1 < self->nb_chunk) ? self->chunk[i+1].position : SIZE_MAX;
+    chunk->nb_punctuation_list = 1;
+    chunk->point = (sync_point_t*)allocator_malloc(&self->handle->allocator, SYNC_POINT_MAX*sizeof(*chunk->point));
+    chunk->tlv_message.buffer = (uint8_t*)allocator_malloc(&self->handle->allocator, length);
+    if (!chunk->point || !chunk->tlv_message.buffer)
+      return false;
+    chunk->tlv_message.length = 0;
+    chunk->tlv_message.charset = self->tlv_charset;
+    chunk->tlv_message.end_of_buffer = chunk->tlv_message.buffer + length;
+  }
+  return (self->nb_chunk > 1);
+}
+
+/* true if the text is valid (the whole text can be decoded) */
+static bool parallel_check_text(const inote_slice_t *text) {
+  char *inbuf = (char*)text->buffer;
+  size_t inbytesleft = text->length;
+
+  if (memmem(text->buffer, text->length, "`l", 2)) {
+    // language switching: text_left is set from the whole text
+    return false;
+  }
+  if (text->charset == INOTE_CHARSET_ISO_8859_1)
+    return true;
+  if (text->charset != INOTE_CHARSET_UTF_8)
+    return false;
+  while (inbytesleft) {
+    char buf[MAX_INPUT_BYTES];
+    char *outbuf = buf;
+    size_t outbytesleft = sizeof(buf);
+    if ((conv_check_utf8(&inbuf, &inbytesleft, &outbuf, &outbytesleft) == (size_t)-1)
+	&& (errno != E2BIG))
+      return false;
+  }
+  return true;
+}
+
+/* add the work of the workers to the counters of the handle */
+static void parallel_count(parallel_t *self, inote_stats_t *stats) {
+  size_t i;
+  for (i=0; i<self->nb_chunk; i++) {
+    const inote_stats_t *s = &self->chunk[i].stats;
+    stats->units_decoded += s->units_decoded;
+    stats->iconv_calls += s->iconv_calls;
+    stats->fallbacks += s->fallbacks;
+    stats->decode_ns += s->decode_ns;
+    stats->scan_ns += s->scan_ns;
+    stats->encode_ns += s->encode_ns;
+  }
+}
+
+static void parallel_free(parallel_t *self) {
+  size_t i;
+  if (!self->chunk)
+    return;
+  for (i=0; i<self->nb_chunk; i++) {
+    chunk_t *chunk = self->chunk + i;
+    size_t j;
+    allocator_free(&self->handle->allocator, chunk->point);
+    allocator_free(&self->handle->allocator, chunk->tlv_message.buffer);
+    for (j=0; j<chunk->nb_punctuation_list; j++) {
+      punct_set_unref(chunk->punctuation_list[j]);
+    }
+    punct_set_unref(chunk->end_punctuation_list);
+  }
+  allocator_free(&self->handle->allocator, self->chunk);
+}
+
+/*
+  join the chunks to the tlv message of the handle.
+  Return INOTE_UNPROCESSED if the text must be converted sequentially.
+*/
+static inote_error parallel_join(parallel_t *self, inote_t *handle, inote_state_t *state, inote_slice_t *tlv_message) {
+  const inote_slice_t *text = self->text;
+  chunk_t *chunk = self->chunk;
+  size_t position = 0;
+  size_t byte = 0;
+  size_t offset = tlv_message->length;
+  join_t join;
+  tlv_t tlv;
 
-  if (!state || !text_left) {
-    ret = INOTE_ARGS_ERROR;
+  memset(&join, 0, sizeof(join));
+  join.observer.converted = join_converted;
+  join.observer.unit = self->unit;
+  join.parallel = self;
+  join.handle = handle;
+  join.tlv_message = tlv_message;
+  join.chunk = 1;
+  convert_tlv_init(handle, &tlv, tlv_message);
+
+  // the first chunk is converted from the state of the handle
+  if (chunk->valid
+      && (tlv_message->buffer + offset + chunk->tlv_message.length + 2*TLV2_LENGTH_MAX <= tlv_message->end_of_buffer)) {
+    join.synced = chunk;
+    join.tlv_offset = offset;
+  }
+
+  while (true) {
+    inote_slice_t slice = *text;
+    size_t text_left;
+    inote_error ret;
+    
+    if (join.synced) {
+      // copy the tlv of the chunk from the sync point
+      chunk_t *c = join.synced;
+      trace(INOTE_TRACE_JOIN, c - chunk, join.synced_point ? join.synced_point->position : 0);
+      size_t from = join.synced_point ? join.synced_point->tlv_offset : 0;
+      memcpy(tlv_message->buffer + join.tlv_offset, c->tlv_message.buffer + from, c->tlv_message.length - from);
+      tlv_message->length = join.tlv_offset + c->tlv_message.length - from;
+      tlv.header = c->end_header ?
+	(inote_tlv_t*)(tlv_message->buffer + join.tlv_offset + (c->end_header - c->tlv_message.buffer - from)) : NULL;
+      tlv.previous_header = NULL;
+      *state = c->end_state;
+      handle->removing_leading_space = c->end_removing_leading_space;
+      handle->run = c->end_run;
+      punct_set_assign(&handle->punctuation_list, c->end_punctuation_list);
+      position = c->end;
+      byte = chunk_get_byte(c, self, position);
+      join.chunk = c - chunk + 1;
+      join.point = 0;
+      join.synced = NULL;
+      join.synced_point = NULL;
+    }
+    if (byte >= text->length)
+      break;
+
+    // sequential conversion up to the next sync point
+    slice.buffer += byte;
+    slice.length -= byte;
+    join.observer.base = position;
+    join.observer.stopped = false;
+    handle->run.type = INOTE_TYPE_UNDEFINED;
+    handle->observer = &join.observer;
+    ret = convert_windows(handle, &slice, state, &tlv, &text_left, false, false);
+    handle->observer = NULL;
+    convert_reset(handle->cd_to_char32, text->charset);
+    if (ret)
+      return INOTE_UNPROCESSED;
+    if (!join.synced)
+      break;
+  }
+  return INOTE_OK;
+}
+
+inote_error inote_convert_text_to_tlv_parallel(void *batch, void *handle, const inote_slice_t *text, inote_state_t *state, inote_slice_t *tlv_message, size_t *text_left) {
+  dbg("ENTER batch=%p, self=%p", batch, (inote_t*)handle);
+  batch_t *b = (batch_t*)batch;
+  inote_t *self = (inote_t*)handle;
+  parallel_t parallel;
+  inote_slice_t output;
+  inote_error ret;
+  size_t i;
+  // initial: restored to convert the text sequentially
+  struct {
+    size_t tlv_message_length;
+    inote_state_t state;
+    bool removing_leading_space;
+    punct_set_t *punctuation_list;
+  } initial;
+  
+  if (!b || (b->magic != BATCH_MAGIC))
+    return INOTE_ARGS_ERROR;
+
+  ret = convert_check_args(handle, text, state, tlv_message, text_left);
+  if (ret)
+    return ret;
+
+  if ((b->nb_worker < 2) || self->sink.write
+      || (text->length < PARALLEL_TEXT_LENGTH_MIN)
+      || !parallel_check_text(text))
+    goto exit1;
+
+  ret = handle_get_scratch(self);
+  if (ret)
+    goto exit1;
+  ret = convert_init(self, text, tlv_message, &output);
+  if (ret) {
+    handle_put_scratch(self);
+    goto exit1;
+  }
+
+  memset(&parallel, 0, sizeof(parallel));
+  parallel.batch = b;
+  parallel.handle = self;
+  parallel.text = text;
+  parallel.tlv_charset = tlv_message->charset;
+  parallel.unit = (output.charset == INOTE_CHARSET_UTF_8) ? 1 : sizeof(char32_t);
+  parallel.chunk = (chunk_t*)allocator_calloc(&self->allocator, b->nb_worker, sizeof(chunk_t));
+  ret = INOTE_UNPROCESSED;
+  if (!parallel.chunk || !parallel_split(&parallel, b->nb_worker))
     goto exit0;
-  }	
+
+  parallel_predict_state(&parallel, state, self->punctuation_list);
+  for (i=0; i<parallel.nb_chunk; i++) {
+    parallel.chunk[i].observer.converted = chunk_converted;
+  }
+  pool_run(b->pool, parallel.nb_chunk, chunk_convert_job, &parallel);
+
+  initial.tlv_message_length = tlv_message->length;
+  initial.state = *state;
+  initial.removing_leading_space = self->removing_leading_space;
+  initial.punctuation_list = punct_set_ref(self->punctuation_list);
   
   *text_left = 0;
+  ret = parallel_join(&parallel, self, state, tlv_message);
+  if (ret) {
+    tlv_message->length = initial.tlv_message_length;
+    *state = initial.state;
+    self->removing_leading_space = initial.removing_leading_space;
+    punct_set_assign(&self->punctuation_list, initial.punctuation_list);
+  } else {
+    parallel_count(&parallel, &self->stats);
+    stats_count_conversion(&self->stats, ret, text, 0, tlv_message, initial.tlv_message_length, false);
+  }
+  punct_set_unref(initial.punctuation_list);
+  
+ exit0:
+  parallel_free(&parallel);
+  handle_put_scratch(self);
+  if (!ret) {
+    dbg("LEAVE(%s)", inote_error_get_string(ret));
+    return ret;
+  }
+  
+ exit1:
+  dbg("sequential conversion");
+  return inote_convert_text_to_tlv(handle, text, state, tlv_message, text_left);
+}
 
-  if (!text->length) {
-    tlv_message->length = 0;
-    ret = INOTE_OK;
+inote_error inote_tlv_iterator_begin(inote_tlv_iterator_t *it, const inote_slice_t *tlv_message) {
+  if (!it || !slice_check(tlv_message))
+    return INOTE_ARGS_ERROR;
+  memset(it, 0, sizeof(*it));
+  it->next = tlv_message->buffer;
+  it->end = tlv_message->buffer + tlv_message->length;
+  return INOTE_OK;
+}
+
+bool inote_tlv_iterator_next(inote_tlv_iterator_t *it) {
+  const inote_tlv_t *tlv;
+  size_t header_size;
+
+  if (!it || !it->next || (it->next >= it->end))
+    return false;
+  
+  tlv = (const inote_tlv_t*)it->next;
+  if ((size_t)(it->end - it->next) < TLV_HEADER_LENGTH_MAX)
+    goto truncated;
+  header_size = header_get_size(tlv);
+  if ((size_t)(it->end - it->next) < header_size)
+    goto truncated;
+  it->length = inote_tlv_get_length(tlv);
+  if (it->end - it->next - header_size < it->length)
+    goto truncated;
+  it->tlv = tlv;
+  it->type = inote_tlv_get_type(tlv);
+  it->value = it->next + header_size;
+  it->next = it->value + it->length;
+  return true;
+
+ truncated:
+  dbg("truncated tlv (%p)", (void*)tlv);
+  it->error = INOTE_TLV_ERROR;
+  it->next = NULL;
+  return false;
+}
+
+inote_error inote_tlv_index(const inote_slice_t *tlv_message, inote_tlv_index_t *index) {
+  ENTER();
+  inote_tlv_iterator_t it;
+  inote_error ret = inote_tlv_iterator_begin(&it, tlv_message);
+  size_t i;
+
+  if (ret || !index || (tlv_message->length > UINT32_MAX)) {
+    ret = INOTE_ARGS_ERROR;
     goto exit0;
   }
 
-  DBG_PRINT_SLICE(text);
-  DBG_PRINT_STATE(state);
+  for (i=0; inote_tlv_iterator_next(&it); i++) {
+    if (i >= index->capacity)
+      continue;
+    if (index->type)
+      index->type[i] = it.type;
+    if (index->offset)
+      index->offset[i] = it.value - tlv_message->buffer;
+    if (index->length)
+      index->length[i] = it.length;
+  }
+  index->nb = i;
+  ret = it.error;
 
-  dbg("text=%s", text->buffer)
-  
-  output.buffer = (uint8_t*)self->char32_buf;
-  output.length = 0;
-  output.charset = INOTE_CHARSET_UTF_32;
-  output.end_of_buffer = output.buffer + sizeof(self->char32_buf);
-  
-  if (get_charset("UTF32LE", charset_name[text->charset], &self->cd_to_char32[text->charset])
-      || get_charset(charset_name[tlv_message->charset], "UTF32LE", &self->cd_from_char32[tlv_message->charset]))  {
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));  
+  return ret;
+}
+
+/*
+  check the attributes of an INOTE_TYPE_SSML tlv: pairs of strings
+  (name, value), each one preceded by its length in bytes
+*/
+static inote_error tlv_validate_ssml_attributes(const uint8_t *value, size_t length, inote_charset_t charset, bool check_charset) {
+  const uint8_t *max = value + length;
+  inote_error ret;
+  int i;
+
+  while (value < max) {
+    for (i=0; i<2; i++) {
+      if ((value >= max) || (*value >= (size_t)(max - value)) || (!i && !*value))
+	return INOTE_TLV_ERROR;
+      if (check_charset && (ret = conv_validate(charset, value + 1, *value)))
+	return ret;
+      value += 1 + *value;
+    }
+  }
+  return INOTE_OK;
+}
+
+static inote_error tlv_validate_value(const inote_tlv_iterator_t *it, inote_charset_t charset, bool check_charset) {
+  switch (it->type) {
+  case INOTE_TYPE_TEXT:
+  case INOTE_TYPE_PUNCTUATION:
+  case INOTE_TYPE_ANNOTATION:
+  case INOTE_TYPE_CAPITAL:
+  case INOTE_TYPE_CAPITALS:
+    return check_charset ? conv_validate(charset, it->value, it->length) : INOTE_OK;
+  case INOTE_TYPE_CHARSET:
+    return INOTE_OK;
+  case INOTE_TYPE_SSML:
+    if (!it->length || (it->value[0] == INOTE_SSML_UNDEFINED) || (it->value[0] > INOTE_SSML_LANG_END))
+      break;
+    if (it->value[0] == INOTE_SSML_BREAK)
+      return (it->length == 1 + sizeof(uint32_t)) ? INOTE_OK : INOTE_TLV_ERROR;
+    return tlv_validate_ssml_attributes(it->value + 1, it->length - 1, charset, check_charset);
+  case INOTE_TYPE_LANGUAGE:
+    if (it->length == sizeof(uint32_t))
+      return INOTE_OK;
+    break;
+  default:
+    break;
+  }
+  return INOTE_TLV_ERROR;
+}
+
+inote_error inote_tlv_validate(const inote_slice_t *tlv_message, bool check_charset, size_t *offset) {
+  ENTER();
+  inote_tlv_iterator_t it;
+  inote_error ret = inote_tlv_iterator_begin(&it, tlv_message);
+
+  if (ret || !offset) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+  if (check_charset && (tlv_message->charset == INOTE_CHARSET_UNDEFINED)) {
     ret = INOTE_CHARSET_ERROR;
     goto exit0;
   }
-  
-  inbuf = (char *)(text->buffer);
-  inbytesleft = text->length;
-  outbuf = (char *)(output.buffer);
-  outbytesleft = outbytesleftmax = slice_get_free_size(&output);
 
-  iconv_status = -1;
-  dbg("iconv");
-  iconv_status = iconv(self->cd_to_char32[text->charset],
-		       &inbuf, &inbytesleft,
-		       &outbuf, &outbytesleft);
-  if (iconv_status != -1) {
-    *text_left = inbytesleft;
-    output.length = outbytesleftmax - outbytesleft;
-    ret = inote_get_type_length_value(self, &output, state, tlv_message);
-	
-    if (ret == INOTE_LANGUAGE_SWITCHING) {
-      char *s = (char *)memmem(text->buffer, text->length, "`l", 2); // TODO convert the annotation in the corresponding charset
-      const char *tmax = text->buffer + text->length;
-      if (s && (s < tmax)) {
-	*text_left = tmax - s;
+  // the headers are chained: the walk is sequential, the values are
+  // checked by the vectorized helpers of conv
+  *offset = 0;
+  while (inote_tlv_iterator_next(&it)) {
+    if (it.length > TLV2_VALUE_LENGTH_MAX) {
+      ret = INOTE_TLV_ERROR;
+    } else {
+      ret = tlv_validate_value(&it, tlv_message->charset, check_charset);
+    }
+    if (ret)
+      goto exit0;
+    *offset = it.next - tlv_message->buffer;
+  }
+  ret = it.error;
+
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));  
+  return ret;
+}
+
+/* next tlv of the message */
+static uint8_t *tlv_skip(uint8_t *t) {
+  const inote_tlv_t *tlv = (const inote_tlv_t*)t;
+  return t + header_get_size(tlv) + inote_tlv_get_length(tlv);
+}
+
+inote_error inote_tlv_coalesce(inote_slice_t *tlv_message, size_t length_max) {
+  ENTER();
+  inote_tlv_iterator_t it;
+  inote_error ret = inote_tlv_iterator_begin(&it, tlv_message);
+  uint8_t *r, *w, *end;
+
+  if (ret || (length_max > TLV2_VALUE_LENGTH_MAX)) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+  while (inote_tlv_iterator_next(&it)) {
+  }
+  ret = it.error;
+  if (ret)
+    goto exit0;
+
+  r = w = tlv_message->buffer;
+  end = r + tlv_message->length;
+  while (r < end) {
+    inote_tlv_t *header = (inote_tlv_t*)r;
+    size_t header_size = header_get_size(header);
+    size_t first_length = inote_tlv_get_length(header);
+    size_t length = first_length;
+    size_t new_header_size, nb = 1;
+    uint8_t *next = tlv_skip(r);
+    uint8_t *second = next;
+    uint8_t *t, *value;
+    bool forward;
+
+    if (inote_tlv_get_type(header) == INOTE_TYPE_TEXT) {
+      while ((next < end) && (inote_tlv_get_type((inote_tlv_t*)next) == INOTE_TYPE_TEXT)
+	     && (length + inote_tlv_get_length((inote_tlv_t*)next) <= length_max)) {
+	length += inote_tlv_get_length((inote_tlv_t*)next);
+	next = tlv_skip(next);
+	nb++;
       }
     }
-  } else {
-    int err = errno;
-    uint8_t *byte_error = (uint8_t *)inbuf;
-    uint8_t *last_byte = slice_get_last_byte(text);
-    if (byte_error && last_byte && (byte_error <= last_byte)) {
-      *text_left = last_byte - byte_error + 1;
-    }
-    switch (err) {
-    case EILSEQ:
-      ret = INOTE_INVALID_MULTIBYTE;
-      break;
-    case EINVAL:
-      ret = INOTE_INCOMPLETE_MULTIBYTE;
-      break;
-    default:
-      ret = INOTE_ERRNO + err;
-      break;
+    if (nb == 1) {
+      memmove(w, r, next - r);
+      w += next - r;
+      r = next;
+      continue;
     }
-    dbg("%s", strerror(err));
+
+    /*
+      the values are moved in order: a value never overwrites the
+      header of the next tlv. If the v2 header shifts it forward, the
+      first value is moved last.
+    */
+    new_header_size = ((length > TLV_VALUE_LENGTH_MAX) || (header_size == TLV2_HEADER_LENGTH)) ?
+      TLV2_HEADER_LENGTH : TLV_HEADER_LENGTH_MAX;
+    forward = (w + new_header_size > r + header_size);
+    if (!forward) {
+      memmove(w + new_header_size, r + header_size, first_length);
+    }
+    value = w + new_header_size + first_length;
+    for (t = second; t < next; ) {
+      const inote_tlv_t *tlv = (const inote_tlv_t*)t;
+      size_t len = inote_tlv_get_length(tlv);
+      uint8_t *t_next = tlv_skip(t);
+      memmove(value, inote_tlv_get_value(tlv), len);
+      value += len;
+      t = t_next;
+    }
+    if (forward) {
+      memmove(w + new_header_size, r + header_size, first_length);
+    }
+    header = (inote_tlv_t*)w;
+    header->type = INOTE_TYPE_TEXT | ((new_header_size == TLV2_HEADER_LENGTH) ? INOTE_TLV_V2 : 0);
+    header_set_length(header, length);
+    dbg("%lu text tlv merged (length=%lu)", (unsigned long)nb, (unsigned long)length);
+    w += new_header_size + length;
+    r = next;
   }
-  
-  /* initialize iconv state */
-  iconv(self->cd_to_char32[text->charset], NULL, NULL, NULL, NULL);
-  //  DebugDump("tlv: ", tlv_message->buffer, min_size(tlv_message->length, 256));
-  
+  tlv_message->length = w - tlv_message->buffer;
+
  exit0:
-  DBG_PRINT_SLICE(tlv_message);
-  dbg("LEAVE(%s), *text_left=%lu", inote_error_get_string(ret), text_left ? (long unsigned int)(*text_left) : 0);  
+  dbg("LEAVE(%s)", inote_error_get_string(ret));  
   return ret;
 }
 
 inote_error inote_convert_tlv_to_text(inote_slice_t *tlv_message, inote_cb_t *cb) {
+  inote_cb_ext_t ext;
+
+  if (!cb) {
+    return INOTE_ARGS_ERROR;
+  }
+  // the callbacks added since are unknown to the caller
+  memset(&ext, 0, sizeof(ext));
+  ext.cb = *cb;
+  return inote_convert_tlv_to_text_ext(tlv_message, &ext);
+}
+
+inote_error inote_convert_tlv_to_text_ext(inote_slice_t *tlv_message, const inote_cb_ext_t *ext) {
   ENTER();
   inote_error ret = INOTE_OK;
+  const inote_cb_t *cb = ext ? &ext->cb : NULL;
+  inote_tlv_iterator_t it;
   inote_tlv_t *tlv;
-  uint8_t *t, *tmax;
   bool capitals = false;
 
   if (!cb_check(cb)) {
@@ -1052,41 +3815,49 @@ inote_error inote_convert_tlv_to_text(inote_slice_t *tlv_message, inote_cb_t *cb
     goto exit0;
   }
   
-  if (!slice_check(tlv_message)) {
-    ret = INOTE_ARGS_ERROR;
+  ret = inote_tlv_iterator_begin(&it, tlv_message);
+  if (ret)
     goto exit0;
-  }  
 
   DBG_PRINT_SLICE(tlv_message);
 
-  tmax = slice_get_last_byte(tlv_message) + 1 - TLV_HEADER_LENGTH_MAX;
-  t = tlv_message->buffer;
-  while ((t <= tmax) && !ret) {
-    tlv = (inote_tlv_t*)t;
-    switch (tlv->type) {
+  while (!ret && inote_tlv_iterator_next(&it)) {
+    tlv = (inote_tlv_t*)it.tlv;
+    switch (it.type) {
     case INOTE_TYPE_TEXT:
-      cb->add_text(tlv, cb->user_data);
+      ret = cb->add_text(tlv, cb->user_data);
       break;
     case INOTE_TYPE_CAPITALS:
       capitals = true;
+      /* fallthrough */
     case INOTE_TYPE_CAPITAL:
-      cb->add_capital(tlv, capitals, cb->user_data);
+      ret = cb->add_capital(tlv, capitals, cb->user_data);
       break;
     case INOTE_TYPE_PUNCTUATION:
-      cb->add_punctuation(tlv, cb->user_data);
+      ret = cb->add_punctuation(tlv, cb->user_data);
       break;
     case INOTE_TYPE_ANNOTATION:
-      cb->add_annotation(tlv, cb->user_data);
+      ret = cb->add_annotation(tlv, cb->user_data);
       break;
     case INOTE_TYPE_CHARSET:
-      cb->add_charset(tlv, cb->user_data);
+      ret = cb->add_charset(tlv, cb->user_data);
+      break;
+    case INOTE_TYPE_SSML:
+      if (ext->add_ssml)
+	ret = ext->add_ssml(tlv, cb->user_data);
+      break;
+    case INOTE_TYPE_LANGUAGE:
+      if (ext->add_language)
+	ret = ext->add_language(tlv, cb->user_data);
       break;
     default:
       dbg("wrong tlv (%p)", (void*)tlv);
       ret = INOTE_TLV_ERROR;
       break;
     }
-    t += TLV_HEADER_LENGTH_MAX + (uint8_t)tlv->length;
+  }
+  if (!ret) {
+    ret = it.error;
   }
 
  exit0:
@@ -1105,7 +3876,7 @@ inote_error inote_slice_get_type(const inote_slice_t *tlv_message, inote_type_t
   }  
 
   tlv = (inote_tlv_t*)tlv_message->buffer;
-  *type = tlv->type;
+  *type = inote_tlv_get_type(tlv);
 
  exit0:
   dbg("LEAVE(%s)", inote_error_get_string(ret));  
@@ -1117,6 +3888,9 @@ inote_error inote_set_compatibility(void *handle, int major, int minor, int patc
   inote_error ret = INOTE_OK;
   inote_t *self;
   version_t minimal_version = VERSION_COMPAT_CAPITAL;
+  version_t tlv_v2_version = VERSION_COMPAT_TLV_V2;
+  version_t ssml_version = VERSION_COMPAT_SSML;
+  version_t language_version = VERSION_COMPAT_LANGUAGE;
 
   if (!handle || ( (self=(inote_t*)handle)->magic != MAGIC)) {
     ret = INOTE_ARGS_ERROR;
@@ -1131,11 +3905,38 @@ inote_error inote_set_compatibility(void *handle, int major, int minor, int patc
 	    || ((minor == minimal_version.minor)
 		&& (patch >= minimal_version.patch))));
 
+  self->with_feature_tlv_v2 = (major > tlv_v2_version.major)
+    || ((major == tlv_v2_version.major)
+	&& ((minor > tlv_v2_version.minor)
+	    || ((minor == tlv_v2_version.minor)
+		&& (patch >= tlv_v2_version.patch))));
+
+  self->with_feature_ssml = (major > ssml_version.major)
+    || ((major == ssml_version.major)
+	&& ((minor > ssml_version.minor)
+	    || ((minor == ssml_version.minor)
+		&& (patch >= ssml_version.patch))));
+
+  self->with_feature_language = (major > language_version.major)
+    || ((major == language_version.major)
+	&& ((minor > language_version.minor)
+	    || ((minor == language_version.minor)
+		&& (patch >= language_version.patch))));
+
   self->capital_activated = false; // must be explicitly activated by inote_enable_capital()
   dbg("capital deactivated");
+  self->tlv_v2_activated = false; // must be explicitly activated by inote_enable_tlv_v2()
+  self->ssml_activated = false; // must be explicitly activated by inote_enable_ssml_tlv()
+  self->language_activated = false; // must be explicitly activated by inote_enable_language_tlv()
   
   if (self->with_feature_capital)
     dbg("with_feature_capital");
+  if (self->with_feature_tlv_v2)
+    dbg("with_feature_tlv_v2");
+  if (self->with_feature_ssml)
+    dbg("with_feature_ssml");
+  if (self->with_feature_language)
+    dbg("with_feature_language");
   
  exit0:
   dbg("LEAVE(%s)", inote_error_get_string(ret));  
@@ -1164,6 +3965,158 @@ inote_error inote_enable_capital(void *handle, bool with_capital) {
   return ret;
 }
 
+inote_error inote_enable_tlv_v2(void *handle, bool with_tlv_v2) {
+  dbg("ENTER with_tlv_v2:%d, self=%p", with_tlv_v2, (inote_t*)handle);
+  inote_error ret = INOTE_OK;
+  inote_t *self;
+
+  if (!handle || ( (self=(inote_t*)handle)->magic != MAGIC)) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+
+  if (self->with_feature_tlv_v2) {
+    self->tlv_v2_activated = with_tlv_v2;
+    dbg("tlv v2 %s", with_tlv_v2 ? "activated" : "deactivated");
+  } else if (with_tlv_v2) {
+    ret = INOTE_ARGS_ERROR;
+  }
+
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));  
+  return ret;
+}
+
+inote_error inote_enable_ssml_tlv(void *handle, bool with_ssml) {
+  dbg("ENTER with_ssml:%d, self=%p", with_ssml, (inote_t*)handle);
+  inote_error ret = INOTE_OK;
+  inote_t *self;
+
+  if (!handle || ( (self=(inote_t*)handle)->magic != MAGIC)) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+
+  if (self->with_feature_ssml) {
+    self->ssml_activated = with_ssml;
+    dbg("ssml tlv %s", with_ssml ? "activated" : "deactivated");
+  } else if (with_ssml) {
+    ret = INOTE_ARGS_ERROR;
+  }
+
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));  
+  return ret;
+}
+
+inote_error inote_enable_language_tlv(void *handle, bool with_language) {
+  dbg("ENTER with_language:%d, self=%p", with_language, (inote_t*)handle);
+  inote_error ret = INOTE_OK;
+  inote_t *self;
+
+  if (!handle || ( (self=(inote_t*)handle)->magic != MAGIC)) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+
+  if (self->with_feature_language) {
+    self->language_activated = with_language;
+    dbg("language tlv %s", with_language ? "activated" : "deactivated");
+  } else if (with_language) {
+    ret = INOTE_ARGS_ERROR;
+  }
+
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));  
+  return ret;
+}
+
+inote_error inote_set_tlv_split(void *handle, size_t threshold, inote_split_t split) {
+  dbg("ENTER threshold:%lu, split:%d, self=%p", (unsigned long)threshold, split, (inote_t*)handle);
+  inote_error ret = INOTE_OK;
+  inote_t *self;
+
+  if (!handle || ( (self=(inote_t*)handle)->magic != MAGIC)
+      || (threshold > TLV2_VALUE_LENGTH_MAX)
+      || ((split != INOTE_SPLIT_ANY) && (split != INOTE_SPLIT_WORD))) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+
+  self->tlv_threshold = threshold;
+  self->tlv_split = split;
+
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));  
+  return ret;
+}
+
+inote_error inote_set_scratch(void *handle, void *scratch) {
+  dbg("ENTER scratch=%p, self=%p", scratch, (inote_t*)handle);
+  inote_error ret = INOTE_OK;
+  inote_t *self;
+
+  if (!handle || ( (self=(inote_t*)handle)->magic != MAGIC)
+      || (scratch && !scratch_check((scratch_t*)scratch))) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+
+  self->attached_scratch = (scratch_t*)scratch;
+
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));  
+  return ret;
+}
+
+inote_error inote_get_stats(const void *handle, inote_stats_t *stats) {
+  dbg("ENTER self=%p", handle);
+  inote_error ret = INOTE_OK;
+  const inote_t *self = (const inote_t*)handle;
+
+  if (!self || (self->magic != MAGIC) || !stats) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+  *stats = self->stats;
+
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));  
+  return ret;
+}
+
+inote_error inote_reset_stats(void *handle) {
+  dbg("ENTER self=%p", handle);
+  inote_error ret = INOTE_OK;
+  inote_t *self = (inote_t*)handle;
+
+  if (!self || (self->magic != MAGIC)) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+  memset(&self->stats, 0, sizeof(self->stats));
+
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));  
+  return ret;
+}
+
+inote_error inote_enable_stats_timing(void *handle, bool with_timing) {
+  dbg("ENTER with_timing:%d, self=%p", with_timing, handle);
+  inote_error ret = INOTE_OK;
+  inote_t *self = (inote_t*)handle;
+
+  if (!self || (self->magic != MAGIC)) {
+    ret = INOTE_ARGS_ERROR;
+    goto exit0;
+  }
+  self->stats_timing = with_timing;
+
+ exit0:
+  dbg("LEAVE(%s)", inote_error_get_string(ret));  
+  return ret;
+}
+
 /* local variables: */
 /* c-basic-offset: 2 */
 /* end: */
@@ -0,0 +1,248 @@
+// for sysconf
+#define _GNU_SOURCE
+#include <unistd.h>
+//
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "pool.h"
+#include "debug.h"
+
+#define POOL_WORKER_MAX 256
+#define POOL_JOB_MAX UINT32_MAX
+
+/*
+   range of jobs of a worker: head (first job, low 32 bits) and tail
+   (end, high 32 bits), updated by compare-and-swap by its worker
+   (pop from head) and by the thieves (steal from tail)
+*/
+typedef struct {
+  _Alignas(64) _Atomic uint64_t jobs; // one cache line per worker
+} range_t;
+
+#define RANGE(head, tail) ((uint64_t)(head) | ((uint64_t)(tail) << 32))
+#define RANGE_HEAD(range) ((uint32_t)(range))
+#define RANGE_TAIL(range) ((uint32_t)((range) >> 32))
+
+typedef struct pool_t pool_t;
+
+typedef struct {
+  pool_t *pool;
+  size_t index;
+  pthread_t thread;
+} worker_t;
+
+struct pool_t {
+  size_t nb_worker;
+  worker_t *worker;
+  range_t *range;
+  // run_mutex: serialize the pool_run() calls
+  pthread_mutex_t run_mutex;
+  // mutex, start, done: protect generation, running and quit
+  pthread_mutex_t mutex;
+  pthread_cond_t start;
+  pthread_cond_t done;
+  // generation: incremented for each run
+  unsigned long generation;
+  // running: number of threads still running the current jobs
+  size_t running;
+  bool quit;
+  // current jobs
+  size_t offset;
+  pool_job_t job;
+  void *user_data;
+};
+
+/* take the first job of the range */
+static bool range_pop(range_t *self, uint32_t *job) {
+  uint64_t range = atomic_load(&self->jobs);
+  while (RANGE_HEAD(range) < RANGE_TAIL(range)) {
+    if (atomic_compare_exchange_weak(&self->jobs, &range,
+				     RANGE(RANGE_HEAD(range) + 1, RANGE_TAIL(range)))) {
+      *job = RANGE_HEAD(range);
+      return true;
+    }
+  }
+  return false;
+}
+
+/* move half of the jobs left by another worker to the range of worker */
+static bool pool_steal(pool_t *self, size_t worker) {
+  size_t i;
+  for (i=1; i<self->nb_worker; i++) {
+    range_t *victim = &self->range[(worker + i) % self->nb_worker];
+    uint64_t range = atomic_load(&victim->jobs);
+    while (RANGE_HEAD(range) < RANGE_TAIL(range)) {
+      uint32_t tail = RANGE_TAIL(range);
+      uint32_t nb = (tail - RANGE_HEAD(range) + 1)/2;
+      if (atomic_compare_exchange_weak(&victim->jobs, &range,
+				       RANGE(RANGE_HEAD(range), tail - nb))) {
+	atomic_store(&self->range[worker].jobs, RANGE(tail - nb, tail));
+	return true;
+      }
+    }
+  }
+  return false;
+}
+
+static void pool_work(pool_t *self, size_t worker) {
+  uint32_t job;
+  do {
+    while (range_pop(&self->range[worker], &job)) {
+      self->job(worker, self->offset + job, self->user_data);
+    }
+  } while (pool_steal(self, worker));
+}
+
+static void *pool_thread(void *arg) {
+  worker_t *worker = (worker_t*)arg;
+  pool_t *self = worker->pool;
+  unsigned long generation = 0;
+
+  while (true) {
+    pthread_mutex_lock(&self->mutex);
+    while (!self->quit && (generation == self->generation)) {
+      pthread_cond_wait(&self->start, &self->mutex);
+    }
+    generation = self->generation;
+    if (self->quit) {
+      pthread_mutex_unlock(&self->mutex);
+      break;
+    }
+    pthread_mutex_unlock(&self->mutex);
+
+    pool_work(self, worker->index);
+
+    pthread_mutex_lock(&self->mutex);
+    if (!--self->running) {
+      pthread_cond_signal(&self->done);
+    }
+    pthread_mutex_unlock(&self->mutex);
+  }
+  return NULL;
+}
+
+void *pool_create(size_t nb_worker) {
+  ENTER();
+  pool_t *self;
+  size_t i;
+
+  if (!nb_worker) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    nb_worker = (n > 0) ? n : 1;
+  }
+  if (nb_worker > POOL_WORKER_MAX) {
+    nb_worker = POOL_WORKER_MAX;
+  }
+
+  self = (pool_t*)calloc(1, sizeof(*self));
+  if (!self)
+    return NULL;
+
+  self->nb_worker = nb_worker;
+  self->worker = (worker_t*)calloc(nb_worker, sizeof(*self->worker));
+  self->range = (range_t*)aligned_alloc(sizeof(range_t), nb_worker*sizeof(range_t));
+  if (!self->worker || !self->range) {
+    free(self->worker);
+    free(self->range);
+    free(self);
+    return NULL;
+  }
+  for (i=0; i<nb_worker; i++) {
+    atomic_init(&self->range[i].jobs, 0);
+  }
+  pthread_mutex_init(&self->run_mutex, NULL);
+  pthread_mutex_init(&self->mutex, NULL);
+  pthread_cond_init(&self->start, NULL);
+  pthread_cond_init(&self->done, NULL);
+
+  // worker 0: calling thread
+  for (i=1; i<nb_worker; i++) {
+    worker_t *worker = &self->worker[i];
+    worker->pool = self;
+    worker->index = i;
+    if (pthread_create(&worker->thread, NULL, pool_thread, worker)) {
+      err("pthread_create failed (worker %lu)", (long unsigned int)i);
+      self->nb_worker = i;
+      break;
+    }
+  }
+  dbg("self=%p, nb_worker=%lu", self, (long unsigned int)self->nb_worker);
+  return self;
+}
+
+void pool_delete(void *pool) {
+  ENTER();
+  pool_t *self = (pool_t*)pool;
+  size_t i;
+
+  if (!self)
+    return;
+
+  pthread_mutex_lock(&self->mutex);
+  self->quit = true;
+  pthread_cond_broadcast(&self->start);
+  pthread_mutex_unlock(&self->mutex);
+
+  for (i=1; i<self->nb_worker; i++) {
+    pthread_join(self->worker[i].thread, NULL);
+  }
+  pthread_cond_destroy(&self->done);
+  pthread_cond_destroy(&self->start);
+  pthread_mutex_destroy(&self->mutex);
+  pthread_mutex_destroy(&self->run_mutex);
+  free(self->range);
+  free(self->worker);
+  free(self);
+}
+
+size_t pool_get_worker_nb(void *pool) {
+  return pool ? ((pool_t*)pool)->nb_worker : 0;
+}
+
+void pool_run(void *pool, size_t nb_job, pool_job_t job, void *user_data) {
+  pool_t *self = (pool_t*)pool;
+  size_t offset;
+
+  if (!self || !job)
+    return;
+
+  pthread_mutex_lock(&self->run_mutex);
+  for (offset=0; offset<nb_job; offset+=POOL_JOB_MAX) {
+    size_t nb = nb_job - offset;
+    size_t i;
+
+    if (nb > POOL_JOB_MAX) {
+      nb = POOL_JOB_MAX;
+    }
+    // initial ranges of the same size
+    for (i=0; i<self->nb_worker; i++) {
+      atomic_store(&self->range[i].jobs,
+		   RANGE(nb*i/self->nb_worker, nb*(i+1)/self->nb_worker));
+    }
+    self->offset = offset;
+    self->job = job;
+    self->user_data = user_data;
+
+    pthread_mutex_lock(&self->mutex);
+    self->running = self->nb_worker - 1;
+    self->generation++;
+    pthread_cond_broadcast(&self->start);
+    pthread_mutex_unlock(&self->mutex);
+
+    pool_work(self, 0);
+
+    pthread_mutex_lock(&self->mutex);
+    while (self->running) {
+      pthread_cond_wait(&self->done, &self->mutex);
+    }
+    pthread_mutex_unlock(&self->mutex);
+  }
+  pthread_mutex_unlock(&self->run_mutex);
+}
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
@@ -0,0 +1,42 @@
+#ifndef __POOL_H_
+#define __POOL_H_
+
+/*
+  Pool of worker threads.
+
+  pool_run() distributes the jobs 0..nb_job-1 among the workers: each
+  worker first processes its own range of jobs, then steals half of
+  the jobs left in the range of another worker (work stealing) until
+  no job is left.
+  The calling thread is the worker 0: a pool of n workers runs n-1
+  threads.
+*/
+
+#include <stddef.h>
+
+/* process the job (index) by the worker (index) */
+typedef void (*pool_job_t)(size_t worker, size_t job, void *user_data);
+
+/*
+   create a pool of nb_worker workers (number of online processors if
+   nb_worker equals 0).
+   Return NULL on error.
+*/
+extern void *pool_create(size_t nb_worker);
+
+/* stop the threads and delete the pool */
+extern void pool_delete(void *pool);
+
+extern size_t pool_get_worker_nb(void *pool);
+
+/*
+  run the jobs and wait for their completion.
+  The calls are serialized if several threads use the same pool.
+*/
+extern void pool_run(void *pool, size_t nb_job, pool_job_t job, void *user_data);
+
+#endif
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
@@ -0,0 +1,76 @@
+#include <stdlib.h>
+#include <string.h>
+#include "punct.h"
+
+#define PUNCT_SET_HASH_MIN 8
+
+punct_set_t *punct_set_new(size_t length, const allocator_t *allocator) {
+  punct_set_t *self;
+  size_t slots = PUNCT_SET_HASH_MIN;
+
+  // at most half of the slots are used: a lookup always ends
+  while (slots < 2*length) {
+    slots *= 2;
+  }
+  self = (punct_set_t*)allocator_calloc(allocator, 1, sizeof(*self) + (length + slots)*sizeof(char32_t));
+  if (!self)
+    return NULL;
+  atomic_init(&self->refcount, 1);
+  if (allocator) {
+    self->allocator = *allocator;
+  }
+  self->list = (char32_t*)(self + 1);
+  self->hash = self->list + length;
+  self->mask = slots - 1;
+  return self;
+}
+
+void punct_set_add(punct_set_t *self, char32_t c) {
+  size_t i;
+
+  self->list[self->length++] = c;
+  if (!c || punct_set_has(self, c))
+    return;
+  if (c <= PUNCT_SET_LATIN1_MAX) {
+    self->latin1[c/32] |= 1u << (c%32);
+    return;
+  }
+  for (i = punct_set_hash(c, self->mask); self->hash[i]; i = (i + 1) & self->mask) {
+  }
+  self->hash[i] = c;
+}
+
+punct_set_t *punct_set_ref(punct_set_t *self) {
+  if (self) {
+    atomic_fetch_add(&self->refcount, 1);
+  }
+  return self;
+}
+
+void punct_set_unref(punct_set_t *self) {
+  if (self && (atomic_fetch_sub(&self->refcount, 1) == 1)) {
+    allocator_t allocator = self->allocator;
+    allocator_free(&allocator, self);
+  }
+}
+
+void punct_set_assign(punct_set_t **dst, punct_set_t *src) {
+  if (*dst == src)
+    return;
+  punct_set_unref(*dst);
+  *dst = punct_set_ref(src);
+}
+
+bool punct_set_equal(const punct_set_t *a, const punct_set_t *b) {
+  size_t la = a ? a->length : 0;
+  size_t lb = b ? b->length : 0;
+  if (a == b)
+    return true;
+  if (la != lb)
+    return false;
+  return !la || !memcmp(a->list, b->list, la*sizeof(char32_t));
+}
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
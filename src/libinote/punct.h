@@ -0,0 +1,80 @@
+#ifndef __PUNCT_H_
+#define __PUNCT_H_
+
+/*
+  Set of the punctuation characters to signal (INOTE_PUNCT_MODE_SOME),
+  built from the list of the `Pf2 annotation.
+
+  Constant time membership whatever the length of the list: a bitmap
+  for U+0000..U+00FF and an open addressing hash table for the other
+  characters.
+  A set is immutable once built and is shared by reference (handles,
+  workers, saved states); NULL is the empty set. It is freed by the
+  allocator of the handle which built it.
+*/
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <uchar.h>
+#include "allocator.h"
+
+#define PUNCT_SET_LATIN1_MAX 0xff
+
+typedef struct {
+  atomic_uint refcount;
+  allocator_t allocator;
+  uint32_t latin1[(PUNCT_SET_LATIN1_MAX+1)/32];
+  // list: characters as listed by the annotation
+  char32_t *list;
+  size_t length;
+  // hash: characters above U+00FF (0: free slot), mask+1 slots
+  char32_t *hash;
+  size_t mask;
+} punct_set_t;
+
+/*
+   create an empty set of capacity length characters (see
+   punct_set_add) with allocator (NULL: C library). Return NULL on
+   error.
+*/
+extern punct_set_t *punct_set_new(size_t length, const allocator_t *allocator);
+
+/* append c to the list of the set being built */
+extern void punct_set_add(punct_set_t *self, char32_t c);
+
+/* return a new reference of the set */
+extern punct_set_t *punct_set_ref(punct_set_t *self);
+
+/* release the reference; the set is freed by the last one */
+extern void punct_set_unref(punct_set_t *self);
+
+/* release the set of *dst and store a new reference of src */
+extern void punct_set_assign(punct_set_t **dst, punct_set_t *src);
+
+/* true if the sets are built from the same list */
+extern bool punct_set_equal(const punct_set_t *a, const punct_set_t *b);
+
+static inline size_t punct_set_hash(char32_t c, size_t mask) {
+  return (((uint64_t)c * 0x9e3779b97f4a7c15ull) >> 32) & mask;
+}
+
+static inline bool punct_set_has(const punct_set_t *self, char32_t c) {
+  size_t i;
+  if (!self || !c)
+    return false;
+  if (c <= PUNCT_SET_LATIN1_MAX)
+    return self->latin1[c/32] & (1u << (c%32));
+  for (i = punct_set_hash(c, self->mask); self->hash[i]; i = (i + 1) & self->mask) {
+    if (self->hash[i] == c)
+      return true;
+  }
+  return false;
+}
+
+#endif
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
@@ -0,0 +1,86 @@
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "scratch.h"
+#include "debug.h"
+
+// scratches of the thread, freed when the thread exits
+static _Thread_local scratch_t *scratch_pool = NULL;
+static pthread_key_t scratch_key;
+static pthread_once_t scratch_once = PTHREAD_ONCE_INIT;
+
+scratch_t *scratch_new(const allocator_t *allocator) {
+  scratch_t *self = (scratch_t*)allocator_calloc(allocator, 1, sizeof(*self));
+  if (self) {
+    self->magic = SCRATCH_MAGIC;
+    if (allocator) {
+      self->allocator = *allocator;
+    }
+  }
+  return self;
+}
+
+void scratch_free(scratch_t *self) {
+  if (scratch_check(self)) {
+    allocator_t allocator = self->allocator;
+    self->magic = 0;
+    allocator_free(&allocator, self);
+  }
+}
+
+/* the thread exits: free its pool */
+static void scratch_free_pool(void *pool) {
+  scratch_t *self = (scratch_t*)pool;
+  while (self) {
+    scratch_t *next = self->next;
+    scratch_free(self);
+    self = next;
+  }
+}
+
+static void scratch_init() {
+  pthread_key_create(&scratch_key, scratch_free_pool);
+}
+
+scratch_t *scratch_borrow(void) {
+  scratch_t *self;
+
+  for (self = scratch_pool; self; self = self->next) {
+    if (!self->busy)
+      break;
+  }
+  if (!self) {
+    pthread_once(&scratch_once, scratch_init);
+    self = scratch_new(NULL);
+    if (!self)
+      return NULL;
+    self->next = scratch_pool;
+    scratch_pool = self;
+    pthread_setspecific(scratch_key, scratch_pool);
+    dbg("new scratch %p", (void*)self);
+  }
+  self->busy = true;
+  return self;
+}
+
+void scratch_release(scratch_t *self) {
+  if (self) {
+    self->busy = false;
+  }
+}
+
+void *inote_scratch_create() {
+  ENTER();
+  scratch_t *self = scratch_new(NULL);
+  dbg("self=%p", (void*)self);
+  return self;
+}
+
+void inote_scratch_delete(void *scratch) {
+  dbg("ENTER self=%p", scratch);
+  scratch_free((scratch_t*)scratch);
+}
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
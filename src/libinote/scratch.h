@@ -0,0 +1,56 @@
+#ifndef __SCRATCH_H_
+#define __SCRATCH_H_
+
+/*
+  Scratch memory of a conversion: the internal buffer of the text
+  decoded to UTF-32 (or valid UTF-8 bytes).
+
+  It is only used during a call, so that a handle keeps its settings
+  and the state carried over between the calls: a scratch is either
+  supplied by the application (see inote_set_scratch) or borrowed for
+  the duration of the call from the pool of the calling thread, or
+  owned by a handle created with an allocator.
+  The pool of a thread keeps its scratches (one per nested
+  conversion, e.g. from a sink) until the thread exits.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <uchar.h>
+#include "inote.h"
+#include "allocator.h"
+
+#define SCRATCH_CHAR32_MAX (TEXT_LENGTH_MAX*sizeof(char32_t))
+#define SCRATCH_MAGIC 0x7E40B173
+
+typedef struct scratch_t {
+  uint32_t magic;
+  struct scratch_t *next; // pool of the thread
+  bool busy; // borrowed from the pool
+  allocator_t allocator;
+  char32_t char32_buf[SCRATCH_CHAR32_MAX];
+} scratch_t;
+
+/* create a scratch with allocator (NULL: C library), NULL on error */
+extern scratch_t *scratch_new(const allocator_t *allocator);
+
+extern void scratch_free(scratch_t *self);
+
+static inline bool scratch_check(const scratch_t *self) {
+  return self && (self->magic == SCRATCH_MAGIC);
+}
+
+/*
+  borrow a scratch from the pool of the calling thread (allocated
+  the first time). Return NULL on error.
+*/
+extern scratch_t *scratch_borrow(void);
+
+/* give back the scratch to the pool of the thread */
+extern void scratch_release(scratch_t *self);
+
+#endif
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
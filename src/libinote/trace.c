@@ -0,0 +1,117 @@
+#include <stdlib.h>
+#include <time.h>
+#include <pthread.h>
+#include "trace.h"
+#include "debug.h"
+
+/*
+  ring of a thread: the record n is written at index n %
+  TRACE_RING_LENGTH, then count is set to n+1.
+  The ring of a thread which exits can be used by another thread;
+  the rings are never freed (they can still be read).
+*/
+typedef struct ring_t {
+  struct ring_t *next;
+  atomic_bool used;
+  _Atomic uint64_t count;
+  uint32_t thread;
+  inote_trace_record_t record[TRACE_RING_LENGTH];
+} ring_t;
+
+atomic_bool trace_enabled = false;
+static _Atomic(ring_t*) trace_rings = NULL;
+static atomic_uint trace_thread_nb = 0;
+static _Thread_local ring_t *trace_ring = NULL;
+static pthread_key_t trace_key;
+static pthread_once_t trace_once = PTHREAD_ONCE_INIT;
+
+/* the thread exits: its ring can be used by another thread */
+static void trace_release(void *ring) {
+  atomic_store(&((ring_t*)ring)->used, false);
+}
+
+static void trace_init() {
+  pthread_key_create(&trace_key, trace_release);
+}
+
+static ring_t *trace_get_ring() {
+  ring_t *ring;
+  bool used = false;
+
+  pthread_once(&trace_once, trace_init);
+  for (ring = atomic_load(&trace_rings); ring; ring = ring->next) {
+    if (atomic_compare_exchange_strong(&ring->used, &used, true))
+      break;
+    used = false;
+  }
+  if (!ring) {
+    ring = (ring_t*)calloc(1, sizeof(*ring));
+    if (!ring)
+      return NULL;
+    atomic_init(&ring->used, true);
+    atomic_init(&ring->count, 0);
+    ring->next = atomic_load(&trace_rings);
+    while (!atomic_compare_exchange_weak(&trace_rings, &ring->next, ring)) {
+    }
+  }
+  ring->thread = atomic_fetch_add(&trace_thread_nb, 1);
+  pthread_setspecific(trace_key, ring);
+  return ring;
+}
+
+void trace_write(inote_trace_event_t event, uint64_t arg0, uint64_t arg1) {
+  inote_trace_record_t *record;
+  struct timespec ts;
+  uint64_t n;
+
+  if (!trace_ring) {
+    trace_ring = trace_get_ring();
+    if (!trace_ring)
+      return;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  n = atomic_load_explicit(&trace_ring->count, memory_order_relaxed);
+  record = trace_ring->record + (n & (TRACE_RING_LENGTH-1));
+  record->time = (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+  record->thread = trace_ring->thread;
+  record->event = event;
+  record->arg0 = arg0;
+  record->arg1 = arg1;
+  atomic_store_explicit(&trace_ring->count, n+1, memory_order_release);
+}
+
+void inote_trace_enable(bool enable) {
+  ENTER();
+  atomic_store(&trace_enabled, enable);
+}
+
+void inote_trace_read(inote_trace_cb_t cb, void *user_data) {
+  ENTER();
+  ring_t *ring;
+
+  if (!cb)
+    return;
+
+  for (ring = atomic_load(&trace_rings); ring; ring = ring->next) {
+    inote_trace_record_t record[TRACE_RING_LENGTH];
+    uint64_t base, first, count, n;
+
+    count = atomic_load_explicit(&ring->count, memory_order_acquire);
+    base = (count > TRACE_RING_LENGTH) ? count - TRACE_RING_LENGTH : 0;
+    for (n=base; n<count; n++) {
+      record[n - base] = ring->record[n & (TRACE_RING_LENGTH-1)];
+    }
+    // skip the records overwritten meanwhile (the record n -
+    // TRACE_RING_LENGTH may be being overwritten if count equals n)
+    atomic_thread_fence(memory_order_acquire);
+    n = atomic_load_explicit(&ring->count, memory_order_relaxed);
+    first = (n >= base + TRACE_RING_LENGTH) ? n - TRACE_RING_LENGTH + 1 : base;
+    for (n=first; n<count; n++) {
+      cb(record + (n - base), user_data);
+    }
+  }
+}
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
@@ -0,0 +1,42 @@
+#ifndef __TRACE_H_
+#define __TRACE_H_
+
+/*
+  Binary trace.
+
+  Each thread writes fixed-size records (inote_trace_record_t) in its
+  own ring buffer: no lock, no system call; the oldest records are
+  overwritten. The rings are read by inote_trace_read().
+
+  The trace points are removed at compilation time if INOTE_TRACE
+  equals 0; otherwise they cost a relaxed atomic load while the trace
+  is disabled (see inote_trace_enable).
+*/
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "inote.h"
+
+#ifndef INOTE_TRACE
+#define INOTE_TRACE 1
+#endif
+
+// number of records per thread (power of 2)
+#define TRACE_RING_LENGTH 1024
+
+extern atomic_bool trace_enabled;
+
+extern void trace_write(inote_trace_event_t event, uint64_t arg0, uint64_t arg1);
+
+#if INOTE_TRACE
+#define trace(event, arg0, arg1) if (atomic_load_explicit(&trace_enabled, memory_order_relaxed)) {trace_write(event, arg0, arg1);}
+#else
+#define trace(event, arg0, arg1)
+#endif
+
+#endif
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
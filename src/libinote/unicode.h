@@ -0,0 +1,58 @@
+#ifndef __UNICODE_H_
+#define __UNICODE_H_
+
+/*
+  Unicode properties of the characters.
+
+  Two-level tables generated at build time by gen_unicode
+  (unicode_table.c) from the character classes of unicode.txt: the
+  properties of the character c are stored in the block
+  unicode_block[c >> UNICODE_BLOCK_SHIFT], the identical blocks being
+  stored once.
+  Unlike iswpunct(), iswblank(),... the result does not depend on the
+  locale of the process.
+*/
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <uchar.h>
+
+#define UNICODE_MAX 0x10ffff
+#define UNICODE_BLOCK_SHIFT 8
+
+#define UNICODE_PUNCT 0x01
+#define UNICODE_BLANK 0x02
+#define UNICODE_UPPER 0x04
+#define UNICODE_LETTER 0x08
+#define UNICODE_FALLBACK 0x10 // see fallback.h
+
+extern const uint8_t unicode_block[];
+extern const uint8_t unicode_property[][1 << UNICODE_BLOCK_SHIFT];
+
+static inline uint8_t unicode_get_property(char32_t c) {
+  if (c > UNICODE_MAX)
+    return 0;
+  return unicode_property[unicode_block[c >> UNICODE_BLOCK_SHIFT]][c & ((1 << UNICODE_BLOCK_SHIFT) - 1)];
+}
+
+static inline bool unicode_is_punct(char32_t c) {
+  return unicode_get_property(c) & UNICODE_PUNCT;
+}
+
+static inline bool unicode_is_blank(char32_t c) {
+  return unicode_get_property(c) & UNICODE_BLANK;
+}
+
+static inline bool unicode_is_upper(char32_t c) {
+  return unicode_get_property(c) & UNICODE_UPPER;
+}
+
+static inline bool unicode_is_letter(char32_t c) {
+  return unicode_get_property(c) & UNICODE_LETTER;
+}
+
+#endif
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
@@ -0,0 +1,504 @@
+// --> For clock_gettime, getopt
+#define _POSIX_C_SOURCE 200809L
+// <--
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+#include <time.h>
+#include <iconv.h>
+#include "inote.h"
+
+/*
+  Throughput benchmark.
+
+  Deterministic synthetic corpora (no download) are generated in
+  UTF-8, then encoded in each supported text charset; the corpora
+  which can't be encoded in a charset (e.g. CJK in ISO-8859-1) are
+  skipped.
+  Each corpus is converted by calls of call_length bytes with
+  inote_convert_text_to_tlv(), then each tlv message is decoded by
+  inote_convert_tlv_to_text(). The results are written in JSON.
+*/
+
+#define MEGABYTE (1024*1024)
+
+typedef enum {
+  CORPUS_PROSE,
+  CORPUS_SSML,
+  CORPUS_ANNOTATION,
+  CORPUS_PUNCTUATION,
+  CORPUS_CAPITALS,
+  CORPUS_CJK,
+  CORPUS_MAX
+} corpus_t;
+
+static const char *corpus_name[CORPUS_MAX] = {
+  "prose", "ssml", "annotation", "punctuation", "capitals", "cjk"
+};
+
+typedef struct {
+  const char *name;
+  const char *iconv_name;
+  inote_charset_t charset;
+} charset_t;
+
+static const charset_t charset[] = {
+  {"ISO-8859-1", "ISO-8859-1", INOTE_CHARSET_ISO_8859_1},
+  {"GBK", "GBK", INOTE_CHARSET_GBK},
+  {"UCS-2", "UCS2", INOTE_CHARSET_UCS_2},
+  {"BIG5", "BIG5", INOTE_CHARSET_BIG_5},
+  {"SJIS", "SJIS", INOTE_CHARSET_SJIS},
+  {"UTF-8", "UTF-8", INOTE_CHARSET_UTF_8},
+  {"UTF-16", "UTF16", INOTE_CHARSET_UTF_16},
+};
+
+static const char *words[] = {
+  "the", "voice", "reads", "a", "long", "text", "aloud", "and", "each",
+  "sentence", "is", "split", "into", "segments", "before", "being",
+  "spoken", "by", "synthesizer", "with", "some", "punctuation", "marks",
+  "of", "morning", "train", "station", "people", "were", "waiting",
+  "for", "next", "departure", "while", "weather", "changed", "quickly",
+};
+
+static const char *capitals[] = {
+  "NASA", "HTTP", "THE", "VOICE", "READS", "LOUD", "TEXT", "WARNING",
+  "STOP", "UNESCO", "URL", "PDF", "NOW", "OK", "A", "I",
+};
+
+static const char *punctuations[] = {
+  "(1)", "[a-b]", "x/y", "3.14,", "50%", "a@b.c", "\"quote\"", "#12;",
+  "*", "?!", "...", "1+2=3", "<=", "{x}", "a_b", "$5", "&", "'s", ":",
+};
+
+static const char *annotations[] = {
+  "`Pf1 ", "`Pf0 ", "`Pf2.,? ", "`v1 ", "`v2 ", "`vv80 ", "`vs5 ",
+};
+
+static const char *cjk[] = {
+  "日", "本", "人", "大", "中", "山", "川", "田", "上", "下", "天", "地",
+  "水", "火", "木", "金", "土", "月", "年", "時", "間", "東", "京", "電",
+  "話", "語", "文", "字",
+};
+
+typedef struct {
+  char *buffer;
+  size_t length;
+  size_t max;
+} buffer_t;
+
+typedef struct {
+  uint64_t *ns;
+  size_t nb;
+  size_t max;
+} latency_t;
+
+typedef struct {
+  double mb_per_s;
+  double tlv_per_s;
+  uint64_t p50_ns;
+  uint64_t p99_ns;
+  size_t calls;
+} result_t;
+
+static void *xrealloc(void *p, size_t size) {
+  p = realloc(p, size);
+  if (!p) {
+    perror(NULL);
+    exit(1);
+  }
+  return p;
+}
+
+static void buffer_append(buffer_t *self, const char *s, size_t length) {
+  if (self->length + length > self->max) {
+    self->max = 2*(self->length + length);
+    self->buffer = xrealloc(self->buffer, self->max);
+  }
+  memcpy(self->buffer + self->length, s, length);
+  self->length += length;
+}
+
+static void buffer_add(buffer_t *self, const char *s) {
+  buffer_append(self, s, strlen(s));
+}
+
+/* xorshift32: same corpus on every machine */
+static uint32_t random_get(uint32_t *seed) {
+  uint32_t x = *seed;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return *seed = x;
+}
+
+#define PICK(array, seed) array[random_get(seed) % (sizeof(array)/sizeof(*array))]
+
+static void add_sentence(buffer_t *self, uint32_t *seed) {
+  size_t i, nb = 5 + random_get(seed) % 10;
+  for (i=0; i<nb; i++) {
+    const char *w = PICK(words, seed);
+    if (!i) {
+      char c = w[0] - 'a' + 'A';
+      buffer_append(self, &c, 1);
+      buffer_add(self, w + 1);
+    } else {
+      buffer_add(self, w);
+    }
+    if ((i + 1 < nb) && !(random_get(seed) % 7)) {
+      buffer_add(self, ",");
+    }
+    buffer_add(self, (i + 1 < nb) ? " " : ". ");
+  }
+}
+
+/* generate about length bytes of the corpus in UTF-8 */
+static void corpus_generate(corpus_t corpus, size_t length, buffer_t *text) {
+  uint32_t seed = 2463534242U + corpus;
+  size_t i = 0;
+
+  text->length = 0;
+  if (corpus == CORPUS_SSML) {
+    buffer_add(text, "<speak>");
+  }
+  while (text->length < length) {
+    switch (corpus) {
+    case CORPUS_PROSE:
+      add_sentence(text, &seed);
+      break;
+    case CORPUS_SSML:
+      buffer_add(text, "<p><s>");
+      add_sentence(text, &seed);
+      buffer_add(text, "</s><break time=\"300ms\"/><emphasis level=\"strong\">");
+      buffer_add(text, PICK(words, &seed));
+      buffer_add(text, "</emphasis> &lt;");
+      buffer_add(text, PICK(words, &seed));
+      buffer_add(text, "&gt; &amp; <say-as interpret-as=\"characters\">");
+      buffer_add(text, PICK(capitals, &seed));
+      buffer_add(text, "</say-as></p>");
+      break;
+    case CORPUS_ANNOTATION:
+      buffer_add(text, PICK(annotations, &seed));
+      add_sentence(text, &seed);
+      break;
+    case CORPUS_PUNCTUATION:
+      buffer_add(text, PICK(punctuations, &seed));
+      buffer_add(text, " ");
+      buffer_add(text, PICK(words, &seed));
+      buffer_add(text, " ");
+      break;
+    case CORPUS_CAPITALS:
+      buffer_add(text, PICK(capitals, &seed));
+      buffer_add(text, (random_get(&seed) % 9) ? " " : ". ");
+      break;
+    case CORPUS_CJK:
+      buffer_add(text, PICK(cjk, &seed));
+      if (!(random_get(&seed) % 23)) {
+	buffer_add(text, "。");
+      } else if (!(random_get(&seed) % 9)) {
+	buffer_add(text, "、");
+      }
+      break;
+    default:
+      break;
+    }
+    if (!(++i % 16)) {
+      buffer_add(text, "\n");
+    }
+  }
+  if (corpus == CORPUS_SSML) {
+    buffer_add(text, "</speak>");
+  }
+}
+
+/* encode the UTF-8 corpus; return false if it can't be encoded */
+static bool corpus_encode(const buffer_t *utf8, const charset_t *c, buffer_t *text) {
+  iconv_t cd = iconv_open(c->iconv_name, "UTF-8");
+  char *inbuf = utf8->buffer;
+  size_t inbytesleft = utf8->length;
+  char *outbuf;
+  size_t outbytesleft;
+  bool ok;
+
+  if (cd == (iconv_t)-1)
+    return false;
+  if (text->max < 4*utf8->length) {
+    text->max = 4*utf8->length;
+    text->buffer = xrealloc(text->buffer, text->max);
+  }
+  outbuf = text->buffer;
+  outbytesleft = text->max;
+  ok = (iconv(cd, &inbuf, &inbytesleft, &outbuf, &outbytesleft) != (size_t)-1);
+  text->length = outbuf - text->buffer;
+  iconv_close(cd);
+  return ok;
+}
+
+static uint64_t get_time() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec*1000000000 + ts.tv_nsec;
+}
+
+static void latency_add(latency_t *self, uint64_t ns) {
+  if (self->nb == self->max) {
+    self->max = self->max ? 2*self->max : 1024;
+    self->ns = xrealloc(self->ns, self->max*sizeof(*self->ns));
+  }
+  self->ns[self->nb++] = ns;
+}
+
+static int compare_ns(const void *a, const void *b) {
+  uint64_t x = *(const uint64_t*)a;
+  uint64_t y = *(const uint64_t*)b;
+  return (x > y) - (x < y);
+}
+
+static void result_set(result_t *self, latency_t *latency, size_t bytes, uint64_t nb_tlv) {
+  uint64_t total = 0;
+  size_t i;
+
+  for (i=0; i<latency->nb; i++) {
+    total += latency->ns[i];
+  }
+  qsort(latency->ns, latency->nb, sizeof(*latency->ns), compare_ns);
+  self->calls = latency->nb;
+  self->mb_per_s = total ? (double)bytes/MEGABYTE/(total/1e9) : 0;
+  self->tlv_per_s = total ? nb_tlv/(total/1e9) : 0;
+  self->p50_ns = latency->nb ? latency->ns[(latency->nb - 1)*50/100] : 0;
+  self->p99_ns = latency->nb ? latency->ns[(latency->nb - 1)*99/100] : 0;
+  latency->nb = 0;
+}
+
+static inote_error count_tlv(inote_tlv_t *tlv, void *user_data) {
+  (void)tlv;
+  (*(uint64_t*)user_data)++;
+  return INOTE_OK;
+}
+
+static inote_error count_capital(inote_tlv_t *tlv, bool capitals, void *user_data) {
+  (void)capitals;
+  return count_tlv(tlv, user_data);
+}
+
+/*
+  convert the text by calls of call_length bytes, then decode the tlv
+  messages; return false if the text can't be converted
+*/
+static bool run(corpus_t corpus, const buffer_t *text, inote_charset_t text_charset, size_t call_length, result_t *to_tlv, result_t *to_text, size_t *tlv_length) {
+  void *handle = inote_create();
+  size_t tlv_max = (call_length/TEXT_LENGTH_MAX + 1)*TLV_MESSAGE_LENGTH_MAX*2;
+  uint8_t *tlv_buffer = xrealloc(NULL, tlv_max);
+  buffer_t tlv = {NULL, 0, 0};
+  size_t *message = NULL; // end of each tlv message in tlv
+  size_t nb_message = 0;
+  latency_t latency = {NULL, 0, 0};
+  inote_state_t state;
+  inote_stats_t stats;
+  inote_cb_ext_t cb;
+  uint64_t nb_tlv = 0;
+  size_t offset = 0;
+  size_t i;
+  bool ok = true;
+
+  memset(&state, 0, sizeof(state));
+  state.annotation = 1;
+  state.ssml = (corpus == CORPUS_SSML);
+  state.punct_mode = (corpus == CORPUS_PUNCTUATION) ? INOTE_PUNCT_MODE_ALL : INOTE_PUNCT_MODE_SOME;
+  if (corpus == CORPUS_CAPITALS) {
+    inote_enable_capital(handle, true);
+  }
+
+  while (offset < text->length) {
+    inote_slice_t slice;
+    inote_slice_t tlv_message;
+    size_t text_left = 0;
+    uint64_t start;
+    inote_error ret;
+
+    slice.buffer = (uint8_t*)text->buffer + offset;
+    slice.length = text->length - offset;
+    if (slice.length > call_length) {
+      slice.length = call_length;
+    }
+    slice.charset = text_charset;
+    slice.end_of_buffer = slice.buffer + slice.length;
+    tlv_message.buffer = tlv_buffer;
+    tlv_message.length = 0;
+    tlv_message.charset = INOTE_CHARSET_UTF_8;
+    tlv_message.end_of_buffer = tlv_buffer + tlv_max;
+
+    start = get_time();
+    ret = inote_convert_text_to_tlv(handle, &slice, &state, &tlv_message, &text_left);
+    if ((ret == INOTE_INCOMPLETE_MULTIBYTE) && (text_left < slice.length)
+	&& (offset + slice.length < text->length)) {
+      // character split by the call: convert the complete characters
+      slice.length -= text_left;
+      ret = inote_convert_text_to_tlv(handle, &slice, &state, &tlv_message, &text_left);
+    }
+    latency_add(&latency, get_time() - start);
+
+    if ((ret != INOTE_OK) && (ret != INOTE_TLV_MESSAGE_FULL)) {
+      fprintf(stderr, "%s (charset %d): error %s at byte %lu\n", corpus_name[corpus], text_charset,
+	      inote_error_get_string(ret), (long unsigned int)(offset + slice.length - text_left));
+      ok = false;
+      break;
+    }
+    if (slice.length == text_left) {
+      fprintf(stderr, "%s (charset %d): no progress at byte %lu\n", corpus_name[corpus], text_charset, (long unsigned int)offset);
+      ok = false;
+      break;
+    }
+    offset += slice.length - text_left;
+    buffer_append(&tlv, (char*)tlv_message.buffer, tlv_message.length);
+    message = xrealloc(message, (nb_message + 1)*sizeof(*message));
+    message[nb_message++] = tlv.length;
+  }
+
+  if (ok) {
+    inote_get_stats(handle, &stats);
+    nb_tlv = stats.tlv_text + stats.tlv_punctuation + stats.tlv_annotation
+      + stats.tlv_capital + stats.tlv_capitals + stats.tlv_ssml
+      + stats.tlv_language;
+    result_set(to_tlv, &latency, text->length, nb_tlv);
+
+    cb.cb.add_annotation = count_tlv;
+    cb.cb.add_charset = count_tlv;
+    cb.cb.add_punctuation = count_tlv;
+    cb.cb.add_text = count_tlv;
+    cb.cb.add_capital = count_capital;
+    cb.cb.user_data = &nb_tlv;
+    cb.add_ssml = count_tlv;
+    cb.add_language = count_tlv;
+    nb_tlv = 0;
+    for (i=0; i<nb_message; i++) {
+      size_t begin = i ? message[i-1] : 0;
+      inote_slice_t tlv_message;
+      uint64_t start;
+      if (begin == message[i])
+	continue;
+      tlv_message.buffer = (uint8_t*)tlv.buffer + begin;
+      tlv_message.length = message[i] - begin;
+      tlv_message.charset = INOTE_CHARSET_UTF_8;
+      tlv_message.end_of_buffer = tlv_message.buffer + tlv_message.length;
+      start = get_time();
+      inote_convert_tlv_to_text_ext(&tlv_message, &cb);
+      latency_add(&latency, get_time() - start);
+    }
+    result_set(to_text, &latency, tlv.length, nb_tlv);
+    *tlv_length = tlv.length;
+  }
+
+  inote_delete(handle);
+  free(latency.ns);
+  free(message);
+  free(tlv.buffer);
+  free(tlv_buffer);
+  return ok;
+}
+
+static void print_result(FILE *fd, const char *name, const result_t *result) {
+  fprintf(fd, "\"%s\": {\"calls\": %lu, \"mb_per_s\": %.3f, \"tlv_per_s\": %.0f, \"p50_ns\": %llu, \"p99_ns\": %llu}",
+	  name, (long unsigned int)result->calls, result->mb_per_s, result->tlv_per_s,
+	  (unsigned long long)result->p50_ns, (unsigned long long)result->p99_ns);
+}
+
+void usage() {
+  printf("\
+Usage: benchmark [-m megabytes] [-k call] [-o outputfile]\n\
+Measure the throughput of the conversions over synthetic corpora\n\
+(prose, ssml, annotation, punctuation, capitals, cjk) in each charset\n\
+  -m megabytes          optional size of each corpus in UTF-8 (by default: 2)\n\
+  -k call               optional bytes of text per call (by default: TEXT_LENGTH_MAX)\n\
+  -o outputfile         optional write the JSON results to this file (by default: stdout)\n\
+\n\
+EXAMPLE:\n\
+benchmark -m 8 -o bench.json\n\
+\n\
+");
+}
+
+int main(int argc, char **argv) {
+  int opt;
+  size_t megabytes = 2;
+  size_t call_length = TEXT_LENGTH_MAX;
+  FILE *output = stdout;
+  buffer_t utf8 = {NULL, 0, 0};
+  buffer_t text = {NULL, 0, 0};
+  bool first = true;
+  int ret = 0;
+  int i;
+  size_t j;
+
+  while ((opt = getopt(argc, argv, "k:m:o:")) != -1) {
+    switch (opt) {
+    case 'k':
+      call_length = atoi(optarg);
+      break;
+    case 'm':
+      megabytes = atoi(optarg);
+      break;
+    case 'o':
+      output = fopen(optarg, "w");
+      if (!output) {
+	perror(NULL);
+	exit(1);
+      }
+      break;
+    default:
+      usage();
+      exit(1);
+      break;
+    }
+  }
+  if (!megabytes || (call_length < 4)) {
+    usage();
+    exit(1);
+  }
+  if (getenv("HOME")) {
+    char filename[256];
+    snprintf(filename, sizeof(filename), "%s/libinote.ok", getenv("HOME"));
+    if (!access(filename, F_OK)) {
+      fprintf(stderr, "warning: the logs are enabled (%s)\n", filename);
+    }
+  }
+
+  fprintf(output, "{\"megabytes\": %lu, \"call_bytes\": %lu, \"results\": [",
+	  (long unsigned int)megabytes, (long unsigned int)call_length);
+  for (i=0; i<CORPUS_MAX; i++) {
+    corpus_generate(i, megabytes*MEGABYTE, &utf8);
+    for (j=0; j<sizeof(charset)/sizeof(*charset); j++) {
+      result_t to_tlv, to_text;
+      size_t tlv_length = 0;
+      if (!corpus_encode(&utf8, charset + j, &text))
+	continue;
+      if (!run(i, &text, charset[j].charset, call_length, &to_tlv, &to_text, &tlv_length)) {
+	ret = 1;
+	continue;
+      }
+      fprintf(output, "%s\n  {\"corpus\": \"%s\", \"charset\": \"%s\", \"bytes\": %lu, \"tlv_bytes\": %lu, ",
+	      first ? "" : ",", corpus_name[i], charset[j].name,
+	      (long unsigned int)text.length, (long unsigned int)tlv_length);
+      print_result(output, "text_to_tlv", &to_tlv);
+      fprintf(output, ", ");
+      print_result(output, "tlv_to_text", &to_text);
+      fprintf(output, "}");
+      first = false;
+    }
+  }
+  fprintf(output, "\n]}\n");
+
+  if (output != stdout) {
+    fclose(output);
+  }
+  free(utf8.buffer);
+  free(text.buffer);
+  return ret;
+}
+
+/* local variables: */
+/* c-basic-offset: 2 */
+/* end: */
@@ -304,6 +304,97 @@ testCharset() {
 	echo "charset $CHARSETS: OK"
 }
 
+# same as testCharset, the file is read by chunks of CHUNK bytes (stream mode)
+testStream() {
+	FILE=$1
+	SEP=$2
+	CHARSETS=$3
+	FILE_EXPECTED=$4
+	CHUNK=$5
+	ERROR=$6
+	./text2tlv       -p 1 -c $CHARSETS -S $CHUNK -i "$FILE" -o "$FILE.$SEP.tlv"
+	local err=$?
+	if [ -n "$ERROR" ]; then
+	    if [ "$err" = "$ERROR" ]; then
+		echo "Expected error: OK"
+		return
+	    else
+		leave "Expected error: KO" 1
+	    fi
+	fi
+	./tlv2text -i "$FILE.$SEP.tlv" -o "$FILE.$SEP.txt"
+	diff -q $FILE_EXPECTED $FILE.$SEP.txt
+	if [ $? != 0 ]; then
+		diff -u $FILE_EXPECTED $FILE.$SEP.txt		
+		leave "stream $CHARSETS ($CHUNK): KO" 1
+	fi
+	rm "$FILE.$SEP.tlv" "$FILE.$SEP.txt"
+	echo "stream $CHARSETS ($CHUNK): OK"
+}
+
+# the tlv delivered to a sink by blocks of BLOCK bytes must be
+# identical to those of a single tlv_message (stream mode)
+testSink() {
+	FILE=$1
+	SEP=$2
+	CHARSETS=$3
+	CHUNK=$4
+	BLOCK=$5
+	./text2tlv       -p 1 -c $CHARSETS -S $CHUNK -i "$FILE" -o "$FILE.$SEP.tlv" || leave "sink $CHARSETS ($BLOCK): KO" 1
+	./text2tlv       -p 1 -c $CHARSETS -S $CHUNK -k $BLOCK -i "$FILE" -o "$FILE.$SEP.sink.tlv" || leave "sink $CHARSETS ($BLOCK): KO" 1
+	cmp "$FILE.$SEP.tlv" "$FILE.$SEP.sink.tlv" || leave "sink $CHARSETS ($BLOCK): KO" 1
+	rm "$FILE.$SEP.tlv" "$FILE.$SEP.sink.tlv"
+	echo "sink $CHARSETS ($BLOCK): OK"
+}
+
+# same as testCharset with TLV v2 (whole file, no punctuation): the
+# text must be identical and the tlv shorter
+testTlv2() {
+	FILE=$1
+	SEP=$2
+	CHARSETS=$3
+	FILE_EXPECTED=$4
+	./text2tlv       -p 0 -c $CHARSETS -S 100000 -i "$FILE" -o "$FILE.$SEP.tlv" || leave "tlv v2 $CHARSETS: KO" 1
+	./text2tlv    -2 -p 0 -c $CHARSETS -S 100000 -i "$FILE" -o "$FILE.$SEP.v2.tlv" || leave "tlv v2 $CHARSETS: KO" 1
+	./tlv2text -i "$FILE.$SEP.v2.tlv" -o "$FILE.$SEP.txt"
+	diff -q $FILE_EXPECTED $FILE.$SEP.txt
+	if [ $? != 0 ]; then
+		diff -u $FILE_EXPECTED $FILE.$SEP.txt		
+		leave "tlv v2 $CHARSETS: KO" 1
+	fi
+	[ $(stat -c %s "$FILE.$SEP.v2.tlv") -lt $(stat -c %s "$FILE.$SEP.tlv") ] || leave "tlv v2 $CHARSETS (length): KO" 1
+	rm "$FILE.$SEP.tlv" "$FILE.$SEP.v2.tlv" "$FILE.$SEP.txt"
+	echo "tlv v2 $CHARSETS: OK"
+}
+
+# each line converted by a batch of THREADS workers must give the same
+# tlv as the line converted alone
+testBatch() {
+	FILE=$1
+	SEP=$2
+	CHARSETS=$3
+	THREADS=$4
+	OPTIONS=$5
+	./text2tlv       -p 1 $OPTIONS -c $CHARSETS -l -i "$FILE" -o "$FILE.$SEP.tlv" || leave "batch $CHARSETS ($THREADS): KO" 1
+	./text2tlv       -p 1 $OPTIONS -c $CHARSETS -B $THREADS -i "$FILE" -o "$FILE.$SEP.batch.tlv" || leave "batch $CHARSETS ($THREADS): KO" 1
+	cmp "$FILE.$SEP.tlv" "$FILE.$SEP.batch.tlv" || leave "batch $CHARSETS ($THREADS): KO" 1
+	rm "$FILE.$SEP.tlv" "$FILE.$SEP.batch.tlv"
+	echo "batch $CHARSETS ($THREADS): OK"
+}
+
+testParallel() {
+	FILE=$1
+	SEP=$2
+	CHARSETS=$3
+	THREADS=$4
+	OPTIONS=$5
+	./text2tlv $OPTIONS -c $CHARSETS -P 1 -i "$FILE" -o "$FILE.$SEP.tlv" || leave "parallel $CHARSETS ($THREADS $OPTIONS): KO" 1
+	./text2tlv $OPTIONS -c $CHARSETS -P $THREADS -i "$FILE" -o "$FILE.$SEP.parallel.tlv" || leave "parallel $CHARSETS ($THREADS $OPTIONS): KO" 1
+	cmp "$FILE.$SEP.tlv" "$FILE.$SEP.parallel.tlv" || leave "parallel $CHARSETS ($THREADS $OPTIONS): KO" 1
+	rm "$FILE.$SEP.tlv" "$FILE.$SEP.parallel.tlv"
+	echo "parallel $CHARSETS ($THREADS $OPTIONS): OK"
+}
+
 echo
 echo "libinote: starting tests"
 echo
@@ -346,11 +437,16 @@ TMPDIR=$(mktemp -d)
 filea8=${TMPDIR}/test_utf8_symbol
 filea1=${TMPDIR}/test_latin1
 
-# currently utf8-t character without implemented equivalent are filtered 
+# utf-8 characters without equivalent are replaced by their ascii fallback
 echo "cœur vaillant" > $filea8
-echo "cur vaillant" > $filea1
+echo "coeur vaillant" > $filea1
 testCharset $filea8 8-1 UTF-8:ISO-8859-1 $filea1
 
+echo "fin—début… ﬁnal" > $filea8
+echo "fin-début... final" | iconv -f UTF-8 -t ISO-8859-1 > $filea1
+testCharset $filea8 8-1 UTF-8:ISO-8859-1 $filea1
+
+# or filtered if they have no fallback
 echo "Produits • La Boutique" > $filea8
 echo "Produits  La Boutique" > $filea1
 testCharset $filea8 8-1 UTF-8:ISO-8859-1 $filea1
@@ -394,9 +490,9 @@ cat <<EOF>$filea8
 󠀢
 EOF
 
-cat <<EOF>$filea1
-'
-'
+# « and » are punctuation characters, kept in ISO-8859-1
+printf "\xab\n\xbb\n" > $filea1
+cat <<EOF>>$filea1
 '
 '
 '
@@ -433,6 +529,273 @@ testCharset $file8 8-8 UTF-8:UTF-8 $file8
 testCharset $file1 1-8 ISO-8859-1:UTF-8 $file8
 testCharset $file8 8-1 UTF-8:ISO-8859-1 $file1
 
+# --> checking stream mode
+for i in a b c d e; do
+    testStream utf8_err6$i.txt 8-1 UTF-8:ISO-8859-1 res/utf8_err6$i.txt.8-1.txt 1
+done
+
+## the incomplete sequence is reported by inote_stream_flush
+testStream utf8_err1.txt 8-1 UTF-8:ISO-8859-1 res/utf8_err1.txt 3 $INOTE_INCOMPLETE_MULTIBYTE
+
+testStream $file8 8-8 UTF-8:UTF-8 $file8 7
+testStream $file1 1-8 ISO-8859-1:UTF-8 $file8 7
+testStream $file8 8-1 UTF-8:ISO-8859-1 $file1 7
+
+## whole file in one call (several windows)
+testStream $file8 8-8 UTF-8:UTF-8 $file8 100000
+testStream $file1 1-8 ISO-8859-1:UTF-8 $file8 100000
+testStream $file8 8-1 UTF-8:ISO-8859-1 $file1 100000
+
+## capitalized words split by the chunks
+filec=${TMPDIR}/test_stream_capital
+echo -n "Hello World. CAPITAL letter, ABC def Ghi jKL." > $filec
+./text2tlv -C -p 1 -S 3 -i $filec -o $filec.tlv
+./tlv2text -i $filec.tlv -o $filec.txt -c "_"
+diff -q res/stream_capital.txt $filec.txt || leave "stream capital: KO" 1
+echo "stream capital: OK"
+# <--
+
+# --> checking tlv v2
+testTlv2 $file8 8-8 UTF-8:UTF-8 $file8
+testTlv2 $file1 1-8 ISO-8859-1:UTF-8 $file8
+testTlv2 $file8 8-1 UTF-8:ISO-8859-1 $file1
+# <--
+
+# --> checking sink
+testSink $file8 8-8 UTF-8:UTF-8 100000 512
+testSink $file1 1-8 ISO-8859-1:UTF-8 100000 512
+testSink $file8 8-1 UTF-8:ISO-8859-1 7 600
+testSink $file8 8-8 UTF-8:UTF-8 100000 "8192 -2"
+# <--
+
+# --> checking batch
+testBatch $file8 8-8 UTF-8:UTF-8 1
+testBatch $file8 8-8 UTF-8:UTF-8 4
+testBatch $file1 1-8 ISO-8859-1:UTF-8 3 -C
+testBatch $file8 8-1 UTF-8:ISO-8859-1 8 -2
+# <--
+
+# --> checking parallel conversion
+## large text (several chunks) with annotations changing the state
+filep8=${TMPDIR}/test_parallel_utf8
+filep1=${TMPDIR}/test_parallel_latin1
+for i in $(seq 8); do
+	cat $file8
+	echo "\`Pf2.,?! "
+	cat $file8
+	echo "\`Pf$((i%2)) "
+done > $filep8
+iconv -f UTF-8 -t ISO-8859-1 $filep8 > $filep1
+testParallel $filep8 8-8 UTF-8:UTF-8 4 "-p 0"
+testParallel $filep8 8-8 UTF-8:UTF-8 3 "-p 1 -C"
+testParallel $filep1 1-8 ISO-8859-1:UTF-8 4 "-p 1 -2"
+testParallel $filep8 8-1 UTF-8:ISO-8859-1 2 "-p 2 -s"
+# <--
+
+# --> checking trace
+filet=${TMPDIR}/test_trace
+./text2tlv -p 1 -T $filet.trace -i $file8 -o $filet.tlv || leave "trace: KO" 1
+nb_start=$(grep -c " convert_start " $filet.trace)
+nb_end=$(grep -c " convert_end " $filet.trace)
+[ "$nb_start" -gt 1 ] && [ "$nb_start" = "$nb_end" ] || leave "trace: KO" 1
+grep -q " window " $filet.trace || leave "trace: KO" 1
+echo "trace: OK"
+# <--
+
+# --> checking stats
+## same counters of the tlv whether the text is converted in parallel or not
+files=${TMPDIR}/test_stats
+./text2tlv -p 1 -M $files.1 -P 1 -i $filep8 -o $files.tlv || leave "stats: KO" 1
+./text2tlv -p 1 -M $files.4 -P 4 -i $filep8 -o $files.tlv || leave "stats: KO" 1
+[ "$(grep "^bytes_in " $files.1)" = "bytes_in $(stat -c %s $filep8)" ] || leave "stats: KO" 1
+[ "$(grep "^tlv_punctuation " $files.1 | cut -d' ' -f2)" -gt 0 ] || leave "stats: KO" 1
+[ "$(grep -E "^(bytes_in|tlv_)" $files.1)" = "$(grep -E "^(bytes_in|tlv_)" $files.4)" ] || leave "stats: KO" 1
+echo "stats: OK"
+# <--
+
+# --> checking unicode properties
+## same classification whatever the locale: É upper, « and » punctuation
+fileu=${TMPDIR}/test_unicode
+LC_ALL=C ./text2tlv -C -p 1 -t "Été ÉTÉ «été»" -o $fileu.tlv || leave "unicode: KO" 1
+printf "\x11\x06Été \x13\x06ÉTÉ \x05\x07«été\x05\x02»" > $fileu.expected
+cmp $fileu.tlv $fileu.expected || leave "unicode: KO" 1
+echo "unicode: OK"
+# <--
+
+# --> checking entities
+## named (HTML5) and numeric character references; unknown or invalid ones are kept
+filee=${TMPDIR}/test_entity
+./text2tlv -s -p 0 -t "<speak>caf&eacute; &#233;t&#xE9; &lt;x&gt; &ne; &bogus; &#xD800;</speak>" -o $filee.tlv || leave "entities: KO" 1
+printf "\x01\x24café été <x> ≠ &bogus; &#xD800;" > $filee.expected
+cmp $filee.tlv $filee.expected || leave "entities: KO" 1
+echo "entities: OK"
+# <--
+
+# --> checking ssml tlv
+## break, prosody, say-as and mark give INOTE_TYPE_SSML tlv; the other tags are filtered out
+filex=${TMPDIR}/test_ssml
+textx='<speak>Un<break time="1.5s"/><prosody rate="slow">deux</prosody><p><mark name="m 1"/></p></speak>'
+./text2tlv -s -x -p 0 -t "$textx" -o $filex.tlv || leave "ssml tlv: KO" 1
+printf "\x01\x02Un\x20\x05\x01\xdc\x05\x00\x00\x20\x0b\x02\x04rate\x04slow\x01\x04deux\x20\x01\x03\x20\x0a\x06\x04name\x03m 1" > $filex.expected
+cmp $filex.tlv $filex.expected || leave "ssml tlv: KO" 1
+## the attribute values are kept as is, in the tlv charset
+./text2tlv -s -x -p 0 -t '<mark name="Amélie Dupont"/>' -o $filex.tlv || leave "ssml tlv (charset): KO" 1
+printf "\x20\x15\x06\x04name\x0eAm\xc3\xa9lie Dupont" > $filex.expected
+cmp $filex.tlv $filex.expected || leave "ssml tlv (charset): KO" 1
+./text2tlv -s -x -p 0 -c UTF-8:ISO-8859-1 -t '<mark name="Amélie Dupont"/>' -o $filex.tlv || leave "ssml tlv (charset): KO" 1
+printf "\x20\x14\x06\x04name\x0dAm\xe9lie Dupont" > $filex.expected
+cmp $filex.tlv $filex.expected || leave "ssml tlv (charset): KO" 1
+## not generated for an older decoder
+./text2tlv -s -x -p 0 -v 120 -t "$textx" -o $filex.tlv || leave "ssml tlv (1.2.0): KO" 1
+printf "\x01\x06Undeux" > $filex.expected
+cmp $filex.tlv $filex.expected || leave "ssml tlv (1.2.0): KO" 1
+## skipped by a caller of inote_convert_tlv_to_text with the inote_cb_t layout of 1.2.0
+./text2tlv -s -x -L -p 0 -t "$textx \`l2 trois" -o $filex.tlv || leave "ssml tlv (callbacks): KO" 1
+./tlv2text -i $filex.tlv -o $filex.txt || leave "ssml tlv (callbacks): KO" 1
+printf "Undeux trois" | cmp - $filex.txt || leave "ssml tlv (callbacks): KO" 1
+echo "ssml tlv: OK"
+# <--
+
+# --> checking language tlv
+## the expected languages (1, 2) give INOTE_TYPE_LANGUAGE tlv in the same call
+filel=${TMPDIR}/test_language
+./text2tlv -p 0 -L -t 'Un `l2 deux `l1 one' -o $filel.tlv || leave "language tlv: KO" 1
+printf "\x01\x03Un \x40\x04\x02\x00\x00\x00\x01\x05deux \x40\x04\x01\x00\x00\x00\x01\x03one" > $filel.expected
+cmp $filel.tlv $filel.expected || leave "language tlv: KO" 1
+## an unexpected language still stops the conversion on its annotation
+./text2tlv -p 0 -L -t 'Un `l0x2 deux `l3 three' -o $filel.tlv | grep -q "annotation: \`l3" || leave "language tlv (unexpected): KO" 1
+## the annotation left is neither in a tag
+./text2tlv -p 0 -s -L -t '<speak><mark name="`l2"/> a `l2 b `l3 c</speak>' -o $filel.tlv | grep -q "annotation: \`l3" || leave "language tlv (tag): KO" 1
+./tlv2text -i $filel.tlv -o $filel.txt || leave "language tlv (tag): KO" 1
+printf "a b c" | cmp - $filel.txt || leave "language tlv (tag): KO" 1
+## nor in a multibyte character (SJIS trail byte 0x60)
+printf 'a\x81\x60lb `l3 c' > $filel.sjis
+./text2tlv -p 0 -L -c SJIS:UTF-8 -i $filel.sjis -o $filel.tlv | grep -q "annotation: \`l3" || leave "language tlv (multibyte): KO" 1
+./tlv2text -i $filel.tlv -o $filel.txt || leave "language tlv (multibyte): KO" 1
+printf "a\xe3\x80\x9clb c" | cmp - $filel.txt || leave "language tlv (multibyte): KO" 1
+## stream: the annotation left starts in the previous chunk
+printf 'xxxxx`l3 `l1 c' > $filel.txt
+./text2tlv -p 0 -L -i $filel.txt -o $filel.expected | grep -q "annotation: \`l3" || leave "language tlv (stream): KO" 1
+for chunk in 6 7; do
+    ./text2tlv -p 0 -L -i $filel.txt -S $chunk -o $filel.tlv | grep -q "annotation: \`l3" || leave "language tlv (stream $chunk): KO" 1
+    cmp $filel.tlv $filel.expected || leave "language tlv (stream $chunk): KO" 1
+done
+echo "language tlv: OK"
+# <--
+
+# --> checking tlv iterator and index
+## type and length of each tlv (iterator), number of tlv by type (index)
+filei=${TMPDIR}/test_iterator
+./text2tlv -s -x -C -p 1 -t '<speak>Hello, World<break/> ABC.</speak>' -o $filei.tlv || leave "tlv iterator: KO" 1
+./tlv2text -d -i $filei.tlv -o $filei.txt || leave "tlv iterator: KO" 1
+printf "17 5\n5 2\n17 5\n32 5\n1 1\n19 3\n5 1\n" > $filei.expected
+cmp $filei.txt $filei.expected || leave "tlv iterator: KO" 1
+./tlv2text -n -i $filei.tlv -o $filei.txt || leave "tlv index: KO" 1
+printf "1 1\n5 2\n17 2\n19 1\n32 1\n" > $filei.expected
+cmp $filei.txt $filei.expected || leave "tlv index: KO" 1
+## truncated tlv
+head -c 5 $filei.tlv > $filei.truncated.tlv
+./tlv2text -d -i $filei.truncated.tlv -o $filei.txt && leave "tlv iterator (truncated): KO" 1
+echo "tlv iterator: OK"
+# <--
+
+# --> checking tlv validation
+## valid message, then truncated tlv, unknown type and invalid UTF-8 text
+filev=${TMPDIR}/test_validate
+./text2tlv -s -x -L -p 0 -t '<speak>Un, `l2 deux<break time="1s"/>.</speak>' -o $filev.tlv || leave "tlv validation: KO" 1
+./tlv2text -v -i $filev.tlv -o $filev.txt || leave "tlv validation: KO" 1
+wc -c < $filev.tlv | tr -d ' ' | cmp - $filev.txt || leave "tlv validation: KO" 1
+head -c 5 $filev.tlv > $filev.truncated.tlv
+./tlv2text -v -i $filev.truncated.tlv -o $filev.txt && leave "tlv validation (truncated): KO" 1
+printf '\x01\x02Un\x04\x01a' > $filev.type.tlv
+./tlv2text -v -i $filev.type.tlv -o $filev.txt && leave "tlv validation (type): KO" 1
+echo 4 | cmp - $filev.txt || leave "tlv validation (type): KO" 1
+printf '\x01\x02\xc3\x28' > $filev.utf8.tlv
+./tlv2text -v -i $filev.utf8.tlv -o $filev.txt && leave "tlv validation (utf-8): KO" 1
+printf '\x20\x05\x01\xe8\x03\x00' > $filev.ssml.tlv
+./tlv2text -v -i $filev.ssml.tlv -o $filev.txt && leave "tlv validation (ssml): KO" 1
+printf '\x20\x06\x02\x04rate' > $filev.ssml.tlv
+./tlv2text -v -i $filev.ssml.tlv -o $filev.txt && leave "tlv validation (ssml): KO" 1
+printf '\x20\x0a\x06\x04name\x03m\xc3\x28' > $filev.ssml.tlv
+./tlv2text -v -i $filev.ssml.tlv -o $filev.txt && leave "tlv validation (ssml): KO" 1
+printf '\x20\x0a\x06\x04name\x03m\xc3\xa9' > $filev.ssml.tlv
+./tlv2text -v -i $filev.ssml.tlv -o $filev.txt || leave "tlv validation (ssml): KO" 1
+echo "tlv validation: OK"
+# <--
+
+# --> checking tlv chunking
+## split after a blank (-W), merge of the text tlv of the stream calls (-m)
+filek=${TMPDIR}/test_chunking
+./text2tlv -p 0 -t "$(printf 'abcd %.0s' $(seq 60))" -o $filek.tlv || leave "tlv chunking: KO" 1
+./tlv2text -d -i $filek.tlv -o $filek.txt
+printf "1 254\n1 46\n" | cmp - $filek.txt || leave "tlv chunking: KO" 1
+./text2tlv -p 0 -W 16 -t "$(printf 'abcd %.0s' $(seq 60))" -o $filek.tlv || leave "tlv chunking (word): KO" 1
+./tlv2text -d -i $filek.tlv -o $filek.txt
+printf "1 250\n1 50\n" | cmp - $filek.txt || leave "tlv chunking (word): KO" 1
+printf 'Un texte assez court, coupé en morceaux.' > $filek.in.txt
+./text2tlv -p 0 -S 4 -i $filek.in.txt -o $filek.tlv || leave "tlv chunking (merge): KO" 1
+./tlv2text -m 254 -d -i $filek.tlv -o $filek.txt || leave "tlv chunking (merge): KO" 1
+printf "1 41\n" | cmp - $filek.txt || leave "tlv chunking (merge): KO" 1
+./tlv2text -m 254 -i $filek.tlv -o $filek.txt
+cmp $filek.in.txt $filek.txt || leave "tlv chunking (merge): KO" 1
+echo "tlv chunking: OK"
+# <--
+
+# --> checking scratch attached to the handle
+## same tlv as with the scratch of the thread, single call and stream mode
+filez=${TMPDIR}/test_scratch
+printf '<speak>Un &lt;éléphant&gt; `Pf2()? (1) <break time="1s"/> fin.</speak>' > $filez.txt
+for opt in "" "-S 5"; do
+	./text2tlv -s -p 2 $opt -i $filez.txt -o $filez.expected || leave "scratch: KO" 1
+	./text2tlv -s -p 2 -z $opt -i $filez.txt -o $filez.tlv || leave "scratch: KO" 1
+	cmp $filez.expected $filez.tlv || leave "scratch ($opt): KO" 1
+done
+echo "scratch: OK"
+# <--
+
+# --> checking allocator
+## same tlv with the handles created with an allocator, all their memory is released
+filea=${TMPDIR}/test_allocator
+for i in $(seq 1000); do
+	printf '<speak>Un &lt;éléphant&gt; `Pf2()? (%d) <break time="1s"/> `Pf2!, fin.</speak>\n' $i
+done > $filea.txt
+for opt in "" "-S 5" "-l" "-B 2" "-P 2"; do
+	./text2tlv -s -p 2 $opt -i $filea.txt -o $filea.expected || leave "allocator: KO" 1
+	./text2tlv -s -p 2 -A $opt -i $filea.txt -o $filea.tlv || leave "allocator ($opt): KO" 1
+	cmp $filea.expected $filea.tlv || leave "allocator ($opt): KO" 1
+done
+## the handle of a batch is deleted first: the workers keep none of its memory (punctuation list)
+seq 100 | sed 's/.*/Un; deux, (&) fin./' > $filea.batch.txt
+./text2tlv -p 2 -B 2 -H '`Pf2; x' -i $filea.batch.txt -o $filea.expected || leave "allocator (batch): KO" 1
+./text2tlv -p 2 -A -B 2 -H '`Pf2; x' -i $filea.batch.txt -o $filea.tlv || leave "allocator (batch): KO" 1
+cmp $filea.expected $filea.tlv || leave "allocator (batch): KO" 1
+echo "allocator: OK"
+# <--
+
+# --> checking patterns split across stream calls
+## tags, annotations and entities cut by the chunks give the same text as a single call
+files=${TMPDIR}/test_stream_pattern
+printf '<speak>Un &lt;éléphant&gt; `Pf2()? (1) <break time="1s"/> &eacute;t&#233; fin.</speak>' > $files.txt
+./text2tlv -s -p 2 -i $files.txt -o $files.tlv || leave "stream pattern: KO" 1
+./tlv2text -i $files.tlv -o $files.expected
+for chunk in 1 2 3 5 7; do
+	./text2tlv -s -p 2 -S $chunk -i $files.txt -o $files.$chunk.tlv || leave "stream pattern ($chunk): KO" 1
+	./tlv2text -i $files.$chunk.tlv -o $files.$chunk.txt
+	cmp $files.expected $files.$chunk.txt || leave "stream pattern ($chunk): KO" 1
+done
+echo "stream pattern: OK"
+# <--
+
+# --> checking punctuation list
+## `Pf2 list longer than 50 characters, non ASCII characters
+filel=${TMPDIR}/test_punct_list
+list=$(printf '.%.0s' $(seq 55))"«!"
+./text2tlv -p 0 -t "\`Pf2$list a«b!c;d" -o $filel.tlv || leave "punctuation list: KO" 1
+printf "\x01\x01a\x05\x03«b\x05\x02!c\x01\x02;d" > $filel.expected
+cmp $filel.tlv $filel.expected || leave "punctuation list: KO" 1
+echo "punctuation list: OK"
+# <--
+
 testSentence
 
 # testCharset $file1_orig 1-1 ISO-8859-1:ISO-8859-1 $file1_orig
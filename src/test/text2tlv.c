@@ -7,6 +7,7 @@
 #include <string.h>
 #include <unistd.h>
 #include <errno.h>
+#include <stdatomic.h>
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -22,7 +23,7 @@ enum {
 
 void usage() {
   printf("\
-Usage: text2tlv [-p <punct_mode>] [-s] [-i inputfile | -t <text>] [-o outputfile] [-C]\n\
+Usage: text2tlv [-p <punct_mode>] [-s] [-i inputfile [-S chunk] | -t <text>] [-o outputfile] [-k block] [-l | -B threads | -P threads] [-C] [-2] [-x] [-L] [-W threshold] [-z] [-A] [-T tracefile] [-M statsfile]\n\
 Convert a text to a type-length-value byte buffer\n\
   -i inputfile          read text from file\n\
   -o outputfile         write tlv to this file\n\
@@ -30,8 +31,22 @@ Convert a text to a type-length-value byte buffer\n\
   -c charset0:charset1  optional charsets: set0 = text charset, set1 = tlv charset. By Default: UTF-8.\n\
                         possible choices: ISO-8859-1, GBK, UCS-2, SJIS or UTF-8.\n\
   -C                    optional enable TLV for capitalized words.\n\
+  -2                    optional generate TLV v2 (16 bits length).\n\
+  -x                    optional generate TLV for the SSML elements (break, prosody,...).\n\
+  -L                    optional generate TLV for the language switching (expected: 1=english, 2=french).\n\
+  -W threshold          optional split the text tlv after a blank; a text tlv with less than threshold free bytes is not continued.\n\
+  -z                    optional convert with a scratch buffer attached to the handle (instead of the thread one).\n\
+  -A                    optional create the handles with an allocator; check that their memory is released.\n\
   -p punct_mode         optional punctuation mode; value from 0 to 2 (see inote_punct_mode_t in inote.h)\n\
   -s ssml               optional activate ssml mode\n\
+  -S chunk              optional read the input file by chunks of this size (stream mode)\n\
+  -k block              optional write the tlv by blocks of this size (sink)\n\
+  -l                    optional convert each line of the input file separately\n\
+  -B threads            optional same as -l, the lines are converted in parallel (batch)\n\
+  -H text               optional with -B, text converted first by the handle of the batch, tlv dropped (e.g. a `Pf2 list).\n\
+  -P threads            optional convert the whole input file at once, in parallel\n\
+  -T tracefile          optional write the binary trace records to this file (as text)\n\
+  -M statsfile          optional write the counters of the handle to this file (as text)\n\
   -v version            optional backward compatibility with this older version.\n\
                         e.g. -v 104 for version 1.0.4\n\
 \n\
@@ -43,6 +58,258 @@ text2tlv -c ISO-8859-1:UTF-8 -i file.txt -o file.tlv\n\
 ");
 }
 
+static inote_error write_block(inote_slice_t *tlv_block, void *user_data) {
+  int output = *(int*)user_data;
+  if (write(output, tlv_block->buffer, tlv_block->length) != tlv_block->length)
+    return INOTE_IO_ERROR;
+  return INOTE_OK;
+}
+
+typedef struct {
+  int version_compat;
+  bool with_capital;
+  bool with_tlv_v2;
+  bool with_ssml_tlv;
+  bool with_language_tlv;
+  int split_threshold; // -1: default chunking policy
+  bool with_allocator;
+  const char *batch_prefix; // -H
+} settings_t;
+
+// blocks allocated by the handles (-A)
+static atomic_long allocated_blocks;
+
+static void *count_alloc(size_t size, void *user_data) {
+  void *ptr = malloc(size);
+  if (ptr) {
+    atomic_fetch_add(&allocated_blocks, 1);
+  }
+  return ptr;
+}
+
+static void count_free(void *ptr, void *user_data) {
+  atomic_fetch_sub(&allocated_blocks, 1);
+  free(ptr);
+}
+
+/* exit if more than expected blocks are still allocated */
+static void check_released(long expected) {
+  long blocks = atomic_load(&allocated_blocks);
+  if (blocks > expected) {
+    fprintf(stderr, "%ld blocks not released\n", blocks - expected);
+    exit(1);
+  }
+}
+
+static void *handle_create(const settings_t *settings) {
+  void *handle = settings->with_allocator ? inote_create_with_allocator(count_alloc, count_free, NULL) : inote_create();
+  if (settings->version_compat != -1) {
+    int major, minor, patch;
+    major = settings->version_compat/100;
+    minor = (settings->version_compat%100)/10;
+    patch = settings->version_compat%10;
+    inote_set_compatibility(handle, major, minor, patch);
+  }
+  if (settings->with_capital) {
+    inote_enable_capital(handle, settings->with_capital);
+  }
+  if (settings->with_tlv_v2) {
+    inote_enable_tlv_v2(handle, settings->with_tlv_v2);
+  }
+  if (settings->with_ssml_tlv) {
+    inote_enable_ssml_tlv(handle, settings->with_ssml_tlv);
+  }
+  if (settings->with_language_tlv) {
+    inote_enable_language_tlv(handle, settings->with_language_tlv);
+  }
+  if (settings->split_threshold != -1) {
+    inote_set_tlv_split(handle, settings->split_threshold, INOTE_SPLIT_WORD);
+  }
+  return handle;
+}
+
+/* read the whole file */
+static uint8_t *read_file(FILE *fdi, size_t *length) {
+  uint8_t *text = NULL;
+  size_t max = 0;
+  size_t len;
+
+  *length = 0;
+  do {
+    if (*length == max) {
+      max = max ? 2*max : TEXT_LENGTH_MAX;
+      text = realloc(text, max);
+      if (!text) {
+	perror(NULL);
+	exit(1);
+      }
+    }
+    len = fread(text + *length, 1, max - *length, fdi);
+    *length += len;
+  } while (len);
+  return text;
+}
+
+/*
+  convert each line of the file with its own copy of the state:
+  sequentially with a new instance per line, or by a batch of
+  nb_thread workers if nb_thread > 0
+*/
+static int convert_lines(FILE *fdi, int output, const inote_state_t *state, inote_charset_t charset0, inote_charset_t charset1, const settings_t *settings, size_t nb_thread) {
+  uint8_t *text = NULL;
+  size_t length = 0;
+  inote_job_t *job = NULL;
+  inote_state_t *job_state = NULL;
+  size_t nb_job = 0;
+  size_t i;
+  int ret = 0;
+
+  text = read_file(fdi, &length);
+
+  for (i=0; i<length; i++) {
+    if ((text[i] == '\n') || (i == length-1))
+      nb_job++;
+  }
+  job = calloc(nb_job ? nb_job : 1, sizeof(*job));
+  job_state = calloc(nb_job ? nb_job : 1, sizeof(*job_state));
+  if (!job || !job_state) {
+    perror(NULL);
+    exit(1);
+  }
+
+  nb_job = 0;
+  for (i=0; i<length; i++) {
+    if ((text[i] == '\n') || (i == length-1)) {
+      inote_job_t *j = job + nb_job;
+      size_t tlv_length;
+      j->text.buffer = (nb_job ? job[nb_job-1].text.end_of_buffer : text);
+      j->text.length = text + i + 1 - j->text.buffer;
+      j->text.charset = charset0;
+      j->text.end_of_buffer = text + i + 1;
+      job_state[nb_job] = *state;
+      j->state = job_state + nb_job;
+      tlv_length = (j->text.length/TEXT_LENGTH_MAX + 1)*TLV_MESSAGE_LENGTH_MAX;
+      j->tlv_message.buffer = malloc(tlv_length);
+      if (!j->tlv_message.buffer) {
+	perror(NULL);
+	exit(1);
+      }
+      j->tlv_message.end_of_buffer = j->tlv_message.buffer + tlv_length;
+      j->tlv_message.charset = charset1;
+      nb_job++;
+    }
+  }
+
+  if (nb_thread) {
+    long blocks = atomic_load(&allocated_blocks);
+    void *handle = handle_create(settings);
+    void *batch = inote_batch_create(nb_thread);
+    if (!batch) {
+      fprintf(stderr, "inote_batch_create failed\n");
+      exit(1);
+    }
+    if (settings->batch_prefix) {
+      // settings of the handle copied by the workers (e.g. punctuation list)
+      uint8_t buffer[TLV_MESSAGE_LENGTH_MAX];
+      inote_slice_t prefix = {(uint8_t*)settings->batch_prefix, strlen(settings->batch_prefix), charset0, (uint8_t*)settings->batch_prefix + strlen(settings->batch_prefix)};
+      inote_slice_t tlv = {buffer, 0, charset1, buffer + sizeof(buffer)};
+      inote_state_t prefix_state = *state;
+      size_t left;
+      inote_convert_text_to_tlv(handle, &prefix, &prefix_state, &tlv, &left);
+    }
+    ret = inote_batch_convert(batch, handle, job, nb_job);
+    // the handle may be deleted before the batch: the workers keep
+    // none of its memory
+    inote_delete(handle);
+    check_released(blocks);
+    inote_batch_delete(batch);
+  } else {
+    for (i=0; i<nb_job; i++) {
+      void *handle = handle_create(settings);
+      job[i].ret = inote_convert_text_to_tlv(handle, &job[i].text, job[i].state, &job[i].tlv_message, &job[i].text_left);
+      inote_delete(handle);
+    }
+  }
+
+  for (i=0; i<nb_job; i++) {
+    if (!ret && job[i].ret) {
+      ret = job[i].ret;
+    }
+    write(output, job[i].tlv_message.buffer, job[i].tlv_message.length);
+    free(job[i].tlv_message.buffer);
+  }
+  free(job_state);
+  free(job);
+  free(text);
+  return ret;
+}
+
+/* convert the whole file by a batch of nb_thread workers */
+static int convert_file(FILE *fdi, int output, void *handle, inote_state_t *state, inote_charset_t charset0, inote_charset_t charset1, size_t nb_thread) {
+  inote_slice_t text;
+  inote_slice_t tlv_message;
+  size_t text_left = 0;
+  size_t tlv_length;
+  void *batch;
+  int ret;
+
+  text.buffer = read_file(fdi, &text.length);
+  text.charset = charset0;
+  text.end_of_buffer = text.buffer + text.length;
+  tlv_length = (text.length/TEXT_LENGTH_MAX + 1)*TLV_MESSAGE_LENGTH_MAX;
+  tlv_message.buffer = malloc(tlv_length);
+  if (!tlv_message.buffer) {
+    perror(NULL);
+    exit(1);
+  }
+  tlv_message.length = 0;
+  tlv_message.charset = charset1;
+  tlv_message.end_of_buffer = tlv_message.buffer + tlv_length;
+
+  batch = inote_batch_create(nb_thread);
+  if (!batch) {
+    fprintf(stderr, "inote_batch_create failed\n");
+    exit(1);
+  }
+  ret = inote_convert_text_to_tlv_parallel(batch, handle, &text, state, &tlv_message, &text_left);
+  inote_batch_delete(batch);
+
+  write(output, tlv_message.buffer, tlv_message.length);
+  free(tlv_message.buffer);
+  free(text.buffer);
+  return ret;
+}
+
+static void write_trace_record(const inote_trace_record_t *record, void *user_data) {
+  static const char *event[] = {"convert_start", "convert_end", "window", "sink", "join"};
+  fprintf((FILE*)user_data, "%llu %u %s %llu %llu\n",
+	  (unsigned long long)record->time, record->thread,
+	  (record->event < sizeof(event)/sizeof(*event)) ? event[record->event] : "?",
+	  (unsigned long long)record->arg0, (unsigned long long)record->arg1);
+}
+
+static void write_stats(FILE *fd, const void *handle) {
+  inote_stats_t stats;
+  if (inote_get_stats(handle, &stats))
+    return;
+  fprintf(fd, "bytes_in %llu\n", (unsigned long long)stats.bytes_in);
+  fprintf(fd, "units_decoded %llu\n", (unsigned long long)stats.units_decoded);
+  fprintf(fd, "tlv_text %llu\n", (unsigned long long)stats.tlv_text);
+  fprintf(fd, "tlv_punctuation %llu\n", (unsigned long long)stats.tlv_punctuation);
+  fprintf(fd, "tlv_annotation %llu\n", (unsigned long long)stats.tlv_annotation);
+  fprintf(fd, "tlv_capital %llu\n", (unsigned long long)stats.tlv_capital);
+  fprintf(fd, "tlv_capitals %llu\n", (unsigned long long)stats.tlv_capitals);
+  fprintf(fd, "tlv_ssml %llu\n", (unsigned long long)stats.tlv_ssml);
+  fprintf(fd, "tlv_language %llu\n", (unsigned long long)stats.tlv_language);
+  fprintf(fd, "iconv_calls %llu\n", (unsigned long long)stats.iconv_calls);
+  fprintf(fd, "fallbacks %llu\n", (unsigned long long)stats.fallbacks);
+  fprintf(fd, "tlv_message_full %llu\n", (unsigned long long)stats.tlv_message_full);
+  fprintf(fd, "language_switching %llu\n", (unsigned long long)stats.language_switching);
+  fprintf(fd, "decode_ns %llu\n", (unsigned long long)stats.decode_ns);
+  fprintf(fd, "scan_ns %llu\n", (unsigned long long)stats.scan_ns);
+  fprintf(fd, "encode_ns %llu\n", (unsigned long long)stats.encode_ns);
+}
+
 static inote_charset_t getCharset(const char* s) {
   inote_charset_t ret = INOTE_CHARSET_UNDEFINED;
 
@@ -80,7 +347,22 @@ int main(int argc, char **argv)
   inote_charset_t charset1 = INOTE_CHARSET_UTF_8;
   int version_compat = -1;
   bool with_capital = false;
+  bool with_tlv_v2 = false;
+  bool with_ssml_tlv = false;
+  bool with_language_tlv = false;
+  int split_threshold = -1;
+  bool with_scratch = false;
+  bool with_allocator = false;
+  const char *batch_prefix = NULL;
+  void *scratch = NULL;
   bool with_ssml = false;
+  size_t chunk = 0;
+  size_t block = 0;
+  bool with_lines = false;
+  size_t nb_thread = 0;
+  size_t nb_parallel = 0;
+  FILE *trace = NULL;
+  FILE *stats = NULL;
   
   memset(&text, 0, sizeof(text));
   memset(&tlv_message, 0, sizeof(tlv_message));
@@ -89,8 +371,25 @@ int main(int argc, char **argv)
   text.buffer = text_buffer;
   *text.buffer = 0;
   
-  while ((opt = getopt(argc, argv, "c:Ci:o:p:st:v:")) != -1) {
+  while ((opt = getopt(argc, argv, "2AB:c:CH:i:k:lLM:o:p:P:sS:t:T:v:W:xz")) != -1) {
     switch (opt) {
+    case '2':
+      with_tlv_v2 = true;
+      break;
+    case 'A':
+      with_allocator = true;
+      break;
+    case 'H':
+      batch_prefix = optarg;
+      break;
+    case 'B':
+      nb_thread = atoi(optarg);
+      with_lines = true;
+      if (!nb_thread) {
+	usage();
+	exit(1);
+      }
+      break;
     case 'c': {
       char *x = strchr(optarg, ':');
       if (!x) {
@@ -114,6 +413,19 @@ int main(int argc, char **argv)
 	exit(1);
       }
       break;
+    case 'k':
+      block = atoi(optarg);
+      if (block < TLV_BLOCK_LENGTH_MIN) { // TLV2_BLOCK_LENGTH_MIN for TLV v2
+	usage();
+	exit(1);
+      }
+      break;
+    case 'l':
+      with_lines = true;
+      break;
+    case 'L':
+      with_language_tlv = true;
+      break;
     case 'o':
       output = creat(optarg, S_IRWXU);
       if (output==-1) {
@@ -124,17 +436,55 @@ int main(int argc, char **argv)
     case 'p':
       punct_mode = atoi(optarg);
       break;
+    case 'P':
+      nb_parallel = atoi(optarg);
+      if (!nb_parallel) {
+	usage();
+	exit(1);
+      }
+      break;
     case 's':
       with_ssml = true;
       break;
+    case 'S':
+      chunk = atoi(optarg);
+      if (!chunk) {
+	usage();
+	exit(1);
+      }
+      break;
     case 't':
       strncpy(text.buffer, optarg, TEXT_LENGTH_MAX);
       text.length = strlen(text.buffer);
       text.end_of_buffer = text.buffer + TEXT_LENGTH_MAX;	  
       break;
+    case 'T':
+      trace = fopen(optarg, "w");
+      if (!trace) {
+	perror(NULL);
+	exit(1);
+      }
+      inote_trace_enable(true);
+      break;
+    case 'M':
+      stats = fopen(optarg, "w");
+      if (!stats) {
+	perror(NULL);
+	exit(1);
+      }
+      break;
     case 'v':
       version_compat = atoi(optarg);
       break;
+    case 'W':
+      split_threshold = atoi(optarg);
+      break;
+    case 'x':
+      with_ssml_tlv = true;
+      break;
+    case 'z':
+      with_scratch = true;
+      break;
     default:
       usage();
       exit(1);
@@ -163,18 +513,45 @@ int main(int argc, char **argv)
   tlv_message.end_of_buffer = tlv_message.buffer + TLV_MESSAGE_LENGTH_MAX;
   tlv_message.charset = charset1;
 
-  void *handle = inote_create();
-  if (version_compat != -1) {
-    int major, minor, patch;
-    major = version_compat/100;
-    minor = (version_compat%100)/10;
-    patch = version_compat%10;
-    inote_set_compatibility(handle, major, minor, patch);
+  {
+    inote_charset_t charset[] = {charset0, charset1};
+    ret = inote_prewarm(charset, sizeof(charset)/sizeof(*charset));
+    if (ret) {
+      fprintf(stderr, "%s\n", inote_error_get_string(ret));
+      exit(1);
+    }
   }
-  if (with_capital) {
-    inote_enable_capital(handle, with_capital);
+
+  settings_t settings = {version_compat, with_capital, with_tlv_v2, with_ssml_tlv, with_language_tlv, split_threshold, with_allocator, batch_prefix};
+  void *handle = handle_create(&settings);
+  if (with_scratch) {
+    scratch = inote_scratch_create();
+    if (!scratch) {
+      perror(NULL);
+      exit(1);
+    }
+    inote_set_scratch(handle, scratch);
   }
-  if (!fdi) {
+  if (stats) {
+    inote_enable_stats_timing(handle, true);
+  }
+  if (block) {
+    inote_sink_t sink = {write_block, &output};
+    tlv_message.buffer = malloc(block);
+    if (!tlv_message.buffer) {
+      perror(NULL);
+      exit(1);
+    }
+    tlv_message.end_of_buffer = tlv_message.buffer + block;
+    inote_set_sink(handle, &sink);
+  }
+  if (nb_parallel && fdi) {
+    ret = convert_file(fdi, output, handle, &state, charset0, charset1, nb_parallel);
+    fclose(fdi);
+  } else if (with_lines && fdi) {
+    ret = convert_lines(fdi, output, &state, charset0, charset1, &settings, nb_thread);
+    fclose(fdi);
+  } else if (!fdi) {
     ret = inote_convert_text_to_tlv(handle, &text, &state, &tlv_message, &text_left);
     switch (ret) {
     case INOTE_INCOMPLETE_MULTIBYTE:
@@ -204,6 +581,71 @@ int main(int argc, char **argv)
     default:
       break;
     }
+  } else if (chunk) {
+    // no limit on the chunk size: allocate the text and tlv buffers
+    uint8_t *chunk_buffer = malloc(chunk);
+    if (!block && (chunk > TEXT_LENGTH_MAX)) {
+      tlv_message.buffer = malloc(3*chunk);
+      tlv_message.end_of_buffer = tlv_message.buffer + 3*chunk;
+    }
+    if (!chunk_buffer || !tlv_message.buffer) {
+      perror(NULL);
+      exit(1);
+    }
+    inote_stream_start(handle);
+    while(true) {
+      size_t len = fread(chunk_buffer, 1, chunk, fdi);
+      if (!len)
+	break;
+      text.buffer = chunk_buffer;
+      text.length = len;
+      text.charset = charset0;
+      text.end_of_buffer = text.buffer + len;	  
+      ret = inote_stream_feed(handle, &text, &state, &tlv_message, &text_left);
+      if (ret == INOTE_LANGUAGE_SWITCHING) {
+	char *s = text.buffer + text.length - text_left;
+	// beginning of the annotation in the previous chunks
+	uint8_t head[1024];
+	inote_slice_t annotation = {head, 0, charset0, head + sizeof(head)};
+	uint8_t *space;
+	bool found = false;
+	int i = 0;
+	inote_stream_take_annotation(handle, &annotation);
+	space = memchr(head, ' ', annotation.length);
+	if (space) {
+	  // the annotation ends in the previous chunks
+	  printf("annotation: %.*s\n", (int)(space - head), head);
+	  found = true;
+	} else {
+	  for (i=0; i<text_left; i++) {
+	    if (s[i] == ' ')
+	      break;
+	  }
+	  if (i < text_left) {
+	    s[i] = 0;
+	    printf("annotation: %.*s%s\n", (int)annotation.length, head, s);
+	    i++;
+	    found = true;
+	  }
+	}
+	if (found) {
+	  text.buffer = s + i;
+	  text.length = text_left - i;
+	  ret = inote_stream_feed(handle, &text, &state, &tlv_message, &text_left);
+	}
+      }
+      if (ret)
+	break;
+      write(output, tlv_message.buffer, tlv_message.length);
+      tlv_message.length = 0;
+    }
+    fclose(fdi);
+    free(chunk_buffer);
+    if (!ret) {
+      ret = inote_stream_flush(handle, &state, &tlv_message);
+      write(output, tlv_message.buffer, tlv_message.length);
+      tlv_message.length = 0;
+    }
   } else {
     bool loop = true;
     while(loop) {
@@ -275,10 +717,21 @@ int main(int argc, char **argv)
   if (ret) {
     printf("%s: error = %d\n", __func__, ret);
   }
+  if (stats) {
+    write_stats(stats, handle);
+    fclose(stats);
+  }
   inote_delete(handle);
+  inote_scratch_delete(scratch);
   write(output, tlv_message.buffer, tlv_message.length);
   tlv_message.length = 0;
 
+  if (trace) {
+    inote_trace_read(write_trace_record, trace);
+    fclose(trace);
+  }
+  check_released(0);
+
   return ret;
 }
 /* local variables: */
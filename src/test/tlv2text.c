@@ -25,10 +25,14 @@ static char *prefix_capitals;
 
 void usage() {
   printf("\
-Usage: tlv2text -i inputfile -o outputfile\n\
+Usage: tlv2text -i inputfile -o outputfile [-c capital] [-m length] [-d | -n | -v]\n\
 Convert a type-length-value formatted file to text\n\
   -i inputfile    read tlv from file\n\
   -o outputfile   write text to this file\n\
+  -d              optional write the type and length of each tlv instead of the text\n\
+  -n              optional write the number of tlv of each type instead of the text\n\
+  -m length       optional merge the adjacent text tlv up to this length first\n\
+  -v              optional validate the tlv (UTF-8 text) and write the offset of the first invalid tlv\n\
   -c capital      optional word to insert when a capital is detected.\n\
                   spaces will be added around his word.\n\
                   #n will be appended in case of several capitals.\n\
@@ -45,7 +49,7 @@ inote_error add_text(inote_tlv_t *tlv, void *user_data) {
   inote_error ret = INOTE_OK;
 
   if (t && fdo) {
-    if (1 != fwrite(t, tlv->length, 1, fdo)) {
+    if (1 != fwrite(t, inote_tlv_get_length(tlv), 1, fdo)) {
       printf("%s: write error\n", __func__);
       ret = INOTE_IO_ERROR;
     }
@@ -69,6 +73,58 @@ inote_error add_capital(inote_tlv_t *tlv, bool capitals, void *user_data) {
   return add_text(tlv, user_data);
 }
 
+/* type and length of each tlv (iterator) */
+static inote_error dump_tlv(inote_slice_t *tlv_message, FILE *fdo) {
+  inote_tlv_iterator_t it;
+  inote_error ret = inote_tlv_iterator_begin(&it, tlv_message);
+
+  if (ret)
+    return ret;
+  while (inote_tlv_iterator_next(&it)) {
+    fprintf(fdo, "%d %lu\n", it.type, (unsigned long)it.length);
+  }
+  return it.error;
+}
+
+/* number of tlv by type (index) */
+static inote_error count_tlv(inote_slice_t *tlv_message, FILE *fdo) {
+  inote_tlv_index_t index;
+  unsigned long count[UINT8_MAX+1] = {0};
+  inote_error ret;
+  size_t i;
+
+  memset(&index, 0, sizeof(index));
+  ret = inote_tlv_index(tlv_message, &index);
+  if (ret || !index.nb)
+    return ret;
+  index.capacity = index.nb;
+  index.type = malloc(index.capacity);
+  if (!index.type)
+    return INOTE_ERRNO + ENOMEM;
+  ret = inote_tlv_index(tlv_message, &index);
+  for (i=0; !ret && (i<index.nb); i++) {
+    count[index.type[i]]++;
+  }
+  for (i=0; !ret && (i<=UINT8_MAX); i++) {
+    if (count[i])
+      fprintf(fdo, "%lu %lu\n", (unsigned long)i, count[i]);
+  }
+  free(index.type);
+  return ret;
+}
+
+/* validation of the message (UTF-8 text) */
+static inote_error validate_tlv(inote_slice_t *tlv_message, FILE *fdo) {
+  size_t offset = 0;
+  inote_error ret;
+
+  tlv_message->charset = INOTE_CHARSET_UTF_8;
+  ret = inote_tlv_validate(tlv_message, true, &offset);
+  tlv_message->charset = INOTE_CHARSET_UNDEFINED;
+  fprintf(fdo, "%lu\n", (unsigned long)offset);
+  return ret;
+}
+
 int main(int argc, char **argv)
 {
   int opt; 
@@ -79,11 +135,13 @@ int main(int argc, char **argv)
   struct stat statbuf;
   inote_cb_t cb;
   void *data = NULL;
+  int mode = 0;
+  int length_max = -1;
 
   prefix_capital = strdup("");
   prefix_capitals = strdup("");
   
-  while ((opt = getopt(argc, argv, "i:o:c:")) != -1) {
+  while ((opt = getopt(argc, argv, "i:o:c:dm:nv")) != -1) {
     switch (opt) {
     case 'i':
       if (fdi)
@@ -120,6 +178,14 @@ int main(int argc, char **argv)
 	}
       }
       break;
+    case 'm':
+      length_max = atoi(optarg);
+      break;
+    case 'd':
+    case 'n':
+    case 'v':
+      mode = opt;
+      break;
     default:
       usage();
       exit(1);
@@ -142,14 +208,31 @@ int main(int argc, char **argv)
     exit(1);
   }
   
-  cb.add_annotation = add_text;
-  cb.add_charset = add_text;
-  cb.add_punctuation = add_text;
-  cb.add_text = add_text;  
-  cb.add_capital = add_capital;  
-  cb.user_data = (void *)fdo;  
-
-  inote_convert_tlv_to_text(&tlv_message, &cb);
+  if (length_max != -1) {
+    ret = inote_tlv_coalesce(&tlv_message, length_max);
+    if (ret) {
+      printf("%s: coalesce error = %d\n", __func__, ret);
+      exit(1);
+    }
+  }
+
+  // positional initializer: layout of the callbacks unchanged since 1.0
+  cb = (inote_cb_t){add_text, add_text, add_text, add_text, add_capital, (void *)fdo};
+
+  switch (mode) {
+  case 'd':
+    ret = dump_tlv(&tlv_message, fdo);
+    break;
+  case 'n':
+    ret = count_tlv(&tlv_message, fdo);
+    break;
+  case 'v':
+    ret = validate_tlv(&tlv_message, fdo);
+    break;
+  default:
+    inote_convert_tlv_to_text(&tlv_message, &cb);
+    break;
+  }
 
   fclose(fdi);
   fclose(fdo);